@@ -97,3 +97,24 @@ ApplicationContainer CCNxConsumerHelper::Install (NodeContainer c)
     }
   return apps;
 }
+
+Ptr<CCNxLatencyHistogram>
+CCNxConsumerHelper::MergeLatencyHistograms (NodeContainer c)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  Ptr<CCNxLatencyHistogram> merged = Create<CCNxLatencyHistogram> ();
+
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<Node> node = *i;
+      for (uint32_t j = 0; j < node->GetNApplications (); ++j)
+        {
+          Ptr<CCNxConsumer> consumer = DynamicCast<CCNxConsumer> (node->GetApplication (j));
+          if (consumer)
+            {
+              merged->Merge (*consumer->GetLatencyHistogram ());
+            }
+        }
+    }
+  return merged;
+}
@@ -106,6 +106,16 @@ public:
    */
   ApplicationContainer Install (NodeContainer c);
 
+  /**
+   * Merge the latency histograms of every CCNxConsumer installed on the nodes, e.g. to
+   * report network-wide percentiles after Simulator::Run ().
+   *
+   * @param[in] NodeContainer The nodes whose consumers to include.
+   *
+   * @return A new histogram holding the samples of all those consumers.
+   */
+  static Ptr<CCNxLatencyHistogram> MergeLatencyHistograms (NodeContainer c);
+
 private:
   Ptr<Application> InstallPriv (Ptr<Node> node) const;
   ObjectFactory m_consumerFactory;       //!< Object factory.
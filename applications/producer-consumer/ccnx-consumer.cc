@@ -55,8 +55,13 @@
 
 #include <iostream>
 #include <iomanip>
+#include <algorithm>
 #include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
 #include "ns3/ccnx-consumer.h"
+#include "ns3/ccnx-uniform-popularity.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -64,6 +69,15 @@ NS_LOG_COMPONENT_DEFINE ("CCNxConsumer");
 NS_OBJECT_ENSURE_REGISTERED (CCNxConsumer);
 
 static bool printConsStatsHeader = 1;
+
+static ObjectFactory
+GetDefaultPopularityModelFactory ()
+{
+  static ObjectFactory factory;
+  factory.SetTypeId (CCNxUniformPopularity::GetTypeId ());
+  return factory;
+}
+
 TypeId
 CCNxConsumer::GetTypeId (void)
 {
@@ -75,11 +89,62 @@ CCNxConsumer::GetTypeId (void)
                    "delay between successive Interests",
                    TimeValue (MilliSeconds (0)),
                    MakeTimeAccessor (&CCNxConsumer::m_requestInterval),
-                   MakeTimeChecker ());
+                   MakeTimeChecker ())
+    .AddAttribute ("PopularityModel",
+                   "The ObjectFactory to create the CCNxPopularityModel that picks each requested name (not used in window mode)",
+                   ObjectFactoryValue (GetDefaultPopularityModelFactory ()),
+                   MakeObjectFactoryAccessor (&CCNxConsumer::m_popularityModelFactory),
+                   MakeObjectFactoryChecker ())
+    .AddAttribute ("WindowMode",
+                   "Request sequential chunks through an AIMD congestion window instead of one random name per RequestInterval",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&CCNxConsumer::m_windowMode),
+                   MakeBooleanChecker ())
+    .AddAttribute ("InitialWindow",
+                   "Congestion window, in Interests, at start (window mode)",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&CCNxConsumer::m_initialWindow),
+                   MakeDoubleChecker<double> (1.0))
+    .AddAttribute ("MaxWindow",
+                   "Upper bound on the congestion window, in Interests (window mode)",
+                   DoubleValue (1024.0),
+                   MakeDoubleAccessor (&CCNxConsumer::m_maxWindow),
+                   MakeDoubleChecker<double> (1.0))
+    .AddAttribute ("AdditiveIncrease",
+                   "Window growth per window of Content Objects received (window mode)",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&CCNxConsumer::m_additiveIncrease),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("DecreaseFactor",
+                   "Window multiplier on a timeout or InterestReturn (window mode)",
+                   DoubleValue (0.5),
+                   MakeDoubleAccessor (&CCNxConsumer::m_decreaseFactor),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("InitialRto",
+                   "Retransmission timeout before the first RTT sample",
+                   TimeValue (Seconds (1)),
+                   MakeTimeAccessor (&CCNxConsumer::m_initialRto),
+                   MakeTimeChecker ())
+    .AddAttribute ("MinRto",
+                   "Lower bound on the retransmission timeout",
+                   TimeValue (MilliSeconds (200)),
+                   MakeTimeAccessor (&CCNxConsumer::m_minRto),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxRto",
+                   "Upper bound on the retransmission timeout, including backoff",
+                   TimeValue (Seconds (60)),
+                   MakeTimeAccessor (&CCNxConsumer::m_maxRto),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxRetries",
+                   "Retransmissions of an Interest before it is abandoned",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&CCNxConsumer::m_maxRetries),
+                   MakeUintegerChecker<uint32_t> ());
   return tid;
 }
 
 CCNxConsumer::CCNxConsumer ()
+  : m_popularityModelFactory (GetDefaultPopularityModelFactory ())
 {
   NS_LOG_FUNCTION_NOARGS ();
   m_consumerPortal = Ptr<CCNxPortal> (0);
@@ -87,9 +152,29 @@ CCNxConsumer::CCNxConsumer ()
   m_goodContentReceived = 0;
   m_interestProcessFails = 0;
   m_contentProcessFails = 0;
+  m_interestReturnsReceived = 0;
+  m_interestTimeouts = 0;
+  m_retransmissions = 0;
+  m_bytesReceived = 0;
+  m_firstSendTime = Seconds (-1);
+  m_lastReceiveTime = Seconds (0);
+  m_windowMode = false;
+  m_initialWindow = 1.0;
+  m_maxWindow = 1024.0;
+  m_additiveIncrease = 1.0;
+  m_decreaseFactor = 0.5;
+  m_cwnd = 1.0;
+  m_recoverySequence = 0;
+  m_initialRto = Seconds (1);
+  m_minRto = MilliSeconds (200);
+  m_maxRto = Seconds (60);
+  m_maxRetries = 3;
+  m_srtt = Seconds (-1);
+  m_rttvar = Seconds (0);
+  m_rto = m_initialRto;
+  m_nextSequence = 0;
   m_count = 0;
-  m_sum = 0;
-  m_sumSquare = 0;
+  m_latencyHistogram = Create<CCNxLatencyHistogram> ();
 }
 
 CCNxConsumer::~CCNxConsumer ()
@@ -107,8 +192,28 @@ CCNxConsumer::StartApplication (void)
   m_consumerPortal->SetRecvCallback (
     MakeCallback (&CCNxConsumer::ReceiveCallback, this));
 
+  m_srtt = Seconds (-1);
+  m_rttvar = Seconds (0);
+  m_rto = m_initialRto;
+  m_nextSequence = 0;
+  m_timeoutTimer = Timer (Timer::REMOVE_ON_DESTROY);
+  m_timeoutTimer.SetFunction (&CCNxConsumer::CheckTimeouts, this);
+
   m_requestIntervalTimer = Timer (Timer::REMOVE_ON_DESTROY);
-  m_requestIntervalTimer.SetFunction (&CCNxConsumer::GenerateTraffic, this);
+  if (m_windowMode)
+    {
+      NS_ASSERT_MSG (m_globalContentRepositoryPrefix->GetContentObjectCount () > 0, "Window mode needs a non-empty repository");
+      m_cwnd = std::min (m_initialWindow, m_maxWindow);
+      m_recoverySequence = 0;
+
+      // The first window goes out after RequestInterval, after that it is clocked by the responses
+      m_requestIntervalTimer.SetFunction (&CCNxConsumer::FillWindow, this);
+    }
+  else
+    {
+      m_popularityModel = m_popularityModelFactory.Create<CCNxPopularityModel> ();
+      m_requestIntervalTimer.SetFunction (&CCNxConsumer::GenerateTraffic, this);
+    }
   m_requestIntervalTimer.SetDelay (m_requestInterval);
   m_requestIntervalTimer.Schedule ();
 }
@@ -121,6 +226,11 @@ CCNxConsumer::StopApplication (void)
     {
       m_requestIntervalTimer.Cancel ();
     }
+  if (m_timeoutTimer.IsRunning ())
+    {
+      m_timeoutTimer.Cancel ();
+    }
+  m_timeoutQueue.clear ();
   m_consumerPortal->Close ();
   if (m_outstandingRequests.size ())
     {
@@ -143,6 +253,30 @@ CCNxConsumer::SetContentRepository (
   m_globalContentRepositoryPrefix = repositoryPtr;
 }
 
+Ptr<const CCNxLatencyHistogram>
+CCNxConsumer::GetLatencyHistogram (void) const
+{
+  return m_latencyHistogram;
+}
+
+Time
+CCNxConsumer::GetRto (void) const
+{
+  return m_rto;
+}
+
+uint64_t
+CCNxConsumer::GetRequestCount (void) const
+{
+  return m_count;
+}
+
+uint32_t
+CCNxConsumer::GetErrorCount (void) const
+{
+  return m_contentProcessFails + m_interestProcessFails;
+}
+
 void
 CCNxConsumer::InsertOutStandingInterest (Ptr<const CCNxName> interest)
 {
@@ -150,7 +284,7 @@ CCNxConsumer::InsertOutStandingInterest (Ptr<const CCNxName> interest)
 #if 0
   m_outstandingRequests.insert (interest);
 #else
-  m_outstandingRequests[interest].txTime = (uint64_t) Simulator::Now ().GetMilliSeconds ();
+  m_outstandingRequests[interest].txTime = Simulator::Now ();
 #endif
 }
 
@@ -161,9 +295,7 @@ CCNxConsumer::RemoveOutStandingInterest (Ptr<const CCNxName> interest)
 #if 0
   m_outstandingRequests.erase (interest);
 #else
-  uint64_t packet_latency = (uint64_t) Simulator::Now ().GetMilliSeconds () - m_outstandingRequests[interest].txTime ;
-  m_sum += packet_latency;
-  m_sumSquare += packet_latency * packet_latency;
+  m_latencyHistogram->Record (Simulator::Now () - m_outstandingRequests[interest].txTime);
   m_outstandingRequests.erase (interest);
 #endif
 }
@@ -182,6 +314,28 @@ CCNxConsumer::ReceiveCallback (Ptr<CCNxPortal> portal)
   Ptr<CCNxPacket> packet;
   while ((packet = portal->Recv ()))
     {
+      if (packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_InterestReturn)
+        {
+          // The network could not satisfy the interest, so stop waiting for it
+          m_interestReturnsReceived++;
+          Ptr<const CCNxName> name = packet->GetMessage ()->GetName ();
+          NS_LOG_INFO (
+            "CCNxConsumer:Received InterestReturn code " << (uint32_t) packet->GetFixedHeader ()->GetReturnCode () <<
+            " for Node " << GetNode ()->GetId () << *name);
+          OutstandingRequestType::iterator it = m_outstandingRequests.find (name);
+          if (it != m_outstandingRequests.end ())
+            {
+              uint32_t sequence = it->second.sequence;
+              m_outstandingRequests.erase (it);
+              if (m_windowMode)
+                {
+                  WindowDecrease (sequence);
+                  FillWindow ();
+                }
+            }
+          continue;
+        }
+
       NS_LOG_DEBUG (
         "CCNxConsumer:Received content response " << *packet << " packet dump");
       m_goodContentReceived++;
@@ -189,11 +343,30 @@ CCNxConsumer::ReceiveCallback (Ptr<CCNxPortal> portal)
           == CCNxMessage::ContentObject)
         {
           Ptr<const CCNxName> name = packet->GetMessage ()->GetName ();
-          if (FindOutStandingInterest (name))
+          OutstandingRequestType::iterator it = m_outstandingRequests.find (name);
+          if (it != m_outstandingRequests.end ())
             {
               NS_LOG_INFO (
                 "CCNxConsumer:Received content back for Node " << GetNode ()->GetId () << *name);
+
+              // Karn: a retransmitted Interest's response is ambiguous, so it gives no RTT sample
+              if (it->second.retries == 0)
+                {
+                  UpdateRto (Simulator::Now () - it->second.lastTxTime);
+                }
               RemoveOutStandingInterest (name);
+
+              // Repository objects carry a virtual payload of the repository size; count an object
+              // without a payload (e.g. from another kind of producer) at that nominal size
+              uint64_t bytes = packet->GetMessage ()->GetPayloadSize ();
+              m_bytesReceived += bytes ? bytes : m_globalContentRepositoryPrefix->GetContentObjectSize ();
+              m_lastReceiveTime = Simulator::Now ();
+
+              if (m_windowMode)
+                {
+                  WindowIncrease ();
+                  FillWindow ();
+                }
             }
           else
             {
@@ -214,26 +387,201 @@ void
 CCNxConsumer::GenerateTraffic ()
 {
   NS_LOG_FUNCTION_NOARGS ();
-  Ptr<const CCNxName> name = m_globalContentRepositoryPrefix->GetRandomName ();
-  m_count++;
+  Ptr<const CCNxName> name = m_popularityModel->GetNextName (m_globalContentRepositoryPrefix);
   if (name)
     {
-      Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
-      Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
-      m_consumerPortal->Send (packet);
-      InsertOutStandingInterest (name);
+      m_count++;
+      SendInterest (name);
       m_requestIntervalTimer.Schedule (m_requestInterval);
-      NS_LOG_DEBUG (
-        "CCNxConsumer:Sending interest request" << *packet << " packet dump");
-      m_goodInterestsSent++;
     }
   else
     {
-      NS_LOG_ERROR ("Bad Interest Generated");
-      m_interestProcessFails++;
+      // The model has no more requests (e.g. a trace that does not loop), so the consumer is done
+      NS_LOG_INFO ("Popularity model finished after " << m_count << " requests");
+    }
+}
+
+void
+CCNxConsumer::SendInterest (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+  InsertOutStandingInterest (name);
+  OutstandingRequestEntryType &entry = m_outstandingRequests[name];
+  entry.interestName = name;
+  entry.sequence = m_nextSequence++;
+  entry.retries = 0;
+  TransmitInterest (entry);
+
+  if (m_firstSendTime.IsStrictlyNegative ())
+    {
+      m_firstSendTime = Simulator::Now ();
+    }
+  m_goodInterestsSent++;
+}
+
+void
+CCNxConsumer::TransmitInterest (OutstandingRequestEntryType &entry)
+{
+  NS_LOG_FUNCTION (this << entry.interestName << entry.sequence << entry.retries);
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (entry.interestName);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+  m_consumerPortal->Send (packet);
+  NS_LOG_DEBUG (
+    "CCNxConsumer:Sending interest request" << *packet << " packet dump");
+
+  entry.lastTxTime = Simulator::Now ();
+  TimeoutEntryType timeout;
+  timeout.name = entry.interestName;
+  timeout.sequence = entry.sequence;
+  timeout.retries = entry.retries;
+  m_timeoutQueue.insert (std::make_pair (entry.lastTxTime + m_rto, timeout));
+  ArmTimeoutTimer ();
+}
+
+void
+CCNxConsumer::UpdateRto (Time rtt)
+{
+  int64_t sample = rtt.GetNanoSeconds ();
+  int64_t srtt = m_srtt.GetNanoSeconds ();
+  int64_t rttvar = m_rttvar.GetNanoSeconds ();
+  if (m_srtt.IsStrictlyNegative ())
+    {
+      srtt = sample;
+      rttvar = sample / 2;
+    }
+  else
+    {
+      int64_t error = srtt > sample ? srtt - sample : sample - srtt;
+      rttvar = (3 * rttvar + error) / 4;
+      srtt = (7 * srtt + sample) / 8;
+    }
+  m_srtt = NanoSeconds (srtt);
+  m_rttvar = NanoSeconds (rttvar);
+  m_rto = Min (m_maxRto, Max (m_minRto, NanoSeconds (srtt + 4 * rttvar)));
+  NS_LOG_FUNCTION (this << rtt << m_srtt << m_rttvar << m_rto);
+}
+
+void
+CCNxConsumer::ArmTimeoutTimer ()
+{
+  if (m_timeoutQueue.empty ())
+    {
+      return;
     }
+  Time delay = m_timeoutQueue.begin ()->first - Simulator::Now ();
+  if (m_timeoutTimer.IsRunning ())
+    {
+      if (m_timeoutTimer.GetDelayLeft () <= delay)
+        {
+          return;
+        }
+      m_timeoutTimer.Cancel ();
+    }
+  m_timeoutTimer.Schedule (delay);
 }
 
+void
+CCNxConsumer::FillWindow ()
+{
+  NS_LOG_FUNCTION (this << m_cwnd << m_outstandingRequests.size ());
+  uint32_t objectCount = m_globalContentRepositoryPrefix->GetContentObjectCount ();
+  while (m_outstandingRequests.size () < (size_t) m_cwnd)
+    {
+      Ptr<const CCNxName> name = m_globalContentRepositoryPrefix->GetName (m_nextSequence % objectCount);
+      if (FindOutStandingInterest (name))
+        {
+          // The window is larger than the repository and has wrapped onto a chunk still in flight
+          break;
+        }
+      NS_LOG_DEBUG ("CCNxConsumer:Sending chunk " << m_nextSequence << " cwnd " << m_cwnd << " " << *name);
+      m_count++;
+      SendInterest (name);
+    }
+}
+
+void
+CCNxConsumer::WindowIncrease ()
+{
+  m_cwnd = std::min (m_maxWindow, m_cwnd + m_additiveIncrease / m_cwnd);
+  NS_LOG_FUNCTION (this << m_cwnd);
+}
+
+void
+CCNxConsumer::WindowDecrease (uint32_t sequence)
+{
+  NS_LOG_FUNCTION (this << sequence << m_recoverySequence);
+  if (sequence < m_recoverySequence)
+    {
+      // Sent before the last cut, so this loss was already accounted for
+      return;
+    }
+  m_cwnd = std::max (1.0, m_cwnd * m_decreaseFactor);
+  m_recoverySequence = m_nextSequence;
+  NS_LOG_INFO ("CCNxConsumer:Node " << GetNode ()->GetId () << " loss on chunk " << sequence << " cwnd now " << m_cwnd);
+}
+
+void
+CCNxConsumer::CheckTimeouts ()
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  bool backedOff = false;
+  while (!m_timeoutQueue.empty () && m_timeoutQueue.begin ()->first <= now)
+    {
+      TimeoutEntryType timeout = m_timeoutQueue.begin ()->second;
+      m_timeoutQueue.erase (m_timeoutQueue.begin ());
+
+      OutstandingRequestType::iterator it = m_outstandingRequests.find (timeout.name);
+      if (it == m_outstandingRequests.end () || it->second.sequence != timeout.sequence
+          || it->second.retries != timeout.retries)
+        {
+          // Answered, returned or already retransmitted since this deadline was set
+          continue;
+        }
+
+      // Back off once per expiry of the timer (RFC 6298 5.5), not once per Interest of a window
+      // that expired together.  The retransmissions below then all use the backed off RTO.
+      if (!backedOff)
+        {
+          m_rto = Min (m_maxRto, NanoSeconds (2 * m_rto.GetNanoSeconds ()));
+          backedOff = true;
+        }
+      if (m_windowMode)
+        {
+          WindowDecrease (timeout.sequence);
+        }
+
+      if (it->second.retries < m_maxRetries)
+        {
+          NS_LOG_INFO ("CCNxConsumer:Node " << GetNode ()->GetId () << " retransmitting " << *timeout.name << " rto " << m_rto);
+          it->second.retries++;
+          m_retransmissions++;
+          TransmitInterest (it->second);
+        }
+      else
+        {
+          NS_LOG_INFO ("CCNxConsumer:Node " << GetNode ()->GetId () << " gave up on " << *timeout.name);
+          m_interestTimeouts++;
+          m_outstandingRequests.erase (it);
+        }
+    }
+
+  ArmTimeoutTimer ();
+  if (m_windowMode)
+    {
+      FillWindow ();
+    }
+}
+
+double
+CCNxConsumer::GetGoodput () const
+{
+  if (m_firstSendTime.IsStrictlyNegative () || m_lastReceiveTime <= m_firstSendTime)
+    {
+      return 0.0;
+    }
+  return m_bytesReceived * 8.0 / (m_lastReceiveTime - m_firstSendTime).GetSeconds () / 1e6;
+}
 
 void
 CCNxConsumer::ShowStatistics ()
@@ -243,34 +591,29 @@ CCNxConsumer::ShowStatistics ()
   if (printConsStatsHeader)
     {
       std::cout << std::endl <<  "Consumer " << " Interest " << "Content   " << \
-    		  " Missing   " << " Bad        " << "Average   " << "Std Dev    " \
-			  << "Total    " <<" Repository" << std::endl;
+    		  " Missing   " << " Bad        " << "Returned  " << "Retransmit" << "Timed Out " << "Average   " << "Std Dev    " \
+			  << "P50       " << "P90       " << "P99       " << "P99.9     " << "Max       " << "Goodput   " << "Total    " <<" Repository" << std::endl;
       std::cout << "Node Id :" << " Sent    :" << "Received  :" \
-    		  << "Interests :" << "Packets   :" << "Delay(Ms):" <<  "Delay(Ms) :" \
-			  << "Count     :" << "Prefix   " << std::endl;
+    		  << "Interests :" << "Packets   :" << "Interests:" << "Interests:" << "Interests:" << "Delay(Ms):" <<  "Delay(Ms) :" \
+			  << "Delay(Ms):" << "Delay(Ms):" << "Delay(Ms):" << "Delay(Ms):" << "Delay(Ms):" << "(Mbps)   :" << "Count     :" << "Prefix   " << std::endl;
       printConsStatsHeader = 0;
     }
-  double average = 0.0;
-  double stdev = 0.0;
-
-  if (m_count > 0) {
-	  average = m_sum / m_count;
-
-	  // This comes from https://en.wikipedia.org/wiki/Standard_deviation#Identities_and_mathematical_properties
-	  if (m_count > 2) {
-		  double k = sqrt(m_count / (m_count - 1));
-
-		  double variance = (m_sumSquare / m_count) - (average * average);
-		  stdev = k * sqrt(variance);
-	  }
-  }
   std::cout << std::setw (10) << std::left << node->GetId ();
   std::cout << std::setw (10) << std::left  << m_goodInterestsSent;
   std::cout << std::setw (12) << std::left << m_goodContentReceived;
   std::cout << std::setw (12) << std::left << m_goodInterestsSent - m_goodContentReceived;
   std::cout << std::setw (8) << std::left << m_contentProcessFails + m_interestProcessFails;
-  std::cout << std::setw (10) << std::left << average;
-  std::cout << std::setw (11) << std::left << stdev;
+  std::cout << std::setw (10) << std::left << m_interestReturnsReceived;
+  std::cout << std::setw (10) << std::left << m_retransmissions;
+  std::cout << std::setw (10) << std::left << m_interestTimeouts;
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetMean ().ToDouble (Time::MS);
+  std::cout << std::setw (11) << std::left << m_latencyHistogram->GetStdDev ().ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetPercentile (50.0).ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetPercentile (90.0).ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetPercentile (99.0).ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetPercentile (99.9).ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << m_latencyHistogram->GetMax ().ToDouble (Time::MS);
+  std::cout << std::setw (10) << std::left << GetGoodput ();
   std::cout << std::setw (10) << std::left << m_count;
   std::cout << *m_globalContentRepositoryPrefix->GetRepositoryPrefix () << std::endl;
 
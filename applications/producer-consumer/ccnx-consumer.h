@@ -60,6 +60,7 @@
 #include <vector>
 
 #include "ns3/object.h"
+#include "ns3/object-factory.h"
 #include "ns3/nstime.h"
 #include "ns3/timer.h"
 
@@ -77,6 +78,8 @@
 #include "ns3/ccnx-application.h"
 #include "ns3/ccnx-portal.h"
 #include "ns3/ccnx-content-repository.h"
+#include "ns3/ccnx-latency-histogram.h"
+#include "ns3/ccnx-popularity-model.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -89,6 +92,22 @@ namespace ccnx {
   * The consumer class is derived from the CCNxApplication class which in turn is derived from ns3::Application.
   * The interests generated are routed according FIB entry.
   *
+  * By default one Interest is sent every RequestInterval, for a name chosen by the
+  * CCNxPopularityModel created from the "PopularityModel" attribute (uniform unless set).  With the "WindowMode"
+  * attribute set the consumer instead requests the repository chunks in sequence and keeps up to
+  * a congestion window of Interests in flight.  The window grows additively (AdditiveIncrease / cwnd
+  * per Content Object) and is multiplied by DecreaseFactor on an InterestReturn or when an Interest
+  * times out, at most once per window of data.  Goodput is reported in Mbps by ShowStatistics.
+  *
+  * In both modes an unanswered Interest is retransmitted after a retransmission timeout (RTO)
+  * estimated from SRTT and RTTVAR as in RFC 6298, sampling only Interests that were never
+  * retransmitted (Karn's algorithm) and doubling the RTO once each time the timer expires.  After MaxRetries
+  * retransmissions the Interest is abandoned and counted as timed out.  The reported latency of
+  * a recovered Interest runs from its first transmission, so it includes the recovery time.
+  *
+  * Latencies are kept in nanoseconds in a CCNxLatencyHistogram, see GetLatencyHistogram () and
+  * CCNxConsumerHelper::MergeLatencyHistograms ().
+  *
   */
 
 class CCNxConsumer : public CCNxApplication
@@ -129,7 +148,55 @@ public:
     */
   void SetContentRepository (Ptr<CCNxContentRepository> repositoryPtr);
 
+  /**
+   * The latency, from first transmission to Content Object, of every Interest this consumer
+   * has had answered.
+   */
+  Ptr<const CCNxLatencyHistogram> GetLatencyHistogram (void) const;
+
+  /**
+   * The current retransmission timeout, including any backoff.
+   */
+  Time GetRto (void) const;
+
+  /**
+   * The number of Interests generated, not counting retransmissions.
+   */
+  uint64_t GetRequestCount (void) const;
+
+  /**
+   * The number of bad or unexpected packets received (the Bad Packets column of the statistics).
+   */
+  uint32_t GetErrorCount (void) const;
+
 private:
+  /**
+   * txTime is the first transmission, for the latency statistics.  lastTxTime is
+   * the most recent transmission, for RTT samples.  sequence is unique per Interest expressed (in
+   * window mode it is also the chunk number) and retries counts retransmissions.
+   */
+  typedef struct {
+    Ptr <const CCNxName> interestName;
+    Time           txTime;
+    uint32_t       sequence;
+    uint32_t       retries;
+    Time           lastTxTime;
+  }OutstandingRequestEntryType;
+
+  typedef std::map < Ptr <const CCNxName> , OutstandingRequestEntryType , CCNxName::isLessPtrCCNxName > OutstandingRequestType;
+
+  /**
+   * A retransmission deadline.  It is stale, and skipped, once the outstanding entry for `name`
+   * has gone or no longer has the same sequence and retries.
+   */
+  typedef struct {
+    Ptr<const CCNxName> name;
+    uint32_t sequence;
+    uint32_t retries;
+  } TimeoutEntryType;
+
+  typedef std::multimap<Time, TimeoutEntryType> TimeoutQueueType;
+
   /**
    *
    * This is inherited from the base class ns3::Application
@@ -144,6 +211,8 @@ private:
    * This private method is a registered callback to portal. Portal will invoke this callback function every time a packet is received.
    * The ConsumerClass will decode the message to check if this were an interest or content. Ofcourse we are not expecting an interest
    * but upon receiving content we will then strike it out from our OutStandingInterest list.
+   * An InterestReturn (NACK) also strikes the interest out, without a latency sample, and is counted
+   * in m_interestReturnsReceived.
    *
    * @param [in] Pointer to CCNxPortal class
    */
@@ -169,6 +238,58 @@ private:
    */
   void GenerateTraffic ();
 
+  /**
+   * Express a new Interest for `name`: record it in m_outstandingRequests under the next
+   * sequence number and transmit it.
+   */
+  void SendInterest (Ptr<const CCNxName> name);
+
+  /**
+   * Put the Interest for an outstanding entry on the wire and queue its retransmission
+   * deadline of now + m_rto.
+   */
+  void TransmitInterest (OutstandingRequestEntryType &entry);
+
+  /**
+   * Fold an RTT sample into SRTT and RTTVAR and recompute m_rto.
+   */
+  void UpdateRto (Time rtt);
+
+  /**
+   * Schedule m_timeoutTimer for the earliest deadline in m_timeoutQueue, if that is
+   * earlier than where it is already set to fire.
+   */
+  void ArmTimeoutTimer ();
+
+  /**
+   * In window mode, send Interests for the next sequential chunks until the number outstanding
+   * reaches the congestion window.
+   */
+  void FillWindow ();
+
+  /**
+   * In window mode, a Content Object answered an outstanding Interest: open the window.
+   */
+  void WindowIncrease ();
+
+  /**
+   * In window mode, the Interest for chunk `sequence` was lost (timeout or InterestReturn).  Cut the
+   * window unless it was already cut for a chunk sent after that loss was possible.
+   */
+  void WindowDecrease (uint32_t sequence);
+
+  /**
+   * Process every deadline in m_timeoutQueue that has passed: back off the RTO (once for all of them) and either
+   * retransmit the Interest or, once it has used up MaxRetries, abandon it.
+   */
+  void CheckTimeouts ();
+
+  /**
+   * Goodput in Mbps: the content bytes received between the first Interest and the
+   * last Content Object.
+   */
+  double GetGoodput () const;
+
   Ptr<CCNxPortal> m_consumerPortal;
   Time m_requestInterval;
   Timer m_requestIntervalTimer;
@@ -176,15 +297,37 @@ private:
   typedef std::set<Ptr<const CCNxName>, CCNxName::isLessPtrCCNxName> NameIndexLookupType;
   NameIndexLookupType m_outstandingRequests;
 #else
-  	typedef struct {
-  		Ptr <const CCNxName> interestName;
-  		uint64_t       txTime;
-  	}OutstandingRequestEntryType;
-
-  	typedef std::map < Ptr <const CCNxName> , OutstandingRequestEntryType , CCNxName::isLessPtrCCNxName > OutstandingRequestType;
   	OutstandingRequestType m_outstandingRequests;
 #endif
   Ptr<CCNxContentRepository> m_globalContentRepositoryPrefix;
+  ObjectFactory m_popularityModelFactory;
+  Ptr<CCNxPopularityModel> m_popularityModel;
+
+  /**
+   * Window mode state.
+   */
+  bool m_windowMode;
+  double m_initialWindow;
+  double m_maxWindow;
+  double m_additiveIncrease;
+  double m_decreaseFactor;
+  double m_cwnd;
+  uint32_t m_recoverySequence;
+
+  /**
+   * Retransmission state.  All outstanding Interests share m_timeoutTimer, which is set for the
+   * earliest deadline in m_timeoutQueue.  m_srtt is negative until the first RTT sample.
+   */
+  Time m_initialRto;
+  Time m_minRto;
+  Time m_maxRto;
+  uint32_t m_maxRetries;
+  Time m_srtt;
+  Time m_rttvar;
+  Time m_rto;
+  uint32_t m_nextSequence;
+  Timer m_timeoutTimer;
+  TimeoutQueueType m_timeoutQueue;
 
   /**
    * Statistics and a show method to display them.
@@ -194,9 +337,14 @@ private:
   uint32_t m_goodContentReceived;
   uint32_t m_interestProcessFails;
   uint32_t m_contentProcessFails;
+  uint32_t m_interestReturnsReceived;
+  uint32_t m_interestTimeouts;
+  uint32_t m_retransmissions;
+  uint64_t m_bytesReceived;
+  Time m_firstSendTime;
+  Time m_lastReceiveTime;
   uint64_t m_count;
-  uint64_t m_sum;
-  uint64_t m_sumSquare;
+  Ptr<CCNxLatencyHistogram> m_latencyHistogram;
 };
 }
 }
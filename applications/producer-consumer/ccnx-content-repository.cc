@@ -67,6 +67,20 @@ CCNxContentRepository::CCNxContentRepository (
   NS_LOG_FUNCTION (
     this << repositoryPrefix << contentObjectSize << contentObjectCount);
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  m_lazy = false;
+  m_hotCacheSize = 0;
+  CreateRepository (repositoryPrefix, contentObjectSize, contentObjectCount);
+}
+
+CCNxContentRepository::CCNxContentRepository (
+  Ptr<const CCNxName> repositoryPrefix, uint32_t contentObjectSize,
+  uint32_t contentObjectCount, bool lazy, uint32_t hotCacheSize)
+{
+  NS_LOG_FUNCTION (
+    this << repositoryPrefix << contentObjectSize << contentObjectCount << lazy << hotCacheSize);
+  m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  m_lazy = lazy;
+  m_hotCacheSize = hotCacheSize;
   CreateRepository (repositoryPrefix, contentObjectSize, contentObjectCount);
 }
 
@@ -82,41 +96,121 @@ CCNxContentRepository::CreateRepository (Ptr<const CCNxName> repositoryPrefix,
 {
   NS_LOG_FUNCTION (
     this << repositoryPrefix << contentObjectSize << contentObjectCount);
-  char buffer[8];
 
   m_repositoryPrefix = repositoryPrefix;
   m_objectSize = contentObjectSize;
+  m_objectCount = contentObjectCount;
+  if (m_lazy)
+    {
+      return;
+    }
+
+  m_contentObjects.reserve (contentObjectCount);
   for (uint32_t ii = 0; ii < contentObjectCount; ii++)
     {
-      CCNxNameBuilder nameBuilder (*repositoryPrefix);
-      snprintf (buffer, sizeof(buffer), "%d", ii);
-      nameBuilder.Append (
-        Create<CCNxNameSegment> (CCNxNameSegment_Chunk, buffer));
-      Ptr<CCNxContentObject> contentObject = Create<CCNxContentObject> (
-          nameBuilder.CreateName ());
-      m_contentObjects.push_back (contentObject);
-      NS_LOG_DEBUG ("Added name " << *nameBuilder.CreateName () << "to repository " << *repositoryPrefix);
+      Ptr<const CCNxName> name = CreateChunkName (ii);
+      m_contentObjects.push_back (CreateContentObject (name));
+      NS_LOG_DEBUG ("Added name " << *name << "to repository " << *repositoryPrefix);
     }
 }
 
+Ptr<const CCNxName>
+CCNxContentRepository::CreateChunkName (uint32_t index) const
+{
+  char buffer[16];
+  snprintf (buffer, sizeof(buffer), "%u", index);
+  CCNxNameBuilder nameBuilder (*m_repositoryPrefix);
+  nameBuilder.Append (Create<CCNxNameSegment> (CCNxNameSegment_Chunk, buffer));
+  return nameBuilder.CreateName ();
+}
+
 Ptr<CCNxContentObject>
-CCNxContentRepository::GetContentObject (Ptr<const CCNxName> interestName)
+CCNxContentRepository::CreateContentObject (Ptr<const CCNxName> name) const
 {
-  NS_LOG_FUNCTION (this << interestName);
+  return Create<CCNxContentObject> (name, (size_t) m_objectSize);
+}
+
+bool
+CCNxContentRepository::ParseChunkIndex (Ptr<const CCNxName> name, uint32_t &index) const
+{
+  size_t prefixCount = m_repositoryPrefix->GetSegmentCount ();
+  if (name->GetSegmentCount () != prefixCount + 1 || !m_repositoryPrefix->IsPrefixOf (*name))
+    {
+      return false;
+    }
+
+  Ptr<const CCNxNameSegment> segment = name->GetSegment (prefixCount);
+  if (segment->GetType () != CCNxNameSegment_Chunk)
+    {
+      return false;
+    }
 
-  if (m_repositoryPrefix->IsPrefixOf (*interestName))
+  // Only the canonical form CreateChunkName produces: digits, no leading zeros
+  const std::string &value = segment->GetValue ();
+  if (value.empty () || value.size () > 10 || (value.size () > 1 && value[0] == '0'))
     {
-      for (ContentObjectList::iterator ii = m_contentObjects.begin (); ii != m_contentObjects.end (); ++ii)
+      return false;
+    }
+  uint64_t parsed = 0;
+  for (size_t i = 0; i < value.size (); ++i)
+    {
+      if (value[i] < '0' || value[i] > '9')
         {
-          Ptr<CCNxContentObject> contentResponse  = *ii;
-          if (interestName->Equals (*contentResponse->GetName ()))
-            {
-              return contentResponse;
-            }
+          return false;
         }
+      parsed = parsed * 10 + (value[i] - '0');
+    }
+  if (parsed >= m_objectCount)
+    {
+      return false;
     }
+  index = parsed;
+  return true;
+}
 
-  return Ptr <CCNxContentObject> (0);
+Ptr<CCNxContentObject>
+CCNxContentRepository::GetContentObject (Ptr<const CCNxName> interestName)
+{
+  NS_LOG_FUNCTION (this << interestName);
+
+  uint32_t index;
+  if (!ParseChunkIndex (interestName, index))
+    {
+      return Ptr <CCNxContentObject> (0);
+    }
+
+  if (m_lazy)
+    {
+      return GetLazyContentObject (interestName, index);
+    }
+  return m_contentObjects[index];
+}
+
+Ptr<CCNxContentObject>
+CCNxContentRepository::GetLazyContentObject (Ptr<const CCNxName> name, uint32_t index)
+{
+  if (m_hotCacheSize == 0)
+    {
+      return CreateContentObject (name);
+    }
+
+  HotEntryType *found = m_hotMap.Find (index);
+  if (found)
+    {
+      m_hotList.splice (m_hotList.begin (), m_hotList, found->second);
+      return found->first;
+    }
+
+  if (m_hotMap.Size () >= m_hotCacheSize)
+    {
+      m_hotMap.Erase (m_hotList.back ());
+      m_hotList.pop_back ();
+    }
+
+  Ptr<CCNxContentObject> contentObject = CreateContentObject (name);
+  m_hotList.push_front (index);
+  m_hotMap.Insert (index, std::make_pair (contentObject, m_hotList.begin ()));
+  return contentObject;
 }
 
 Ptr<const CCNxName>
@@ -137,7 +231,19 @@ uint32_t
 CCNxContentRepository::GetContentObjectCount ( ) const
 {
   NS_LOG_FUNCTION (this);
-  return m_contentObjects.size ();
+  return m_objectCount;
+}
+
+bool
+CCNxContentRepository::IsLazy (void) const
+{
+  return m_lazy;
+}
+
+uint32_t
+CCNxContentRepository::GetHotCacheCount (void) const
+{
+  return m_hotMap.Size ();
 }
 
 Ptr<const CCNxName>
@@ -145,9 +251,20 @@ CCNxContentRepository::GetRandomName ()
 {
   NS_LOG_FUNCTION (this);
   uint32_t randIndex = m_uniformRandomVariable->GetInteger (
-      0, (m_contentObjects.size () - 1));
-  Ptr <const CCNxName> randName = m_contentObjects[randIndex]->GetName ();
+      0, (m_objectCount - 1));
+  Ptr <const CCNxName> randName = GetName (randIndex);
   NS_LOG_DEBUG ("randName is " << *randName);
   return randName;
 }
 
+Ptr<const CCNxName>
+CCNxContentRepository::GetName (uint32_t index) const
+{
+  NS_LOG_FUNCTION (this << index);
+  NS_ASSERT_MSG (index < m_objectCount, "Index " << index << " beyond repository size " << m_objectCount);
+  if (m_lazy)
+    {
+      return CreateChunkName (index);
+    }
+  return m_contentObjects[index]->GetName ();
+}
@@ -58,6 +58,7 @@
 
 
 #include <map>
+#include <list>
 #include <vector>
 #include <set>
 
@@ -69,6 +70,7 @@
 #include "ns3/ccnx-name-builder.h"
 #include "ns3/ccnx-buffer.h"
 #include "ns3/ccnx-contentobject.h"
+#include "ns3/ccnx-flat-hash-map.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -79,6 +81,11 @@ namespace ccnx {
  * This is then used by the producer class to serve content objects from.
  * This is then used by the consumer class to generate random interest requests for the content objects.
  *
+ * Content object i is named <prefix>/chunk=i, so a lookup parses the chunk number from the last
+ * name segment and indexes directly instead of searching.  A lazy repository stores no objects
+ * at all: names and content objects are synthesized when asked for, optionally keeping the
+ * hotCacheSize most recently requested objects, so memory does not grow with the catalog.
+ *
  */
 class CCNxContentRepository : public SimpleRefCount<CCNxContentRepository>
 {
@@ -96,6 +103,26 @@ public:
   CCNxContentRepository ( Ptr <const CCNxName> repositoryPrefix,
                           uint32_t contentObjectSize,
                           uint32_t contentObjectCount);
+
+  /**
+   * Create a repository that, if `lazy` is true, generates its content objects on demand.
+   *
+   * @param [in] repositoryPrefix a prefix for all the content objects.
+   * @param [in] contentObjectSize, the payload/size of each content object.
+   * @param [in] contentObjectCount, the number of content objects in the catalog.
+   * @param [in] lazy, synthesize objects on demand rather than creating them all up front.
+   * @param [in] hotCacheSize, in lazy mode the number of recently served objects to keep (0 keeps none).
+   *
+   * Example:
+   * @code
+   * Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix, 1200, 10000000, true, 1000);
+   * @endcode
+   */
+  CCNxContentRepository ( Ptr <const CCNxName> repositoryPrefix,
+                          uint32_t contentObjectSize,
+                          uint32_t contentObjectCount,
+                          bool lazy,
+                          uint32_t hotCacheSize);
 /**
  * Destroy the object instantiated
  */
@@ -121,17 +148,58 @@ public:
    */
   Ptr <const CCNxName> GetRandomName (void);
 
+  /**
+   * This method returns the name of the index'th object in the repository.  Names are
+   * ordered by chunk number, so walking the indices in order walks the content sequentially.
+   *
+   * @param [in] index must be less than GetContentObjectCount ()
+   */
+  Ptr <const CCNxName> GetName (uint32_t index) const;
+
   /**
    * This method returns the prefix with which the repository was constructed.
    */
   Ptr <const CCNxName> GetRepositoryPrefix (void) const;
 
   /**
-   * This method will return a Content Object with no payload
+   * This method will return a Content Object with a virtual payload of GetContentObjectSize()
+   * bytes, or null if the name is not in the repository.
    */
   Ptr<CCNxContentObject> GetContentObject (Ptr <const CCNxName>contentObjectName);
 
+  /**
+   * Returns true if this repository generates its content objects on demand.
+   */
+  bool IsLazy (void) const;
+
+  /**
+   * In lazy mode, the number of content objects currently held in the hot cache.
+   */
+  uint32_t GetHotCacheCount (void) const;
+
 private:
+  /**
+   * If `name` is <prefix>/chunk=i with i a canonical decimal below the object count, set
+   * `index` to i and return true.
+   */
+  bool ParseChunkIndex (Ptr <const CCNxName> name, uint32_t &index) const;
+
+  /**
+   * Build the name <prefix>/chunk=index.
+   */
+  Ptr <const CCNxName> CreateChunkName (uint32_t index) const;
+
+  /**
+   * Create the content object served for `name`.  It carries a virtual payload of
+   * contentObjectSize bytes, so it has the right size on the wire without storing the bytes.
+   */
+  Ptr<CCNxContentObject> CreateContentObject (Ptr <const CCNxName> name) const;
+
+  /**
+   * In lazy mode, find or synthesize the object for chunk `index` and refresh it in the hot cache.
+   */
+  Ptr<CCNxContentObject> GetLazyContentObject (Ptr <const CCNxName> name, uint32_t index);
+
   void AddNameToRepository (Ptr <const CCNxName> repositoryPrefix, Ptr <const CCNxName> objectName);
   void CreateRepository (Ptr <const CCNxName> repositoryPrefix,
                          uint32_t contentObjectSize,
@@ -144,9 +212,26 @@ private:
 
   uint32_t m_objectSize;
 
+  uint32_t m_objectCount;
+
+  bool m_lazy;
+
   typedef std::vector < Ptr <CCNxContentObject> > ContentObjectList;
   ContentObjectList m_contentObjects;
 
+  /**
+   * The lazy mode hot cache: m_hotList has the most recently used chunk index at the front,
+   * m_hotMap finds an index's object and list position in O(1).
+   */
+  uint32_t m_hotCacheSize;
+
+  typedef std::list <uint32_t> HotListType;
+  HotListType m_hotList;
+
+  typedef std::pair <Ptr <CCNxContentObject>, HotListType::iterator> HotEntryType;
+  typedef CCNxFlatHashMap <uint32_t, HotEntryType> HotMapType;
+  HotMapType m_hotMap;
+
 };
 }
 }
@@ -0,0 +1,246 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+#include <algorithm>
+#include <limits>
+
+#include "ns3/log.h"
+#include "ns3/ccnx-latency-histogram.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxLatencyHistogram");
+
+/*
+ * Values below 2^subBucketBits each get their own bucket.  Above that, the range [2^k, 2^(k+1))
+ * is split into halfSubBucketCount buckets of width 2^(k - subBucketBits + 1).
+ */
+static const uint32_t subBucketBits = 6;
+static const uint64_t subBucketCount = 1 << subBucketBits;
+static const uint64_t halfSubBucketCount = subBucketCount / 2;
+
+CCNxLatencyHistogram::CCNxLatencyHistogram ()
+{
+  Reset ();
+}
+
+CCNxLatencyHistogram::~CCNxLatencyHistogram ()
+{
+  // empty
+}
+
+void
+CCNxLatencyHistogram::Reset (void)
+{
+  m_buckets.clear ();
+  m_count = 0;
+  m_min = std::numeric_limits<uint64_t>::max ();
+  m_max = 0;
+  m_sum = 0.0;
+  m_sumSquare = 0.0;
+}
+
+uint32_t
+CCNxLatencyHistogram::GetBucketIndex (uint64_t value)
+{
+  if (value < subBucketCount)
+    {
+      return value;
+    }
+
+  uint32_t msb = 0;
+  uint64_t x = value;
+  for (uint32_t shift = 32; shift > 0; shift >>= 1)
+    {
+      if (x >> shift)
+        {
+          x >>= shift;
+          msb += shift;
+        }
+    }
+
+  uint32_t exponent = msb - subBucketBits + 1;
+  return exponent * halfSubBucketCount + (value >> exponent);
+}
+
+uint64_t
+CCNxLatencyHistogram::GetBucketUpperBound (uint32_t index)
+{
+  if (index < subBucketCount)
+    {
+      return index;
+    }
+  uint32_t exponent = index / halfSubBucketCount - 1;
+  uint64_t subBucket = index % halfSubBucketCount + halfSubBucketCount;
+  return ((subBucket + 1) << exponent) - 1;
+}
+
+void
+CCNxLatencyHistogram::Record (Time latency)
+{
+  int64_t ns = latency.GetNanoSeconds ();
+  uint64_t value = ns > 0 ? ns : 0;
+
+  uint32_t index = GetBucketIndex (value);
+  if (index >= m_buckets.size ())
+    {
+      m_buckets.resize (index + 1, 0);
+    }
+  m_buckets[index]++;
+
+  m_count++;
+  m_min = std::min (m_min, value);
+  m_max = std::max (m_max, value);
+  m_sum += value;
+  m_sumSquare += (double) value * value;
+}
+
+void
+CCNxLatencyHistogram::Merge (const CCNxLatencyHistogram &other)
+{
+  if (other.m_buckets.size () > m_buckets.size ())
+    {
+      m_buckets.resize (other.m_buckets.size (), 0);
+    }
+  for (size_t i = 0; i < other.m_buckets.size (); ++i)
+    {
+      m_buckets[i] += other.m_buckets[i];
+    }
+
+  m_count += other.m_count;
+  m_min = std::min (m_min, other.m_min);
+  m_max = std::max (m_max, other.m_max);
+  m_sum += other.m_sum;
+  m_sumSquare += other.m_sumSquare;
+}
+
+uint64_t
+CCNxLatencyHistogram::GetCount (void) const
+{
+  return m_count;
+}
+
+Time
+CCNxLatencyHistogram::GetMin (void) const
+{
+  return m_count ? NanoSeconds (m_min) : Time (0);
+}
+
+Time
+CCNxLatencyHistogram::GetMax (void) const
+{
+  return NanoSeconds (m_max);
+}
+
+Time
+CCNxLatencyHistogram::GetMean (void) const
+{
+  if (m_count == 0)
+    {
+      return Time (0);
+    }
+  return NanoSeconds ((int64_t) (m_sum / m_count));
+}
+
+Time
+CCNxLatencyHistogram::GetStdDev (void) const
+{
+  if (m_count < 2)
+    {
+      return Time (0);
+    }
+  double variance = (m_sumSquare - m_sum * m_sum / m_count) / (m_count - 1);
+  return NanoSeconds ((int64_t) std::sqrt (std::max (variance, 0.0)));
+}
+
+Time
+CCNxLatencyHistogram::GetPercentile (double percentile) const
+{
+  NS_ASSERT_MSG (percentile >= 0.0 && percentile <= 100.0, "Percentile out of range " << percentile);
+  if (m_count == 0)
+    {
+      return Time (0);
+    }
+
+  uint64_t rank = (uint64_t) std::ceil (percentile / 100.0 * m_count);
+  rank = std::max (rank, (uint64_t) 1);
+
+  uint64_t seen = 0;
+  for (size_t i = 0; i < m_buckets.size (); ++i)
+    {
+      seen += m_buckets[i];
+      if (seen >= rank)
+        {
+          return NanoSeconds (std::min (GetBucketUpperBound (i), m_max));
+        }
+    }
+  return NanoSeconds (m_max);
+}
+
+std::ostream &
+ns3::ccnx::operator<< (std::ostream &os, const CCNxLatencyHistogram &histogram)
+{
+  os << "count " << histogram.GetCount ()
+     << " mean " << histogram.GetMean ().ToDouble (Time::MS)
+     << " p50 " << histogram.GetPercentile (50.0).ToDouble (Time::MS)
+     << " p90 " << histogram.GetPercentile (90.0).ToDouble (Time::MS)
+     << " p99 " << histogram.GetPercentile (99.0).ToDouble (Time::MS)
+     << " p99.9 " << histogram.GetPercentile (99.9).ToDouble (Time::MS)
+     << " max " << histogram.GetMax ().ToDouble (Time::MS)
+     << " (ms)";
+  return os;
+}
@@ -0,0 +1,152 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_LATENCY_HISTOGRAM_H_
+#define CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_LATENCY_HISTOGRAM_H_
+
+#include <vector>
+#include <ostream>
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ccnx {
+/**
+ * @ingroup ccnx-apps
+ *
+ * A log-linear histogram of latencies with nanosecond resolution.  Values below 64ns have their
+ * own bucket; above that every power of two is split into 32 buckets, so a reported percentile
+ * is within about 3% of the true value while the whole 64-bit range fits in under 2000 counters.
+ *
+ * Every histogram has the same bucket layout, so histograms from many consumers can be merged
+ * by adding their counters.
+ *
+ * Example:
+ * @code
+ * {
+ *     CCNxLatencyHistogram histogram;
+ *     histogram.Record (MicroSeconds (250));
+ *     histogram.Record (MilliSeconds (2));
+ *     Time p99 = histogram.GetPercentile (99.0);
+ * }
+ * @endcode
+ */
+class CCNxLatencyHistogram : public SimpleRefCount<CCNxLatencyHistogram>
+{
+public:
+  CCNxLatencyHistogram ();
+  virtual ~CCNxLatencyHistogram ();
+
+  /**
+   * Add one latency sample.  Negative values are recorded as 0.
+   */
+  void Record (Time latency);
+
+  /**
+   * Add every sample of `other` to this histogram.
+   */
+  void Merge (const CCNxLatencyHistogram &other);
+
+  /**
+   * Discard all samples.
+   */
+  void Reset (void);
+
+  /**
+   * The number of samples recorded.
+   */
+  uint64_t GetCount (void) const;
+
+  /**
+   * The exact smallest and largest samples, 0 if there are none.
+   */
+  Time GetMin (void) const;
+  Time GetMax (void) const;
+
+  /**
+   * The exact mean and sample standard deviation, 0 if there are too few samples.
+   */
+  Time GetMean (void) const;
+  Time GetStdDev (void) const;
+
+  /**
+   * The latency at or below which `percentile` percent of the samples fall, e.g. 99.9.
+   * This is the upper edge of the bucket holding that sample, capped at GetMax ().
+   *
+   * @param [in] percentile in the range [0, 100]
+   */
+  Time GetPercentile (double percentile) const;
+
+  /**
+   * Outputs count, mean, p50, p90, p99, p99.9 and max in milliseconds.
+   */
+  friend std::ostream &operator<< (std::ostream &os, const CCNxLatencyHistogram &histogram);
+
+private:
+  static uint32_t GetBucketIndex (uint64_t value);
+  static uint64_t GetBucketUpperBound (uint32_t index);
+
+  std::vector<uint64_t> m_buckets;
+  uint64_t m_count;
+  uint64_t m_min;
+  uint64_t m_max;
+  double m_sum;
+  double m_sumSquare;
+};
+}
+}
+
+#endif /* CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_LATENCY_HISTOGRAM_H_ */
@@ -66,6 +66,12 @@ NS_LOG_COMPONENT_DEFINE ("CCNxProducer");
 NS_OBJECT_ENSURE_REGISTERED (CCNxProducer);
 
 static bool printProdStatsHeader = 1;
+
+/**
+ * The number of packets read from the portal per RecvBatch() call.
+ */
+static const size_t _receiveBatchSize = 64;
+
 TypeId CCNxProducer::GetTypeId (void)
 {
   static TypeId tid =
@@ -131,41 +137,51 @@ void
 CCNxProducer::ReceiveCallback (Ptr<CCNxPortal> portal)
 {
   NS_LOG_FUNCTION (this << portal);
-  Ptr<CCNxPacket> packet;
 
-  while ((packet = portal->Recv ()))
+  while (portal->RecvBatch (m_receiveBatch, _receiveBatchSize) > 0)
     {
-      if (packet->GetMessage ()->GetMessageType () == CCNxMessage::Interest)
+      for (size_t i = 0; i < m_receiveBatch.size (); i++)
         {
-          m_goodInterestsReceived++;
-          NS_LOG_DEBUG (
-            "CCNxProducer::Received request" << *packet << " packet dump");
-          Ptr<const CCNxName> name = packet->GetMessage ()->GetName ();
-          Ptr<CCNxContentObject> contentResponse =
-            m_globalContentRepositoryPrefix->GetContentObject (name);
-          if (contentResponse)
-            {
-              m_goodContentServed++;
-              Ptr<CCNxPacket> response = CCNxPacket::CreateFromMessage (
-                  contentResponse);
-              portal->Send (response);
-              NS_LOG_INFO (
-                "CCNxProducer::Sending Response for request " << *name);
-            }
-          else
-            {
-              m_contentProcessFails++;
-              NS_LOG_ERROR (
-                "CCNxProducer::Producer on node" << GetNode ()->GetId () << "got wrong prefix request " << *name);
-            }
+          ServeRequest (portal, m_receiveBatch[i].first);
+        }
+      m_receiveBatch.clear ();
+    }
+}
+
+void
+CCNxProducer::ServeRequest (Ptr<CCNxPortal> portal, Ptr<CCNxPacket> packet)
+{
+  // An InterestReturn also carries an Interest message, so check the packet type
+  if (packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Interest)
+    {
+      m_goodInterestsReceived++;
+      NS_LOG_DEBUG (
+        "CCNxProducer::Received request" << *packet << " packet dump");
+      Ptr<const CCNxName> name = packet->GetMessage ()->GetName ();
+      Ptr<CCNxContentObject> contentResponse =
+        m_globalContentRepositoryPrefix->GetContentObject (name);
+      if (contentResponse)
+        {
+          m_goodContentServed++;
+          Ptr<CCNxPacket> response = CCNxPacket::CreateFromMessage (
+              contentResponse);
+          portal->Send (response);
+          NS_LOG_INFO (
+            "CCNxProducer::Sending Response for request " << *name);
         }
       else
         {
-          // Cant deal with packet not an interest
-          m_interestProcessFails++;
-          NS_LOG_ERROR ("CCNxProducer::Bad packet type received " << *packet);
+          m_contentProcessFails++;
+          NS_LOG_ERROR (
+            "CCNxProducer::Producer on node" << GetNode ()->GetId () << "got wrong prefix request " << *name);
         }
     }
+  else
+    {
+      // Cant deal with packet not an interest
+      m_interestProcessFails++;
+      NS_LOG_ERROR ("CCNxProducer::Bad packet type received " << *packet);
+    }
 }
 
 void
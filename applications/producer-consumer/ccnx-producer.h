@@ -137,6 +137,20 @@ private:
    */
   void ReceiveCallback (Ptr<CCNxPortal> portal);
 
+  /**
+   * Answer one request read from the portal.  Interests in the repository get
+   * a content object, anything else is counted as a failure.
+   *
+   * @param [in] portal The portal to reply on
+   * @param [in] packet The received packet
+   */
+  void ServeRequest (Ptr<CCNxPortal> portal, Ptr<CCNxPacket> packet);
+
+  /**
+   * Re-used by ReceiveCallback() so draining the portal does not allocate.
+   */
+  CCNxPortal::PacketBatchType m_receiveBatch;
+
   /**
    * Portal for producer to send and receive data.
    */
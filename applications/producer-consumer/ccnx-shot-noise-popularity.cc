@@ -0,0 +1,267 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+#include <algorithm>
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-shot-noise-popularity.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxShotNoisePopularity");
+NS_OBJECT_ENSURE_REGISTERED (CCNxShotNoisePopularity);
+
+TypeId
+CCNxShotNoisePopularity::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxShotNoisePopularity")
+    .SetParent<CCNxPopularityModel> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxShotNoisePopularity> ()
+    .AddAttribute ("ArrivalRate",
+                   "New contents per second; 0 keeps only the InitialContents",
+                   DoubleValue (1.0),
+                   MakeDoubleAccessor (&CCNxShotNoisePopularity::m_arrivalRate),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("MeanLifetime",
+                   "Mean time a content stays popular",
+                   TimeValue (Seconds (60)),
+                   MakeTimeAccessor (&CCNxShotNoisePopularity::m_meanLifetime),
+                   MakeTimeChecker (TimeStep (1)))
+    .AddAttribute ("VolumeShape",
+                   "Pareto shape of a content's request volume; smaller is more skewed",
+                   DoubleValue (1.5),
+                   MakeDoubleAccessor (&CCNxShotNoisePopularity::m_volumeShape),
+                   MakeDoubleChecker<double> (1e-9))
+    .AddAttribute ("InitialContents",
+                   "Contents alive when the first request is made",
+                   UintegerValue (60),
+                   MakeUintegerAccessor (&CCNxShotNoisePopularity::m_initialContents),
+                   MakeUintegerChecker<uint32_t> ());
+  return tid;
+}
+
+CCNxShotNoisePopularity::CCNxShotNoisePopularity ()
+  : m_arrivalRate (1.0), m_meanLifetime (Seconds (60)), m_volumeShape (1.5), m_initialContents (60),
+  m_started (false), m_nextChunk (0), m_alive (0), m_totalWeight (0.0)
+{
+  m_uniform = CreateObject<UniformRandomVariable> ();
+}
+
+CCNxShotNoisePopularity::~CCNxShotNoisePopularity ()
+{
+  // empty
+}
+
+double
+CCNxShotNoisePopularity::Exponential (double mean)
+{
+  // 1 - U is in (0, 1], so the log is finite
+  return -mean * std::log (1.0 - m_uniform->GetValue ());
+}
+
+void
+CCNxShotNoisePopularity::TreeAdd (uint32_t slot, double delta)
+{
+  for (uint32_t i = slot + 1; i <= m_tree.size (); i += i & (~i + 1))
+    {
+      m_tree[i - 1] += delta;
+    }
+}
+
+uint32_t
+CCNxShotNoisePopularity::TreeFind (double target) const
+{
+  // Descend to the first slot whose prefix sum exceeds target
+  uint32_t position = 0;
+  uint32_t step = 1;
+  while (step * 2 <= m_tree.size ())
+    {
+      step *= 2;
+    }
+  for (; step > 0; step /= 2)
+    {
+      if (position + step <= m_tree.size () && m_tree[position + step - 1] <= target)
+        {
+          position += step;
+          target -= m_tree[position - 1];
+        }
+    }
+  return position;
+}
+
+void
+CCNxShotNoisePopularity::Birth (Time birth, Time now, uint32_t catalogSize)
+{
+  Time death = birth + Seconds (Exponential (m_meanLifetime.GetSeconds ()));
+  uint32_t chunk = m_nextChunk;
+  m_nextChunk = (m_nextChunk + 1) % catalogSize;
+  if (death <= now && birth < now)
+    {
+      // Born and gone between two requests
+      return;
+    }
+
+  // Pareto volume with scale 1, spread over the lifetime
+  double volume = std::pow (1.0 - m_uniform->GetValue (), -1.0 / m_volumeShape);
+  double weight = volume / std::max ((death - birth).GetSeconds (), 1e-9);
+
+  uint32_t slot;
+  if (!m_freeSlots.empty ())
+    {
+      slot = m_freeSlots.back ();
+      m_freeSlots.pop_back ();
+    }
+  else
+    {
+      slot = m_chunks.size ();
+      m_chunks.push_back (0);
+      m_weights.push_back (0.0);
+      if (m_weights.size () > m_tree.size ())
+        {
+          // Double the tree and rebuild it from the weights
+          m_tree.assign (std::max ((size_t) 16, 2 * m_tree.size ()), 0.0);
+          for (uint32_t i = 0; i < m_weights.size (); ++i)
+            {
+              TreeAdd (i, m_weights[i]);
+            }
+        }
+    }
+
+  m_chunks[slot] = chunk;
+  m_weights[slot] = weight;
+  TreeAdd (slot, weight);
+  m_totalWeight += weight;
+  m_alive++;
+  m_deaths.push (std::make_pair (death, slot));
+}
+
+void
+CCNxShotNoisePopularity::Advance (Time now, uint32_t catalogSize)
+{
+  if (!m_started)
+    {
+      m_started = true;
+      for (uint32_t i = 0; i < m_initialContents; ++i)
+        {
+          Birth (now, now, catalogSize);
+        }
+      if (m_arrivalRate > 0.0)
+        {
+          m_nextBirth = now + Seconds (Exponential (1.0 / m_arrivalRate));
+        }
+    }
+
+  while (m_arrivalRate > 0.0 && m_nextBirth <= now)
+    {
+      Birth (m_nextBirth, now, catalogSize);
+      m_nextBirth += Seconds (Exponential (1.0 / m_arrivalRate));
+    }
+
+  while (!m_deaths.empty () && m_deaths.top ().first <= now)
+    {
+      uint32_t slot = m_deaths.top ().second;
+      m_deaths.pop ();
+      TreeAdd (slot, -m_weights[slot]);
+      m_totalWeight -= m_weights[slot];
+      m_weights[slot] = 0.0;
+      m_freeSlots.push_back (slot);
+      m_alive--;
+    }
+
+  if (m_alive == 0)
+    {
+      // Clear accumulated rounding so an empty tree sums to exactly zero
+      m_tree.assign (m_tree.size (), 0.0);
+      m_totalWeight = 0.0;
+    }
+}
+
+Ptr<const CCNxName>
+CCNxShotNoisePopularity::GetNextName (Ptr<CCNxContentRepository> repository)
+{
+  NS_LOG_FUNCTION (this << repository);
+  uint32_t catalogSize = repository->GetContentObjectCount ();
+  Time now = Simulator::Now ();
+  Advance (now, catalogSize);
+
+  if (m_alive == 0)
+    {
+      // Nothing is popular right now; a request still has to go somewhere, so start a new content.
+      // A content born now is alive for this request even if its lifetime rounds to zero.
+      Birth (now, now, catalogSize);
+    }
+  NS_ASSERT_MSG (m_alive > 0, "No content alive after a birth");
+
+  uint32_t slot = TreeFind (m_uniform->GetValue () * m_totalWeight);
+  if (slot >= m_weights.size () || m_weights[slot] == 0.0)
+    {
+      // Rounding walked past the last live slot; take the live content that dies soonest instead
+      slot = m_deaths.top ().second;
+    }
+  return repository->GetName (m_chunks[slot]);
+}
+
+uint32_t
+CCNxShotNoisePopularity::GetAliveCount (void) const
+{
+  return m_alive;
+}
@@ -0,0 +1,134 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_SHOT_NOISE_POPULARITY_H_
+#define CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_SHOT_NOISE_POPULARITY_H_
+
+#include <vector>
+#include <queue>
+#include <functional>
+
+#include "ns3/nstime.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/ccnx-popularity-model.h"
+
+namespace ns3 {
+namespace ccnx {
+/**
+ * @ingroup ccnx-apps
+ *
+ * Shot-noise request model (S. Traverso et al., "Temporal locality in today's content caching",
+ * 2013).  Contents are born as a Poisson process of rate ArrivalRate and live for an exponential
+ * time with mean MeanLifetime.  While it is alive, a content draws requests at a constant rate
+ * of volume / lifetime, where the volume is Pareto with shape VolumeShape.  Requests are
+ * therefore concentrated on the contents that are alive now, and the popular set churns over time.
+ *
+ * Each new content takes the next chunk of the repository in turn, wrapping around at the end.
+ * The model starts with InitialContents contents alive; with an ArrivalRate of 0 no other
+ * contents are born, except that a request made when nothing is alive starts a new content.  It advances lazily to Simulator::Now ()
+ * on each request.  The alive contents are kept in a Fenwick tree of request rates, so each
+ * request and each birth or death costs O(log alive).
+ */
+class CCNxShotNoisePopularity : public CCNxPopularityModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxShotNoisePopularity ();
+  virtual ~CCNxShotNoisePopularity ();
+
+  virtual Ptr<const CCNxName> GetNextName (Ptr<CCNxContentRepository> repository);
+
+  /**
+   * The number of contents alive at the last request.
+   */
+  uint32_t GetAliveCount (void) const;
+
+private:
+  void Advance (Time now, uint32_t catalogSize);
+  void Birth (Time birth, Time now, uint32_t catalogSize);
+  double Exponential (double mean);
+
+  /**
+   * Fenwick tree over m_weights, grown by doubling.
+   */
+  void TreeAdd (uint32_t slot, double delta);
+  uint32_t TreeFind (double target) const;
+
+  double m_arrivalRate;
+  Time m_meanLifetime;
+  double m_volumeShape;
+  uint32_t m_initialContents;
+
+  Ptr<UniformRandomVariable> m_uniform;
+  bool m_started;
+  Time m_nextBirth;
+  uint32_t m_nextChunk;
+
+  std::vector<uint32_t> m_chunks;
+  std::vector<double> m_weights;
+  std::vector<double> m_tree;
+  std::vector<uint32_t> m_freeSlots;
+  uint32_t m_alive;
+  double m_totalWeight;
+
+  typedef std::pair<Time, uint32_t> DeathType;
+  std::priority_queue<DeathType, std::vector<DeathType>, std::greater<DeathType> > m_deaths;
+};
+
+}
+}
+
+#endif /* CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_SHOT_NOISE_POPULARITY_H_ */
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cstdlib>
+
+#include "ns3/log.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/ccnx-trace-popularity.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxTracePopularity");
+NS_OBJECT_ENSURE_REGISTERED (CCNxTracePopularity);
+
+TypeId
+CCNxTracePopularity::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxTracePopularity")
+    .SetParent<CCNxPopularityModel> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxTracePopularity> ()
+    .AddAttribute ("TraceFile",
+                   "Path of the request trace, one name or chunk number per line",
+                   StringValue (""),
+                   MakeStringAccessor (&CCNxTracePopularity::m_traceFile),
+                   MakeStringChecker ())
+    .AddAttribute ("Loop",
+                   "Start the trace again when it ends",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&CCNxTracePopularity::m_loop),
+                   MakeBooleanChecker ());
+  return tid;
+}
+
+CCNxTracePopularity::CCNxTracePopularity ()
+  : m_loop (true), m_requestCount (0), m_passRequestCount (0)
+{
+  // empty
+}
+
+CCNxTracePopularity::~CCNxTracePopularity ()
+{
+  // empty
+}
+
+void
+CCNxTracePopularity::DoDispose (void)
+{
+  if (m_trace.is_open ())
+    {
+      m_trace.close ();
+    }
+  CCNxPopularityModel::DoDispose ();
+}
+
+bool
+CCNxTracePopularity::ReadRequestLine (std::string &line)
+{
+  if (!m_trace.is_open ())
+    {
+      m_trace.open (m_traceFile.c_str ());
+      if (!m_trace.is_open ())
+        {
+          NS_LOG_ERROR ("Could not open trace file '" << m_traceFile << "'");
+          return false;
+        }
+    }
+
+  while (true)
+    {
+      if (std::getline (m_trace, line))
+        {
+          size_t start = line.find_first_not_of (" \t\r");
+          if (start == std::string::npos || line[start] == '#')
+            {
+              continue;
+            }
+          size_t end = line.find_last_not_of (" \t\r");
+          line = line.substr (start, end - start + 1);
+          return true;
+        }
+
+      // End of file: rewind only if this pass produced something, or an empty trace would spin
+      if (!m_loop || m_passRequestCount == 0)
+        {
+          return false;
+        }
+      NS_LOG_INFO ("Trace file '" << m_traceFile << "' ended after " << m_passRequestCount << " requests, looping");
+      m_passRequestCount = 0;
+      m_trace.clear ();
+      m_trace.seekg (0, std::ios::beg);
+    }
+}
+
+Ptr<const CCNxName>
+CCNxTracePopularity::GetNextName (Ptr<CCNxContentRepository> repository)
+{
+  NS_LOG_FUNCTION (this << repository);
+  std::string line;
+  while (ReadRequestLine (line))
+    {
+      if (line.compare (0, 5, "ccnx:") == 0)
+        {
+          m_requestCount++;
+          m_passRequestCount++;
+          return Create<CCNxName> (line);
+        }
+
+      char *end;
+      unsigned long long chunk = std::strtoull (line.c_str (), &end, 10);
+      if (*end == '\0' && end != line.c_str ())
+        {
+          m_requestCount++;
+          m_passRequestCount++;
+          return repository->GetName (chunk % repository->GetContentObjectCount ());
+        }
+      NS_LOG_ERROR ("Skipping unparseable trace line '" << line << "'");
+    }
+  return Ptr<const CCNxName> (0);
+}
+
+uint64_t
+CCNxTracePopularity::GetRequestCount (void) const
+{
+  return m_requestCount;
+}
@@ -0,0 +1,114 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_TRACE_POPULARITY_H_
+#define CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_TRACE_POPULARITY_H_
+
+#include <string>
+#include <fstream>
+
+#include "ns3/ccnx-popularity-model.h"
+
+namespace ns3 {
+namespace ccnx {
+/**
+ * @ingroup ccnx-apps
+ *
+ * Replays the requests in TraceFile, one per line, in order.  A line is either a CCNx URI
+ * (ccnx:/name=...), which is requested as is, or a decimal chunk number, which is requested
+ * as CCNxContentRepository::GetName (number % catalog size).  Blank lines and lines starting
+ * with '#' are skipped.
+ *
+ * The file is read one line per request through an open stream, so the memory used does not
+ * depend on the trace length and multi-GB traces replay fine.  At the end of the file the
+ * trace starts again if Loop is true; otherwise GetNextName returns null and the consumer stops.
+ */
+class CCNxTracePopularity : public CCNxPopularityModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxTracePopularity ();
+  virtual ~CCNxTracePopularity ();
+
+  virtual Ptr<const CCNxName> GetNextName (Ptr<CCNxContentRepository> repository);
+
+  /**
+   * The number of requests replayed so far.
+   */
+  uint64_t GetRequestCount (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Read the next request line into `line`, rewinding at the end if Loop is set.
+   * Returns false when the trace is exhausted.
+   */
+  bool ReadRequestLine (std::string &line);
+
+  std::string m_traceFile;
+  bool m_loop;
+
+  std::ifstream m_trace;
+  uint64_t m_requestCount;
+  uint64_t m_passRequestCount;
+};
+
+}
+}
+
+#endif /* CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_TRACE_POPULARITY_H_ */
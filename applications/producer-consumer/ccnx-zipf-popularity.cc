@@ -0,0 +1,191 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+
+#include "ns3/log.h"
+#include "ns3/double.h"
+#include "ns3/ccnx-zipf-popularity.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxZipfPopularity");
+NS_OBJECT_ENSURE_REGISTERED (CCNxZipfPopularity);
+
+TypeId
+CCNxZipfPopularity::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxZipfPopularity")
+    .SetParent<CCNxPopularityModel> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxZipfPopularity> ()
+    .AddAttribute ("Alpha",
+                   "The Zipf exponent; larger values concentrate requests on the first chunks",
+                   DoubleValue (0.8),
+                   MakeDoubleAccessor (&CCNxZipfPopularity::m_alpha),
+                   MakeDoubleChecker<double> (0.0));
+  return tid;
+}
+
+CCNxZipfPopularity::CCNxZipfPopularity ()
+  : m_alpha (0.8), m_count (0), m_setupAlpha (0.0), m_hIntegralX1 (0.0), m_hIntegralCount (0.0), m_s (0.0)
+{
+  m_uniform = CreateObject<UniformRandomVariable> ();
+}
+
+CCNxZipfPopularity::~CCNxZipfPopularity ()
+{
+  // empty
+}
+
+/*
+ * log1p(x)/x and expm1(x)/x, with their Taylor series near 0 where the quotient loses precision.
+ */
+static double
+Helper1 (double x)
+{
+  if (std::fabs (x) > 1e-8)
+    {
+      return std::log1p (x) / x;
+    }
+  return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+}
+
+static double
+Helper2 (double x)
+{
+  if (std::fabs (x) > 1e-8)
+    {
+      return std::expm1 (x) / x;
+    }
+  return 1.0 + x * 0.5 * (1.0 + x * 1.0 / 3.0 * (1.0 + 0.25 * x));
+}
+
+double
+CCNxZipfPopularity::H (double x) const
+{
+  return std::exp (-m_alpha * std::log (x));
+}
+
+double
+CCNxZipfPopularity::HIntegral (double x) const
+{
+  double logX = std::log (x);
+  return Helper2 ((1.0 - m_alpha) * logX) * logX;
+}
+
+double
+CCNxZipfPopularity::HIntegralInverse (double x) const
+{
+  double t = x * (1.0 - m_alpha);
+  if (t < -1.0)
+    {
+      // Limit t to the domain of log1p; only reachable through rounding
+      t = -1.0;
+    }
+  return std::exp (Helper1 (t) * x);
+}
+
+void
+CCNxZipfPopularity::Setup (uint64_t count)
+{
+  NS_LOG_FUNCTION (this << count << m_alpha);
+  NS_ASSERT_MSG (count > 0, "Zipf needs at least one item");
+  NS_ASSERT_MSG (m_alpha > 0.0, "Zipf Alpha must be positive");
+  m_count = count;
+  m_setupAlpha = m_alpha;
+  m_hIntegralX1 = HIntegral (1.5) - 1.0;
+  m_hIntegralCount = HIntegral (count + 0.5);
+  m_s = 2.0 - HIntegralInverse (HIntegral (2.5) - H (2.0));
+}
+
+uint64_t
+CCNxZipfPopularity::SampleRank (uint64_t count)
+{
+  if (count != m_count || m_alpha != m_setupAlpha)
+    {
+      Setup (count);
+    }
+
+  while (true)
+    {
+      double u = m_hIntegralCount + m_uniform->GetValue () * (m_hIntegralX1 - m_hIntegralCount);
+      double x = HIntegralInverse (u);
+      double k = std::floor (x + 0.5);
+      if (k < 1.0)
+        {
+          k = 1.0;
+        }
+      else if (k > count)
+        {
+          k = count;
+        }
+
+      // Accept if k is in the region where the hat and the distribution agree, otherwise test u
+      if (k - x <= m_s || u >= HIntegral (k + 0.5) - H (k))
+        {
+          return (uint64_t) k;
+        }
+    }
+}
+
+Ptr<const CCNxName>
+CCNxZipfPopularity::GetNextName (Ptr<CCNxContentRepository> repository)
+{
+  NS_LOG_FUNCTION (this << repository);
+  uint64_t rank = SampleRank (repository->GetContentObjectCount ());
+  return repository->GetName (rank - 1);
+}
@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_ZIPF_POPULARITY_H_
+#define CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_ZIPF_POPULARITY_H_
+
+#include "ns3/random-variable-stream.h"
+#include "ns3/ccnx-popularity-model.h"
+
+namespace ns3 {
+namespace ccnx {
+/**
+ * @ingroup ccnx-apps
+ *
+ * Chunk i of the repository (rank i + 1) is requested with probability proportional to
+ * 1 / (i + 1)^Alpha.
+ *
+ * Sampling uses rejection-inversion (W. Hormann and G. Derflinger, "Rejection-inversion to
+ * generate variates from monotone discrete distributions", 1996): expected O(1) time per sample,
+ * with fewer than two uniform draws on average, and O(1) memory whatever the catalog size.
+ * So it works with a lazy 10M-chunk CCNxContentRepository, where an alias table or CDF would not.
+ */
+class CCNxZipfPopularity : public CCNxPopularityModel
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxZipfPopularity ();
+  virtual ~CCNxZipfPopularity ();
+
+  virtual Ptr<const CCNxName> GetNextName (Ptr<CCNxContentRepository> repository);
+
+  /**
+   * Draw a rank in [1, count] from Zipf(Alpha) over `count` items.
+   */
+  uint64_t SampleRank (uint64_t count);
+
+private:
+  void Setup (uint64_t count);
+  double H (double x) const;
+  double HIntegral (double x) const;
+  double HIntegralInverse (double x) const;
+
+  double m_alpha;
+  Ptr<UniformRandomVariable> m_uniform;
+
+  /**
+   * Constants of the sampler for m_count items and m_setupAlpha; recomputed when either changes.
+   */
+  uint64_t m_count;
+  double m_setupAlpha;
+  double m_hIntegralX1;
+  double m_hIntegralCount;
+  double m_s;
+};
+
+}
+}
+
+#endif /* CCNS3SIM_APPLICATIONS_PRODUCER_CONSUMER_CCNX_ZIPF_POPULARITY_H_ */
@@ -0,0 +1,184 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+// Network topology: a `side` x `side` grid of point-to-point links (70 x 70 = 4900 nodes by default).
+//
+//   n0 ---- n1 ---- n2 ...
+//   |       |       |
+//   n70 --- n71 --- n72 ...
+//   |       |       |
+//   ...
+//
+// This example shows global routing on a large topology.  The sink on n0 registers
+// ccnx:/name=foo/name=sink, CCNxGlobalRoutingHelper::PopulateRoutingTables() computes and
+// installs every node's routes before the simulation starts, and the source in the far corner
+// sends Interests from time 0.5s, with no routing protocol to wait for.  We print the
+// wall-clock time of the route computation.
+//
+// ./waf --run "ccnx-global-routing-grid --side=70 --threads=4"
+
+
+#include <iostream>
+#include <string>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccns3Sim-module.h"
+#include "ns3/system-wall-clock-ms.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("ccnx-global-routing-grid");
+
+static const char * sinkNameString = "ccnx:/name=foo/name=sink";
+
+static void
+GenerateTraffic (Ptr<CCNxPortal> source, uint32_t count, Ptr<CCNxName> name)
+{
+  std::cout << "Client Send    at=" << Simulator::Now ().GetSeconds () << "s" << std::endl;
+  source->Send (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name)));
+  if (count > 1)
+    {
+      Simulator::Schedule (Seconds (0.5), &GenerateTraffic, source, count - 1, name);
+    }
+  else
+    {
+      source->Close ();
+    }
+}
+
+static void
+PortalPrinter (Ptr<CCNxPortal> portal)
+{
+  Ptr<CCNxPacket> packet;
+  while ((packet = portal->Recv ()))
+    {
+      std::cout << "Sink Receive   at=" << Simulator::Now ().GetSeconds () << "s, name=" << *packet->GetMessage ()->GetName () << std::endl;
+    }
+}
+
+static void
+RunSimulation (uint32_t side, uint32_t threads)
+{
+  Time::SetResolution (Time::NS);
+
+  NodeContainer nodes;
+  nodes.Create (side * side);
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", DataRateValue (DataRate (5000000)));
+  p2p.SetChannelAttribute ("Delay", TimeValue (MilliSeconds (2)));
+
+  NetDeviceContainer devices;
+  for (uint32_t row = 0; row < side; row++)
+    {
+      for (uint32_t col = 0; col < side; col++)
+        {
+          uint32_t node = row * side + col;
+          if (col + 1 < side)
+            {
+              devices.Add (p2p.Install (nodes.Get (node), nodes.Get (node + 1)));
+            }
+          if (row + 1 < side)
+            {
+              devices.Add (p2p.Install (nodes.Get (node), nodes.Get (node + side)));
+            }
+        }
+    }
+
+  CCNxGlobalRoutingHelper globalHelper;
+  CCNxStackHelper ccnxStack;
+  ccnxStack.SetRoutingHelper (globalHelper);
+  ccnxStack.Install (nodes);
+  ccnxStack.AddInterfaces (devices);
+
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory");
+  Ptr<CCNxName> sinkName = Create<CCNxName> (sinkNameString);
+
+  Ptr<CCNxPortal> sink = CCNxPortal::CreatePortal (nodes.Get (0), tid);
+  sink->SetRecvCallback (MakeCallback (&PortalPrinter));
+  sink->RegisterAnchor (sinkName);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  CCNxGlobalRoutingHelper::PopulateRoutingTables (threads);
+  int64_t elapsed = clock.End ();
+  std::cout << "nodes " << nodes.GetN () << " links " << devices.GetN () / 2 << " threads " << threads
+            << " route computation wallClock " << elapsed << " ms" << std::endl;
+
+  Ptr<CCNxPortal> source = CCNxPortal::CreatePortal (nodes.Get (side * side - 1), tid);
+  Simulator::Schedule (Seconds (0.5), &GenerateTraffic, source, 5, sinkName);
+
+  Simulator::Stop (Seconds (5));
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t side = 70;
+  uint32_t threads = 4;
+  CommandLine cmd;
+  cmd.AddValue ("side", "Number of nodes on each side of the grid", side);
+  cmd.AddValue ("threads", "Number of threads for the route computation", threads);
+  cmd.Parse (argc, argv);
+
+  RunSimulation (side, threads);
+  return 0;
+}
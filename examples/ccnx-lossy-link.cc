@@ -72,7 +72,7 @@ using namespace ns3::ccnx;
 #define DEBUG_TRACE 0
 
 void
-RunSimulation (std::string uri, uint32_t nSize, uint32_t nCount, double nSecsToRun)
+RunSimulation (std::string uri, uint32_t nSize, uint32_t nCount, double nSecsToRun, bool windowMode, double lossRate)
 {
   LogComponentEnable ("CCNxStandardPit", (LogLevel) (LOG_LEVEL_DEBUG | LOG_PREFIX_ALL));
   LogComponentEnable ("CCNxStandardPitEntry", (LogLevel) (LOG_LEVEL_DEBUG | LOG_PREFIX_ALL));
@@ -113,6 +113,15 @@ RunSimulation (std::string uri, uint32_t nSize, uint32_t nCount, double nSecsToR
   pppDevices.Add(p2pLossyLink.Install(lossyNode));
   pppDevices.Add(p2pLosslessLink.Install(losslessNode));
 
+  /*
+   * Drop packets in both directions of the lossy link so the consumer has to retransmit.
+   */
+  Ptr<RateErrorModel> lossModel = CreateObject<RateErrorModel> ();
+  lossModel->SetAttribute ("ErrorRate", DoubleValue (lossRate));
+  lossModel->SetAttribute ("ErrorUnit", StringValue ("ERROR_UNIT_PACKET"));
+  pppDevices.Get (0)->SetAttribute ("ReceiveErrorModel", PointerValue (lossModel));
+  pppDevices.Get (1)->SetAttribute ("ReceiveErrorModel", PointerValue (lossModel));
+
 
   /*
    * Setup a Forwarder and associate it with the nodes created.
@@ -153,6 +162,7 @@ RunSimulation (std::string uri, uint32_t nSize, uint32_t nCount, double nSecsToR
 
   CCNxConsumerHelper consumerHelper (globalContentRepository);
   consumerHelper.SetAttribute ("RequestInterval", TimeValue (MilliSeconds (5)));
+  consumerHelper.SetAttribute ("WindowMode", BooleanValue (windowMode));
   ApplicationContainer consumerApps = consumerHelper.Install (nodes.Get(2));
   consumerApps.Start (Seconds (1.0));
 
@@ -164,6 +174,8 @@ RunSimulation (std::string uri, uint32_t nSize, uint32_t nCount, double nSecsToR
 
   Simulator::Run ();
 
+  std::cout << "Consumer latency " << *CCNxConsumerHelper::MergeLatencyHistograms (nodes) << std::endl;
+
   Ptr<OutputStreamWrapper> trace = Create<OutputStreamWrapper> (&std::cout);
   standardHelper.PrintForwardingStatistics(trace, nodes.Get(0));
   standardHelper.PrintForwardingStatistics(trace, nodes.Get(1));
@@ -181,6 +193,8 @@ main (int argc, char *argv[])
   uint32_t nSize = 124;
   uint32_t nChunks = 1000;
   double nSecsToRun = 10.0;
+  bool windowMode = false;
+  double lossRate = 0.01;
   std::string repoPrefix = "ccnx:/name=ccnx/name=link/name=loss";
 
    CommandLine cmd;
@@ -188,8 +202,10 @@ main (int argc, char *argv[])
    cmd.AddValue ("nChunks", "Number of Chunks that the producer will provide", nChunks);
    cmd.AddValue ("repoPrefix", "uri://<string> representing the repository", repoPrefix);
    cmd.AddValue ("nSecsToRun", "Number of seconds to simulate", nSecsToRun);
+   cmd.AddValue ("lossRate", "Packet loss probability on the lossy link", lossRate);
+   cmd.AddValue ("windowMode", "Consumer keeps an AIMD window of sequential Interests in flight", windowMode);
    cmd.Parse (argc, argv);
 
-  RunSimulation (repoPrefix,nSize,nChunks,nSecsToRun);
+  RunSimulation (repoPrefix,nSize,nChunks,nSecsToRun,windowMode,lossRate);
   return 0;
 }
@@ -0,0 +1,188 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+
+// Network topology (same as ccnx-6node-topo)
+//
+//  n0                                  n4
+//     \ 5 Mb/s, 2ms                   /
+//      \          1.5Mb/s, 10ms      /
+//       n2 -------------------------n3
+//      /                             \
+//     / 5 Mb/s, 2ms                    \
+//   n1                                   n5
+//
+
+// This example is a benchmark for NFP routing with a large number of prefixes.
+// Nodes n0 and n1 are both anchors for the same `nPrefixes` prefixes (100,000 by default),
+// so every node learns two anchors for each prefix.  There is no application traffic,
+// only routing.  At the end we print the simulation wall-clock time, the convergence-time
+// distribution of the prefix additions and, for each node, the NFP statistics, computation cost
+// and the wall-clock time spent in the NFP handlers.
+//
+// ./waf --run "ccnx-nfp-prefix-scale --nPrefixes=100000"
+
+
+#include <iostream>
+#include <string>
+
+#include "ns3/core-module.h"
+#include "ns3/network-module.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccns3Sim-module.h"
+#include "ns3/system-wall-clock-ms.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("ccnx-nfp-prefix-scale");
+
+static void
+AddAnchorPrefixes (Ptr<Node> node, uint32_t nPrefixes)
+{
+  Ptr<CCNxRoutingProtocol> routing = node->GetObject<CCNxL3Protocol> ()->GetRoutingProtocol ();
+
+  const std::string pre = "ccnx:/name=6nodetopo/name=producer/";
+  char fix[64];
+  for (uint32_t ii = 0; ii < nPrefixes; ii++)
+    {
+      snprintf (fix, sizeof(fix), "name=prefix%u", ii);
+      routing->AddAnchorPrefix (Create<CCNxName> (pre + fix));
+    }
+}
+
+static void
+RunSimulation (uint32_t nPrefixes, Time simTime)
+{
+  NS_LOG_INFO ("Number of Prefixes to simulate are = " << nPrefixes );
+  Time::SetResolution (Time::NS);
+  NodeContainer nodes;
+  nodes.Create (6);
+
+  NodeContainer n0n2 = NodeContainer (nodes.Get (0), nodes.Get (2));
+  NodeContainer n1n2 = NodeContainer (nodes.Get (1), nodes.Get (2));
+  NodeContainer n3n2 = NodeContainer (nodes.Get (3), nodes.Get (2));
+  NodeContainer n4n3 = NodeContainer (nodes.Get (4), nodes.Get (3));
+  NodeContainer n5n3 = NodeContainer (nodes.Get (5), nodes.Get (3));
+
+  PointToPointHelper p2p;
+  p2p.SetDeviceAttribute ("DataRate", DataRateValue (DataRate (5000000)));
+  p2p.SetChannelAttribute ("Delay", TimeValue (MilliSeconds (2)));
+  NetDeviceContainer d0d2 = p2p.Install (n0n2);
+  NetDeviceContainer d1d2 = p2p.Install (n1n2);
+  NetDeviceContainer d4d3 = p2p.Install (n4n3);
+  NetDeviceContainer d5d3 = p2p.Install (n5n3);
+
+  p2p.SetDeviceAttribute ("DataRate", DataRateValue (DataRate (1500000)));
+  p2p.SetChannelAttribute ("Delay", TimeValue (MilliSeconds (10)));
+  NetDeviceContainer d3d2 = p2p.Install (n3n2);
+
+  CCNxStackHelper ccnxStack;
+  CCNxStandardForwarderHelper standardHelper;
+  ccnxStack.SetForwardingHelper (standardHelper);
+
+  // Flooding 100k prefixes over the 1.5 Mbps link takes tens of seconds, so
+  // use a route timeout well beyond that.
+  Ptr<NfpConvergenceObserver> observer = CreateObject<NfpConvergenceObserver> ();
+  NfpRoutingHelper nfpHelper;
+  nfpHelper.Set ("HelloInterval", TimeValue (Seconds (5)));
+  nfpHelper.Set ("RouteTimeout", TimeValue (Seconds (120)));
+  nfpHelper.Set ("ConvergenceObserver", PointerValue (observer));
+  nfpHelper.Set ("EnableProfiling", BooleanValue (true));
+  ccnxStack.SetRoutingHelper (nfpHelper);
+
+  ccnxStack.Install (nodes);
+  ccnxStack.AddInterfaces (d0d2);
+  ccnxStack.AddInterfaces (d1d2);
+  ccnxStack.AddInterfaces (d3d2);
+  ccnxStack.AddInterfaces (d4d3);
+  ccnxStack.AddInterfaces (d5d3);
+
+  Simulator::Schedule (Seconds (1.0), &AddAnchorPrefixes, nodes.Get (0), nPrefixes);
+  Simulator::Schedule (Seconds (1.0), &AddAnchorPrefixes, nodes.Get (1), nPrefixes);
+
+  Simulator::Stop (simTime);
+
+  SystemWallClockMs clock;
+  clock.Start ();
+  Simulator::Run ();
+  int64_t elapsed = clock.End ();
+
+  std::cout << "nPrefixes " << nPrefixes << " simTime " << simTime.GetSeconds ()
+            << " s wallClock " << elapsed << " ms" << std::endl;
+  observer->Print (std::cout);
+  for (uint32_t i = 0; i < nodes.GetN (); i++)
+    {
+      std::cout << NfpRoutingHelper::GetStats (nodes.Get (i));
+      std::cout << "Node " << i << " " << NfpRoutingHelper::GetComputationCost (nodes.Get (i)) << std::endl;
+      std::cout << "Node " << i << " " << NfpRoutingHelper::GetWallClockProfile (nodes.Get (i)) << std::endl;
+    }
+
+  Simulator::Destroy ();
+}
+
+int
+main (int argc, char *argv[])
+{
+  uint32_t nPrefixes = 100000;
+  double simTime = 100.0;
+  CommandLine cmd;
+  cmd.AddValue ("nPrefixes", "Number of Prefixes to simulate", nPrefixes);
+  cmd.AddValue ("simTime", "Simulation time in seconds", simTime);
+  cmd.Parse (argc, argv);
+
+  RunSimulation (nPrefixes, Seconds (simTime));
+  return 0;
+}
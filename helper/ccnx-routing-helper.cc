@@ -56,6 +56,8 @@
 #include "ccnx-routing-helper.h"
 #include "ns3/node-list.h"
 #include "ns3/simulator.h"
+#include "ns3/channel.h"
+#include "ns3/ccnx-l3-protocol.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -65,6 +67,60 @@ CCNxRoutingHelper::~CCNxRoutingHelper ()
   // empty
 }
 
+Ptr<CCNxL3Interface>
+CCNxRoutingHelper::GetUpInterface (Ptr<NetDevice> device)
+{
+  Ptr<CCNxL3Protocol> ccnx = device->GetNode ()->GetObject<CCNxL3Protocol> ();
+  if (ccnx)
+    {
+      Ptr<CCNxL3Interface> iface = ccnx->GetInterface (device->GetIfIndex ());
+      if (iface && iface->IsUp ())
+        {
+          return iface;
+        }
+    }
+  return 0;
+}
+
+std::vector< Ptr<NetDevice> >
+CCNxRoutingHelper::GetUpPeers (Ptr<NetDevice> device)
+{
+  std::vector< Ptr<NetDevice> > peers;
+  Ptr<Channel> channel = device->GetChannel ();
+  if (!channel || !GetUpInterface (device))
+    {
+      return peers;
+    }
+
+  for (uint32_t k = 0; k < channel->GetNDevices (); k++)
+    {
+      Ptr<NetDevice> peer = channel->GetDevice (k);
+      if (peer != device && GetUpInterface (peer))
+        {
+          peers.push_back (peer);
+        }
+    }
+  return peers;
+}
+
+Ptr<CCNxConnection>
+CCNxRoutingHelper::ConnectNeighbor (Ptr<Node> node, uint32_t neighborId)
+{
+  for (uint32_t d = 0; d < node->GetNDevices (); d++)
+    {
+      Ptr<NetDevice> device = node->GetDevice (d);
+      std::vector< Ptr<NetDevice> > peers = GetUpPeers (device);
+      for (size_t k = 0; k < peers.size (); k++)
+        {
+          if (peers[k]->GetNode ()->GetId () == neighborId)
+            {
+              return node->GetObject<CCNxL3Protocol> ()->GetNeighbor (peers[k]->GetAddress (), device);
+            }
+        }
+    }
+  return 0;
+}
+
 
 void
 CCNxRoutingHelper::PrintRoutingTableAllNodesWithDelay (Time printDelay, Ptr<OutputStreamWrapper> stream)
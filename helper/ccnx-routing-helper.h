@@ -56,11 +56,16 @@
 #ifndef CCNS3_CCNXROUTINGHELPER_H
 #define CCNS3_CCNXROUTINGHELPER_H
 
+#include <vector>
+
 #include "ns3/ptr.h"
 #include "ns3/node.h"
+#include "ns3/net-device.h"
 #include "ns3/nstime.h"
 #include "ns3/output-stream-wrapper.h"
 #include "ns3/ccnx-routing-protocol.h"
+#include "ns3/ccnx-l3-interface.h"
+#include "ns3/ccnx-connection.h"
 
 namespace ns3 {
 
@@ -311,8 +316,28 @@ public:
    */
   static void PrintNeighborTableWithInterval (Time printInterval, Ptr<OutputStreamWrapper> stream, Ptr<Node> node);
 
+protected:
+  // ===== Neighbor lookup for the helpers that install routes themselves
 
+  /**
+   * The CCNx interface of `device` if it has one and it is up, otherwise null
+   */
+  static Ptr<CCNxL3Interface> GetUpInterface (Ptr<NetDevice> device);
 
+  /**
+   * The other devices on the channel of `device` that have a CCNx interface up.  Empty if
+   * `device` has no channel or no CCNx interface up.
+   */
+  static std::vector< Ptr<NetDevice> > GetUpPeers (Ptr<NetDevice> device);
+
+  /**
+   * The connection on `node` to the neighbor node `neighborId`, found through GetUpPeers().
+   * It is the connection the node already has to the neighbor if there is one, see
+   * CCNxL3Protocol::GetNeighbor().
+   *
+   * @return The connection, or null if the nodes do not share a channel with CCNx interfaces up
+   */
+  static Ptr<CCNxConnection> ConnectNeighbor (Ptr<Node> node, uint32_t neighborId);
 
 private:
   /**
@@ -54,6 +54,7 @@
  */
 
 #include <ns3/ccnx-message-portalfactory.h>
+#include <ns3/ccnx-transfer-portalfactory.h>
 #include "ns3/log.h"
 #include "ccnx-stack-helper.h"
 #include "ns3/ccnx-forwarder.h"
@@ -173,6 +174,12 @@ CCNxStackHelper::Install (Ptr<Node> node) const
   mpf->SetCCNx (ccnx);
   NS_LOG_DEBUG ("Node " << node << " Installed CCNxMessagePortalFactory " << mpf);
 
+  CreateAndAggregateObjectFromTypeId (node, "ns3::ccnx::CCNxTransferPortalFactory");
+  Ptr<CCNxTransferPortalFactory> tpf = node->GetObject<CCNxTransferPortalFactory> ();
+  NS_ASSERT_MSG (tpf, "Got null CCNxTransferPortalFactory from node " << node);
+  tpf->SetCCNx (ccnx);
+  NS_LOG_DEBUG ("Node " << node << " Installed CCNxTransferPortalFactory " << tpf);
+
   // Install the routing protocol on the node
   if (m_routingHelper)
     {
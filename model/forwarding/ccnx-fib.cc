@@ -84,3 +84,14 @@ CCNxFib::~CCNxFib ()
 {
 
 }
+
+bool
+CCNxFib::AddRoutes (const RouteEntryListType &entries)
+{
+  bool added = false;
+  for (RouteEntryListType::const_iterator i = entries.begin (); i != entries.end (); ++i)
+    {
+      added |= AddRoute ((*i)->GetPrefix (), (*i)->GetConnection (), (*i)->GetCost ());
+    }
+  return added;
+}
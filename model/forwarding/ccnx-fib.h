@@ -64,6 +64,7 @@
 #include "ns3/ccnx-connection.h"
 #include "ns3/ccnx-forwarder.h"
 #include "ns3/ccnx-forwarder-message.h"
+#include "ns3/ccnx-forwarding-strategy.h"
 
 
 namespace ns3 {
@@ -165,6 +166,20 @@ public:
    */
   virtual bool AddRoute (Ptr<const CCNxName> ccnxName, Ptr<CCNxConnection>  connection) = 0;
 
+  /**
+   * AddRoute - add a prefix with a route cost to the Fib.  If the prefix already
+   * has the connection, its cost is updated.
+   *
+   * The cost is used by forwarding strategies that choose between nexthops.
+   * `AddRoute(Ptr<const CCNxName>, Ptr<CCNxConnection>)` adds the route with cost 0.
+   *
+   * @param [in] ccnxName The prefix
+   * @param [in] connection The nexthop
+   * @param [in] cost The route cost via the connection (lower is better)
+   * @return true on success.
+   */
+  virtual bool AddRoute (Ptr<const CCNxName> ccnxName, Ptr<CCNxConnection>  connection, uint32_t cost) = 0;
+
   /**
    * DeleteRoute - delete a route from the Fib. The FibEntry is deleted if empty.
    *
@@ -187,6 +202,23 @@ public:
    */
   virtual bool DeleteRoute (Ptr<const CCNxName> ccnxName, Ptr<CCNxConnection>  connection) = 0;
 
+  /**
+   * A batch of route entries, see `CCNxForwarder::AddRoutes()`.
+   */
+  typedef CCNxForwarder::RouteEntryListType RouteEntryListType;
+
+  /**
+   * AddRoutes - add a batch of route entries to the Fib, as if each was added with
+   * `AddRoute(Ptr<const CCNxName>, Ptr<CCNxConnection>, uint32_t)`.
+   *
+   * The default implementation adds the entries one at a time.  A Fib may override it
+   * to insert a large table more efficiently.
+   *
+   * @param [in] entries The route entries to add, in any order
+   * @return true if one or more entries were added.
+   */
+  virtual bool AddRoutes (const RouteEntryListType &entries);
+
   /**
    * PrintRoute(s) - print one or more Fib entries.
    *
@@ -204,6 +236,34 @@ public:
 
   virtual int CountEntries () = 0;
 
+  /**
+   * Use `strategy` for all Interests whose longest matching strategy prefix is `prefix`.
+   *
+   * The strategy table is independent of the routes, so a strategy may be set before
+   * the routes for the prefix exist and it survives the routes being deleted.
+   * Interests that match no strategy prefix use the FIB's default strategy.
+   *
+   * @param [in] prefix The name prefix
+   * @param [in] strategy The forwarding strategy (replaces any existing one for the prefix)
+   */
+  virtual void SetStrategy (Ptr<const CCNxName> prefix, Ptr<CCNxForwardingStrategy> strategy) = 0;
+
+  /**
+   * Remove the strategy for a prefix set with `SetStrategy()`.
+   *
+   * @param [in] prefix The name prefix
+   * @return true if the prefix had a strategy
+   */
+  virtual bool ClearStrategy (Ptr<const CCNxName> prefix) = 0;
+
+  /**
+   * Returns the strategy used for a name.
+   *
+   * @param [in] name The Interest name
+   * @return The strategy of the longest matching strategy prefix, or the default strategy
+   */
+  virtual Ptr<CCNxForwardingStrategy> GetStrategy (Ptr<const CCNxName> name) const = 0;
+
 
 };          //class
 }    //namespace
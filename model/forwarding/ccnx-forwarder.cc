@@ -100,8 +100,33 @@ CCNxForwarder::SetNode (Ptr<Node> node)
   NS_ASSERT_MSG (m_ccnx != NULL, "Got nul CCNxL3Protcol from node " << node);
 }
 
+bool
+CCNxForwarder::AddRoutes (const RouteEntryListType &entries)
+{
+  bool added = false;
+  for (RouteEntryListType::const_iterator i = entries.begin (); i != entries.end (); ++i)
+    {
+      Ptr<CCNxRoute> route = Create<CCNxRoute> ((*i)->GetPrefix ());
+      route->AddNexthop (*i);
+      added |= AddRoute (route);
+    }
+  return added;
+}
+
 void
 CCNxForwarder::SetRouteCallback (RouteCallback callback)
 {
   m_routeCallback = callback;
 }
+
+void
+CCNxForwarder::NotifyOutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason)
+{
+  // empty
+}
+
+void
+CCNxForwarder::NotifyOutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn)
+{
+  // empty
+}
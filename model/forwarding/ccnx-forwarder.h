@@ -56,6 +56,8 @@
 #ifndef CCNS3_FORWARDER_H
 #define CCNS3_FORWARDER_H
 
+#include <vector>
+
 #include "ns3/object.h"
 #include "ns3/net-device.h"
 #include "ns3/traced-callback.h"
@@ -67,6 +69,7 @@
 #include "ns3/callback.h"
 #include "ns3/ccnx-connection-list.h"
 #include "ns3/output-stream-wrapper.h"
+#include "ns3/ccnx-output-queue.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -162,7 +165,8 @@ public:
 
   /**
    * @deprecated Use AddRoute(Ptr<const CCNxRoute>)
-   *  Add Route to FIB using connection and name.
+   *  Add Route to FIB using connection and name.  An existing nexthop keeps its cost,
+   *  a new one has cost 0.
    *
    * \param connection Pointer to connection object.
    * \param name Pointer to name object.
@@ -200,6 +204,23 @@ public:
    */
   virtual bool RemoveRoute (Ptr<const CCNxRoute> route) = 0;
 
+  /**
+   * A batch of route entries.  Unlike a CCNxRoute, the entries may be for different prefixes.
+   */
+  typedef std::vector< Ptr<const CCNxRouteEntry> > RouteEntryListType;
+
+  /**
+   * Add a batch of route entries to the FIB, as if each was added with `AddRoute()`.
+   * This is meant for loading large static tables, where a forwarder can do better
+   * than one insert at a time.
+   *
+   * The default implementation adds the entries one at a time.
+   *
+   * @param [in] entries The route entries to add, in any order
+   * @return true if one or more entries were added to the FIB.
+   */
+  virtual bool AddRoutes (const RouteEntryListType &entries);
+
   /**
    * Dump the node's forwarding table (FIB) to the given output stream.  The format of the FIB is
    * particular to each instance of a CCNxForwarder.
@@ -222,6 +243,24 @@ public:
    */
   virtual void PrintForwardingStatistics (Ptr<OutputStreamWrapper> streamWrapper) const = 0;
 
+  /**
+   * Called by the Layer 3 when the output queue of an egress connection drops a packet.
+   * The default does nothing.  A forwarder may count it or use it as a congestion signal.
+   *
+   * @param packet [in] The dropped packet
+   * @param reason [in] Why the queue dropped it
+   */
+  virtual void NotifyOutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason);
+
+  /**
+   * Called by the Layer 3 when a packet leaves the output queue of an egress connection.
+   * The default does nothing.
+   *
+   * @param packet [in] The packet being transmitted
+   * @param sojourn [in] How long the packet waited in the queue
+   */
+  virtual void NotifyOutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn);
+
 
   // =======
 
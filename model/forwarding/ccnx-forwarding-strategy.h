@@ -0,0 +1,163 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_CCNX_FORWARDING_STRATEGY_H_
+#define CCNS3SIM_MODEL_FORWARDING_CCNX_FORWARDING_STRATEGY_H_
+
+#include <vector>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-connection.h"
+#include "ns3/ccnx-connection-list.h"
+#include "ns3/ccnx-forwarder-message.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-forwarder
+ *
+ * Abstract base class for a forwarding strategy.
+ *
+ * After the FIB finds the longest matching prefix for an Interest, it hands the
+ * nexthops of that entry (minus the ingress connection) to a strategy, which decides
+ * which of them the Interest is actually forwarded on.  A FIB has a default strategy
+ * and may override it for specific prefixes, so the strategy is selected by longest
+ * prefix match, the same as a route.
+ *
+ * A strategy may be shared between several prefixes and several FIBs, so an
+ * implementation should not keep per-prefix state unless it keys it by prefix.
+ */
+class CCNxForwardingStrategy : public ns3::Object
+{
+public:
+  /**
+   *  Get the type ID.
+   * \return the object TypeId
+   */
+  static TypeId GetTypeId (void);
+
+  CCNxForwardingStrategy ();
+  virtual ~CCNxForwardingStrategy ();
+
+  /**
+   * A candidate egress for an Interest, as stored in the FIB.
+   */
+  typedef struct
+  {
+    Ptr<CCNxConnection> connection;   /*!< The egress connection */
+    uint32_t cost;                    /*!< The route cost via the connection (lower is better) */
+  } Nexthop;
+
+  /**
+   * The nexthops of a FIB entry, in the order they were added to the entry.
+   */
+  typedef std::vector<Nexthop> NexthopVecType;
+
+  /**
+   * Choose the egress connections for an Interest.
+   *
+   * This is called synchronously from within the FIB lookup.
+   *
+   * @param message [in] The forwarder message being routed (must be a CCNxInterest)
+   * @param prefix [in] The FIB prefix that matched the Interest name
+   * @param nexthops [in] The candidate nexthops (never contains the ingress connection, may be empty)
+   * @param egress [in] An allocated, empty list.  The chosen connections are appended here.
+   */
+  virtual void SelectEgress (Ptr<CCNxForwarderMessage> message, Ptr<const CCNxName> prefix,
+                             const NexthopVecType & nexthops, Ptr<CCNxConnectionList> egress) = 0;
+
+  /**
+   * Feedback from the PIT: a Content Object satisfied an Interest that this node forwarded.
+   *
+   * The PIT reports each upstream an Interest was forwarded on at most once, through this method,
+   * `InterestReturned()` or `InterestTimedOut()`.
+   *
+   * The default implementation does nothing.  Strategies that adapt to measured
+   * performance override it.
+   *
+   * @param prefix [in] The FIB prefix the Interest was forwarded under (as given to `SelectEgress()`)
+   * @param upstream [in] The connection the Content Object arrived on
+   * @param rtt [in] The time from forwarding the Interest to receiving the Content Object
+   */
+  virtual void InterestSatisfied (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt);
+
+  /**
+   * Feedback from the PIT: an upstream sent back an InterestReturn for an Interest this node forwarded.
+   *
+   * The default implementation does nothing.
+   *
+   * @param prefix [in] The FIB prefix the Interest was forwarded under (as given to `SelectEgress()`)
+   * @param upstream [in] The connection the InterestReturn arrived on
+   */
+  virtual void InterestReturned (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  /**
+   * Feedback from the PIT: an upstream did not answer an Interest this node forwarded within
+   * the PIT lifetime of the Interest.
+   *
+   * The default implementation does nothing.
+   *
+   * @param prefix [in] The FIB prefix the Interest was forwarded under (as given to `SelectEgress()`)
+   * @param upstream [in] The connection that did not answer
+   */
+  virtual void InterestTimedOut (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_CCNX_FORWARDING_STRATEGY_H_ */
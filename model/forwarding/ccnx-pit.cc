@@ -86,6 +86,12 @@ CCNxPit::~CCNxPit ()
 
 }
 
+void
+CCNxPit::InterestForwarded (Ptr<CCNxInterest> interest, Ptr<const CCNxName> prefix, Ptr<CCNxConnectionList> egress)
+{
+  // empty
+}
+
 static struct _verdictString {
   enum CCNxPit::Verdict verdict;
   std::string s;
@@ -170,6 +170,95 @@ public:
    */
   virtual void SetSatisfyInterestCallback (SatisfyInterestCallback satisfyInterestCallback) = 0;
 
+  /**
+   * Receive an InterestReturn packet.  Once every upstream the Interest was forwarded on (see
+   * `InterestForwarded()`) has returned it, the PIT entry of the Interest it carries is removed and its
+   * reverse routes (less the ingress) are returned, so the InterestReturn can be sent downstream.
+   * Until then, or if it comes from a connection the Interest was not forwarded on, the InterestReturn
+   * is absorbed and no reverse routes are returned.  An InterestReturn with no ingress connection
+   * removes the entry right away.
+   * The list may be empty if there is no matching PIT entry.
+   *
+   * @param message [in] The forwarder message to be looked up in the PIT (must be an InterestReturn)
+   */
+  virtual void ReceiveInterestReturn (Ptr<CCNxForwarderMessage> message) = 0;
+
+  /**
+   * The `ReceiveInterestReturnCallback` is an asynchronous callback from the PIT after it has processed
+   * an InterestReturn sent to `ReceiveInterestReturn()`.
+   *
+   * The PIT should ensure there is always one call to the callback for each call to `ReceiveInterestReturn()`.
+   *
+   * @param Ptr<CCNxForwarderMessage> The forwarder message being routed
+   * @param Ptr<CCNxConnectionList> The set of connections to forward the InterestReturn on (may be empty)
+   */
+  typedef Callback<void, Ptr<CCNxForwarderMessage>, Ptr<CCNxConnectionList> > ReceiveInterestReturnCallback;
+
+  /**
+   * Configure the callback for `ReceiveInterestReturn()`.  This must be set before using the PIT table.
+   *
+   * @param receiveInterestReturnCallback The callback to use for `ReceiveInterestReturn()`.
+   */
+  virtual void SetReceiveInterestReturnCallback (ReceiveInterestReturnCallback receiveInterestReturnCallback) = 0;
+
+  /**
+   * The `InterestSatisfiedCallback` is called from `SatisfyInterest()` processing for each named
+   * Content Object that arrives on a connection the Interest was forwarded on (see `InterestForwarded()`),
+   * before the `SatisfyInterestCallback`.
+   * It lets the forwarder feed round trip times back to its forwarding strategies.
+   *
+   * @param Ptr<const CCNxName> The Content Object name
+   * @param Ptr<const CCNxName> The FIB prefix the Interest was forwarded under
+   * @param Ptr<CCNxConnection> The upstream connection the Content Object arrived on
+   * @param Time The time from forwarding the Interest on that connection to receiving the Content Object
+   */
+  typedef Callback<void, Ptr<const CCNxName>, Ptr<const CCNxName>, Ptr<CCNxConnection>, Time > InterestSatisfiedCallback;
+
+  /**
+   * Configure the callback for Interest satisfaction events.  This one is optional.
+   *
+   * @param interestSatisfiedCallback The callback to use when an Interest is satisfied.
+   */
+  virtual void SetInterestSatisfiedCallback (InterestSatisfiedCallback interestSatisfiedCallback) = 0;
+
+  /**
+   * The `InterestUnsatisfiedCallback` is called when a named Interest forwarded on a connection
+   * (see `InterestForwarded()`) comes back as an InterestReturn from that connection, or is not
+   * answered by it within the Interest's PIT lifetime.
+   *
+   * @param Ptr<const CCNxName> The Interest name
+   * @param Ptr<const CCNxName> The FIB prefix the Interest was forwarded under
+   * @param Ptr<CCNxConnection> The upstream connection
+   */
+  typedef Callback<void, Ptr<const CCNxName>, Ptr<const CCNxName>, Ptr<CCNxConnection> > InterestUnsatisfiedCallback;
+
+  /**
+   * Configure the callback for InterestReturns from an upstream.  This one is optional.
+   *
+   * @param interestReturnedCallback The callback to use when an upstream returns an Interest.
+   */
+  virtual void SetInterestReturnedCallback (InterestUnsatisfiedCallback interestReturnedCallback) = 0;
+
+  /**
+   * Configure the callback for upstreams that do not answer.  This one is optional.
+   *
+   * @param interestTimedOutCallback The callback to use when an upstream times out.
+   */
+  virtual void SetInterestTimedOutCallback (InterestUnsatisfiedCallback interestTimedOutCallback) = 0;
+
+  /**
+   * Tells the PIT which upstream connections a forwarded Interest was sent on, so it can
+   * measure the round trip time of each one for the `InterestSatisfiedCallback` and report
+   * the ones that do not answer.
+   *
+   * The default implementation does nothing.
+   *
+   * @param interest [in] The Interest, which must have a PIT entry
+   * @param prefix [in] The FIB prefix that matched the Interest, may be null
+   * @param egress [in] The upstream connections
+   */
+  virtual void InterestForwarded (Ptr<CCNxInterest> interest, Ptr<const CCNxName> prefix, Ptr<CCNxConnectionList> egress);
+
   /**
    * Removes the PIT entry that corresponds to the given Interest
    */
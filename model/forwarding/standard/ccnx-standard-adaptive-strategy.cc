@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ccnx-standard-adaptive-strategy.h"
+#include <algorithm>
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxStandardAdaptiveStrategy");
+NS_OBJECT_ENSURE_REGISTERED (CCNxStandardAdaptiveStrategy);
+
+static const Time _defaultProbeInterval = MilliSeconds (500);
+
+/**
+ * srtt gain of 1/8, as in TCP
+ */
+static const int64_t _rttGainDivisor = 8;
+
+static const double _satisfactionGain = 0.125;
+static const double _minSatisfaction = 0.01;
+
+TypeId
+CCNxStandardAdaptiveStrategy::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxStandardAdaptiveStrategy")
+    .SetParent<CCNxForwardingStrategy> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxStandardAdaptiveStrategy> ()
+    .AddAttribute ("ProbeInterval", "How often an Interest is also sent on an alternative nexthop",
+                   TimeValue (_defaultProbeInterval),
+                   MakeTimeAccessor (&CCNxStandardAdaptiveStrategy::m_probeInterval),
+                   MakeTimeChecker ());
+  return tid;
+}
+
+CCNxStandardAdaptiveStrategy::CCNxStandardAdaptiveStrategy ()
+  : m_probeInterval (_defaultProbeInterval)
+{
+}
+
+CCNxStandardAdaptiveStrategy::~CCNxStandardAdaptiveStrategy ()
+{
+}
+
+void
+CCNxStandardAdaptiveStrategy::SelectEgress (Ptr<CCNxForwarderMessage> message, Ptr<const CCNxName> prefix,
+                                            const NexthopVecType & nexthops, Ptr<CCNxConnectionList> egress)
+{
+  if (nexthops.empty ())
+    {
+      return;
+    }
+
+  Time now = Simulator::Now ();
+
+  PrefixStatsMapType::iterator pit = m_prefixStats.find (prefix);
+  if (pit == m_prefixStats.end ())
+    {
+      PrefixStats stats;
+      stats.lastProbe = now;
+      stats.probeIndex = 0;
+      pit = m_prefixStats.insert (std::make_pair (prefix, stats)).first;
+    }
+  PrefixStats & stats = pit->second;
+
+  // Pick the measured nexthop with the lowest srtt / satisfaction, else the lowest cost one
+  size_t best = nexthops.size ();
+  double bestScore = 0;
+  bool bestMeasured = false;
+  for (size_t i = 0; i < nexthops.size (); ++i)
+    {
+      FaceStatsMapType::iterator fit = stats.faces.find (nexthops[i].connection->GetConnectionId ());
+      if (fit == stats.faces.end ())
+        {
+          FaceStats face;
+          face.srtt = Seconds (-1);
+          face.satisfaction = 1.0;
+          face.nextProbe = now;
+          fit = stats.faces.insert (std::make_pair (nexthops[i].connection->GetConnectionId (), face)).first;
+        }
+
+      FaceStats & face = fit->second;
+      if (!face.srtt.IsStrictlyNegative ())
+        {
+          double score = face.srtt.GetSeconds () / std::max (face.satisfaction, _minSatisfaction);
+          if (!bestMeasured || score < bestScore)
+            {
+              best = i;
+              bestScore = score;
+              bestMeasured = true;
+            }
+        }
+      else if (!bestMeasured && (best == nexthops.size () || nexthops[i].cost < nexthops[best].cost))
+        {
+          best = i;
+        }
+    }
+
+  egress->push_back (nexthops[best].connection);
+
+  // Measure the new nexthops right away
+  bool probed = false;
+  for (size_t i = 0; i < nexthops.size (); ++i)
+    {
+      FaceStats & face = stats.faces[nexthops[i].connection->GetConnectionId ()];
+      if (i != best && face.srtt.IsStrictlyNegative () && face.nextProbe <= now)
+        {
+          NS_LOG_DEBUG ("Probing unmeasured connid " << nexthops[i].connection->GetConnectionId () << " for " << *prefix);
+          egress->push_back (nexthops[i].connection);
+          face.nextProbe = now + m_probeInterval;
+          probed = true;
+        }
+    }
+
+  // And the others now and then
+  if (!probed && nexthops.size () > 1 && now - stats.lastProbe >= m_probeInterval)
+    {
+      size_t probe = stats.probeIndex++ % nexthops.size ();
+      if (probe == best)
+        {
+          probe = (probe + 1) % nexthops.size ();
+        }
+      NS_LOG_DEBUG ("Probing connid " << nexthops[probe].connection->GetConnectionId () << " for " << *prefix);
+      egress->push_back (nexthops[probe].connection);
+      probed = true;
+    }
+
+  if (probed)
+    {
+      stats.lastProbe = now;
+    }
+}
+
+void
+CCNxStandardAdaptiveStrategy::InterestSatisfied (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt)
+{
+  FaceStats *face = FindFaceStats (prefix, upstream);
+  if (!face)
+    {
+      return;
+    }
+
+  if (face->srtt.IsStrictlyNegative ())
+    {
+      face->srtt = rtt;
+    }
+  else
+    {
+      face->srtt = NanoSeconds (face->srtt.GetNanoSeconds () + (rtt.GetNanoSeconds () - face->srtt.GetNanoSeconds ()) / _rttGainDivisor);
+    }
+  face->satisfaction += _satisfactionGain * (1.0 - face->satisfaction);
+
+  NS_LOG_DEBUG ("connid " << upstream->GetConnectionId () << " rtt " << rtt << " srtt " << face->srtt << " satisfaction " << face->satisfaction);
+}
+
+void
+CCNxStandardAdaptiveStrategy::InterestReturned (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  Unsatisfied (prefix, upstream);
+}
+
+void
+CCNxStandardAdaptiveStrategy::InterestTimedOut (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  Unsatisfied (prefix, upstream);
+}
+
+void
+CCNxStandardAdaptiveStrategy::Unsatisfied (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  FaceStats *face = FindFaceStats (prefix, upstream);
+  if (face)
+    {
+      face->satisfaction -= _satisfactionGain * face->satisfaction;
+      NS_LOG_DEBUG ("connid " << upstream->GetConnectionId () << " unsatisfied, satisfaction " << face->satisfaction);
+    }
+}
+
+CCNxStandardAdaptiveStrategy::FaceStats *
+CCNxStandardAdaptiveStrategy::FindFaceStats (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection)
+{
+  PrefixStatsMapType::iterator pit = m_prefixStats.find (prefix);
+  if (pit != m_prefixStats.end ())
+    {
+      FaceStatsMapType::iterator fit = pit->second.faces.find (connection->GetConnectionId ());
+      if (fit != pit->second.faces.end ())
+        {
+          return &fit->second;
+        }
+    }
+  return 0;
+}
+
+const CCNxStandardAdaptiveStrategy::FaceStats *
+CCNxStandardAdaptiveStrategy::FindFaceStats (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const
+{
+  return const_cast<CCNxStandardAdaptiveStrategy *> (this)->FindFaceStats (prefix, connection);
+}
+
+Time
+CCNxStandardAdaptiveStrategy::GetSmoothedRtt (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const
+{
+  const FaceStats *face = FindFaceStats (prefix, connection);
+  return face ? face->srtt : Seconds (-1);
+}
+
+double
+CCNxStandardAdaptiveStrategy::GetSatisfaction (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const
+{
+  const FaceStats *face = FindFaceStats (prefix, connection);
+  return face ? face->satisfaction : 1.0;
+}
+
+std::ostream &
+CCNxStandardAdaptiveStrategy::PrintStatistics (std::ostream & os) const
+{
+  for (PrefixStatsMapType::const_iterator pit = m_prefixStats.begin (); pit != m_prefixStats.end (); ++pit)
+    {
+      os << "Prefix " << *pit->first << std::endl;
+      for (FaceStatsMapType::const_iterator fit = pit->second.faces.begin (); fit != pit->second.faces.end (); ++fit)
+        {
+          os << "   connid " << fit->first
+             << " srtt " << fit->second.srtt.GetMicroSeconds () << " usec"
+             << " satisfaction " << fit->second.satisfaction
+             << std::endl;
+        }
+    }
+  return os;
+}
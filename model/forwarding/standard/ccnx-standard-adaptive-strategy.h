@@ -0,0 +1,174 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ADAPTIVE_STRATEGY_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ADAPTIVE_STRATEGY_H_
+
+#include <map>
+#include "ns3/nstime.h"
+#include "ns3/ccnx-forwarding-strategy.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * A strategy that measures each nexthop and forwards on the one that looks fastest.
+ *
+ * For every FIB prefix and nexthop it keeps a smoothed round trip time and a satisfaction ratio
+ * (an EWMA of satisfied versus returned or timed out Interests).  An Interest is forwarded on the
+ * nexthop with the lowest srtt / satisfaction.  Until a nexthop has a measurement the lowest cost
+ * one is used, as in `CCNxStandardBestRouteStrategy`.
+ *
+ * Probing:
+ * - A nexthop without a measurement gets a copy of an Interest at most once per "ProbeInterval".
+ * - Every "ProbeInterval", one other nexthop (round robin) gets a copy of an Interest, so the
+ *   strategy notices when an alternative path gets faster.
+ *
+ * The strategy does not track the Interests it forwards.  The PIT does, in its out records (see
+ * `CCNxPit::InterestForwarded()`), and reports each upstream via `InterestSatisfied()`,
+ * `InterestReturned()` or `InterestTimedOut()` with the FIB prefix given to `SelectEgress()`.
+ */
+class CCNxStandardAdaptiveStrategy : public CCNxForwardingStrategy
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxStandardAdaptiveStrategy ();
+  virtual ~CCNxStandardAdaptiveStrategy ();
+
+  //! @copydoc CCNxForwardingStrategy::SelectEgress()
+  virtual void SelectEgress (Ptr<CCNxForwarderMessage> message, Ptr<const CCNxName> prefix,
+                             const NexthopVecType & nexthops, Ptr<CCNxConnectionList> egress);
+
+  //! @copydoc CCNxForwardingStrategy::InterestSatisfied()
+  virtual void InterestSatisfied (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt);
+
+  //! @copydoc CCNxForwardingStrategy::InterestReturned()
+  virtual void InterestReturned (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  //! @copydoc CCNxForwardingStrategy::InterestTimedOut()
+  virtual void InterestTimedOut (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  /**
+   * The smoothed round trip time of a nexthop.
+   *
+   * @param prefix The FIB prefix
+   * @param connection The nexthop
+   * @return The srtt, or a negative time if there is no measurement
+   */
+  Time GetSmoothedRtt (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const;
+
+  /**
+   * The satisfaction ratio of a nexthop, between 0 and 1.
+   *
+   * @param prefix The FIB prefix
+   * @param connection The nexthop
+   * @return The ratio, or 1 if the nexthop was never used
+   */
+  double GetSatisfaction (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const;
+
+  /**
+   * Prints the per prefix and nexthop measurements.
+   */
+  std::ostream & PrintStatistics (std::ostream & os) const;
+
+private:
+  typedef struct
+  {
+    Time srtt;                          /*!< smoothed round trip time, negative until the first sample */
+    double satisfaction;                /*!< EWMA of satisfied (1) and returned or timed out (0) Interests */
+    Time nextProbe;                     /*!< when the nexthop may be probed again while it has no srtt */
+  } FaceStats;
+
+  typedef std::map<CCNxConnection::ConnIdType, FaceStats> FaceStatsMapType;
+
+  typedef struct
+  {
+    FaceStatsMapType faces;
+    Time lastProbe;                     /*!< when an alternative nexthop was last probed */
+    unsigned probeIndex;                /*!< round robin position of the next probe */
+  } PrefixStats;
+
+  typedef std::map<Ptr<const CCNxName>, PrefixStats, CCNxName::isLessPtrCCNxName> PrefixStatsMapType;
+
+  /**
+   * Returns the stats of an exact prefix and nexthop or null.
+   */
+  FaceStats * FindFaceStats (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection);
+
+  //! @copydoc FindFaceStats()
+  const FaceStats * FindFaceStats (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> connection) const;
+
+  /**
+   * Counts an Interest returned by or timed out on the nexthop as unsatisfied.
+   */
+  void Unsatisfied (Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  PrefixStatsMapType m_prefixStats;
+
+  /**
+   * How often to send a copy of an Interest on an alternative nexthop.
+   *
+   * This value is set via the attribute "ProbeInterval".  The default is 500 msec.
+   */
+  Time m_probeInterval;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ADAPTIVE_STRATEGY_H_ */
@@ -71,6 +71,7 @@ NS_OBJECT_ENSURE_REGISTERED (CCNxStandardContentStore);
 
 
 static const long long _defaultObjectCapacity = 10000;  //size_t and uint64_t dont work with AddAttribute
+static const long long _defaultByteCapacity = 0;        // 0 means no byte limit
 
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = NanoSeconds (10);
@@ -108,6 +109,11 @@ CCNxStandardContentStore::GetTypeId ()
 		   IntegerValue (_defaultObjectCapacity),
 		   MakeIntegerAccessor (&CCNxStandardContentStore::m_objectCapacity),
 		   MakeIntegerChecker<long long> ())
+    .AddAttribute ("ByteCapacity",
+                  "The maximum number of content object packet bytes to store, 0 for no limit (default = 0)",
+		   IntegerValue (_defaultByteCapacity),
+		   MakeIntegerAccessor (&CCNxStandardContentStore::m_byteCapacity),
+		   MakeIntegerChecker<long long> (0))
     .AddAttribute ("LayerDelayConstant", "The amount of constant layer delay",
 		  TimeValue (_defaultLayerDelayConstant),
 		  MakeTimeAccessor (&CCNxStandardContentStore::m_layerDelayConstant),
@@ -125,6 +131,7 @@ CCNxStandardContentStore::GetTypeId ()
 
 
 CCNxStandardContentStore::CCNxStandardContentStore () : m_objectCapacity (_defaultObjectCapacity),
+      m_byteCapacity (_defaultByteCapacity), m_byteCount (0),
       m_matchInterestCallback (MakeCallback (&NullMatchInterestCallback)),
       m_addContentObjectCallback (MakeCallback (&NullAddContentObjectCallback)),
       m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
@@ -352,21 +359,31 @@ CCNxStandardContentStore::ServiceAddContentObject (Ptr<CCNxStandardForwarderWork
     }
   else
     {
-      if (GetObjectCount()>=GetObjectCapacity())
+      // The packet length includes the virtual payload, so large objects are charged in full
+      uint64_t packetBytes = GetPacketBytes (cPacket);
+      if (m_byteCapacity > 0 && packetBytes > (uint64_t) m_byteCapacity)
 	{
-	  Ptr<CCNxStandardContentStoreEntry> oldestEntry = m_lruList->GetBackEntry();
-	  DeleteContentObject(oldestEntry->GetPacket());
+	  NS_LOG_INFO ("content object of " << packetBytes << " bytes is larger than the byte capacity " << m_byteCapacity);
 	}
-      //create new entry
-      Ptr<CCNxStandardContentStoreEntry> newEntry = Create<CCNxStandardContentStoreEntry> (cPacket);
+      else
+	{
+	  while (GetObjectCount() > 0 && (GetObjectCount()>=GetObjectCapacity()
+	         || (m_byteCapacity > 0 && m_byteCount + packetBytes > (uint64_t) m_byteCapacity)))
+	    {
+	      Ptr<CCNxStandardContentStoreEntry> oldestEntry = m_lruList->GetBackEntry();
+	      DeleteContentObject(oldestEntry->GetPacket());
+	    }
+	  //create new entry
+	  Ptr<CCNxStandardContentStoreEntry> newEntry = Create<CCNxStandardContentStoreEntry> (cPacket);
 
-      result = m_lruList->AddEntry(newEntry);
+	  result = m_lruList->AddEntry(newEntry);
 
-      if (result)
-	{
-	  result = AddMapEntry(cPacket,newEntry);
+	  if (result)
+	    {
+	      result = AddMapEntry(cPacket,newEntry);
+	      m_byteCount += packetBytes;
+	    }
 	}
-
   }
 
   workItem->SetContentAddedFlag(result);
@@ -457,6 +474,10 @@ CCNxStandardContentStore::DeleteContentObject(Ptr<CCNxPacket> cPacket)
 	{
 	      NS_LOG_ERROR("could not delete Entry from m_lruList.");
 	}
+      else
+	{
+	  m_byteCount -= GetPacketBytes (entry->GetPacket ());
+	}
 
 
       if (*cPacket->GetContentObjectHash()->GetValue() != *nullHashValue->GetValue())
@@ -571,6 +592,26 @@ CCNxStandardContentStore::GetObjectCapacity () const
   return m_objectCapacity;
 }
 
+uint64_t
+CCNxStandardContentStore::GetByteCount () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_byteCount;
+}
+
+uint64_t
+CCNxStandardContentStore::GetByteCapacity () const
+{
+  NS_LOG_FUNCTION (this);
+  return m_byteCapacity;
+}
+
+uint64_t
+CCNxStandardContentStore::GetPacketBytes (Ptr<CCNxPacket> cPacket)
+{
+  return cPacket->GetFixedHeader ()->GetPacketLength ();
+}
+
 
 Ptr<const CCNxByteArray>
 CCNxStandardContentStore::GetKeyidOrRestriction(Ptr<const CCNxPacket> z)
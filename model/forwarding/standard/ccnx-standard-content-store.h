@@ -166,6 +166,24 @@ public:
    */
   virtual size_t GetObjectCapacity () const;
 
+  /**
+   * Returns the number of packet bytes of the content objects in the content store.
+   *
+   * Each object is charged its CCNx packet length (from the fixed header), which includes
+   * any virtual payload, so the count is correct even though virtual bytes are never stored.
+   *
+   * @return The number of bytes in the store.
+   */
+  uint64_t GetByteCount () const;
+
+  /**
+   * Returns the maximum capacity (in bytes) of the content store, set by the
+   * ByteCapacity attribute.  0 means there is no byte limit.
+   *
+   * @return The byte capacity of the content store
+   */
+  uint64_t GetByteCapacity () const;
+
   /**
    * return entry pointer if this object in the content store, null otherwise.
    *
@@ -352,6 +370,17 @@ private:
   /** Maxium number of content objects to store in content store */
   long long m_objectCapacity;
 
+  /** Maximum number of packet bytes to store in content store, 0 for no limit */
+  long long m_byteCapacity;
+
+  /** Number of packet bytes currently in the content store */
+  uint64_t m_byteCount;
+
+  /**
+   * The number of bytes a content object packet is charged in the content store.
+   */
+  static uint64_t GetPacketBytes (Ptr<CCNxPacket> cPacket);
+
 
 
    /**
@@ -0,0 +1,111 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ECMP_STRATEGY_H_
+#define CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ECMP_STRATEGY_H_
+
+#include "ns3/ccnx-forwarding-strategy.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-standard-forwarder
+ *
+ * Equal-cost multipath: forwards an Interest on one of the lowest cost nexthops,
+ * chosen by a consistent hash of the Interest name.
+ *
+ * The hash is a rendezvous (highest random weight) hash of the name and the connection id,
+ * so every node picks the same nexthop for the same name, and adding or removing
+ * a nexthop only moves the names that hash to that nexthop.
+ *
+ * By default the whole name is hashed, which spreads the chunks of one object over all the
+ * paths.  Setting the attribute "HashSegmentCount" hashes only the first N name segments,
+ * which keeps all the names under one N-segment prefix on the same path.
+ */
+class CCNxStandardEcmpStrategy : public CCNxForwardingStrategy
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxStandardEcmpStrategy ();
+  virtual ~CCNxStandardEcmpStrategy ();
+
+  //! @copydoc CCNxForwardingStrategy::SelectEgress()
+  virtual void SelectEgress (Ptr<CCNxForwarderMessage> message, Ptr<const CCNxName> prefix,
+                             const NexthopVecType & nexthops, Ptr<CCNxConnectionList> egress);
+
+  /**
+   * The hash of a name, as used to select the nexthop.
+   *
+   * @param name [in] The name to hash
+   * @param segmentCount [in] The number of leading segments to hash (0 means all of them)
+   * @return A 64-bit FNV-1a hash of the segment types and values
+   */
+  static uint64_t HashName (Ptr<const CCNxName> name, unsigned segmentCount);
+
+private:
+  /**
+   * The number of leading name segments to hash, 0 is the whole name.
+   *
+   * This value is set via the attribute "HashSegmentCount".  The default is 0.
+   */
+  unsigned m_hashSegmentCount;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_FORWARDING_STANDARD_CCNX_STANDARD_ECMP_STRATEGY_H_ */
@@ -85,3 +85,9 @@ CCNxStandardFibFactory::SetLayerDelayServers (unsigned serverCount)
 {
   Set ("LayerDelayServers", IntegerValue (serverCount));
 }
+
+void
+CCNxStandardFibFactory::SetDefaultStrategy (ObjectFactory strategyFactory)
+{
+  Set ("DefaultStrategy", ObjectFactoryValue (strategyFactory));
+}
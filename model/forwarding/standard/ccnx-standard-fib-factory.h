@@ -109,6 +109,15 @@ public:
    * This value is set via the attribute "LayerDelayServers".  The default is 1.
    */
   void SetLayerDelayServers (unsigned serverCount);
+
+  /**
+   * The forwarding strategy for prefixes that do not have their own strategy.
+   *
+   * This value is set via the attribute "DefaultStrategy".  The default is `CCNxStandardBroadcastStrategy`.
+   *
+   * @param strategyFactory An ObjectFactory that creates a `CCNxForwardingStrategy`
+   */
+  void SetDefaultStrategy (ObjectFactory strategyFactory);
 };
 
 }   /* namespace ccnx */
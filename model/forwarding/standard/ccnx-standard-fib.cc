@@ -55,6 +55,8 @@
 
 
 
+#include <algorithm>
+
 #include "ccnx-standard-fib.h"
 #include "ns3/ccnx-name-builder.h"
 #include "ns3/simple-ref-count.h"
@@ -63,6 +65,7 @@
 #include "ns3/object.h"
 #include "ns3/integer.h"
 #include "ns3/ccnx-standard-forwarder-work-item.h"
+#include "ns3/ccnx-standard-broadcast-strategy.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -75,6 +78,14 @@ static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = NanoSeconds (10);
 static unsigned _defaultLayerDelayServers = 1;
 
+static ObjectFactory
+GetDefaultStrategyFactory ()
+{
+  static ObjectFactory factory;
+  factory.SetTypeId (CCNxStandardBroadcastStrategy::GetTypeId ());
+  return factory;
+}
+
 /**
  * Used as a default callback for m_recieveInterestCallback in case the user does not set it.
  */
@@ -103,6 +114,10 @@ CCNxStandardFib::GetTypeId (void)
                    IntegerValue (_defaultLayerDelayServers),
                    MakeIntegerAccessor (&CCNxStandardFib::m_layerDelayServers),
                    MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("DefaultStrategy", "The ObjectFactory to create the forwarding strategy for prefixes without their own strategy.",
+                   ObjectFactoryValue (GetDefaultStrategyFactory ()),
+                   MakeObjectFactoryAccessor (&CCNxStandardFib::m_defaultStrategyFactory),
+                   MakeObjectFactoryChecker ())
   ;
 
   return tid;
@@ -112,7 +127,8 @@ CCNxStandardFib::GetTypeId (void)
 CCNxStandardFib::CCNxStandardFib ()
   :   m_LookupCallback (MakeCallback (&NullLookupCallback)),
   m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
-  m_layerDelayServers (_defaultLayerDelayServers)
+  m_layerDelayServers (_defaultLayerDelayServers),
+  m_defaultStrategyFactory (GetDefaultStrategyFactory ())
 {
 
 }
@@ -125,6 +141,7 @@ CCNxStandardFib::~CCNxStandardFib ()
 void
 CCNxStandardFib::DoInitialize ()
 {
+  m_defaultStrategy = m_defaultStrategyFactory.Create<CCNxForwardingStrategy> ();
   m_inputQueue = Create<DelayQueueType> (m_layerDelayServers,
                                          MakeCallback (&CCNxStandardFib::GetServiceTime, this),
                                          MakeCallback (&CCNxStandardFib::DequeueCallback, this));
@@ -212,17 +229,26 @@ CCNxStandardFib::PerformLookup (Ptr<CCNxStandardForwarderWorkItem> workItem)
     {
       NS_LOG_INFO ( __func__ << " No fib match!");
     }
-  else         //get vector and translate  into list, removing ingress connection
+  else         //get vector and translate into nexthops, removing ingress connection, and let the strategy choose
     {
-      CCNxStandardFibEntry::ConnectionsVecType connectionsVec = bestMatch->second->GetConnections ();
+      Ptr<CCNxStandardFibEntry> entry = bestMatch->second;
+      CCNxStandardFibEntry::ConnectionsVecType connectionsVec = entry->GetConnections ();
+      CCNxForwardingStrategy::NexthopVecType nexthops;
+      nexthops.reserve (connectionsVec.size ());
       for (CCNxStandardFibEntry::ConnectionsVecType::iterator it = connectionsVec.begin (); it != connectionsVec.end (); it++)
         {
           Ptr<CCNxConnection> conn = *it;
           if (conn->GetConnectionId () != ingress->GetConnectionId ())
             {
-              egress->push_back (conn);
+              CCNxForwardingStrategy::Nexthop nexthop;
+              nexthop.connection = conn;
+              nexthop.cost = entry->GetCost (conn);
+              nexthops.push_back (nexthop);
             }
         }
+
+      workItem->SetFibPrefix (bestMatch->first);
+      GetStrategy (ccnxName)->SelectEgress (workItem, bestMatch->first, nexthops, egress);
     }
 
   NS_LOG_DEBUG ("Lookup match count: " << egress->size ());
@@ -276,40 +302,90 @@ CCNxStandardFib::AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  c
 {
   NS_LOG_FUNCTION (this);
 
-  std::pair< FibType::iterator, bool > fibRvPair;
+  //find this name in fib. if not present, add a new entry first.
+  FibType::iterator it = fib.find (ccnxName);
+  if (it == fib.end ())
+    {
+      NS_LOG_DEBUG ( __func__ << " adding new route[" << *ccnxName << "] = [" << connection->GetConnectionId () << "]");
+      it = fib.insert (std::make_pair (ccnxName, Create<CCNxStandardFibEntry> ())).first;
+    }
 
-  //find this name in fib. if already present, it's fibEntry ptr is returned.
-  //if not present, a new location is added to the map and a null ptr is returned.
-  Ptr<CCNxStandardFibEntry> fibEntry = fib[ccnxName];
+  it->second->AddConnection (connection);
+  return true;
 
-  //if route already in fib, modify entry. if not add new entry first.
-  if (fibEntry != NULL)
-    {
+} //AddRoute
 
-      fibEntry->AddConnection (connection);
-    }
-  else
+
+bool
+CCNxStandardFib::AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  connection, uint32_t cost)
+{
+  NS_LOG_FUNCTION (this);
+
+  FibType::iterator it = fib.find (ccnxName);
+  if (it == fib.end ())
     {
-      NS_LOG_DEBUG ( __func__ << " adding new route[" << *ccnxName << "] = [" << connection->GetConnectionId () << "]");
+      NS_LOG_DEBUG ( __func__ << " adding new route[" << *ccnxName << "] = [" << connection->GetConnectionId () << "] cost " << cost);
+      it = fib.insert (std::make_pair (ccnxName, Create<CCNxStandardFibEntry> ())).first;
+    }
 
-      fib[ccnxName] = Create<CCNxStandardFibEntry> ();
+  it->second->AddConnection (connection, cost);
+  return true;
+}
 
-      fib[ccnxName]->AddConnection (connection);
+/**
+ * Orders route entries by prefix, the same order as the fib.
+ */
+struct isLessRouteEntryPrefix
+{
+  bool operator() (Ptr<const CCNxRouteEntry> a, Ptr<const CCNxRouteEntry> b) const
+  {
+    return *a->GetPrefix () < *b->GetPrefix ();
+  }
+};
 
-    }
+bool
+CCNxStandardFib::AddRoutes (const RouteEntryListType &entries)
+{
+  NS_LOG_FUNCTION (this << entries.size ());
 
+  // Insert in fib order so each insert is next to the previous one and the
+  // hinted insert does not need a full search.  A stable sort keeps the batch
+  // order between entries of the same prefix, so the last cost wins.
+  RouteEntryListType sorted (entries);
+  std::stable_sort (sorted.begin (), sorted.end (), isLessRouteEntryPrefix ());
 
-  return true;
+  FibType::iterator last = fib.end ();
+  for (RouteEntryListType::const_iterator i = sorted.begin (); i != sorted.end (); ++i)
+    {
+      Ptr<const CCNxName> prefix = (*i)->GetPrefix ();
+      Ptr<CCNxConnection> connection = (*i)->GetConnection ();
 
-} //AddRoute
+      // entries of the same prefix are adjacent, so reuse the previous fib entry
+      if (last == fib.end () || *last->first < *prefix)
+        {
+          FibType::iterator hint = last;
+          if (hint != fib.end ())
+            {
+              ++hint;
+            }
+          last = fib.insert (hint, FibType::value_type (prefix, Ptr<CCNxStandardFibEntry> ()));
+          if (!last->second)
+            {
+              last->second = Create<CCNxStandardFibEntry> ();
+            }
+        }
+
+      last->second->AddConnection (connection, (*i)->GetCost ());
+    }
 
+  NS_LOG_INFO ( __func__ << " added " << entries.size () << " routes, fib size " << fib.size ());
+  return !entries.empty ();
+}
 
 bool
 CCNxStandardFib::DeleteRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  connection)
 {
 
-  Ptr<CCNxStandardFibEntry> fibEntry = Create<CCNxStandardFibEntry> ();
-
   FibType::iterator it = fib.find (ccnxName);
   std::pair <bool,int > rvPair;
 
@@ -318,7 +394,7 @@ CCNxStandardFib::DeleteRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>
       rvPair = it->second->RemoveConnection (connection);
       if (rvPair.second == 0)          //erase fib entry
         {
-          fib.erase (ccnxName);
+          fib.erase (it);
         }
       NS_LOG_INFO ( __func__ << " successful.");
       return rvPair.first;      //only return true if name and connection were matched.
@@ -337,6 +413,43 @@ int CCNxStandardFib::CountEntries ()
   return fib.size ();
 }
 
+void
+CCNxStandardFib::SetStrategy (Ptr<const CCNxName> prefix, Ptr<CCNxForwardingStrategy> strategy)
+{
+  NS_ASSERT_MSG (strategy, "Strategy must not be null, use ClearStrategy() to remove one");
+  NS_LOG_INFO ( __func__ << " prefix " << *prefix << " strategy " << strategy->GetInstanceTypeId ().GetName ());
+  m_strategyTable[prefix] = strategy;
+}
+
+bool
+CCNxStandardFib::ClearStrategy (Ptr<const CCNxName> prefix)
+{
+  return m_strategyTable.erase (prefix) > 0;
+}
+
+Ptr<CCNxForwardingStrategy>
+CCNxStandardFib::GetStrategy (Ptr<const CCNxName> name) const
+{
+  Ptr<CCNxForwardingStrategy> strategy = m_defaultStrategy;
+  if (m_strategyTable.empty ())
+    {
+      return strategy;
+    }
+
+  // Unlike the fib lookup, keep going past a miss because strategy prefixes need not be nested
+  CCNxNameBuilder builder;
+  for (size_t i = 0; i < name->GetSegmentCount (); ++i)
+    {
+      builder.Append (name->GetSegment (i));
+      StrategyTableType::const_iterator it = m_strategyTable.find (builder.CreateName ());
+      if (it != m_strategyTable.end ())
+        {
+          strategy = it->second;
+        }
+    }
+  return strategy;
+}
+
 std::ostream&
 CCNxStandardFib::PrintRoutes (std::ostream & os)
 {
@@ -347,6 +460,10 @@ CCNxStandardFib::PrintRoutes (std::ostream & os)
     {
       PrintRoute (os, it->first);
     }
+  for (StrategyTableType::iterator it = m_strategyTable.begin (); it != m_strategyTable.end (); ++it )
+    {
+      os << "Strategy " << *it->first << " = " << it->second->GetInstanceTypeId ().GetName () << std::endl;
+    }
   os << this << "----------------End of Routing Table-----------------" << std::endl;
   return os;
 
@@ -61,6 +61,7 @@
 #include <vector>
 #include <list>
 
+#include "ns3/object-factory.h"
 #include "ns3/ccnx-fib.h"
 #include "ns3/ccnx-forwarder.h"
 #include "ns3/ccnx-standard-fibEntry.h"
@@ -76,6 +77,11 @@ namespace ccnx {
  * The CCNx standard Fib class is the top level of the  Fib object hierarchy.
  * CCNx standard fib is derived from `CCNxFib` base class.
  * This fib should work for all implementations but may be replaced if desired.
+ *
+ * The nexthops of the longest matching entry are filtered by a `CCNxForwardingStrategy`.
+ * The strategy is chosen by longest prefix match in a separate strategy table (see `SetStrategy()`),
+ * falling back to the default strategy, which is created from the "DefaultStrategy" attribute
+ * and broadcasts to all nexthops.
  */
 class CCNxStandardFib : public CCNxFib
 {
@@ -97,6 +103,13 @@ protected:
 
   FibType fib;
 
+  /**
+   * The per-prefix forwarding strategies, keyed by prefix like the fib.
+   */
+  typedef std::map<Ptr<const CCNxName>, Ptr<CCNxForwardingStrategy>, CCNxName::isLessPtrCCNxName >  StrategyTableType;
+
+  StrategyTableType m_strategyTable;
+
 public:
   CCNxStandardFib ();
 
@@ -128,8 +141,22 @@ public:
    */
   virtual bool AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  connection);
 
+  /**
+   *
+   * @copydoc CCNxFib::AddRoute(Ptr<const CCNxName>,Ptr<CCNxConnection>,uint32_t)
+   */
+  virtual bool AddRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  connection, uint32_t cost);
+
   virtual bool DeleteRoute (Ptr<const CCNxName> ccnxName,  Ptr<CCNxConnection>  connection);
 
+  /**
+   * @copydoc CCNxFib::AddRoutes()
+   *
+   * The entries are sorted by prefix and inserted in fib order, so each insert
+   * is hinted by the previous one instead of searching the whole map.
+   */
+  virtual bool AddRoutes (const RouteEntryListType &entries);
+
   virtual std::ostream & PrintRoutes (std::ostream & os);
 
   virtual std::ostream & PrintRoute (std::ostream & os, Ptr<const CCNxName> ccnxName);
@@ -140,6 +167,15 @@ public:
    */
   virtual int CountEntries ();
 
+  //! @copydoc CCNxFib::SetStrategy()
+  virtual void SetStrategy (Ptr<const CCNxName> prefix, Ptr<CCNxForwardingStrategy> strategy);
+
+  //! @copydoc CCNxFib::ClearStrategy()
+  virtual bool ClearStrategy (Ptr<const CCNxName> prefix);
+
+  //! @copydoc CCNxFib::GetStrategy()
+  virtual Ptr<CCNxForwardingStrategy> GetStrategy (Ptr<const CCNxName> name) const;
+
 protected:
   // ns3::Object::DoInitialize()
   void DoInitialize ();
@@ -216,6 +252,17 @@ private:
    */
   unsigned m_layerDelayServers;
 
+  /**
+   * Creates m_defaultStrategy in `DoInitialize()`.
+   *
+   * This value is set via the attribute "DefaultStrategy".  The default is `CCNxStandardBroadcastStrategy`.
+   */
+  ObjectFactory m_defaultStrategyFactory;
+
+  /**
+   * The strategy for names that match no prefix in m_strategyTable.
+   */
+  Ptr<CCNxForwardingStrategy> m_defaultStrategy;
 
 };          //class
 }    //namespace
@@ -58,6 +58,7 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/object.h"
+#include <limits>
 
 
 using namespace ns3;
@@ -81,20 +82,29 @@ CCNxStandardFibEntry::~CCNxStandardFibEntry ()
 
 
 
+size_t
+CCNxStandardFibEntry::FindConnection (Ptr<CCNxConnection> connection) const
+{
+  for (size_t i = 0; i < m_connectionsVec.size (); ++i)
+    {
+      if (m_connectionsVec[i]->GetConnectionId () == connection->GetConnectionId () )
+        {
+          return i;
+        }
+    }
+  return m_connectionsVec.size ();
+}
+
 std::pair<bool,int>
 CCNxStandardFibEntry::RemoveConnection ( Ptr<CCNxConnection> & connection)
 {
-
-  ConnectionsVecType::iterator itbegin = m_connectionsVec.begin ();
-  ConnectionsVecType::iterator itend = m_connectionsVec.end ();
   bool erased = false;
-  for (ConnectionsVecType::iterator it = itbegin; it != itend; ++it )
+  size_t index = FindConnection (connection);
+  if (index < m_connectionsVec.size ())
     {
-      if ((*it)->GetConnectionId () == connection->GetConnectionId () )
-        {
-          erased = true;
-          m_connectionsVec.erase (it);
-        }
+      erased = true;
+      m_connectionsVec.erase (m_connectionsVec.begin () + index);
+      m_costsVec.erase (m_costsVec.begin () + index);
     }
   std::pair <bool,int> rvPair;
   rvPair.first = erased;
@@ -109,24 +119,40 @@ CCNxStandardFibEntry::RemoveConnection ( Ptr<CCNxConnection> & connection)
 int
 CCNxStandardFibEntry::AddConnection ( Ptr<CCNxConnection> & connection)
 {
-  bool alreadyThere = false;
-
-  ConnectionsVecType::iterator itbegin = m_connectionsVec.begin ();
-  ConnectionsVecType::iterator itend = m_connectionsVec.end ();
-  for (ConnectionsVecType::iterator it = itbegin; it != itend; ++it )
+  if (FindConnection (connection) == m_connectionsVec.size ())
     {
-      if ( (*it)->GetConnectionId () == connection->GetConnectionId ())
-        {
-          alreadyThere = true;
-        }
+      m_connectionsVec.push_back (connection);
+      m_costsVec.push_back (0);
     }
+  return m_connectionsVec.size ();
 
-  if (not alreadyThere)
+}
+
+int
+CCNxStandardFibEntry::AddConnection ( Ptr<CCNxConnection> & connection, uint32_t cost)
+{
+  size_t index = FindConnection (connection);
+  if (index < m_connectionsVec.size ())
+    {
+      m_costsVec[index] = cost;
+    }
+  else
     {
       m_connectionsVec.push_back (connection);
+      m_costsVec.push_back (cost);
     }
   return m_connectionsVec.size ();
+}
 
+uint32_t
+CCNxStandardFibEntry::GetCost (Ptr<CCNxConnection> connection) const
+{
+  size_t index = FindConnection (connection);
+  if (index < m_connectionsVec.size ())
+    {
+      return m_costsVec[index];
+    }
+  return std::numeric_limits<uint32_t>::max ();
 }
 
 
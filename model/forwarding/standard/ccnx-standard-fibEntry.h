@@ -59,6 +59,7 @@
 
 #include <ns3/ccnx-connection.h>
 #include "ns3/simple-ref-count.h"
+#include <vector>
 
 
 
@@ -151,6 +152,26 @@ public:
    */
   virtual int AddConnection ( Ptr<CCNxConnection> & connection);
 
+  /**
+   * AddConnection - Add a connection with a route cost to the entry.
+   *
+   * If the connection is already in the entry, its cost is updated.
+   *
+   * @param [in] connection
+   * @param [in] cost The route cost via the connection (lower is better)
+   * @return = number of connections in m_fibEntry after adding this one.
+   */
+  virtual int AddConnection ( Ptr<CCNxConnection> & connection, uint32_t cost);
+
+  /**
+   * GetCost - return the route cost of a connection in the entry.
+   *
+   * Connections added without a cost have cost 0.
+   *
+   * @param [in] connection
+   * @return = the cost, or the largest uint32_t if the connection is not in the entry.
+   */
+  virtual uint32_t GetCost (Ptr<CCNxConnection> connection) const;
 
 
 
@@ -181,8 +202,20 @@ public:
   friend std::ostream &operator<< (std::ostream &os, CCNxStandardFibEntry  &ccnxStandardFibEntry);
 
 private:
+  /**
+   * Finds a connection in m_connectionsVec.
+   *
+   * @return The index of the connection, or m_connectionsVec.size () if not present
+   */
+  size_t FindConnection (Ptr<CCNxConnection> connection) const;
+
   ConnectionsVecType m_connectionsVec;
 
+  /*
+   * The route cost of each connection, parallel to m_connectionsVec.
+   */
+  std::vector<uint32_t> m_costsVec;
+
 
 
 };          //class
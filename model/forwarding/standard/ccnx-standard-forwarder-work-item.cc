@@ -124,3 +124,13 @@ bool CCNxStandardForwarderWorkItem::GetContentAddedFlag () const
 {
   return m_contentAddedFlag;
 }
+
+void CCNxStandardForwarderWorkItem::SetFibPrefix (Ptr<const CCNxName> prefix)
+{
+  m_fibPrefix = prefix;
+}
+
+Ptr<const CCNxName> CCNxStandardForwarderWorkItem::GetFibPrefix () const
+{
+  return m_fibPrefix;
+}
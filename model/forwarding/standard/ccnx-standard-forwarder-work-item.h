@@ -157,6 +157,20 @@ public:
   */
  bool GetContentAddedFlag () const;
 
+  /**
+   * On a successful route lookup, the FIB prefix that matched the Interest name.
+   *
+   * @param prefix [in] The matching FIB prefix
+   */
+  void SetFibPrefix (Ptr<const CCNxName> prefix);
+
+  /**
+   * The FIB prefix that matched the Interest name, or null if there was no FIB lookup or no match.
+   *
+   * @return The matching FIB prefix
+   */
+  Ptr<const CCNxName> GetFibPrefix () const;
+
 
 private:
   Ptr<CCNxConnection> m_egressConnection;
@@ -167,6 +181,8 @@ private:
   Ptr<CCNxPacket> m_contentStorePacket;
 
   bool m_contentAddedFlag;
+
+  Ptr<const CCNxName> m_fibPrefix;
 };
 
 }   /* namespace ccnx */
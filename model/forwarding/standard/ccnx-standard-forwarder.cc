@@ -60,6 +60,7 @@
 #include "ccnx-standard-forwarder.h"
 #include "ns3/ccnx-l3-protocol.h"
 #include "ns3/ccnx-routing-error.h"
+#include "ns3/ccnx-connection-l4.h"
 
 #include "ns3/ccnx-standard-content-store.h"
 #include "ns3/ccnx-standard-pit.h"
@@ -79,6 +80,7 @@ NS_OBJECT_ENSURE_REGISTERED (CCNxStandardForwarder);
 static const Time _defaultLayerDelayConstant = MicroSeconds (1);
 static const Time _defaultLayerDelaySlope = Seconds (0);
 static unsigned _defaultLayerDelayServers = 1;
+static unsigned _defaultInputQueueLimit = 0;
 
 static ObjectFactory
 GetDefaultPitFactory ()
@@ -133,6 +135,10 @@ CCNxStandardForwarder::GetTypeId ()
                    IntegerValue (_defaultLayerDelayServers),
                    MakeIntegerAccessor (&CCNxStandardForwarder::m_layerDelayServers),
                    MakeIntegerChecker<unsigned> ())
+    .AddAttribute ("InputQueueLimit", "The maximum number of packets in the input queue before Interests are returned (0 is unlimited)",
+                   IntegerValue (_defaultInputQueueLimit),
+                   MakeIntegerAccessor (&CCNxStandardForwarder::m_inputQueueLimit),
+                   MakeIntegerChecker<unsigned> ())
   ;
   return tid;
 }
@@ -142,7 +148,7 @@ CCNxStandardForwarder::CCNxStandardForwarder ()
   : m_pitFactory (GetDefaultPitFactory ()), m_fibFactory (GetDefaultFibFactory ()),
     m_contentStoreFactory (GetDefaultContentStoreFactory ()),
   m_layerDelayConstant (_defaultLayerDelayConstant), m_layerDelaySlope (_defaultLayerDelaySlope),
-  m_layerDelayServers (_defaultLayerDelayServers)
+  m_layerDelayServers (_defaultLayerDelayServers), m_inputQueueLimit (_defaultInputQueueLimit)
 {
   memset(&m_forwarderStats, 0, sizeof(m_forwarderStats));
 }
@@ -167,6 +173,10 @@ CCNxStandardForwarder::DoInitialize (void)
   m_pit = m_pitFactory.Create<CCNxPit> ();
   m_pit->SetReceiveInterestCallback (MakeCallback (&CCNxStandardForwarder::PitReceiveInterestCallback, this));
   m_pit->SetSatisfyInterestCallback (MakeCallback (&CCNxStandardForwarder::PitSatisfyInterestCallback, this));
+  m_pit->SetReceiveInterestReturnCallback (MakeCallback (&CCNxStandardForwarder::PitReceiveInterestReturnCallback, this));
+  m_pit->SetInterestSatisfiedCallback (MakeCallback (&CCNxStandardForwarder::PitInterestSatisfiedCallback, this));
+  m_pit->SetInterestReturnedCallback (MakeCallback (&CCNxStandardForwarder::PitInterestReturnedCallback, this));
+  m_pit->SetInterestTimedOutCallback (MakeCallback (&CCNxStandardForwarder::PitInterestTimedOutCallback, this));
   m_pit->Initialize ();
 
   m_fib = m_fibFactory.Create<CCNxFib> ();
@@ -223,8 +233,9 @@ CCNxStandardForwarder::ServiceInputQueue (Ptr<CCNxStandardForwarderWorkItem> ite
 
     case CCNxFixedHeaderType_InterestReturn:
       {
-        NS_ASSERT_MSG (false, "Unsupported packetType");
-        m_forwarderStats.dropUnsupportedPacketType++;
+	m_forwarderStats.interestReturnsToPit++;
+	NS_LOG_DEBUG("INTERESTRETURN: sending to PIT.  name="<< *item->GetPacket()->GetMessage()->GetName());
+        m_pit->ReceiveInterestReturn (item);
         break;
       }
 
@@ -260,6 +271,14 @@ CCNxStandardForwarder::FinishRouteLookup (Ptr<CCNxStandardForwarderWorkItem> ite
       egressConnections->push_back (item->GetEgressConnection ());
     }
 
+  // Let the PIT measure each upstream the Interest goes to
+  if (egressConnections->size () > 0
+      && item->GetPacket ()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Interest)
+    {
+      Ptr<CCNxInterest> interest = DynamicCast<CCNxInterest, CCNxMessage> (item->GetPacket ()->GetMessage ());
+      m_pit->InterestForwarded (interest, item->GetFibPrefix (), egressConnections);
+    }
+
 
   //skip this code unless debugging enabled
   if (g_log.IsEnabled(LOG_LEVEL_DEBUG))
@@ -292,6 +311,11 @@ CCNxStandardForwarder::RouteOutput (Ptr<CCNxPacket> packet,
   m_forwarderStats.RouteOutputPacketsIn++;
 
   Ptr<CCNxStandardForwarderWorkItem> item = Create<CCNxStandardForwarderWorkItem> (packet, ingressConnection, egressConnection);
+  if (RefuseIfCongested (item))
+    {
+      return;
+    }
+
   m_inputQueue->push_back (item);
 }
 
@@ -303,6 +327,26 @@ CCNxStandardForwarder::RouteInput (Ptr<CCNxPacket> packet,
   m_forwarderStats.RouteInputPacketsIn++;
 
   Ptr<CCNxStandardForwarderWorkItem> item = Create<CCNxStandardForwarderWorkItem> (packet, ingressConnection, Ptr<CCNxConnection> (0));
+
+  /*
+   * We decrement the HopLimit of an Interest from another node here, on receipt, so the PIT
+   * and FIB see the HopLimit the Interest will leave with.  An Interest that arrives with 0
+   * stays at 0.  It may still be answered by the content store or a local producer, but
+   * FibLookupCallback() will not forward it to another node.
+   */
+  if (packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Interest)
+    {
+      if (!packet->DecrementHopLimit ())
+        {
+          NS_LOG_DEBUG ("INTEREST: HopLimit 0 on receipt, only local delivery for packet=" << *packet);
+        }
+    }
+
+  if (RefuseIfCongested (item))
+    {
+      return;
+    }
+
   m_inputQueue->push_back (item);
 }
 
@@ -340,6 +384,36 @@ CCNxStandardForwarder::PitReceiveInterestCallback (Ptr<CCNxForwarderMessage> mes
     }
 }
 
+void
+CCNxStandardForwarder::PitInterestSatisfiedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt)
+{
+  NS_LOG_FUNCTION (this << name << prefix << upstream << rtt);
+  if (upstream && prefix)
+    {
+      m_fib->GetStrategy (name)->InterestSatisfied (prefix, upstream, rtt);
+    }
+}
+
+void
+CCNxStandardForwarder::PitInterestReturnedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  NS_LOG_FUNCTION (this << name << prefix << upstream);
+  if (prefix)
+    {
+      m_fib->GetStrategy (name)->InterestReturned (prefix, upstream);
+    }
+}
+
+void
+CCNxStandardForwarder::PitInterestTimedOutCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  NS_LOG_FUNCTION (this << name << prefix << upstream);
+  if (prefix)
+    {
+      m_fib->GetStrategy (name)->InterestTimedOut (prefix, upstream);
+    }
+}
+
 void
 CCNxStandardForwarder::PitSatisfyInterestCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egressConnections)
 {
@@ -391,13 +465,146 @@ CCNxStandardForwarder::FibLookupCallback (Ptr<CCNxForwarderMessage> message, Ptr
   Ptr<CCNxStandardForwarderWorkItem> item = DynamicCast<CCNxStandardForwarderWorkItem, CCNxForwarderMessage> (message);
   NS_ASSERT_MSG ( (item), "Got null dynamic cast from CCNxForwarderMessage to CCNxStandardForwarderWorkItem");
 
-  if (egressConnections && egressConnections->size() > 0) {
+  CCNxInterestReturnCode returnCode = CCNxInterestReturnCode_NoRoute;
+  if (egressConnections && item->GetPacket ()->GetFixedHeader ()->GetHopLimit () == 0)
+    {
+      bool hadRoute = egressConnections->size () > 0;
+      RemoveRemoteConnections (egressConnections);
+      if (hadRoute && egressConnections->size () == 0)
+        {
+          m_forwarderStats.interestsHopLimitExceeded++;
+          returnCode = CCNxInterestReturnCode_HopLimitExceeded;
+          item->SetRouteError (CCNxRoutingError::CCNxRoutingError_HopLimitExceeded);
+        }
+    }
+
+  bool forwarded = egressConnections && egressConnections->size() > 0;
+  if (forwarded) {
       m_forwarderStats.interestsFibForwarded++;
   } else {
       NS_LOG_ERROR ("INTEREST:no matching fib entry! discarding packet="<< *message->GetPacket());
       m_forwarderStats.interestsFibNotForwarded++;
   }
   FinishRouteLookup (item, egressConnections); //back to layer 3 protocol eventually
+
+  // Unless the user picked the egress, tell the downstream nodes now rather than letting their PIT entries expire
+  if (!forwarded && !item->GetEgressConnection ())
+    {
+      ReturnInterestViaPit (item, returnCode);
+    }
+}
+
+void
+CCNxStandardForwarder::RemoveRemoteConnections (Ptr<CCNxConnectionList> egressConnections) const
+{
+  // rotate through the list once, putting back only the local connections
+  size_t count = egressConnections->size ();
+  for (size_t i = 0; i < count; ++i)
+    {
+      Ptr<CCNxConnection> conn = egressConnections->front ();
+      egressConnections->pop_front ();
+
+      if (DynamicCast<CCNxConnectionL4, CCNxConnection> (conn))
+        {
+          egressConnections->push_back (conn);
+        }
+      else
+        {
+          NS_LOG_DEBUG ("INTEREST: HopLimit 0, not forwarding to connid " << conn->GetConnectionId ());
+        }
+    }
+}
+
+void
+CCNxStandardForwarder::PitReceiveInterestReturnCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egressConnections)
+{
+  NS_LOG_FUNCTION (message->GetPacket () << message->GetIngressConnection () << egressConnections);
+
+  Ptr<CCNxStandardForwarderWorkItem> item = DynamicCast<CCNxStandardForwarderWorkItem, CCNxForwarderMessage> (message);
+  NS_ASSERT_MSG ( (item), "Got null dynamic cast from CCNxForwarderMessage to CCNxStandardForwarderWorkItem");
+
+  if (egressConnections->size ())
+    {
+      m_forwarderStats.interestReturnsMatchedInPit++;
+    }
+  else
+    {
+      m_forwarderStats.interestReturnsNotMatchedInPit++;
+      NS_LOG_DEBUG ("INTERESTRETURN: no matching Pit Entry, discarding packet=" << *message->GetPacket ());
+    }
+
+  FinishRouteLookup (item, egressConnections);
+}
+
+bool
+CCNxStandardForwarder::RefuseIfCongested (Ptr<CCNxStandardForwarderWorkItem> item)
+{
+  if (m_inputQueueLimit == 0 || m_inputQueue->size () < m_inputQueueLimit)
+    {
+      return false;
+    }
+
+  if (item->GetPacket ()->GetFixedHeader ()->GetPacketType () != CCNxFixedHeaderType_Interest)
+    {
+      return false;
+    }
+
+  NS_LOG_DEBUG ("INTEREST: input queue full (" << m_inputQueue->size () << "), discarding packet=" << *item->GetPacket ());
+  SendInterestReturn (item, CCNxInterestReturnCode_Congestion);
+  item->SetRouteError (CCNxRoutingError::CCNxRoutingError_Congestion);
+  FinishRouteLookup (item, Ptr<CCNxConnectionList> (0));
+  return true;
+}
+
+void
+CCNxStandardForwarder::SendInterestReturn (Ptr<CCNxStandardForwarderWorkItem> item, CCNxInterestReturnCode returnCode)
+{
+  if (!item->GetIngressConnection ())
+    {
+      return;
+    }
+
+  CountInterestReturn (returnCode);
+  Ptr<CCNxPacket> interestReturn = CCNxPacket::CreateInterestReturn (item->GetPacket (), returnCode);
+  NS_LOG_DEBUG ("INTERESTRETURN: code " << returnCode << " to connid " << item->GetIngressConnection ()->GetConnectionId ());
+
+  // The egress overrides the route lookup, so this goes straight back out the ingress
+  Ptr<CCNxStandardForwarderWorkItem> returnItem =
+    Create<CCNxStandardForwarderWorkItem> (interestReturn, Ptr<CCNxConnection> (0), item->GetIngressConnection ());
+  FinishRouteLookup (returnItem, Ptr<CCNxConnectionList> (0));
+}
+
+void
+CCNxStandardForwarder::ReturnInterestViaPit (Ptr<CCNxStandardForwarderWorkItem> item, CCNxInterestReturnCode returnCode)
+{
+  CountInterestReturn (returnCode);
+  Ptr<CCNxPacket> interestReturn = CCNxPacket::CreateInterestReturn (item->GetPacket (), returnCode);
+  NS_LOG_DEBUG ("INTERESTRETURN: code " << returnCode << " sending to PIT.  name=" << *interestReturn->GetMessage ()->GetName ());
+
+  // A null ingress, like a Content Store hit, so every reverse route gets the InterestReturn
+  Ptr<CCNxStandardForwarderWorkItem> returnItem =
+    Create<CCNxStandardForwarderWorkItem> (interestReturn, Ptr<CCNxConnection> (0), Ptr<CCNxConnection> (0));
+  m_forwarderStats.interestReturnsToPit++;
+  m_pit->ReceiveInterestReturn (returnItem);
+}
+
+void
+CCNxStandardForwarder::CountInterestReturn (CCNxInterestReturnCode returnCode)
+{
+  switch (returnCode)
+    {
+    case CCNxInterestReturnCode_NoRoute:
+      m_forwarderStats.interestReturnsNoRoute++;
+      break;
+    case CCNxInterestReturnCode_HopLimitExceeded:
+      m_forwarderStats.interestReturnsHopLimitExceeded++;
+      break;
+    case CCNxInterestReturnCode_Congestion:
+      m_forwarderStats.interestReturnsCongestion++;
+      break;
+    default:
+      break;
+    }
 }
 
 void
@@ -452,19 +659,27 @@ CCNxStandardForwarder::AddRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxN
 {
   NS_LOG_FUNCTION (this);
 
-  return InnerAddRoute (connection,name);
+  bool added = false;
+
+  if (connection->GetConnectionId () != CCNxConnection::ConnIdLocalHost)  //dont add localhost entries to fib
+    {
+      // No cost given, so an existing nexthop keeps its cost and a new one costs 0
+      added = m_fib->AddRoute (name,  connection);
+    }
 
+  NS_LOG_WARN ( (added ? "Added" : "Didn't Add") << " nexthop connid " << connection->GetConnectionId () << " name " << *name);
+  return added;
 }
 
 bool
-CCNxStandardForwarder::InnerAddRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxName> name)
+CCNxStandardForwarder::InnerAddRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxName> name, uint32_t cost)
 {
-  NS_LOG_FUNCTION (this << connection << name);
+  NS_LOG_FUNCTION (this << connection << name << cost);
   bool added = false;
 
   if (connection->GetConnectionId () != CCNxConnection::ConnIdLocalHost)  //dont add localhost entries to fib
     {
-      added = m_fib->AddRoute (name,  connection);
+      added = m_fib->AddRoute (name,  connection, cost);
     }
 
   NS_LOG_WARN ( (added ? "Added" : "Didn't Add") << " nexthop connid " << connection->GetConnectionId () << " name " << *name);
@@ -502,11 +717,48 @@ CCNxStandardForwarder::AddRoute (Ptr<const CCNxRoute> route)
   for (CCNxRoute::const_iterator i = route->begin (); i != route->end (); ++i)
     {
       Ptr<const CCNxRouteEntry> entry = *i;
-      success |= AddRoute (entry->GetConnection (), entry->GetPrefix ()); //TODO CCN add cost to fibEntry - currently cost is lost! ensure cost updated if entry already exists.
+      success |= InnerAddRoute (entry->GetConnection (), entry->GetPrefix (), entry->GetCost ());
     }
   return success;
 }
 
+bool
+CCNxStandardForwarder::AddRoutes (const RouteEntryListType &entries)
+{
+  NS_LOG_FUNCTION (this << entries.size ());
+  NS_ASSERT_MSG (m_fib, "AddRoutes called before the forwarder was initialized");
+
+  RouteEntryListType fibEntries;
+  fibEntries.reserve (entries.size ());
+  for (RouteEntryListType::const_iterator i = entries.begin (); i != entries.end (); ++i)
+    {
+      if ((*i)->GetConnection ()->GetConnectionId () != CCNxConnection::ConnIdLocalHost)  //dont add localhost entries to fib
+        {
+          fibEntries.push_back (*i);
+        }
+    }
+
+  bool added = m_fib->AddRoutes (fibEntries);
+  NS_LOG_INFO ("Added " << fibEntries.size () << " of " << entries.size () << " route entries");
+  return added;
+}
+
+void
+CCNxStandardForwarder::SetForwardingStrategy (Ptr<const CCNxName> prefix, Ptr<CCNxForwardingStrategy> strategy)
+{
+  NS_LOG_FUNCTION (this << prefix << strategy);
+  NS_ASSERT_MSG (m_fib, "SetForwardingStrategy called before the forwarder was initialized");
+  m_fib->SetStrategy (prefix, strategy);
+}
+
+bool
+CCNxStandardForwarder::ClearForwardingStrategy (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << prefix);
+  NS_ASSERT_MSG (m_fib, "ClearForwardingStrategy called before the forwarder was initialized");
+  return m_fib->ClearStrategy (prefix);
+}
+
 bool
 CCNxStandardForwarder::RemoveRoute (Ptr<const CCNxRoute> route)
 {
@@ -559,10 +811,12 @@ CCNxStandardForwarder::PrintForwardingTable (Ptr<OutputStreamWrapper> streamWrap
 /*
  * Example output:
  * (time)     4 StandardForwarder Packets    In 400 Out 398 UnsupportedType 2
- * (time)     4 StandardForwarder Interests  ToPit 206 ToForward 200 ToAggregate 6
+ * (time)     4 StandardForwarder Interests  ToPit 206 ToForward 200 ToAggregate 6 HopLimitExceeded 0
  * (time)     4 StandardForwarder Interests  ToCs  200 Hits 20 Misses 180
  * (time)     4 StandardForwarder Interests  ToFib 180 Forwarded 150 NotForwarded 30
  * (time)     4 StandardForwarder Content    ToPit 192 MatchedInPit 150 NotMatchedInPit 42
+ * (time)     4 StandardForwarder Returns    ToPit 30 Matched 28 NotMatched 2 NoRoute 30 HopLimit 0 Congestion 0
+ * (time)     4 StandardForwarder Queues     Dequeued 150 OverflowDrops 0 AqmDrops 3 MeanDelay 2.1ms MaxDelay 9.8ms
  */
 void
 CCNxStandardForwarder::PrintForwardingStatistics (Ptr<OutputStreamWrapper> streamWrapper) const
@@ -585,7 +839,8 @@ CCNxStandardForwarder::PrintForwardingStatistics (Ptr<OutputStreamWrapper> strea
   *stream << std::setw(10) << "Interests" << std::setw(0);
   *stream << " ToPit " << m_forwarderStats.interestsToPit;
   *stream << " ToForward " << m_forwarderStats.interestsVerdictForward;
-  *stream << " ToAggregate " << m_forwarderStats.interestsVerdictAggregate << std::endl;
+  *stream << " ToAggregate " << m_forwarderStats.interestsVerdictAggregate;
+  *stream << " HopLimitExceeded " << m_forwarderStats.interestsHopLimitExceeded << std::endl;
 
   (*timePrinter)(*stream);
   *stream << std::setw (5) << m_node->GetId () << std::setw (0) << " StandardForwarder ";
@@ -615,6 +870,56 @@ CCNxStandardForwarder::PrintForwardingStatistics (Ptr<OutputStreamWrapper> strea
   *stream << " Added " << m_forwarderStats.contentObjectsAddedToContentStore;
   *stream << " NotAdded " << m_forwarderStats.contentObjectsNotAddedToContentStore << std::endl;
 
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId () << std::setw (0) << " StandardForwarder ";
+  *stream << std::setw(10) << "Returns" << std::setw(0);
+  *stream << " ToPit " << m_forwarderStats.interestReturnsToPit;
+  *stream << " Matched " << m_forwarderStats.interestReturnsMatchedInPit;
+  *stream << " NotMatched " << m_forwarderStats.interestReturnsNotMatchedInPit;
+  *stream << " NoRoute " << m_forwarderStats.interestReturnsNoRoute;
+  *stream << " HopLimit " << m_forwarderStats.interestReturnsHopLimitExceeded;
+  *stream << " Congestion " << m_forwarderStats.interestReturnsCongestion << std::endl;
+
+  double meanDelayMs = 0.0;
+  if (m_forwarderStats.outputQueueDequeued > 0)
+    {
+      meanDelayMs = m_forwarderStats.outputQueueDelayTotalNs / 1.0e6 / m_forwarderStats.outputQueueDequeued;
+    }
+
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId () << std::setw (0) << " StandardForwarder ";
+  *stream << std::setw(10) << "Queues" << std::setw(0);
+  *stream << " Dequeued " << m_forwarderStats.outputQueueDequeued;
+  *stream << " OverflowDrops " << m_forwarderStats.outputQueueOverflowDrops;
+  *stream << " AqmDrops " << m_forwarderStats.outputQueueAqmDrops;
+  *stream << " MeanDelay " << meanDelayMs << "ms";
+  *stream << " MaxDelay " << m_forwarderStats.outputQueueDelayMaxNs / 1.0e6 << "ms" << std::endl;
+
+}
+
+void
+CCNxStandardForwarder::NotifyOutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason)
+{
+  NS_LOG_FUNCTION (this << packet << reason);
+  if (reason == CCNxOutputQueue::DROP_AQM)
+    {
+      m_forwarderStats.outputQueueAqmDrops++;
+    }
+  else
+    {
+      m_forwarderStats.outputQueueOverflowDrops++;
+    }
+}
+
+void
+CCNxStandardForwarder::NotifyOutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn)
+{
+  m_forwarderStats.outputQueueDequeued++;
+  m_forwarderStats.outputQueueDelayTotalNs += sojourn.GetNanoSeconds ();
+  if (sojourn.GetNanoSeconds () > m_forwarderStats.outputQueueDelayMaxNs)
+    {
+      m_forwarderStats.outputQueueDelayMaxNs = sojourn.GetNanoSeconds ();
+    }
 }
 
 // ================
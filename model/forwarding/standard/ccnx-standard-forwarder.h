@@ -84,6 +84,10 @@ namespace ccnx {
  * the responsibility of the calling routine.
 *
 * Implementation compliant with the IRTF ICNRG research group documents.
+*
+* An Interest that cannot be forwarded (no route, HopLimit exceeded or a full input queue)
+* is answered with an InterestReturn, so downstream nodes and the consumer learn of the
+* failure in one round trip and release their PIT entries.
 */
 class CCNxStandardForwarder : public CCNxForwarder
 {
@@ -104,14 +108,58 @@ public:
 
   virtual bool AddRoute (Ptr<const CCNxRoute> route);
 
+  /**
+   * @copydoc CCNxForwarder::AddRoutes()
+   *
+   * Localhost entries are skipped, as in `AddRoute()`, and the rest are given to the FIB in one batch.
+   */
+  virtual bool AddRoutes (const RouteEntryListType &entries);
+
   virtual bool RemoveRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxName> name);
 
   virtual bool RemoveRoute (Ptr<const CCNxRoute> route);
 
+  /**
+   * Use a forwarding strategy for all Interests under a prefix (by longest match).
+   * The forwarder must be initialized first.
+   *
+   * Example:
+   * @code
+   * {
+   *   Ptr<CCNxStandardForwarder> forwarder = DynamicCast<CCNxStandardForwarder> (layer3->GetForwarder ());
+   *   forwarder->SetForwardingStrategy (Create<CCNxName> ("ccnx:/name=video"), CreateObject<CCNxStandardEcmpStrategy> ());
+   * }
+   * @endcode
+   *
+   * @see CCNxFib::SetStrategy()
+   *
+   * @param prefix The name prefix
+   * @param strategy The strategy to use for the prefix
+   */
+  void SetForwardingStrategy (Ptr<const CCNxName> prefix, Ptr<CCNxForwardingStrategy> strategy);
+
+  /**
+   * Go back to the FIB's default strategy for a prefix.
+   *
+   * @param prefix The name prefix
+   * @return true if the prefix had its own strategy
+   */
+  bool ClearForwardingStrategy (Ptr<const CCNxName> prefix);
+
   virtual void PrintForwardingTable (Ptr<OutputStreamWrapper> stream) const;
 
   virtual void PrintForwardingStatistics (Ptr<OutputStreamWrapper> stream) const;
 
+  /**
+   * Counts the drop in the forwarder statistics ("Queues" line of PrintForwardingStatistics()).
+   */
+  virtual void NotifyOutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason);
+
+  /**
+   * Adds the queueing delay to the forwarder statistics ("Queues" line of PrintForwardingStatistics()).
+   */
+  virtual void NotifyOutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn);
+
   typedef enum
   {
     PitTable,FibTable
@@ -137,6 +185,8 @@ private:
 
     size_t dropUnsupportedPacketType;	/*!< packets dropped due to unsupported PacketType */
 
+    size_t interestsHopLimitExceeded;	/*!< number of interests not forwarded because their HopLimit reached 0 and they had no local route */
+
     size_t interestsToPit;		/*!< number of interest sent to PIT */
     size_t interestsVerdictForward;	/*!< Number of interests from PIT to forward */
     size_t interestsVerdictAggregate;	/*!< Number of interests from PIT to aggregate */
@@ -156,19 +206,34 @@ private:
     size_t contentObjectsToContentStore;  	/*!< Number of content objects sent to Content Store */
     size_t contentObjectsAddedToContentStore;	/*!< Number of content objects added to Content Store */
     size_t contentObjectsNotAddedToContentStore; /*!< Number of content objects Not Added to Content Store */
+
+    size_t interestReturnsToPit;		/*!< number of interest returns sent to PIT */
+    size_t interestReturnsMatchedInPit;		/*!< Number of interest returns matched (positive size connection list) */
+    size_t interestReturnsNotMatchedInPit;	/*!< Number of interest returns not matched (zero size connection list) */
+
+    size_t interestReturnsNoRoute;		/*!< Number of interest returns generated for a FIB miss */
+    size_t interestReturnsHopLimitExceeded;	/*!< Number of interest returns generated for an exhausted HopLimit */
+    size_t interestReturnsCongestion;		/*!< Number of interest returns generated for a full input queue */
+
+    size_t outputQueueDequeued;			/*!< Number of packets sent from connection output queues */
+    size_t outputQueueOverflowDrops;		/*!< Number of packets dropped by full connection output queues */
+    size_t outputQueueAqmDrops;			/*!< Number of packets dropped by output queue AQM (e.g. CoDel) */
+    int64_t outputQueueDelayTotalNs;		/*!< Sum of the output queue delay of the dequeued packets (ns) */
+    int64_t outputQueueDelayMaxNs;		/*!< Longest output queue delay of a dequeued packet (ns) */
   } ForwarderStats;
 
   ForwarderStats m_forwarderStats;
 
   /**
-   *  common function for all AddRoute functions.
+   *  common function for the AddRoute functions that carry a cost.
    *
    * \param connection Pointer to connection object.
    * \param name Pointer to name object.
+   * \param cost The route cost, replacing the cost of an existing nexthop.
    * \return true if route added, false otherwise
    *
    */
-  bool InnerAddRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxName> name);
+  bool InnerAddRoute (Ptr<CCNxConnection> connection, Ptr<const CCNxName> name, uint32_t cost);
 
   /**
    *  common function for all RemoveRoute functions.
@@ -305,6 +370,15 @@ private:
    */
   unsigned m_layerDelayServers;
 
+  /**
+   * The maximum number of work items in the input queue.  When it is full, a new Interest is
+   * discarded and an InterestReturn with CCNxInterestReturnCode_Congestion is sent back to its
+   * ingress.
+   *
+   * This value is set via the attribute "InputQueueLimit".  The default is 0 (no limit).
+   */
+  unsigned m_inputQueueLimit;
+
 
   /**
    * Asynchronous callback from the Content Store after servicing a MatchInterest call.
@@ -336,6 +410,46 @@ private:
    */
   void PitSatisfyInterestCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egressConnections);
 
+  /**
+   * Callback from the PIT when a forwarded Interest is satisfied.  Passes the measurement
+   * on to the forwarding strategy of the name.  Interests forwarded without a FIB match
+   * (e.g. to an egress set by the user) are not reported.
+   *
+   * @param name [in] The Content Object name
+   * @param prefix [in] The FIB prefix the Interest was forwarded under, may be null
+   * @param upstream [in] The connection the Content Object arrived on
+   * @param rtt [in] The time from forwarding the Interest to receiving the Content Object
+   */
+  void PitInterestSatisfiedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt);
+
+  /**
+   * Callback from the PIT when an upstream returns a forwarded Interest.  Passes it
+   * on to the forwarding strategy of the name.
+   *
+   * @param name [in] The Interest name
+   * @param prefix [in] The FIB prefix the Interest was forwarded under, may be null
+   * @param upstream [in] The connection the InterestReturn arrived on
+   */
+  void PitInterestReturnedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  /**
+   * Callback from the PIT when an upstream does not answer a forwarded Interest.  Passes it
+   * on to the forwarding strategy of the name.
+   *
+   * @param name [in] The Interest name
+   * @param prefix [in] The FIB prefix the Interest was forwarded under, may be null
+   * @param upstream [in] The connection that did not answer
+   */
+  void PitInterestTimedOutCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream);
+
+  /**
+   * Asynchronous callback from the PIT after servicing a ReceiveInterestReturn call.
+   *
+   * @param message [in] The forwarder message being routed (CCNxStandardForwarderWorkItem)
+   * @param egressConnections [in] The egress connections to forward the InterestReturn on (may be empty)
+   */
+  void PitReceiveInterestReturnCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egressConnections);
+
   /**
    * Asynchronous callback from the FIB after servicing a SatisfyInterest call.
    *
@@ -344,6 +458,48 @@ private:
    */
   void FibLookupCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egressConnections);
 
+  /**
+   * An Interest whose HopLimit has reached 0 may only be given to local applications, so
+   * remove all connections that go to another node.
+   *
+   * @param egressConnections [in/out] The egress connections from the FIB
+   */
+  void RemoveRemoteConnections (Ptr<CCNxConnectionList> egressConnections) const;
+
+  /**
+   * If the input queue is at `m_inputQueueLimit`, send an InterestReturn with
+   * CCNxInterestReturnCode_Congestion to the Interest's ingress and discard the Interest.
+   *
+   * @param item [in] The Interest work item being admitted to the input queue
+   * @return true if the Interest was refused
+   */
+  bool RefuseIfCongested (Ptr<CCNxStandardForwarderWorkItem> item);
+
+  /**
+   * Send an InterestReturn for the Interest in `item` directly back to its ingress connection.
+   * This is used when the Interest never got in to the PIT.
+   *
+   * @param item [in] The Interest work item being returned
+   * @param returnCode [in] The reason the Interest is returned
+   */
+  void SendInterestReturn (Ptr<CCNxStandardForwarderWorkItem> item, CCNxInterestReturnCode returnCode);
+
+  /**
+   * Create an InterestReturn for the Interest in `item` and give it to the PIT.  The PIT removes
+   * the entry and the InterestReturn goes to every reverse route, including aggregated Interests.
+   *
+   * @param item [in] The Interest work item being returned
+   * @param returnCode [in] The reason the Interest is returned
+   */
+  void ReturnInterestViaPit (Ptr<CCNxStandardForwarderWorkItem> item, CCNxInterestReturnCode returnCode);
+
+  /**
+   * Count a generated InterestReturn in the forwarder statistics.
+   *
+   * @param returnCode [in] The reason the Interest is returned
+   */
+  void CountInterestReturn (CCNxInterestReturnCode returnCode);
+
   /**
    * Called at the end of processing a `RouteInput()` or `RouteOutput()`.
    *
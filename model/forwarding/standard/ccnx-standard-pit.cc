@@ -90,6 +90,33 @@ NullSatisfyInterestCallback (Ptr<CCNxForwarderMessage>, Ptr<CCNxConnectionList>)
   NS_ASSERT_MSG (false, "You must set the SatisfyInterest Callback via SetSatisfyInterestCallback()");
 }
 
+/**
+ * Used as a default callback for m_receiveInterestReturnCallback in case the user does not set it.
+ */
+static void
+NullReceiveInterestReturnCallback (Ptr<CCNxForwarderMessage>, Ptr<CCNxConnectionList>)
+{
+  NS_ASSERT_MSG (false, "You must set the ReceiveInterestReturn Callback via SetReceiveInterestReturnCallback()");
+}
+
+/**
+ * Used as a default callback for m_interestSatisfiedCallback.  Satisfaction events are
+ * optional, so this does nothing.
+ */
+static void
+NullInterestSatisfiedCallback (Ptr<const CCNxName>, Ptr<const CCNxName>, Ptr<CCNxConnection>, Time)
+{
+}
+
+/**
+ * Used as a default callback for m_interestReturnedCallback and m_interestTimedOutCallback.
+ * These events are optional, so this does nothing.
+ */
+static void
+NullInterestUnsatisfiedCallback (Ptr<const CCNxName>, Ptr<const CCNxName>, Ptr<CCNxConnection>)
+{
+}
+
 TypeId
 CCNxStandardPit::GetTypeId (void)
 {
@@ -101,6 +128,10 @@ CCNxStandardPit::GetTypeId (void)
                    TimeValue (_defaultLifetime),
                    MakeTimeAccessor (&CCNxStandardPit::m_defaultLifetime),
                    MakeTimeChecker ())
+    .AddAttribute ("StragglerTimeout", "How long after an Interest is satisfied a Content Object from another upstream is still measured.",
+                   TimeValue (_defaultLifetime),
+                   MakeTimeAccessor (&CCNxStandardPit::m_stragglerTimeout),
+                   MakeTimeChecker ())
     .AddAttribute ("LayerDelayConstant", "The amount of constant layer delay",
                    TimeValue (_defaultLayerDelayConstant),
                    MakeTimeAccessor (&CCNxStandardPit::m_layerDelayConstant),
@@ -122,6 +153,11 @@ CCNxStandardPit::GetTypeId (void)
 CCNxStandardPit::CCNxStandardPit () : m_defaultLifetime (_defaultLifetime),
   m_receiveInterestCallback (MakeCallback (&NullReceiveInterestCallback)),
   m_satisfyInterestCallback (MakeCallback (&NullSatisfyInterestCallback)),
+  m_receiveInterestReturnCallback (MakeCallback (&NullReceiveInterestReturnCallback)),
+  m_interestSatisfiedCallback (MakeCallback (&NullInterestSatisfiedCallback)),
+  m_interestReturnedCallback (MakeCallback (&NullInterestUnsatisfiedCallback)),
+  m_interestTimedOutCallback (MakeCallback (&NullInterestUnsatisfiedCallback)),
+  m_stragglerTimeout (_defaultLifetime),
   m_layerDelayConstant (_defaultLayerDelayConstant),
   m_layerDelaySlope (_defaultLayerDelaySlope),
   m_layerDelayServers (_defaultLayerDelayServers)
@@ -153,6 +189,30 @@ CCNxStandardPit::SetSatisfyInterestCallback (SatisfyInterestCallback satisfyInte
   m_satisfyInterestCallback = satisfyInterestCallback;
 }
 
+void
+CCNxStandardPit::SetReceiveInterestReturnCallback (ReceiveInterestReturnCallback receiveInterestReturnCallback)
+{
+  m_receiveInterestReturnCallback = receiveInterestReturnCallback;
+}
+
+void
+CCNxStandardPit::SetInterestSatisfiedCallback (InterestSatisfiedCallback interestSatisfiedCallback)
+{
+  m_interestSatisfiedCallback = interestSatisfiedCallback;
+}
+
+void
+CCNxStandardPit::SetInterestReturnedCallback (InterestUnsatisfiedCallback interestReturnedCallback)
+{
+  m_interestReturnedCallback = interestReturnedCallback;
+}
+
+void
+CCNxStandardPit::SetInterestTimedOutCallback (InterestUnsatisfiedCallback interestTimedOutCallback)
+{
+  m_interestTimedOutCallback = interestTimedOutCallback;
+}
+
 
 #define NOCLEANUP
 
@@ -185,10 +245,14 @@ CCNxStandardPit::GetServiceTime (Ptr<CCNxForwarderMessage> item)
 void
 CCNxStandardPit::ServiceInputQueue (Ptr<CCNxForwarderMessage> item)
 {
-  // Interests are input via ReceiveInterst and ContentObjets are input via SatisfyInterest.
+  // Interests are input via ReceiveInterst and ContentObjets are input via SatisfyInterest,
+  // InterestReturns are input via ReceiveInterestReturn.
   // Because we ensure this invariant before queuing a CCNxStandardWorkItem, we use that
   // invariant here to de-multiplex work items to the proper handler.
 
+  ExpireOutRecords ();
+  ExpireStragglers ();
+
   switch (item->GetPacket ()->GetFixedHeader ()->GetPacketType () )
     {
     case CCNxFixedHeaderType_Interest:
@@ -199,6 +263,10 @@ CCNxStandardPit::ServiceInputQueue (Ptr<CCNxForwarderMessage> item)
       ServiceSatisfyInterest (item);
       break;
 
+    case CCNxFixedHeaderType_InterestReturn:
+      ServiceReceiveInterestReturn (item);
+      break;
+
     default:
       NS_ASSERT_MSG (false, "ServiceInputQueue got unsupported packet type: " << *item->GetPacket ());
       break;
@@ -258,13 +326,22 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
 
   CCNxStandardPitEntry::ReverseRouteType reverseRouteSet;
 
+  // The out record of the upstream the content object came from, if the Interest was
+  // forwarded there.  Content from the content store has no upstream.
+  Ptr<CCNxConnection> upstream = item->GetIngressConnection();
+  CCNxStandardPitEntry::OutRecord record;
+  bool measured = false;
+
   if (contentObject->GetName()) {
       Ptr<CCNxStandardPitEntry> entry = LookupPitEntryByName (contentObject->GetName());
       if (entry) {
+          measured = entry->size() > 0 && FindOutRecord (entry, upstream, record);
           CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest(item->GetIngressConnection());
           reverseRouteSet.insert (aSet.begin(), aSet.end());
 
           if (entry->size() == 0) {
+              AddStragglers (contentObject->GetName(), entry, upstream);
+              entry->ClearOutRecords ();
               RemovePitEntryByName (contentObject->GetName ());
           }
 
@@ -272,6 +349,9 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
 
       } else {
 	  NS_LOG_DEBUG("Content object has name, but did not match LookupPitEntryByName");
+	  if (upstream) {
+	      measured = TakeStragglerRecord (contentObject->GetName(), upstream, record);
+	  }
       }
 
       // TODO CCN: If it has a ValidationAlgorithm and that has a KeyId do a NameAndKeyId lookup here
@@ -282,11 +362,15 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
     Ptr<CCNxHashValue> hash = Create<CCNxHashValue>(item->GetPacket()->GetContentObjectHash()->GetValue());
     Ptr<CCNxStandardPitEntry> entry = LookupPitEntryByHash (hash);
     if (entry) {
+        if (!measured) {
+            measured = entry->size() > 0 && FindOutRecord (entry, upstream, record);
+        }
         CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest(item->GetIngressConnection());
         // because it's a set, this insert will make a union
         reverseRouteSet.insert (aSet.begin(), aSet.end());
 
         if (entry->size() == 0) {
+            entry->ClearOutRecords ();
             RemovePitEntryByHash (hash);
         }
 
@@ -302,6 +386,10 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
       satisfiedConnections->push_back(*i);
   }
 
+  if (contentObject->GetName() && measured) {
+      m_interestSatisfiedCallback (contentObject->GetName(), record.prefix, upstream, Simulator::Now() - record.sendTime);
+  }
+
   NS_LOG_DEBUG ( __func__ << " returning conn list of size = " << satisfiedConnections->size () );
   if (satisfiedConnections->size ())
     {
@@ -311,6 +399,178 @@ CCNxStandardPit::ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item)
   m_satisfyInterestCallback (item, satisfiedConnections);
 }
 
+/*
+ * An InterestReturn means one upstream could not satisfy the Interest.  Only once every upstream
+ * the Interest went to has returned it is the PIT entry removed and the InterestReturn sent to all
+ * the reverse routes, so content from an upstream still pending is not dropped as unsolicited.
+ * An InterestReturn with no ingress is generated here (e.g. no route), so it fails the entry at once.
+ * Each upstream that returns the Interest is reported to the InterestReturnedCallback.
+ */
+void
+CCNxStandardPit::ServiceReceiveInterestReturn (Ptr<CCNxForwarderMessage> item)
+{
+  NS_ASSERT_MSG(item->GetPacket()->GetFixedHeader()->GetPacketType() == CCNxFixedHeaderType_InterestReturn,
+		"Packet is not an interest return: " << *item->GetPacket()->GetFixedHeader());
+
+  Ptr<CCNxInterest> interest = DynamicCast<CCNxInterest, CCNxMessage> (item->GetPacket ()->GetMessage ());
+
+  NS_LOG_DEBUG("ServiceReceiveInterestReturn for " << interest->GetName());
+
+  Ptr<CCNxConnectionList> reverseRoutes = Create<CCNxConnectionList>();
+
+  Ptr<CCNxConnection> upstream = item->GetIngressConnection();
+  Ptr<CCNxStandardPitEntry> entry = LookupPitEntry(interest);
+  CCNxStandardPitEntry::OutRecord record;
+  bool failEntry = false;
+  if (!entry) {
+      NS_LOG_DEBUG("InterestReturn did not match a pit entry");
+  } else if (!upstream) {
+      failEntry = true;
+  } else if (!FindOutRecord (entry, upstream, record)) {
+      NS_LOG_DEBUG("InterestReturn from connid " << upstream->GetConnectionId() << ", which the Interest was not sent to");
+  } else {
+      entry->RemoveOutRecord (upstream);
+      if (interest->GetName()) {
+	  m_interestReturnedCallback (interest->GetName(), record.prefix, upstream);
+      }
+
+      if (entry->GetOutRecords().empty()) {
+	  failEntry = true;
+      } else {
+	  NS_LOG_DEBUG("InterestReturn from connid " << upstream->GetConnectionId() << ", still waiting on "
+		       << entry->GetOutRecords().size() << " upstreams");
+      }
+  }
+
+  if (failEntry) {
+      CCNxStandardPitEntry::ReverseRouteType aSet = entry->SatisfyInterest(upstream);
+      for (CCNxStandardPitEntry::ReverseRouteType::iterator i = aSet.begin(); i != aSet.end(); ++i) {
+	  reverseRoutes->push_back(*i);
+      }
+
+      RemovePitEntry(interest);
+      NS_LOG_DEBUG("InterestReturn removed pit entry, reverseRoutes size = " << reverseRoutes->size());
+  }
+
+  m_receiveInterestReturnCallback (item, reverseRoutes);
+}
+
+bool
+CCNxStandardPit::FindOutRecord (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxConnection> upstream, CCNxStandardPitEntry::OutRecord & record) const
+{
+  if (!upstream) {
+      return false;
+  }
+
+  CCNxStandardPitEntry::OutRecordType::const_iterator i = entry->GetOutRecords ().find (upstream->GetConnectionId ());
+  if (i == entry->GetOutRecords ().end ()) {
+      return false;
+  }
+
+  record = i->second;
+  return true;
+}
+
+void
+CCNxStandardPit::AddStragglers (Ptr<const CCNxName> name, Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxConnection> upstream)
+{
+  ExpireStragglers ();
+
+  CCNxStandardPitEntry::OutRecordType outRecords = entry->GetOutRecords ();
+  if (upstream) {
+      outRecords.erase (upstream->GetConnectionId ());
+  }
+
+  if (!outRecords.empty()) {
+      StragglerType & straggler = m_stragglers[name];
+      straggler.outRecords.swap (outRecords);
+      straggler.expiryTime = Simulator::Now() + m_stragglerTimeout;
+      m_stragglerExpiry.push_back (std::make_pair (straggler.expiryTime, name));
+  }
+}
+
+bool
+CCNxStandardPit::TakeStragglerRecord (Ptr<const CCNxName> name, Ptr<CCNxConnection> upstream, CCNxStandardPitEntry::OutRecord & record)
+{
+  ExpireStragglers ();
+
+  StragglerMapType::iterator i = m_stragglers.find (name);
+  if (i == m_stragglers.end()) {
+      return false;
+  }
+
+  CCNxStandardPitEntry::OutRecordType::iterator found = i->second.outRecords.find (upstream->GetConnectionId ());
+  if (found == i->second.outRecords.end()) {
+      return false;
+  }
+
+  record = found->second;
+  NS_LOG_DEBUG("Straggler from connid " << upstream->GetConnectionId () << " rtt " << Simulator::Now() - record.sendTime);
+  i->second.outRecords.erase (found);
+  if (i->second.outRecords.empty()) {
+      m_stragglers.erase (i);
+  }
+  return true;
+}
+
+void
+CCNxStandardPit::ExpireStragglers ()
+{
+  Time now = Simulator::Now();
+  while (!m_stragglerExpiry.empty() && m_stragglerExpiry.front().first <= now) {
+      StragglerMapType::iterator i = m_stragglers.find (m_stragglerExpiry.front().second);
+      if (i != m_stragglers.end() && i->second.expiryTime == m_stragglerExpiry.front().first) {
+          // The upstreams still in the record never answered
+          Ptr<const CCNxName> name = i->first;
+          CCNxStandardPitEntry::OutRecordType outRecords;
+          outRecords.swap (i->second.outRecords);
+          m_stragglers.erase (i);
+          for (CCNxStandardPitEntry::OutRecordType::iterator record = outRecords.begin(); record != outRecords.end(); ++record) {
+              m_interestTimedOutCallback (name, record->second.prefix, record->second.connection);
+          }
+      }
+      m_stragglerExpiry.pop_front();
+  }
+}
+
+void
+CCNxStandardPit::ExpireOutRecords ()
+{
+  Time now = Simulator::Now();
+  while (!m_outRecordExpiry.empty() && m_outRecordExpiry.front().deadline <= now) {
+      OutRecordTimerType timer = m_outRecordExpiry.front();
+      m_outRecordExpiry.pop_front();
+
+      CCNxStandardPitEntry::OutRecord record;
+      if (FindOutRecord (timer.entry, timer.connection, record) && record.sendTime == timer.sendTime) {
+          NS_LOG_DEBUG("Interest " << *timer.name << " timed out on connid " << timer.connection->GetConnectionId ());
+          timer.entry->RemoveOutRecord (timer.connection);
+          m_interestTimedOutCallback (timer.name, record.prefix, timer.connection);
+      }
+  }
+}
+
+void
+CCNxStandardPit::InterestForwarded (Ptr<CCNxInterest> interest, Ptr<const CCNxName> prefix, Ptr<CCNxConnectionList> egress)
+{
+  Ptr<CCNxStandardPitEntry> entry = LookupPitEntry(interest);
+  if (entry) {
+      for (CCNxConnectionList::iterator i = egress->begin(); i != egress->end(); ++i) {
+          entry->AddOutRecord (*i, prefix);
+
+          if (interest->GetName()) {
+              OutRecordTimerType timer;
+              timer.deadline = Simulator::Now() + m_defaultLifetime;
+              timer.sendTime = Simulator::Now();
+              timer.entry = entry;
+              timer.name = interest->GetName();
+              timer.connection = *i;
+              m_outRecordExpiry.push_back (timer);
+          }
+      }
+  }
+}
+
 void
 CCNxStandardPit::ReceiveInterest (Ptr<CCNxForwarderMessage> item)
 {
@@ -337,6 +597,16 @@ CCNxStandardPit::SatisfyInterest (Ptr<CCNxForwarderMessage> item)
 }
 
 
+void
+CCNxStandardPit::ReceiveInterestReturn (Ptr<CCNxForwarderMessage> item)
+{
+  NS_ASSERT_MSG (item->GetPacket ()->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_InterestReturn,
+                 "ReceiveInterestReturn given a non-InterestReturn packet: " << *item->GetPacket ());
+
+  m_inputQueue->push_back (item);
+}
+
+
 // ============= LOAD AND STORE ROUTINES
 
 CCNxStandardPit::NameAndKeyIdType
@@ -469,6 +739,22 @@ CCNxStandardPit::RemovePitEntryByName(Ptr<const CCNxName> name)
   m_tableByName.erase(name);
 }
 
+void
+CCNxStandardPit::RemovePitEntry(Ptr<CCNxInterest> interest)
+{
+  // The upstreams of a removed entry no longer time out
+  Ptr<CCNxStandardPitEntry> entry = LookupPitEntry(interest);
+  if (entry) {
+      entry->ClearOutRecords();
+  }
+
+  if (interest->HasHashRestriction ()) {
+      RemovePitEntryByHash(interest->GetHashRestriction ());
+  } else if (interest->GetName ()) {
+      RemovePitEntryByName(interest->GetName ());
+  }
+}
+
 // ==============
 
 /**
@@ -477,8 +763,7 @@ CCNxStandardPit::RemovePitEntryByName(Ptr<const CCNxName> name)
 void
 CCNxStandardPit::RemoveEntry (Ptr<CCNxInterest> interest)
 {
-//TODO CCN write RemoveEntry function
-
+  RemovePitEntry (interest);
 }
 
 int
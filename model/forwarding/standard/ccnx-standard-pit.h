@@ -56,6 +56,8 @@
 #ifndef CCNS3_CCNXSTANDARDPIT_H
 #define CCNS3_CCNXSTANDARDPIT_H
 
+#include <deque>
+
 #include "ns3/ccnx-pit.h"
 
 #include "ns3/nstime.h"
@@ -97,6 +99,7 @@ namespace ccnx {
  * There are three primary methods (see  @see Parent::Method for detailed description):
  *      ReceiveInterest, which processes a new interest and returns a verdict on whether it should be forwarded.
  *	SatisfyInterest, which processes a new content and returns a list of connector ids to which it should be forwarded.
+ *	ReceiveInterestReturn, which removes the entry of a returned interest and returns the connector ids to send it to.
  *	RemoveEntry, which deletes the entire map entry corresponding to a given interest.
  *
   * This class is derived from object with a GetTypeId method to enable run-time replacement.
@@ -165,8 +168,31 @@ public:
 
   virtual void SetSatisfyInterestCallback (SatisfyInterestCallback satisfyInterestCallback);
 
+  virtual void ReceiveInterestReturn (Ptr<CCNxForwarderMessage> message);
+
+  virtual void SetReceiveInterestReturnCallback (ReceiveInterestReturnCallback receiveInterestReturnCallback);
+
+  virtual void SetInterestSatisfiedCallback (InterestSatisfiedCallback interestSatisfiedCallback);
+
+  virtual void SetInterestReturnedCallback (InterestUnsatisfiedCallback interestReturnedCallback);
+
+  virtual void SetInterestTimedOutCallback (InterestUnsatisfiedCallback interestTimedOutCallback);
+
   virtual void RemoveEntry (Ptr<CCNxInterest> interest);
 
+  /**
+   * @copydoc CCNxPit::InterestForwarded()
+   *
+   * The send times are kept per upstream connection in the PIT entry.  When a Content Object
+   * satisfies the entry, the send times of the other connections are kept for "StragglerTimeout",
+   * so a slower upstream that also answers is still measured.
+   *
+   * An upstream of a named Interest that has not answered "DefaultLifetime" after the send, or
+   * "StragglerTimeout" after another upstream satisfied the entry, is reported to the
+   * `InterestTimedOutCallback`.  Timeouts are found when the PIT services its next packet.
+   */
+  virtual void InterestForwarded (Ptr<CCNxInterest> interest, Ptr<const CCNxName> prefix, Ptr<CCNxConnectionList> egress);
+
   int CountEntries ();
 
   virtual void Print (std::ostream &os) const;
@@ -300,6 +326,13 @@ private:
    */
   void RemovePitEntryByName(Ptr<const CCNxName> name);
 
+  /**
+   * Remove the PIT entry from the table it was added to (see `AddPitEntry()`).
+   *
+   * @param interest [in] The interest whose entry to remove
+   */
+  void RemovePitEntry(Ptr<CCNxInterest> interest);
+
   // ===
 
   /**
@@ -318,6 +351,47 @@ private:
    */
   void ServiceSatisfyInterest (Ptr<CCNxForwarderMessage> item);
 
+  /**
+   * After input delay, service a ReceiveInterestReturn request and send the
+   * result to the ReceiveInterestReturnCallback.
+   *
+   * @param item [in] The work item being serviced
+   */
+  void ServiceReceiveInterestReturn (Ptr<CCNxForwarderMessage> item);
+
+  /**
+   * The out record of `upstream` in a PIT entry.
+   *
+   * @param record [out] The out record, if found
+   * @return true if the Interest was sent on `upstream`
+   */
+  bool FindOutRecord (Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxConnection> upstream, CCNxStandardPitEntry::OutRecord & record) const;
+
+  /**
+   * Keeps the send times of the upstreams other than `upstream` after the entry for `name`
+   * was satisfied, see `InterestForwarded()`.
+   */
+  void AddStragglers (Ptr<const CCNxName> name, Ptr<CCNxStandardPitEntry> entry, Ptr<CCNxConnection> upstream);
+
+  /**
+   * Removes the out record of `upstream` kept after the PIT entry for `name` was satisfied,
+   * for a Content Object from `upstream` that arrived late.  Each upstream is measured once.
+   *
+   * @param record [out] The out record, if found
+   * @return true if the Interest was outstanding on `upstream`
+   */
+  bool TakeStragglerRecord (Ptr<const CCNxName> name, Ptr<CCNxConnection> upstream, CCNxStandardPitEntry::OutRecord & record);
+
+  /**
+   * Removes the straggler records older than "StragglerTimeout".  Their upstreams timed out.
+   */
+  void ExpireStragglers ();
+
+  /**
+   * Removes the out records of pending PIT entries older than "DefaultLifetime".  Their upstreams timed out.
+   */
+  void ExpireOutRecords ();
+
 
   PitByNameType m_tableByName;
   PitByNameAndKeyIdType m_tableByNameAndKeyId;
@@ -331,6 +405,53 @@ private:
 
   ReceiveInterestCallback m_receiveInterestCallback;
   SatisfyInterestCallback m_satisfyInterestCallback;
+  ReceiveInterestReturnCallback m_receiveInterestReturnCallback;
+  InterestSatisfiedCallback m_interestSatisfiedCallback;
+  InterestUnsatisfiedCallback m_interestReturnedCallback;
+  InterestUnsatisfiedCallback m_interestTimedOutCallback;
+
+  /**
+   * When an out record of a pending PIT entry times out, see `ExpireOutRecords()`.
+   */
+  typedef struct
+  {
+    Time deadline;
+    Time sendTime;                      /*!< skipped if the out record was replaced or removed since */
+    Ptr<CCNxStandardPitEntry> entry;
+    Ptr<const CCNxName> name;
+    Ptr<CCNxConnection> connection;
+  } OutRecordTimerType;
+
+  /**
+   * The out record timers in deadline order.
+   */
+  std::deque<OutRecordTimerType> m_outRecordExpiry;
+
+  /**
+   * The upstream send times of satisfied PIT entries, see `InterestForwarded()`.
+   */
+  typedef struct
+  {
+    CCNxStandardPitEntry::OutRecordType outRecords;
+    Time expiryTime;
+  } StragglerType;
+
+  typedef std::map < Ptr<const CCNxName>, StragglerType, CCNxName::isLessPtrCCNxName > StragglerMapType;
+
+  StragglerMapType m_stragglers;
+
+  /**
+   * The straggler records in expiry order.  A name whose record was replaced later is
+   * skipped when its old expiry time comes up.
+   */
+  std::deque< std::pair<Time, Ptr<const CCNxName> > > m_stragglerExpiry;
+
+  /**
+   * How long after a PIT entry is satisfied another upstream's Content Object is still measured.
+   *
+   * This value is set via the attribute "StragglerTimeout".  The default is the default Interest lifetime.
+   */
+  Time m_stragglerTimeout;
 
   /**
    * The storage type of the CCNxDelayQueue
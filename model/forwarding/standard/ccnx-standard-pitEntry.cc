@@ -92,6 +92,44 @@ CCNxStandardPitEntry::isExpired() const
   return isExpired;
 }
 
+void
+CCNxStandardPitEntry::AddOutRecord (Ptr<CCNxConnection> egress, Ptr<const CCNxName> prefix)
+{
+  OutRecord & record = m_outRecords[egress->GetConnectionId ()];
+  record.sendTime = Simulator::Now ();
+  record.connection = egress;
+  record.prefix = prefix;
+}
+
+Time
+CCNxStandardPitEntry::GetOutRecordTime (Ptr<CCNxConnection> upstream) const
+{
+  OutRecordType::const_iterator i = m_outRecords.find (upstream->GetConnectionId ());
+  if (i == m_outRecords.end ())
+    {
+      return Seconds (-1);
+    }
+  return i->second.sendTime;
+}
+
+bool
+CCNxStandardPitEntry::RemoveOutRecord (Ptr<CCNxConnection> upstream)
+{
+  return m_outRecords.erase (upstream->GetConnectionId ()) > 0;
+}
+
+const CCNxStandardPitEntry::OutRecordType &
+CCNxStandardPitEntry::GetOutRecords () const
+{
+  return m_outRecords;
+}
+
+void
+CCNxStandardPitEntry::ClearOutRecords ()
+{
+  m_outRecords.clear ();
+}
+
 CCNxPit::Verdict
 CCNxStandardPitEntry::ReceiveInterest (Ptr<CCNxInterest> interest, Ptr<CCNxConnection> ingress, Time expiryTime)
 {
@@ -100,6 +138,7 @@ CCNxStandardPitEntry::ReceiveInterest (Ptr<CCNxInterest> interest, Ptr<CCNxConne
 
       // make sure the reverse routes are cleaned up
       m_reverseRoutes.clear();
+      m_outRecords.clear();
       m_expiryTime = Seconds(-1);
   }
 
@@ -65,6 +65,7 @@
 #include "ns3/ccnx-pit.h"
 
 #include <set>
+#include <map>
 
 namespace ns3 {
 namespace ccnx {
@@ -145,6 +146,57 @@ public:
    */
   bool isExpired() const;
 
+  /**
+   * The Interest as sent on one upstream connection.
+   */
+  typedef struct
+  {
+    Time sendTime;                      /*!< when the Interest was last sent */
+    Ptr<CCNxConnection> connection;     /*!< the upstream connection */
+    Ptr<const CCNxName> prefix;         /*!< the FIB prefix the Interest was forwarded under, may be null */
+  } OutRecord;
+
+  /**
+   * The out records, keyed by connection id.
+   */
+  typedef std::map<CCNxConnection::ConnIdType, OutRecord> OutRecordType;
+
+  /**
+   * Record that the Interest was sent upstream on `egress` now.  A retransmission on the
+   * same connection restarts its clock.
+   *
+   * @param egress [in] The upstream connection
+   * @param prefix [in] The FIB prefix the Interest was forwarded under, may be null
+   */
+  void AddOutRecord (Ptr<CCNxConnection> egress, Ptr<const CCNxName> prefix);
+
+  /**
+   * The time the Interest was last sent on `upstream`.  The difference to the time a
+   * Content Object arrives on `upstream` is the round trip time of that connection.
+   *
+   * @param upstream [in] The upstream connection
+   * @return The send time, or a negative time if the Interest was not sent on `upstream`
+   */
+  Time GetOutRecordTime (Ptr<CCNxConnection> upstream) const;
+
+  /**
+   * Forget that the Interest was sent on `upstream`, e.g. because it returned an InterestReturn.
+   *
+   * @param upstream [in] The upstream connection
+   * @return true if the Interest had been sent on `upstream`
+   */
+  bool RemoveOutRecord (Ptr<CCNxConnection> upstream);
+
+  /**
+   * All the upstream send times, see `AddOutRecord()`.
+   */
+  const OutRecordType & GetOutRecords () const;
+
+  /**
+   * Forget all the upstreams, e.g. because the entry was satisfied or removed.
+   */
+  void ClearOutRecords ();
+
   /*
    *  Two methods to display this pit entry
    */
@@ -164,6 +216,11 @@ private:
    */
   Time m_expiryTime;
 
+  /**
+   * The upstream send times, see `AddOutRecord()`.
+   */
+  OutRecordType m_outRecords;
+
 };          //class
 
 
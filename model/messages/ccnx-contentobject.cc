@@ -89,6 +89,19 @@ CCNxContentObject::CCNxContentObject ( Ptr<const CCNxName> name)
   // empty
 }
 
+CCNxContentObject::CCNxContentObject ( Ptr<const CCNxName> name, size_t virtualPayloadLength,
+                                       CCNxContentObjectPayloadType payloadType, Ptr<CCNxTime> expiryTime)
+  : CCNxMessage (name, virtualPayloadLength), m_payloadType (payloadType), m_expiryTime (expiryTime)
+{
+  // empty
+}
+
+CCNxContentObject::CCNxContentObject ( Ptr<const CCNxName> name, size_t virtualPayloadLength)
+  : CCNxMessage (name, virtualPayloadLength), m_payloadType (CCNxContentObjectPayloadType_Data), m_expiryTime (0)
+{
+  // empty
+}
+
 Ptr<CCNxTime>
 CCNxContentObject::GetExpiryTime () const
 {
@@ -117,10 +130,30 @@ CCNxContentObject::Equals (const Ptr<CCNxContentObject> other) const
 bool
 CCNxContentObject::Equals (CCNxContentObject const &other) const
 {
+  bool payloadEqual = false;
+  if (m_payload && other.m_payload)
+    {
+      payloadEqual = m_payload->Equals (*other.m_payload);
+    }
+  else if (!m_payload && !other.m_payload)
+    {
+      payloadEqual = m_virtualPayloadLength == other.m_virtualPayloadLength;
+    }
+
+  bool expiryEqual = false;
+  if (m_expiryTime && other.m_expiryTime)
+    {
+      expiryEqual = m_expiryTime->Equals (*other.m_expiryTime);
+    }
+  else
+    {
+      expiryEqual = !m_expiryTime && !other.m_expiryTime;
+    }
+
   bool result = false;
-  if (m_payload->Equals (*other.m_payload)
+  if (payloadEqual
+      && expiryEqual
       && m_name->Equals (*other.m_name)
-      && m_expiryTime->Equals (*other.m_expiryTime)
       && m_payloadType == other.m_payloadType)
     {
       result = true;
@@ -140,8 +173,12 @@ std::ostream &
 ns3::ccnx::operator<< (std::ostream &os, CCNxContentObject const &content)
 {
   os << "{ Content Object " << *content.GetName ();
-  os << ", PayloadSize " << content.GetPayload ()->GetSize ();
+  os << ", PayloadSize " << content.GetPayloadSize ();
+  if (content.HasVirtualPayload ())
+    {
+      os << " (virtual)";
+    }
   os << ", payloadType " << content.GetPayloadType ();
-  os << ", expiryTime "  << content.GetExpiryTime ()->getTime () << " }";
+  os << ", expiryTime "  << (content.GetExpiryTime () ? content.GetExpiryTime ()->getTime () : 0) << " }";
   return os;
 }
@@ -74,8 +74,10 @@ typedef enum
 /**
  * @ingroup ccnx-messages
  *
- * Class representation of a ContentObject.  The payload is not actually serialized.  If you need
- * to actually carry data bytes... not there yet.
+ * Class representation of a ContentObject.  A Content Object may carry a physical payload
+ * (a CCNxBuffer that is serialized byte for byte) or a virtual payload (only a length).
+ * A virtual payload is serialized as a T_PAYLOAD TLV whose value is the zero-filled area of
+ * the ns3::Packet, so the packet has the right size on the wire without storing the bytes.
  *
  * The keyid is part of the Validation.
  */
@@ -109,6 +111,22 @@ public:
    */
   CCNxContentObject (Ptr<const CCNxName> name);
 
+  /**
+   * Create a Content Object with a virtual payload of `virtualPayloadLength` zero bytes.
+   *
+   * @param name                 The name of the Content Object.
+   * @param virtualPayloadLength The number of virtual payload bytes.
+   * @param payloadType          The payloadType of the Content Object.
+   * @param expiryTime           The expire time (may be null).
+   */
+  CCNxContentObject (Ptr<const CCNxName> name, size_t virtualPayloadLength,
+                     CCNxContentObjectPayloadType payloadType, Ptr<CCNxTime> expiryTime);
+
+  /**
+   * Create a Content Object with a virtual payload, without payloadType and expiryTime
+   */
+  CCNxContentObject (Ptr<const CCNxName> name, size_t virtualPayloadLength);
+
   /**
    * Returns the expiry time associated with the payload of this Content Object.
    *
@@ -127,7 +145,7 @@ public:
    * Determines if the given Content Object is equivalent to this Content Object.
    *
    * Two Content Objects are equivalent if the tuples {name, payload, expiry time}
-   * are exactly equal.
+   * are exactly equal.  Two virtual payloads are equal if they have the same length.
    */
   bool Equals (const Ptr<CCNxContentObject> other) const;
 
@@ -135,7 +153,7 @@ public:
    * Determines if the given Content Object is equivalent to this Content Object.
    *
    * Two Content Objects are equivalent if the tuples {name, payload, expiry time}
-   * are exactly equal.
+   * are exactly equal.  Two virtual payloads are equal if they have the same length.
    */
   bool Equals (CCNxContentObject const &other) const;
 
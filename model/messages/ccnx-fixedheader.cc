@@ -118,6 +118,18 @@ CCNxFixedHeader::SetHopLimit (uint8_t limit)
   m_hopLimit = limit;
 }
 
+void
+CCNxFixedHeader::SetPacketType (CCNxFixedHeaderType packetType)
+{
+  m_packetType = packetType;
+}
+
+void
+CCNxFixedHeader::SetReturnCode (uint8_t returnCode)
+{
+  m_returnCode = returnCode;
+}
+
 bool
 CCNxFixedHeader::Equals (const Ptr<CCNxFixedHeader> other) const
 {
@@ -71,6 +71,24 @@ typedef enum
   CCNxFixedHeaderType_InterestReturn,
 } CCNxFixedHeaderType;
 
+/**
+ * The ReturnCode of an InterestReturn packet (RFC 8609, Section 3.2).  The value 0 is reserved
+ * and is used in Interest and ContentObject packets.
+ */
+typedef enum
+{
+  CCNxInterestReturnCode_None = 0,
+  CCNxInterestReturnCode_NoRoute = 1,
+  CCNxInterestReturnCode_HopLimitExceeded = 2,
+  CCNxInterestReturnCode_NoResources = 3,
+  CCNxInterestReturnCode_PathError = 4,
+  CCNxInterestReturnCode_Prohibited = 5,
+  CCNxInterestReturnCode_Congestion = 6,
+  CCNxInterestReturnCode_MtuTooLarge = 7,
+  CCNxInterestReturnCode_UnsupportedHashRestriction = 8,
+  CCNxInterestReturnCode_MalformedInterest = 9,
+} CCNxInterestReturnCode;
+
 /**
  * @ingroup ccnx-messages
  *
@@ -163,6 +181,20 @@ public:
    */
   void SetHopLimit (uint8_t limit);
 
+  /**
+   * Sets the PacketType of this packet.  Used to turn an Interest in to an InterestReturn.
+   *
+   * No input validation is done on this field.
+   */
+  void SetPacketType (CCNxFixedHeaderType packetType);
+
+  /**
+   * Sets the ReturnCode of this packet.  It only applies to InterestReturn packets.
+   *
+   * No input validation is done on this field.
+   */
+  void SetReturnCode (uint8_t returnCode);
+
   /**
    * Determines if two FixedHeaders are equal.  All fields must be identical.
    */
@@ -84,8 +84,6 @@ CCNxMessage::CCNxMessage (Ptr<const CCNxName> name, Ptr<CCNxBuffer> payload) :
 CCNxMessage::CCNxMessage (Ptr<const CCNxName> name, size_t virtualPayloadLength) :
   m_name (name), m_payload (Ptr<CCNxBuffer> (0)), m_virtualPayloadLength (virtualPayloadLength)
 {
-  NS_ASSERT_MSG (false, "Virtual payload size not implemented yet.");
-  std::terminate ();
   // empty
 }
 
@@ -103,7 +101,7 @@ CCNxMessage::GetName () const
 size_t
 CCNxMessage::GetPayloadSize () const
 {
-  if (HasPayload ())
+  if (m_payload)
     {
       return m_payload->GetSize ();
     }
@@ -130,6 +128,12 @@ CCNxMessage::HasPayload () const
   return result;
 }
 
+bool
+CCNxMessage::HasVirtualPayload () const
+{
+  return !m_payload && m_virtualPayloadLength > 0;
+}
+
 std::ostream &
 ns3::ccnx::operator<< (std::ostream &os, CCNxMessage const &message)
 {
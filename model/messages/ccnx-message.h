@@ -117,8 +117,8 @@ public:
   Ptr<const CCNxName> GetName () const;
 
   /**
-   * If CCNxMessage::HasPayload() is true, returns the size of the payload CCNxBuffer.  If it
-   * is false, return the virtual payload length.
+   * If the message has a physical payload, returns the size of the payload CCNxBuffer.  Otherwise,
+   * returns the virtual payload length (0 if there is no payload).
    *
    * @return The number of bytes of virtual or real payload.
    */
@@ -142,6 +142,15 @@ public:
    */
   bool HasPayload () const;
 
+  /**
+   * Returns whether the message carries a virtual payload.  The virtual bytes are counted in
+   * the serialized size of the message, but they are never stored or copied.  On the wire they
+   * are carried as the zero-filled area of the ns3::Packet.
+   *
+   * @return true if the physical payload is null and the virtual payload size is positive.
+   */
+  bool HasVirtualPayload () const;
+
   enum MessageType
   {
     Interest,
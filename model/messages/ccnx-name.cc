@@ -66,15 +66,18 @@ using namespace ns3::ccnx;
 NS_LOG_COMPONENT_DEFINE ("CCNxName");
 
 CCNxName::CCNxName ()
+  : m_hash (0), m_hashValid (false)
 {
 }
 
 CCNxName::CCNxName (const std::string &uri)
+  : m_hash (0), m_hashValid (false)
 {
   m_segments = parse_uri (uri);
 }
 
 CCNxName::CCNxName (const CCNxName &copy)
+  : m_hash (copy.m_hash), m_hashValid (copy.m_hashValid)
 {
   // allocates a new vector, but uses the same Ptr<NameSegment> inside the vector.
   m_segments = copy.m_segments;
@@ -183,6 +186,30 @@ CCNxName::IsPrefixOf (const CCNxName &other) const
   return result;
 }
 
+size_t
+CCNxName::GetHash () const
+{
+  if (!m_hashValid)
+    {
+      // FNV-1a over the type and value of each name segment
+      uint32_t hash = 2166136261U;
+      for (size_t i = 0; i < m_segments.size (); i++)
+        {
+          hash ^= (uint32_t) m_segments[i]->GetType ();
+          hash *= 16777619U;
+          const std::string &value = m_segments[i]->GetValue ();
+          for (size_t j = 0; j < value.size (); j++)
+            {
+              hash ^= (uint8_t) value[j];
+              hash *= 16777619U;
+            }
+        }
+      m_hash = hash;
+      m_hashValid = true;
+    }
+  return m_hash;
+}
+
 CCNxName::CCNxNameStorageType
 CCNxName::parse_uri (const std::string &uri)
 {
@@ -103,6 +103,30 @@ public:
     }
   };
 
+  /**
+   * Hash function of a smart pointer to a CCNx name.  Hashes the name, not the pointer,
+   * so it may be used with `isEqualPtrCCNxName` in a hash table keyed by name.
+   */
+  struct hashPtrCCNxName
+  {
+    size_t operator() (Ptr<const CCNxName> a) const
+    {
+      return a->GetHash ();
+    }
+  };
+
+  /**
+   * Function to compare two smart pointers to CCNx names for equality.  Compares the
+   * names, not the pointers.
+   */
+  struct isEqualPtrCCNxName
+  {
+    bool operator() (Ptr<const CCNxName> a, Ptr<const CCNxName> b) const
+    {
+      return a->Equals (*b);
+    }
+  };
+
   /**
    * Creates a name from the URI representation.
    * uri = "ccnx:/NAME=foo/VER=bar"
@@ -153,6 +177,14 @@ public:
    */
   bool IsPrefixOf (const CCNxName &other) const;
 
+  /**
+   * Returns a hash of the name segment types and values.  Equal names have equal hashes.
+   *
+   * Because a name is immutable once built, the hash is computed on the first call
+   * and cached.
+   */
+  size_t GetHash () const;
+
 protected:
   /**
    * Creates a name with zero name segments.
@@ -173,6 +205,12 @@ protected:
    * Internal storage of name segments.
    */
   CCNxNameStorageType m_segments;
+
+  /**
+   * The cached result of GetHash(), valid if `m_hashValid` is true.
+   */
+  mutable size_t m_hash;
+  mutable bool m_hashValid;
 };
 
 std::ostream &operator<< (std::ostream &os, const CCNxName &name);
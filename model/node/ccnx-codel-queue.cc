@@ -0,0 +1,238 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ccnx-codel-queue.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxCoDelQueue");
+NS_OBJECT_ENSURE_REGISTERED (CCNxCoDelQueue);
+
+TypeId
+CCNxCoDelQueue::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxCoDelQueue")
+    .SetParent<CCNxOutputQueue> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxCoDelQueue> ()
+    .AddAttribute ("Target",
+                   "The acceptable standing queue delay",
+                   TimeValue (MilliSeconds (5)),
+                   MakeTimeAccessor (&CCNxCoDelQueue::m_target),
+                   MakeTimeChecker ())
+    .AddAttribute ("Interval",
+                   "How long the delay must stay above Target before dropping",
+                   TimeValue (MilliSeconds (100)),
+                   MakeTimeAccessor (&CCNxCoDelQueue::m_interval),
+                   MakeTimeChecker ())
+    .AddAttribute ("Mtu",
+                   "A queue with at most this many bytes is never dropped from",
+                   UintegerValue (1500),
+                   MakeUintegerAccessor (&CCNxCoDelQueue::m_mtu),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+CCNxCoDelQueue::CCNxCoDelQueue ()
+  : m_target (MilliSeconds (5)), m_interval (MilliSeconds (100)), m_mtu (1500), m_queueBytes (0)
+{
+  ResetState (m_state);
+}
+
+CCNxCoDelQueue::~CCNxCoDelQueue ()
+{
+  // empty
+}
+
+void
+CCNxCoDelQueue::DoDispose (void)
+{
+  m_queue.clear ();
+  CCNxOutputQueue::DoDispose ();
+}
+
+void
+CCNxCoDelQueue::ResetState (CoDelStateType &state)
+{
+  state.dropping = false;
+  state.count = 0;
+  state.lastCount = 0;
+  state.firstAboveTime = Time (0);
+  state.dropNext = Time (0);
+}
+
+uint32_t
+CCNxCoDelQueue::GetControlLawCount (void) const
+{
+  return m_state.count;
+}
+
+bool
+CCNxCoDelQueue::DoEnqueue (const ItemType &item)
+{
+  if (m_queue.size () >= GetMaxPackets ())
+    {
+      return false;
+    }
+
+  m_queue.push_back (item);
+  m_queueBytes += item.bytes;
+  return true;
+}
+
+bool
+CCNxCoDelQueue::DoDequeue (ItemType &item)
+{
+  return CoDelDequeue (m_queue, m_queueBytes, m_state, item);
+}
+
+Time
+CCNxCoDelQueue::ControlLaw (Time t, uint32_t count) const
+{
+  return t + Time::FromDouble (m_interval.GetSeconds () / std::sqrt ((double) count), Time::S);
+}
+
+bool
+CCNxCoDelQueue::PopHead (FifoType &fifo, uint64_t &fifoBytes, CoDelStateType &state, ItemType &item, bool &okToDrop)
+{
+  okToDrop = false;
+  if (fifo.empty ())
+    {
+      state.firstAboveTime = Time (0);
+      return false;
+    }
+
+  item = fifo.front ();
+  fifo.pop_front ();
+  fifoBytes -= item.bytes;
+
+  Time now = Simulator::Now ();
+  Time sojourn = now - item.enqueueTime;
+  if (sojourn < m_target || fifoBytes <= m_mtu)
+    {
+      // went below target, so stay below
+      state.firstAboveTime = Time (0);
+    }
+  else if (state.firstAboveTime.IsZero ())
+    {
+      // just went above target, allow one Interval for the queue to drain
+      state.firstAboveTime = now + m_interval;
+    }
+  else if (now >= state.firstAboveTime)
+    {
+      okToDrop = true;
+    }
+  return true;
+}
+
+bool
+CCNxCoDelQueue::CoDelDequeue (FifoType &fifo, uint64_t &fifoBytes, CoDelStateType &state, ItemType &item)
+{
+  Time now = Simulator::Now ();
+  bool okToDrop;
+  bool found = PopHead (fifo, fifoBytes, state, item, okToDrop);
+
+  if (state.dropping)
+    {
+      if (!okToDrop)
+        {
+          state.dropping = false;
+        }
+
+      while (found && state.dropping && now >= state.dropNext)
+        {
+          NS_LOG_DEBUG ("Drop in dropping state, count " << state.count + 1);
+          DropItem (item, DROP_AQM);
+          state.count++;
+          found = PopHead (fifo, fifoBytes, state, item, okToDrop);
+          if (!okToDrop)
+            {
+              state.dropping = false;
+            }
+          else
+            {
+              state.dropNext = ControlLaw (state.dropNext, state.count);
+            }
+        }
+    }
+  else if (found && okToDrop)
+    {
+      NS_LOG_DEBUG ("Enter dropping state");
+      DropItem (item, DROP_AQM);
+      found = PopHead (fifo, fifoBytes, state, item, okToDrop);
+      state.dropping = true;
+
+      // if we were recently in the dropping state, start from the drop rate we had then
+      uint32_t delta = state.count - state.lastCount;
+      if (delta > 1 && now - state.dropNext < Time (16 * m_interval.GetTimeStep ()))
+        {
+          state.count = delta;
+        }
+      else
+        {
+          state.count = 1;
+        }
+      state.dropNext = ControlLaw (now, state.count);
+      state.lastCount = state.count;
+    }
+
+  return found;
+}
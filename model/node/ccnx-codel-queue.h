@@ -0,0 +1,147 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_CODEL_QUEUE_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_CODEL_QUEUE_H_
+
+#include <deque>
+#include "ns3/ccnx-output-queue.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * A FIFO output queue with CoDel active queue management (RFC 8289).
+ *
+ * CoDel looks at the sojourn time of each packet at dequeue.  Once the sojourn time
+ * has stayed above "Target" for a whole "Interval", it enters the dropping state and
+ * drops packets at the head, at intervals of Interval / sqrt(count), until the
+ * sojourn time goes below Target again.  A queue holding no more than one "Mtu" of
+ * bytes is never dropped from.  Packets arriving at a queue of "MaxPackets" are tail dropped.
+ *
+ * The CoDel dequeue works on any FIFO and its state, so CCNxFqCoDelQueue runs it on each flow.
+ */
+class CCNxCoDelQueue : public CCNxOutputQueue
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxCoDelQueue ();
+  virtual ~CCNxCoDelQueue ();
+
+  /**
+   * @return The control law `count` of RFC 8289: the drops since entering the current (or last)
+   * dropping state, plus those carried over when it was re-entered soon after leaving the previous one.
+   * It is not a total; the cumulative AQM drops are in GetStats().aqmDrops.
+   */
+  uint32_t GetControlLawCount (void) const;
+
+protected:
+  typedef std::deque<ItemType> FifoType;
+
+  /**
+   * The CoDel state variables of one FIFO, named as in RFC 8289
+   */
+  typedef struct
+  {
+    bool dropping;          /* In the dropping state */
+    uint32_t count;         /* Packets dropped since entering the dropping state */
+    uint32_t lastCount;     /* `count` when last entering the dropping state */
+    Time firstAboveTime;    /* When the sojourn time will have been above target for Interval (0 if below) */
+    Time dropNext;          /* When to drop the next packet */
+  } CoDelStateType;
+
+  static void ResetState (CoDelStateType &state);
+
+  /**
+   * Dequeue from `fifo` with CoDel.  Dropped packets are passed to DropItem() with DROP_AQM.
+   *
+   * @param fifo The FIFO to dequeue from
+   * @param fifoBytes The bytes in `fifo`, updated for every packet removed
+   * @param state The CoDel state of `fifo`
+   * @param item [out] The dequeued packet
+   * @return false if `fifo` is empty (after drops)
+   */
+  bool CoDelDequeue (FifoType &fifo, uint64_t &fifoBytes, CoDelStateType &state, ItemType &item);
+
+  virtual bool DoEnqueue (const ItemType &item);
+  virtual bool DoDequeue (ItemType &item);
+  virtual void DoDispose (void);
+
+  Time m_target;
+  Time m_interval;
+  uint32_t m_mtu;
+
+private:
+  /**
+   * Remove the head of `fifo` and decide if it may be dropped (`dodequeue` in RFC 8289).
+   *
+   * @return false if `fifo` is empty
+   */
+  bool PopHead (FifoType &fifo, uint64_t &fifoBytes, CoDelStateType &state, ItemType &item, bool &okToDrop);
+
+  Time ControlLaw (Time t, uint32_t count) const;
+
+  FifoType m_queue;
+  uint64_t m_queueBytes;
+  CoDelStateType m_state;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_CODEL_QUEUE_H_ */
@@ -0,0 +1,423 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_FLAT_HASH_MAP_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_FLAT_HASH_MAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include "ns3/assert.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * Default hash for integer keys in a `CCNxFlatHashMap`.  Uses Fibonacci (multiplicative)
+ * hashing so sequential ids, such as ConnIds and L4 instance ids, spread over the table.
+ */
+template <class K>
+struct CCNxIntegerHash
+{
+  uint32_t operator() (const K &key) const
+  {
+    uint64_t x = (uint64_t) key * 0x9E3779B97F4A7C15ULL;
+    return (uint32_t) (x >> 32);
+  }
+};
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * Default key comparison in a `CCNxFlatHashMap`, uses `operator==`.
+ */
+template <class K>
+struct CCNxKeyEqual
+{
+  bool operator() (const K &a, const K &b) const
+  {
+    return a == b;
+  }
+};
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * A hash map with open addressing and linear probing, used for the per-packet
+ * tables in the Layer 3 (e.g. neighbors by L2 address).  All entries live in one
+ * contiguous array, so a lookup is a hash plus (usually) one cache line, with no
+ * node allocation per entry as in `std::map`.
+ *
+ * N.B.: Because this is a class template, all implementation must be in the header
+ * file so the compiler can generate the template specializations from user code.
+ *
+ * The capacity is a power of 2 and the table doubles when it is more than 3/4 full.
+ * Erase uses backward-shift deletion, so there are no tombstones and lookups never
+ * get slower after many erases.  Pointers returned by Find() are only valid until
+ * the next Insert() or Erase().
+ *
+ * `H` is a functor with `uint32_t operator() (const K &) const` and `E` is a functor
+ * with `bool operator() (const K &, const K &) const`.  Keys that are equal under `E`
+ * must have the same hash.  Both `K` and `V` must be default constructible.  For
+ * example, `CCNxName::hashPtrCCNxName` and `CCNxName::isEqualPtrCCNxName` index a
+ * table by the name a `Ptr<const CCNxName>` points to.
+ *
+ * Example:
+ * @code
+ * CCNxFlatHashMap<uint32_t, Ptr<CCNxConnection> > table;
+ * table.Insert (conn->GetConnectionId (), conn);
+ * Ptr<CCNxConnection> *found = table.Find (id);
+ * @endcode
+ */
+template <class K, class V, class H = CCNxIntegerHash<K>, class E = CCNxKeyEqual<K> >
+class CCNxFlatHashMap
+{
+public:
+  CCNxFlatHashMap ()
+    : m_size (0), m_lookups (0), m_probes (0)
+  {
+  }
+
+  /**
+   * @param key The key to lookup
+   * @return A pointer to the value of `key`, or 0 if not in the table
+   */
+  V * Find (const K &key)
+  {
+    size_t slot;
+    if (Lookup (key, slot))
+      {
+        return &m_slots[slot].value;
+      }
+    return 0;
+  }
+
+  /**
+   * @param key The key to lookup
+   * @return A pointer to the value of `key`, or 0 if not in the table
+   */
+  const V * Find (const K &key) const
+  {
+    size_t slot;
+    if (Lookup (key, slot))
+      {
+        return &m_slots[slot].value;
+      }
+    return 0;
+  }
+
+  /**
+   * Insert `key` with `value`, replacing the value if `key` is already in the table.
+   *
+   * @return true if `key` is new, false if an existing value was replaced
+   */
+  bool Insert (const K &key, const V &value)
+  {
+    size_t slot;
+    if (Lookup (key, slot))
+      {
+        m_slots[slot].value = value;
+        return false;
+      }
+
+    if ((m_size + 1) * 4 > m_slots.size () * 3)
+      {
+        Grow ();
+      }
+
+    slot = HomeSlot (key);
+    while (m_slots[slot].occupied)
+      {
+        slot = (slot + 1) & Mask ();
+      }
+
+    m_slots[slot].occupied = true;
+    m_slots[slot].key = key;
+    m_slots[slot].value = value;
+    m_size++;
+    return true;
+  }
+
+  /**
+   * Remove `key` from the table.
+   *
+   * @return true if `key` was in the table
+   */
+  bool Erase (const K &key)
+  {
+    size_t hole;
+    if (!Lookup (key, hole))
+      {
+        return false;
+      }
+
+    // Backward-shift deletion: move later entries of the probe run into the hole
+    // if the hole is between their home slot and their current slot.
+    size_t next = hole;
+    for (;;)
+      {
+        next = (next + 1) & Mask ();
+        if (!m_slots[next].occupied)
+          {
+            break;
+          }
+        size_t home = HomeSlot (m_slots[next].key);
+        size_t distanceToHole = (hole - home) & Mask ();
+        size_t distanceToNext = (next - home) & Mask ();
+        if (distanceToHole < distanceToNext)
+          {
+            m_slots[hole] = m_slots[next];
+            hole = next;
+          }
+      }
+
+    m_slots[hole] = Slot ();
+    m_size--;
+    return true;
+  }
+
+  /**
+   * Remove all entries and release the table
+   */
+  void Clear ()
+  {
+    m_slots.clear ();
+    m_size = 0;
+  }
+
+  /**
+   * @return The number of entries in the table
+   */
+  size_t Size () const
+  {
+    return m_size;
+  }
+
+  /**
+   * @return true if there are no entries
+   */
+  bool Empty () const
+  {
+    return m_size == 0;
+  }
+
+  /**
+   * @return The number of slots in the table (0 or a power of 2)
+   */
+  size_t Capacity () const
+  {
+    return m_slots.size ();
+  }
+
+  /**
+   * Slot access to walk the table.  For each `slot < Capacity()` with
+   * `IsOccupied(slot)`, KeyAt() and ValueAt() return the entry.  The order
+   * is not meaningful.
+   */
+  bool IsOccupied (size_t slot) const
+  {
+    return m_slots[slot].occupied;
+  }
+
+  /**
+   * @see IsOccupied
+   */
+  const K & KeyAt (size_t slot) const
+  {
+    NS_ASSERT_MSG (m_slots[slot].occupied, "Slot " << slot << " is empty");
+    return m_slots[slot].key;
+  }
+
+  /**
+   * @see IsOccupied
+   */
+  V & ValueAt (size_t slot)
+  {
+    NS_ASSERT_MSG (m_slots[slot].occupied, "Slot " << slot << " is empty");
+    return m_slots[slot].value;
+  }
+
+  /**
+   * @see IsOccupied
+   */
+  const V & ValueAt (size_t slot) const
+  {
+    NS_ASSERT_MSG (m_slots[slot].occupied, "Slot " << slot << " is empty");
+    return m_slots[slot].value;
+  }
+
+  /**
+   * @return The number of Find(), Insert() and Erase() lookups done
+   */
+  uint64_t GetLookupCount () const
+  {
+    return m_lookups;
+  }
+
+  /**
+   * @return The number of slots examined by all lookups.  GetProbeCount() / GetLookupCount()
+   * is the mean probe length.
+   */
+  uint64_t GetProbeCount () const
+  {
+    return m_probes;
+  }
+
+  /**
+   * Walks the table, so it is O(Capacity()).
+   *
+   * @return The longest distance of an entry from its home slot, plus 1 (0 if empty)
+   */
+  size_t GetMaxProbeLength () const
+  {
+    size_t longest = 0;
+    for (size_t slot = 0; slot < m_slots.size (); slot++)
+      {
+        if (m_slots[slot].occupied)
+          {
+            size_t length = ((slot - HomeSlot (m_slots[slot].key)) & Mask ()) + 1;
+            if (length > longest)
+              {
+                longest = length;
+              }
+          }
+      }
+    return longest;
+  }
+
+private:
+  struct Slot
+  {
+    Slot () : occupied (false), key (), value ()
+    {
+    }
+
+    bool occupied;
+    K key;
+    V value;
+  };
+
+  size_t Mask () const
+  {
+    return m_slots.size () - 1;
+  }
+
+  size_t HomeSlot (const K &key) const
+  {
+    return m_hash (key) & Mask ();
+  }
+
+  /**
+   * Find `key`.  If found, set `slot` to its position and return true.
+   */
+  bool Lookup (const K &key, size_t &slot) const
+  {
+    m_lookups++;
+    if (m_size == 0)
+      {
+        return false;
+      }
+
+    slot = HomeSlot (key);
+    for (;;)
+      {
+        m_probes++;
+        if (!m_slots[slot].occupied)
+          {
+            return false;
+          }
+        if (m_equal (m_slots[slot].key, key))
+          {
+            return true;
+          }
+        slot = (slot + 1) & Mask ();
+      }
+  }
+
+  void Grow ()
+  {
+    std::vector<Slot> old;
+    old.swap (m_slots);
+    m_slots.resize (old.empty () ? 16 : old.size () * 2);
+
+    for (size_t i = 0; i < old.size (); i++)
+      {
+        if (old[i].occupied)
+          {
+            size_t slot = HomeSlot (old[i].key);
+            while (m_slots[slot].occupied)
+              {
+                slot = (slot + 1) & Mask ();
+              }
+            m_slots[slot] = old[i];
+          }
+      }
+  }
+
+  std::vector<Slot> m_slots;
+  size_t m_size;
+  H m_hash;
+  E m_equal;
+
+  mutable uint64_t m_lookups;
+  mutable uint64_t m_probes;
+};
+
+}   /* namespace ccnx */
+}   /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_FLAT_HASH_MAP_H_ */
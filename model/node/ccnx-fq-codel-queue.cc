@@ -0,0 +1,259 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ccnx-fq-codel-queue.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxFqCoDelQueue");
+NS_OBJECT_ENSURE_REGISTERED (CCNxFqCoDelQueue);
+
+TypeId
+CCNxFqCoDelQueue::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxFqCoDelQueue")
+    .SetParent<CCNxCoDelQueue> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxFqCoDelQueue> ()
+    .AddAttribute ("Flows",
+                   "The number of flow buckets",
+                   UintegerValue (1024),
+                   MakeUintegerAccessor (&CCNxFqCoDelQueue::m_flowCount),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("Quantum",
+                   "The bytes a flow may send in each round of deficit round robin",
+                   UintegerValue (1500),
+                   MakeUintegerAccessor (&CCNxFqCoDelQueue::m_quantum),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("FlowPrefixSegments",
+                   "The number of name segments that identify a flow (0 uses the whole name)",
+                   UintegerValue (2),
+                   MakeUintegerAccessor (&CCNxFqCoDelQueue::m_flowPrefixSegments),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+CCNxFqCoDelQueue::CCNxFqCoDelQueue ()
+  : m_flowCount (1024), m_quantum (1500), m_flowPrefixSegments (2)
+{
+  // empty
+}
+
+CCNxFqCoDelQueue::~CCNxFqCoDelQueue ()
+{
+  // empty
+}
+
+void
+CCNxFqCoDelQueue::DoDispose (void)
+{
+  m_flows.clear ();
+  m_newFlows.clear ();
+  m_oldFlows.clear ();
+  CCNxCoDelQueue::DoDispose ();
+}
+
+uint32_t
+CCNxFqCoDelQueue::GetFlowIndex (Ptr<const CCNxPacket> packet) const
+{
+  Ptr<const CCNxName> name = packet->GetMessage ()->GetName ();
+  if (!name)
+    {
+      return 0;
+    }
+
+  size_t segments = name->GetSegmentCount ();
+  if (m_flowPrefixSegments > 0 && m_flowPrefixSegments < segments)
+    {
+      segments = m_flowPrefixSegments;
+    }
+
+  // FNV-1a over the type and value of each segment of the prefix
+  uint32_t hash = 2166136261U;
+  for (size_t i = 0; i < segments; i++)
+    {
+      Ptr<const CCNxNameSegment> segment = name->GetSegment (i);
+      hash ^= (uint32_t) segment->GetType ();
+      hash *= 16777619U;
+      const std::string &value = segment->GetValue ();
+      for (size_t j = 0; j < value.size (); j++)
+        {
+          hash ^= (uint8_t) value[j];
+          hash *= 16777619U;
+        }
+    }
+  return hash % m_flowCount;
+}
+
+size_t
+CCNxFqCoDelQueue::GetNActiveFlows (void) const
+{
+  return m_newFlows.size () + m_oldFlows.size ();
+}
+
+bool
+CCNxFqCoDelQueue::DoEnqueue (const ItemType &item)
+{
+  if (m_flows.size () != m_flowCount)
+    {
+      NS_ASSERT_MSG (m_flows.empty (), "Cannot change the number of flows of a non-empty queue");
+      m_flows.resize (m_flowCount);
+      for (uint32_t i = 0; i < m_flowCount; i++)
+        {
+          m_flows[i].bytes = 0;
+          ResetState (m_flows[i].codel);
+          m_flows[i].deficit = 0;
+          m_flows[i].status = FLOW_INACTIVE;
+        }
+    }
+
+  uint32_t index = GetFlowIndex (item.packet);
+  FlowType &flow = m_flows[index];
+  flow.queue.push_back (item);
+  flow.bytes += item.bytes;
+
+  if (flow.status == FLOW_INACTIVE)
+    {
+      flow.status = FLOW_NEW;
+      flow.deficit = m_quantum;
+      m_newFlows.push_back (index);
+    }
+
+  if (GetNPackets () > GetMaxPackets ())
+    {
+      DropFromLongestFlow ();
+    }
+  return true;
+}
+
+void
+CCNxFqCoDelQueue::DropFromLongestFlow (void)
+{
+  uint32_t longest = 0;
+  for (uint32_t i = 1; i < m_flows.size (); i++)
+    {
+      if (m_flows[i].bytes > m_flows[longest].bytes)
+        {
+          longest = i;
+        }
+    }
+
+  FlowType &flow = m_flows[longest];
+  NS_ASSERT_MSG (!flow.queue.empty (), "Queue over limit but the longest flow is empty");
+
+  ItemType item = flow.queue.front ();
+  flow.queue.pop_front ();
+  flow.bytes -= item.bytes;
+  NS_LOG_DEBUG ("Overflow, drop from flow " << longest << " with " << flow.bytes << " bytes left");
+  DropItem (item, DROP_OVERFLOW);
+}
+
+bool
+CCNxFqCoDelQueue::DoDequeue (ItemType &item)
+{
+  for (;;)
+    {
+      std::list<uint32_t> *flowList;
+      if (!m_newFlows.empty ())
+        {
+          flowList = &m_newFlows;
+        }
+      else if (!m_oldFlows.empty ())
+        {
+          flowList = &m_oldFlows;
+        }
+      else
+        {
+          return false;
+        }
+
+      uint32_t index = flowList->front ();
+      FlowType &flow = m_flows[index];
+
+      if (flow.deficit <= 0)
+        {
+          // used up its quantum, go to the back of the old flows
+          flow.deficit += m_quantum;
+          flowList->pop_front ();
+          m_oldFlows.push_back (index);
+          flow.status = FLOW_OLD;
+          continue;
+        }
+
+      if (!CoDelDequeue (flow.queue, flow.bytes, flow.codel, item))
+        {
+          flowList->pop_front ();
+          if (flowList == &m_newFlows && !m_oldFlows.empty ())
+            {
+              // an emptied new flow goes through the old list once, so it cannot
+              // re-enter as a new flow to starve the old ones
+              m_oldFlows.push_back (index);
+              flow.status = FLOW_OLD;
+            }
+          else
+            {
+              flow.status = FLOW_INACTIVE;
+            }
+          continue;
+        }
+
+      flow.deficit -= item.bytes;
+      return true;
+    }
+}
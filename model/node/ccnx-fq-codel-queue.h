@@ -0,0 +1,137 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_FQ_CODEL_QUEUE_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_FQ_CODEL_QUEUE_H_
+
+#include <list>
+#include <vector>
+#include "ns3/ccnx-codel-queue.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * A fair queueing output queue with CoDel on each flow (FQ-CoDel, RFC 8290).
+ *
+ * A flow is the first "FlowPrefixSegments" name segments of the packet's name, so
+ * the Interests (or Content Objects) of different name prefixes do not share a FIFO.
+ * The prefix is hashed into one of "Flows" buckets.  Flows are served by deficit round
+ * robin with a "Quantum" of bytes, with new flows served before old ones, and each flow
+ * runs the CoDel dequeue of CCNxCoDelQueue (using its "Target", "Interval" and "Mtu").
+ *
+ * When the queue holds more than "MaxPackets", the packet at the head of the flow with the
+ * largest backlog is dropped, so one prefix cannot push out the others.
+ */
+class CCNxFqCoDelQueue : public CCNxCoDelQueue
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxFqCoDelQueue ();
+  virtual ~CCNxFqCoDelQueue ();
+
+  /**
+   * @return The flow bucket of `packet`
+   */
+  uint32_t GetFlowIndex (Ptr<const CCNxPacket> packet) const;
+
+  /**
+   * @return The number of flows with queued packets or on the new/old flow lists
+   */
+  size_t GetNActiveFlows (void) const;
+
+protected:
+  virtual bool DoEnqueue (const ItemType &item);
+  virtual bool DoDequeue (ItemType &item);
+  virtual void DoDispose (void);
+
+private:
+  typedef enum
+  {
+    FLOW_INACTIVE,
+    FLOW_NEW,
+    FLOW_OLD
+  } FlowStatus;
+
+  typedef struct
+  {
+    FifoType queue;
+    uint64_t bytes;
+    CoDelStateType codel;
+    int64_t deficit;
+    FlowStatus status;
+  } FlowType;
+
+  /**
+   * Drop the head packet of the flow with the largest backlog
+   */
+  void DropFromLongestFlow (void);
+
+  uint32_t m_flowCount;
+  uint32_t m_quantum;
+  uint32_t m_flowPrefixSegments;
+
+  std::vector<FlowType> m_flows;
+  std::list<uint32_t> m_newFlows;
+  std::list<uint32_t> m_oldFlows;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_FQ_CODEL_QUEUE_H_ */
@@ -0,0 +1,283 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
+#include "ccnx-interest-shaper.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxInterestShaper");
+NS_OBJECT_ENSURE_REGISTERED (CCNxInterestShaper);
+
+TypeId
+CCNxInterestShaper::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxInterestShaper")
+    .SetParent<Object> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxInterestShaper> ()
+    .AddAttribute ("LinkRate",
+                   "The rate available to the returning Content Objects.  0 uses the DataRate of the NetDevice.",
+                   DataRateValue (DataRate (0)),
+                   MakeDataRateAccessor (&CCNxInterestShaper::m_linkRate),
+                   MakeDataRateChecker ())
+    .AddAttribute ("ExpectedDataSize",
+                   "The Content Object size (bytes) to assume before any are received",
+                   UintegerValue (1500),
+                   MakeUintegerAccessor (&CCNxInterestShaper::m_initialDataSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("DataSizeGain",
+                   "The weight of each new Content Object in the expected size average",
+                   DoubleValue (0.125),
+                   MakeDoubleAccessor (&CCNxInterestShaper::m_dataSizeGain),
+                   MakeDoubleChecker<double> (0.0, 1.0))
+    .AddAttribute ("MaxQueue",
+                   "The maximum number of Interests waiting to be sent",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&CCNxInterestShaper::m_maxQueue),
+                   MakeUintegerChecker<uint32_t> ())
+    .AddAttribute ("BurstSize",
+                   "The number of Interests that may be sent back-to-back",
+                   DoubleValue (4.0),
+                   MakeDoubleAccessor (&CCNxInterestShaper::m_burstSize),
+                   MakeDoubleChecker<double> (1.0))
+    .AddAttribute ("NackOnDrop",
+                   "Answer an Interest dropped by a full queue with a Congestion InterestReturn",
+                   BooleanValue (true),
+                   MakeBooleanAccessor (&CCNxInterestShaper::m_nackOnDrop),
+                   MakeBooleanChecker ())
+  ;
+  return tid;
+}
+
+CCNxInterestShaper::CCNxInterestShaper ()
+  : m_linkRate (0), m_defaultLinkRate (0), m_initialDataSize (1500), m_dataSizeGain (0.125),
+    m_maxQueue (100), m_burstSize (4.0), m_nackOnDrop (true), m_expectedDataSize (0), m_tokens (-1)
+{
+  m_stats.sent = 0;
+  m_stats.delayed = 0;
+  m_stats.dropped = 0;
+}
+
+CCNxInterestShaper::~CCNxInterestShaper ()
+{
+  m_releaseEvent.Cancel ();
+}
+
+void
+CCNxInterestShaper::DoDispose (void)
+{
+  m_releaseEvent.Cancel ();
+  m_queue.clear ();
+  m_sendCallback = SendCallback ();
+  Object::DoDispose ();
+}
+
+void
+CCNxInterestShaper::SetSendCallback (SendCallback callback)
+{
+  m_sendCallback = callback;
+}
+
+void
+CCNxInterestShaper::SetDefaultLinkRate (DataRate rate)
+{
+  m_defaultLinkRate = rate;
+}
+
+DataRate
+CCNxInterestShaper::GetLinkRate (void) const
+{
+  return m_linkRate.GetBitRate () > 0 ? m_linkRate : m_defaultLinkRate;
+}
+
+double
+CCNxInterestShaper::GetExpectedDataSize (void) const
+{
+  return m_expectedDataSize > 0 ? m_expectedDataSize : m_initialDataSize;
+}
+
+double
+CCNxInterestShaper::GetInterestRate (void) const
+{
+  return GetLinkRate ().GetBitRate () / 8.0 / GetExpectedDataSize ();
+}
+
+size_t
+CCNxInterestShaper::GetNQueued (void) const
+{
+  return m_queue.size ();
+}
+
+bool
+CCNxInterestShaper::GetNackOnDrop (void) const
+{
+  return m_nackOnDrop;
+}
+
+CCNxInterestShaper::Stats
+CCNxInterestShaper::GetStats (void) const
+{
+  return m_stats;
+}
+
+void
+CCNxInterestShaper::ObserveData (uint32_t bytes)
+{
+  if (m_expectedDataSize > 0)
+    {
+      m_expectedDataSize += m_dataSizeGain * (bytes - m_expectedDataSize);
+    }
+  else
+    {
+      m_expectedDataSize = bytes;
+    }
+  NS_LOG_DEBUG ("Content Object " << bytes << " bytes, expected size " << m_expectedDataSize);
+}
+
+void
+CCNxInterestShaper::Refill (void)
+{
+  Time now = Simulator::Now ();
+  if (m_tokens < 0)
+    {
+      // start with a full bucket
+      m_tokens = m_burstSize;
+    }
+  else
+    {
+      m_tokens += (now - m_lastRefill).GetSeconds () * GetInterestRate ();
+      if (m_tokens > m_burstSize)
+        {
+          m_tokens = m_burstSize;
+        }
+    }
+  m_lastRefill = now;
+}
+
+bool
+CCNxInterestShaper::Enqueue (Ptr<CCNxPacket> interest)
+{
+  NS_LOG_FUNCTION (this << interest);
+
+  if (GetLinkRate ().GetBitRate () == 0)
+    {
+      // no rate to shape to
+      Send (interest);
+      return true;
+    }
+
+  Refill ();
+  if (m_queue.empty () && m_tokens >= 1.0)
+    {
+      m_tokens -= 1.0;
+      Send (interest);
+      return true;
+    }
+
+  if (m_queue.size () >= m_maxQueue)
+    {
+      NS_LOG_DEBUG ("Queue full (" << m_queue.size () << "), dropping Interest");
+      m_stats.dropped++;
+      return false;
+    }
+
+  m_queue.push_back (interest);
+  m_stats.delayed++;
+  if (!m_releaseEvent.IsRunning ())
+    {
+      Release ();
+    }
+  return true;
+}
+
+void
+CCNxInterestShaper::Send (Ptr<CCNxPacket> interest)
+{
+  m_stats.sent++;
+  if (!m_sendCallback.IsNull ())
+    {
+      m_sendCallback (interest);
+    }
+}
+
+void
+CCNxInterestShaper::Release (void)
+{
+  Refill ();
+  while (!m_queue.empty () && m_tokens >= 1.0)
+    {
+      Ptr<CCNxPacket> interest = m_queue.front ();
+      m_queue.pop_front ();
+      m_tokens -= 1.0;
+      Send (interest);
+    }
+
+  if (!m_queue.empty ())
+    {
+      // wait until the next token
+      Time wait = Seconds ((1.0 - m_tokens) / GetInterestRate ());
+      if (wait < NanoSeconds (1))
+        {
+          wait = NanoSeconds (1);
+        }
+      m_releaseEvent = Simulator::Schedule (wait, &CCNxInterestShaper::Release, this);
+    }
+}
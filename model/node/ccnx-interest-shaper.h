@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_INTEREST_SHAPER_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_INTEREST_SHAPER_H_
+
+#include <deque>
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/data-rate.h"
+#include "ns3/ccnx-packet.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * Shapes the Interests leaving on one connection so the Content Objects they bring back
+ * fit in the link.  Each Interest asks for about one Content Object, so the shaper limits
+ * Interests to
+ *
+ *     rate = "LinkRate" / expected Content Object size
+ *
+ * The expected size starts at "ExpectedDataSize" and is an exponentially weighted moving
+ * average (gain "DataSizeGain") of the Content Objects received on the connection, reported
+ * with ObserveData().  A token bucket of "BurstSize" Interests lets short bursts through.
+ *
+ * Interests over the rate wait in a FIFO of up to "MaxQueue" Interests and are released as
+ * tokens arrive.  When the FIFO is full Enqueue() returns false, and the caller drops the
+ * Interest or answers it with an InterestReturn (see "NackOnDrop").
+ *
+ * Because Content follows Interests on the reverse path, shaping the Interests at each hop
+ * keeps the Content Objects from overloading the downstream links (e.g. many producers
+ * answering one aggregation router).
+ */
+class CCNxInterestShaper : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxInterestShaper ();
+  virtual ~CCNxInterestShaper ();
+
+  /**
+   * Called with each Interest the shaper releases
+   */
+  typedef Callback<bool, Ptr<CCNxPacket> > SendCallback;
+
+  void SetSendCallback (SendCallback callback);
+
+  /**
+   * The link rate to use when the "LinkRate" attribute is 0 (e.g. the NetDevice's DataRate).
+   */
+  void SetDefaultLinkRate (DataRate rate);
+
+  /**
+   * Send `interest` now if the rate allows, otherwise queue it.
+   *
+   * @return false if the queue is full and `interest` was not accepted
+   */
+  bool Enqueue (Ptr<CCNxPacket> interest);
+
+  /**
+   * Learn from a Content Object of `bytes` bytes received on the connection.
+   */
+  void ObserveData (uint32_t bytes);
+
+  /**
+   * @return The current Interest rate limit in Interests per second (0 if no link rate is known)
+   */
+  double GetInterestRate (void) const;
+
+  /**
+   * @return The expected Content Object size in bytes
+   */
+  double GetExpectedDataSize (void) const;
+
+  /**
+   * @return The number of Interests waiting
+   */
+  size_t GetNQueued (void) const;
+
+  /**
+   * @return true if a dropped Interest should be answered with an InterestReturn ("NackOnDrop")
+   */
+  bool GetNackOnDrop (void) const;
+
+  typedef struct
+  {
+    uint64_t sent;        /* Interests released */
+    uint64_t delayed;     /* Interests that waited in the queue */
+    uint64_t dropped;     /* Interests refused because the queue was full */
+  } Stats;
+
+  Stats GetStats (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  DataRate GetLinkRate (void) const;
+
+  /**
+   * Pass `interest` to the SendCallback
+   */
+  void Send (Ptr<CCNxPacket> interest);
+
+  /**
+   * Add the tokens earned since the last refill
+   */
+  void Refill (void);
+
+  /**
+   * Release the queued Interests there are tokens for, and schedule the next release
+   */
+  void Release (void);
+
+  DataRate m_linkRate;
+  DataRate m_defaultLinkRate;
+  uint32_t m_initialDataSize;
+  double m_dataSizeGain;
+  uint32_t m_maxQueue;
+  double m_burstSize;
+  bool m_nackOnDrop;
+
+  double m_expectedDataSize;
+  double m_tokens;
+  Time m_lastRefill;
+
+  std::deque< Ptr<CCNxPacket> > m_queue;
+  EventId m_releaseEvent;
+  SendCallback m_sendCallback;
+  Stats m_stats;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_INTEREST_SHAPER_H_ */
@@ -306,6 +306,18 @@ public:
     */
   virtual Ptr<CCNxConnectionDevice> AddNeighbor (Address nexthop, Ptr<NetDevice>) = 0;
 
+  /**
+    * Return the neighbor adjacency to `nexthop`, creating it with AddNeighbor() only if there
+    * is none yet.  Use this rather than AddNeighbor() to configure a neighbor that may already
+    * exist (e.g. learned from a received frame, or configured by another helper), so there is
+    * one connection per neighbor.
+    *
+    * @param [in] nexthop Mac address of the neighbor's interface
+    * @param [in] device Device object through which neighbor is reachable
+    * @return Pointer to the ConnectionDevice object
+    */
+  virtual Ptr<CCNxConnectionDevice> GetNeighbor (Address nexthop, Ptr<NetDevice>) = 0;
+
   /**
    * @return The connection object associated with the connection Id
    */
@@ -324,6 +336,7 @@ public:
     DROP_NO_ROUTE,          /**< No route to host */
     DROP_INTERFACE_DOWN,    /**< Interface is down so can not send packet */
     DROP_ROUTE_ERROR,       /**< Route error */
+    DROP_CONGESTION,        /**< Forwarder input queue is full */
   };
 
   /**
@@ -0,0 +1,250 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ccnx-output-queue.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxOutputQueue");
+NS_OBJECT_ENSURE_REGISTERED (CCNxOutputQueue);
+
+TypeId
+CCNxOutputQueue::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxOutputQueue")
+    .SetParent<Object> ()
+    .SetGroupName ("CCNx")
+    .AddAttribute ("MaxPackets",
+                   "The maximum number of packets in the queue",
+                   UintegerValue (1000),
+                   MakeUintegerAccessor (&CCNxOutputQueue::m_maxPackets),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("LinkRate",
+                   "The rate to transmit from the queue.  0 uses the DataRate attribute of the NetDevice.",
+                   DataRateValue (DataRate (0)),
+                   MakeDataRateAccessor (&CCNxOutputQueue::m_linkRate),
+                   MakeDataRateChecker ())
+    .AddAttribute ("LinkOverhead",
+                   "The bytes the link layer adds to each packet, counted when pacing at the link rate.  "
+                   "The default is an Ethernet header and FCS; over-estimating only paces a little below the link rate.",
+                   UintegerValue (18),
+                   MakeUintegerAccessor (&CCNxOutputQueue::m_linkOverhead),
+                   MakeUintegerChecker<uint32_t> ())
+  ;
+  return tid;
+}
+
+CCNxOutputQueue::CCNxOutputQueue ()
+  : m_maxPackets (1000), m_linkRate (0), m_linkOverhead (18), m_packets (0), m_bytes (0)
+{
+  m_stats.enqueued = 0;
+  m_stats.dequeued = 0;
+  m_stats.overflowDrops = 0;
+  m_stats.aqmDrops = 0;
+}
+
+CCNxOutputQueue::~CCNxOutputQueue ()
+{
+  // empty
+}
+
+void
+CCNxOutputQueue::DoDispose (void)
+{
+  m_dropCallback = DropCallback ();
+  m_dequeueCallback = DequeueCallback ();
+  Object::DoDispose ();
+}
+
+bool
+CCNxOutputQueue::Enqueue (Ptr<CCNxPacket> packet)
+{
+  NS_LOG_FUNCTION (this << packet);
+
+  ItemType item;
+  item.packet = packet;
+  item.enqueueTime = Simulator::Now ();
+  item.bytes = packet->GetNs3Packet ()->GetSize ();
+
+  m_packets++;
+  m_bytes += item.bytes;
+
+  if (DoEnqueue (item))
+    {
+      m_stats.enqueued++;
+      return true;
+    }
+
+  m_packets--;
+  m_bytes -= item.bytes;
+  m_stats.overflowDrops++;
+  NS_LOG_DEBUG ("Overflow drop, queue has " << m_packets << " packets");
+  if (!m_dropCallback.IsNull ())
+    {
+      m_dropCallback (packet, DROP_OVERFLOW);
+    }
+  return false;
+}
+
+Ptr<CCNxPacket>
+CCNxOutputQueue::Dequeue (void)
+{
+  NS_LOG_FUNCTION (this);
+
+  ItemType item;
+  if (!DoDequeue (item))
+    {
+      return Ptr<CCNxPacket> (0);
+    }
+
+  NS_ASSERT_MSG (m_packets > 0, "Dequeue from a queue with no packets");
+  m_packets--;
+  m_bytes -= item.bytes;
+
+  Time sojourn = Simulator::Now () - item.enqueueTime;
+  m_stats.dequeued++;
+  m_stats.totalSojourn += sojourn;
+  if (sojourn > m_stats.maxSojourn)
+    {
+      m_stats.maxSojourn = sojourn;
+    }
+
+  if (!m_dequeueCallback.IsNull ())
+    {
+      m_dequeueCallback (item.packet, sojourn);
+    }
+  return item.packet;
+}
+
+void
+CCNxOutputQueue::DropItem (const ItemType &item, DropReason reason)
+{
+  NS_LOG_FUNCTION (this << item.packet << reason);
+  NS_ASSERT_MSG (m_packets > 0, "Drop from a queue with no packets");
+
+  m_packets--;
+  m_bytes -= item.bytes;
+  if (reason == DROP_AQM)
+    {
+      m_stats.aqmDrops++;
+    }
+  else
+    {
+      m_stats.overflowDrops++;
+    }
+
+  if (!m_dropCallback.IsNull ())
+    {
+      m_dropCallback (item.packet, reason);
+    }
+}
+
+uint32_t
+CCNxOutputQueue::GetNPackets (void) const
+{
+  return m_packets;
+}
+
+uint64_t
+CCNxOutputQueue::GetNBytes (void) const
+{
+  return m_bytes;
+}
+
+bool
+CCNxOutputQueue::IsEmpty (void) const
+{
+  return m_packets == 0;
+}
+
+uint32_t
+CCNxOutputQueue::GetMaxPackets (void) const
+{
+  return m_maxPackets;
+}
+
+DataRate
+CCNxOutputQueue::GetLinkRate (void) const
+{
+  return m_linkRate;
+}
+
+uint32_t
+CCNxOutputQueue::GetLinkOverhead (void) const
+{
+  return m_linkOverhead;
+}
+
+CCNxOutputQueue::Stats
+CCNxOutputQueue::GetStats (void) const
+{
+  return m_stats;
+}
+
+void
+CCNxOutputQueue::SetDropCallback (DropCallback callback)
+{
+  m_dropCallback = callback;
+}
+
+void
+CCNxOutputQueue::SetDequeueCallback (DequeueCallback callback)
+{
+  m_dequeueCallback = callback;
+}
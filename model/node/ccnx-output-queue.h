@@ -0,0 +1,227 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_NODE_CCNX_OUTPUT_QUEUE_H_
+#define CCNS3SIM_MODEL_NODE_CCNX_OUTPUT_QUEUE_H_
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/callback.h"
+#include "ns3/data-rate.h"
+#include "ns3/ccnx-packet.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-l3
+ *
+ * Abstract base class of the output queue of a CCNxConnection.  A connection with an
+ * output queue enqueues every packet it sends and transmits them at the link rate, so
+ * the backlog builds up in a CCNx-aware queue instead of inside the NetDevice.
+ *
+ * The base class keeps the packet and byte counts, the statistics and the enqueue time of
+ * every packet (so the queueing delay, or sojourn time, is known at dequeue).  A concrete
+ * queue implements DoEnqueue() and DoDequeue() and calls DropItem() for every packet it
+ * drops after accepting it (e.g. an AQM drop at dequeue).
+ *
+ * Implementations: CCNxDropTailQueue, CCNxCoDelQueue and CCNxFqCoDelQueue.
+ *
+ * The DropCallback and DequeueCallback report each drop and the sojourn time of each
+ * dequeued packet.  CCNxStandardLayer3 uses them to feed the forwarder statistics.
+ */
+class CCNxOutputQueue : public Object
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxOutputQueue ();
+  virtual ~CCNxOutputQueue ();
+
+  /**
+   * Why a packet was dropped
+   */
+  typedef enum
+  {
+    DROP_OVERFLOW,        /* The queue was full (tail drop or drop from the longest flow) */
+    DROP_AQM              /* Dropped by active queue management (e.g. CoDel) */
+  } DropReason;
+
+  /**
+   * Called with (packet, reason) for each dropped packet
+   */
+  typedef Callback<void, Ptr<const CCNxPacket>, DropReason> DropCallback;
+
+  /**
+   * Called with (packet, sojourn time) for each dequeued packet
+   */
+  typedef Callback<void, Ptr<const CCNxPacket>, Time> DequeueCallback;
+
+  typedef struct
+  {
+    uint64_t enqueued;          /* Packets accepted by Enqueue() */
+    uint64_t dequeued;          /* Packets returned by Dequeue() */
+    uint64_t overflowDrops;     /* Packets dropped because the queue was full */
+    uint64_t aqmDrops;          /* Packets dropped by active queue management */
+    Time totalSojourn;          /* Sum of the sojourn time of the dequeued packets */
+    Time maxSojourn;            /* Longest sojourn time of a dequeued packet */
+  } Stats;
+
+  /**
+   * Add a packet to the queue.
+   *
+   * @return true if the packet was queued, false if it was dropped
+   */
+  bool Enqueue (Ptr<CCNxPacket> packet);
+
+  /**
+   * Remove the next packet to transmit.  An AQM queue may drop packets before
+   * returning one.
+   *
+   * @return The next packet, or null if the queue is empty
+   */
+  Ptr<CCNxPacket> Dequeue (void);
+
+  /**
+   * @return The number of packets in the queue
+   */
+  uint32_t GetNPackets (void) const;
+
+  /**
+   * @return The number of bytes in the queue
+   */
+  uint64_t GetNBytes (void) const;
+
+  /**
+   * @return true if there are no packets in the queue
+   */
+  bool IsEmpty (void) const;
+
+  /**
+   * @return The maximum number of packets in the queue ("MaxPackets")
+   */
+  uint32_t GetMaxPackets (void) const;
+
+  /**
+   * @return The rate to transmit from the queue ("LinkRate").  0 means to use the
+   * "DataRate" attribute of the NetDevice.
+   */
+  DataRate GetLinkRate (void) const;
+
+  /**
+   * @return The bytes the link layer adds to each packet ("LinkOverhead").  The connection
+   * paces each packet at its size plus this overhead, so the NetDevice queue does not grow.
+   */
+  uint32_t GetLinkOverhead (void) const;
+
+  /**
+   * @return The queue statistics
+   */
+  Stats GetStats (void) const;
+
+  void SetDropCallback (DropCallback callback);
+
+  void SetDequeueCallback (DequeueCallback callback);
+
+protected:
+  /**
+   * A queued packet with its enqueue time and size
+   */
+  typedef struct
+  {
+    Ptr<CCNxPacket> packet;
+    Time enqueueTime;
+    uint32_t bytes;
+  } ItemType;
+
+  /**
+   * Add `item` to the queue.  The packet and byte counts already include `item`.
+   *
+   * @return false to drop `item` (it is counted as an overflow drop)
+   */
+  virtual bool DoEnqueue (const ItemType &item) = 0;
+
+  /**
+   * Remove the next item to transmit and put it in `item`.
+   *
+   * @return false if the queue is empty
+   */
+  virtual bool DoDequeue (ItemType &item) = 0;
+
+  /**
+   * A concrete queue calls this for each item it drops after it was accepted
+   * by DoEnqueue().  It removes the item from the counts and statistics.
+   */
+  void DropItem (const ItemType &item, DropReason reason);
+
+  virtual void DoDispose (void);
+
+private:
+  uint32_t m_maxPackets;
+  DataRate m_linkRate;
+  uint32_t m_linkOverhead;
+
+  uint32_t m_packets;
+  uint64_t m_bytes;
+  Stats m_stats;
+
+  DropCallback m_dropCallback;
+  DequeueCallback m_dequeueCallback;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_NODE_CCNX_OUTPUT_QUEUE_H_ */
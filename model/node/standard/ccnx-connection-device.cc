@@ -54,6 +54,7 @@
  */
 
 #include "ns3/log.h"
+#include "ns3/simulator.h"
 #include "ccnx-connection-device.h"
 
 using namespace ns3;
@@ -68,7 +69,12 @@ CCNxConnectionDevice::CCNxConnectionDevice () : m_protocolNumber (0)
 
 CCNxConnectionDevice::~CCNxConnectionDevice ()
 {
-  // empty
+  m_transmitEvent.Cancel ();
+  if (m_interestShaper)
+    {
+      // the shaper's callback points to this connection
+      m_interestShaper->SetSendCallback (CCNxInterestShaper::SendCallback ());
+    }
 }
 
 void
@@ -110,14 +116,138 @@ CCNxConnectionDevice::GetOutputDevice (void) const
   return m_outputDevice;
 }
 
+void
+CCNxConnectionDevice::SetOutputQueue (Ptr<CCNxOutputQueue> queue)
+{
+  m_outputQueue = queue;
+}
+
+Ptr<CCNxOutputQueue>
+CCNxConnectionDevice::GetOutputQueue (void) const
+{
+  return m_outputQueue;
+}
+
+void
+CCNxConnectionDevice::SetInterestShaper (Ptr<CCNxInterestShaper> shaper)
+{
+  m_interestShaper = shaper;
+  if (shaper)
+    {
+      DataRateValue deviceRate;
+      if (m_outputDevice && m_outputDevice->GetAttributeFailSafe ("DataRate", deviceRate))
+        {
+          shaper->SetDefaultLinkRate (deviceRate.Get ());
+        }
+      shaper->SetSendCallback (MakeCallback (&CCNxConnectionDevice::Output, this));
+    }
+}
+
+Ptr<CCNxInterestShaper>
+CCNxConnectionDevice::GetInterestShaper (void) const
+{
+  return m_interestShaper;
+}
+
+void
+CCNxConnectionDevice::SetInterestDropCallback (InterestDropCallback callback)
+{
+  m_interestDropCallback = callback;
+}
+
+void
+CCNxConnectionDevice::ObserveReceive (Ptr<CCNxPacket> packet)
+{
+  if (m_interestShaper && packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Object)
+    {
+      m_interestShaper->ObserveData (packet->GetNs3Packet ()->GetSize ());
+    }
+}
+
 bool
 CCNxConnectionDevice::Send (Ptr<CCNxPacket> packet,Ptr <CCNxConnection> ingress)
 {
   NS_LOG_FUNCTION (this << packet << ingress);
 
-  Ptr<Packet> ns3Packet = packet->CreateNs3Packet ();
-  NS_LOG_DEBUG ("Send(" << *packet << ", ingress connId=" << ingress->GetConnectionId () << " to " <<
+  if (m_interestShaper && packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_Interest)
+    {
+      if (!m_interestShaper->Enqueue (packet))
+        {
+          if (!m_interestDropCallback.IsNull ())
+            {
+              m_interestDropCallback (packet, Ptr<CCNxConnection> (this));
+            }
+          return false;
+        }
+      return true;
+    }
+
+  return Output (packet);
+}
+
+bool
+CCNxConnectionDevice::Output (Ptr<CCNxPacket> packet)
+{
+  if (!m_outputQueue)
+    {
+      return Transmit (packet);
+    }
+
+  if (!m_outputQueue->Enqueue (packet))
+    {
+      return false;
+    }
+
+  if (!m_transmitEvent.IsRunning ())
+    {
+      TransmitNext ();
+    }
+  return true;
+}
+
+void
+CCNxConnectionDevice::TransmitNext (void)
+{
+  DataRate rate = GetLinkRate ();
+  Ptr<CCNxPacket> packet = m_outputQueue->Dequeue ();
+  while (packet)
+    {
+      uint32_t bytes = packet->GetNs3Packet ()->GetSize () + m_outputQueue->GetLinkOverhead ();
+      Transmit (packet);
+
+      if (rate.GetBitRate () > 0)
+        {
+          // the link is busy until this packet and its link-layer framing are on the wire
+          m_transmitEvent = Simulator::Schedule (rate.CalculateTxTime (bytes), &CCNxConnectionDevice::TransmitNext, this);
+          return;
+        }
+      packet = m_outputQueue->Dequeue ();
+    }
+}
+
+DataRate
+CCNxConnectionDevice::GetLinkRate (void) const
+{
+  DataRate rate = m_outputQueue->GetLinkRate ();
+  if (rate.GetBitRate () == 0)
+    {
+      DataRateValue deviceRate;
+      if (m_outputDevice->GetAttributeFailSafe ("DataRate", deviceRate))
+        {
+          rate = deviceRate.Get ();
+        }
+    }
+  return rate;
+}
+
+bool
+CCNxConnectionDevice::Transmit (Ptr<CCNxPacket> packet)
+{
+  // The encoded packet is shared by every egress connection of a fan-out.  The NetDevice
+  // adds its link-layer header, so it gets a copy-on-write view of the shared buffer.
+  Ptr<const Packet> wire = packet->GetNs3Packet ();
+  NS_LOG_DEBUG ("Transmit(" << *packet << ") to " <<
                 "{ nexthop " << m_nexthop << " proto 0x" << std::hex << m_protocolNumber << std::dec <<
-                " size " << ns3Packet->GetSize () << " }");
-  return m_outputDevice->Send (ns3Packet, m_nexthop, m_protocolNumber);
+                " size " << wire->GetSize () << " }");
+  return m_outputDevice->Send (wire->Copy (), m_nexthop, m_protocolNumber);
 }
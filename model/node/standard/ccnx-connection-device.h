@@ -61,7 +61,11 @@
 #include "ns3/net-device.h"
 #include "ns3/simple-ref-count.h"
 #include "ns3/output-stream-wrapper.h"
+#include "ns3/event-id.h"
+#include "ns3/data-rate.h"
 #include "ns3/ccnx-connection.h"
+#include "ns3/ccnx-output-queue.h"
+#include "ns3/ccnx-interest-shaper.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -71,6 +75,18 @@ namespace ccnx {
  *
  * Represents a network device (NetDevice) as a CCnx connection.
  * You must set the protocol number, output device, and nexthop.
+ *
+ * If the connection has an output queue (SetOutputQueue()), Send() enqueues the packet
+ * and the connection transmits from the queue at the link rate: the queue's "LinkRate",
+ * or else the "DataRate" attribute of the NetDevice, counting the queue's "LinkOverhead" bytes
+ * of link-layer framing per packet.  The backlog then builds up in the
+ * CCNxOutputQueue, where it is visible to AQM and the statistics, and not in the NetDevice.
+ * If no rate is known, queued packets are sent to the NetDevice immediately.
+ *
+ * If the connection has an Interest shaper (SetInterestShaper()), Interests pass through
+ * it before the output queue.  The Content Objects received on the connection (reported
+ * by the Layer 3 with ObserveReceive()) tell the shaper the expected Content Object size.
+ * An Interest refused by a full shaper is passed to the InterestDropCallback.
  */
 class CCNxConnectionDevice : public CCNxConnection
 {
@@ -122,10 +138,77 @@ public:
    */
   virtual bool Send (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress);
 
+  /**
+   * Queue packets on this connection.  Set before sending any packets.
+   *
+   * @param [in] queue The output queue (null to send straight to the NetDevice)
+   */
+  void SetOutputQueue (Ptr<CCNxOutputQueue> queue);
+
+  /**
+   * @return The output queue, or null if there is none
+   */
+  Ptr<CCNxOutputQueue> GetOutputQueue (void) const;
+
+  /**
+   * Shape the Interests sent on this connection.  Set the output device first, as its
+   * DataRate is the default link rate of the shaper.
+   *
+   * @param [in] shaper The Interest shaper (null to not shape)
+   */
+  void SetInterestShaper (Ptr<CCNxInterestShaper> shaper);
+
+  /**
+   * @return The Interest shaper, or null if there is none
+   */
+  Ptr<CCNxInterestShaper> GetInterestShaper (void) const;
+
+  /**
+   * Called with (interest, this connection) when the Interest shaper refuses an Interest
+   */
+  typedef Callback<void, Ptr<CCNxPacket>, Ptr<CCNxConnection> > InterestDropCallback;
+
+  void SetInterestDropCallback (InterestDropCallback callback);
+
+  /**
+   * The Layer 3 calls this for each packet received on the connection.  Content Objects
+   * update the Interest shaper's expected Content Object size.
+   *
+   * @param [in] packet The received packet
+   */
+  void ObserveReceive (Ptr<CCNxPacket> packet);
+
 private:
+  /**
+   * Send `packet` through the output queue (if any) to the NetDevice
+   */
+  bool Output (Ptr<CCNxPacket> packet);
+
+  /**
+   * Send `packet` on the NetDevice
+   */
+  bool Transmit (Ptr<CCNxPacket> packet);
+
+  /**
+   * Transmit the next packet of the output queue and schedule the one after it
+   * when the link is free.
+   */
+  void TransmitNext (void);
+
+  /**
+   * @return The link rate for the output queue (0 if unknown)
+   */
+  DataRate GetLinkRate (void) const;
+
   Address         m_nexthop;
   Ptr<NetDevice>  m_outputDevice;
   uint16_t        m_protocolNumber;
+
+  Ptr<CCNxOutputQueue> m_outputQueue;
+  EventId         m_transmitEvent;
+
+  Ptr<CCNxInterestShaper> m_interestShaper;
+  InterestDropCallback m_interestDropCallback;
 };
 
 } // namespace ccnx
@@ -74,6 +74,8 @@ void
 CCNxStandardLayer3Helper::Install (Ptr<Node> node) const
 {
   Ptr<CCNxStandardLayer3> protocol = m_factory.Create<CCNxStandardLayer3> ();
+  protocol->SetOutputQueueFactory (m_outputQueueFactory);
+  protocol->SetInterestShaperFactory (m_interestShaperFactory);
   node->AggregateObject (protocol);
 
   Ptr<CCNxL3Protocol> ccnx = node->GetObject<CCNxL3Protocol> ();
@@ -88,3 +90,32 @@ CCNxStandardLayer3Helper::GetLayer3TypeId () const
   return m_factory.GetTypeId ();
 }
 
+void
+CCNxStandardLayer3Helper::SetOutputQueue (std::string type,
+                                          std::string n0, const AttributeValue &v0,
+                                          std::string n1, const AttributeValue &v1,
+                                          std::string n2, const AttributeValue &v2,
+                                          std::string n3, const AttributeValue &v3)
+{
+  m_outputQueueFactory = ObjectFactory ();
+  m_outputQueueFactory.SetTypeId (type);
+  m_outputQueueFactory.Set (n0, v0);
+  m_outputQueueFactory.Set (n1, v1);
+  m_outputQueueFactory.Set (n2, v2);
+  m_outputQueueFactory.Set (n3, v3);
+}
+
+void
+CCNxStandardLayer3Helper::SetInterestShaper (std::string n0, const AttributeValue &v0,
+                                             std::string n1, const AttributeValue &v1,
+                                             std::string n2, const AttributeValue &v2,
+                                             std::string n3, const AttributeValue &v3)
+{
+  m_interestShaperFactory = ObjectFactory ();
+  m_interestShaperFactory.SetTypeId (CCNxInterestShaper::GetTypeId ());
+  m_interestShaperFactory.Set (n0, v0);
+  m_interestShaperFactory.Set (n1, v1);
+  m_interestShaperFactory.Set (n2, v2);
+  m_interestShaperFactory.Set (n3, v3);
+}
+
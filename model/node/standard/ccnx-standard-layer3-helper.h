@@ -94,8 +94,33 @@ public:
    */
   virtual TypeId GetLayer3TypeId () const;
 
+  /**
+   * Give every neighbor connection an output queue of type `type` (e.g. "ns3::ccnx::CCNxFqCoDelQueue")
+   * with the given attributes.  By default there are no output queues.
+   *
+   * @see CCNxStandardLayer3::SetOutputQueueFactory
+   */
+  void SetOutputQueue (std::string type,
+                       std::string n0 = "", const AttributeValue &v0 = EmptyAttributeValue (),
+                       std::string n1 = "", const AttributeValue &v1 = EmptyAttributeValue (),
+                       std::string n2 = "", const AttributeValue &v2 = EmptyAttributeValue (),
+                       std::string n3 = "", const AttributeValue &v3 = EmptyAttributeValue ());
+
+  /**
+   * Shape the Interests on every neighbor connection with a CCNxInterestShaper with the
+   * given attributes.  By default Interests are not shaped.
+   *
+   * @see CCNxStandardLayer3::SetInterestShaperFactory
+   */
+  void SetInterestShaper (std::string n0 = "", const AttributeValue &v0 = EmptyAttributeValue (),
+                          std::string n1 = "", const AttributeValue &v1 = EmptyAttributeValue (),
+                          std::string n2 = "", const AttributeValue &v2 = EmptyAttributeValue (),
+                          std::string n3 = "", const AttributeValue &v3 = EmptyAttributeValue ());
+
 private:
   ObjectFactory m_factory;
+  ObjectFactory m_outputQueueFactory;
+  ObjectFactory m_interestShaperFactory;
 
 };
 
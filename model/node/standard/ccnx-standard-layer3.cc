@@ -114,7 +114,7 @@ CCNxStandardLayer3::CCNxStandardLayer3 ()
 CCNxStandardLayer3::~CCNxStandardLayer3 ()
 {
   NS_LOG_FUNCTION (this);
-  m_protocols.clear ();
+  m_protocols.Clear ();
 }
 
 void
@@ -125,8 +125,8 @@ CCNxStandardLayer3::AddProtocol (const CCNxL4Protocol &protocol,
   Ptr<CCNxConnectionL4> conn = Create<CCNxConnectionL4> ();
   conn->SetReceiveCallback (callback);
 
-  m_protocols[id] = conn;
-  m_connections[conn->GetConnectionId ()] = conn;
+  m_protocols.Insert (id, conn);
+  m_connections.Insert (conn->GetConnectionId (), conn);
 
   NS_LOG_DEBUG ("AddProtocol protocol " << &protocol << " id " << id);
 }
@@ -136,10 +136,10 @@ CCNxStandardLayer3::UnregisterProtocol (const CCNxL4Protocol &protocol)
 {
   CCNxL4Protocol::CCNxL4Id id = protocol.GetInstanceId ();
 
-  L4MapType::iterator i = m_protocols.find (id);
-  if (i != m_protocols.end ())
+  Ptr<CCNxConnectionL4> *found = m_protocols.Find (id);
+  if (found)
     {
-      Ptr<CCNxConnectionL4> conn = i->second;
+      Ptr<CCNxConnectionL4> conn = *found;
 
       NS_LOG_INFO ("Deleting ConnID " << conn->GetConnectionId ());
 
@@ -147,13 +147,12 @@ CCNxStandardLayer3::UnregisterProtocol (const CCNxL4Protocol &protocol)
       conn->Close ();
 
       // TODO: Remove FIB entries that use this nexthop
-      m_connections.erase (conn->GetConnectionId ());
-      m_protocols.erase (i);
+      m_connections.Erase (conn->GetConnectionId ());
+      m_protocols.Erase (id);
     }
   else
     {
-      NS_ASSERT_MSG (i != m_protocols.end (),
-                     "Could not find protocol id " << id);
+      NS_ASSERT_MSG (found, "Could not find protocol id " << id);
     }
 }
 
@@ -164,10 +163,10 @@ CCNxStandardLayer3::RegisterPrefix (const CCNxL4Protocol &protocol,
   CCNxL4Protocol::CCNxL4Id id = protocol.GetInstanceId ();
   NS_LOG_FUNCTION (this << prefix << id);
 
-  L4MapType::iterator i = m_protocols.find (id);
-  if (i != m_protocols.end ())
+  Ptr<CCNxConnectionL4> *found = m_protocols.Find (id);
+  if (found)
     {
-      Ptr<CCNxConnectionL4> conn = i->second;
+      Ptr<CCNxConnectionL4> conn = *found;
 
       NS_LOG_INFO (
         "RegisterPrefix   L4Id " << id << " ConnId " << conn->GetConnectionId () << " for " << *prefix);
@@ -176,8 +175,7 @@ CCNxStandardLayer3::RegisterPrefix (const CCNxL4Protocol &protocol,
     }
   else
     {
-      NS_ASSERT_MSG (i != m_protocols.end (),
-                     "Could not find protocol id " << id);
+      NS_ASSERT_MSG (found, "Could not find protocol id " << id);
     }
 }
 
@@ -188,10 +186,10 @@ CCNxStandardLayer3::UnregisterPrefix (const CCNxL4Protocol &protocol,
   CCNxL4Protocol::CCNxL4Id id = protocol.GetInstanceId ();
   NS_LOG_FUNCTION (this << prefix << id);
 
-  L4MapType::iterator i = m_protocols.find (id);
-  if (i != m_protocols.end ())
+  Ptr<CCNxConnectionL4> *found = m_protocols.Find (id);
+  if (found)
     {
-      Ptr<CCNxConnectionL4> conn = i->second;
+      Ptr<CCNxConnectionL4> conn = *found;
 
       NS_LOG_INFO (
         "UnregisterPrefix L4Id " << id << " ConnId " << conn->GetConnectionId () << " for " << *prefix);
@@ -200,8 +198,7 @@ CCNxStandardLayer3::UnregisterPrefix (const CCNxL4Protocol &protocol,
     }
   else
     {
-      NS_ASSERT_MSG (i != m_protocols.end (),
-                     "Could not find protocol id " << id);
+      NS_ASSERT_MSG (found, "Could not find protocol id " << id);
     }
 }
 
@@ -290,7 +287,7 @@ CCNxStandardLayer3::AddInterface (Ptr<NetDevice> device)
 
   Ptr<CCNxL3Interface> l3if = Create<CCNxL3Interface> (device);
   uint32_t id = device->GetIfIndex ();
-  m_devices[id] = l3if;
+  m_devices.Insert (id, l3if);
   NS_LOG_INFO ("AddInterface " << device << " id " << id);
 
   Ptr<CCNxConnectionDevice> bcast = AddNeighbor (device->GetBroadcast (), device);
@@ -320,16 +317,16 @@ CCNxStandardLayer3::GetInterfaceForwarding (uint32_t interface) const
 uint32_t
 CCNxStandardLayer3::GetNInterfaces (void) const
 {
-  return m_devices.size ();
+  return m_devices.Size ();
 }
 
 Ptr<CCNxL3Interface>
 CCNxStandardLayer3::GetInterface (uint32_t interface) const
 {
-  L2MapType::const_iterator i = m_devices.find (interface);
-  if (i != m_devices.end ())
+  const Ptr<CCNxL3Interface> *found = m_devices.Find (interface);
+  if (found)
     {
-      return i->second;
+      return *found;
     }
   else
     {
@@ -344,33 +341,51 @@ CCNxStandardLayer3::RouteCallback (Ptr<CCNxPacket> ccnxPacket, Ptr<CCNxConnectio
                                    enum CCNxRoutingError::RoutingErrno routingErrno, Ptr<CCNxConnectionList> egress)
 {
 
+  /*
+   * Encode the packet once.  All egress connections and trace sources share the same
+   * read-only ns3::Packet, so a fan-out to N faces does not make N copies of it.
+   */
+  Ptr<const Packet> wire = ccnxPacket->GetNs3Packet ();
+
+  // Packets generated by the forwarder (e.g. an InterestReturn) have no ingress
+  uint32_t ingressId = ingress ? ingress->GetConnectionId () : (uint32_t) -1;
+
   if (egress->size () == 0)
     {
       NS_LOG_WARN ("forwarder return an empty result " << *ccnxPacket->GetMessage ()->GetName ());
-      m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+      DropReason reason = DROP_NO_ROUTE;
+      if (routingErrno == CCNxRoutingError::CCNxRoutingError_HopLimitExceeded)
+        {
+          reason = DROP_TTL_EXPIRED;
+        }
+      else if (routingErrno == CCNxRoutingError::CCNxRoutingError_Congestion)
+        {
+          reason = DROP_CONGESTION;
+        }
+      m_dropTrace (this, wire, ccnxPacket, ingressId, reason);
     }
 
   Ptr<CCNxConnection> egressFromForwarder;
 
   for (CCNxConnectionList::iterator it = egress->begin (); it != egress->end (); it++)
     {
-      egressFromForwarder = *it;      //TODO send to all connections not just the first
+      egressFromForwarder = *it;
 
       if (routingErrno == CCNxRoutingError::CCNxRoutingError_NoError)
         {
-          NS_LOG_DEBUG ("SendCCNxPacket using egress connid " << egressFromForwarder->GetConnectionId () << " packet " << *ccnxPacket->CreateNs3Packet ());
-          m_txTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, egressFromForwarder->GetConnectionId ());
+          NS_LOG_DEBUG ("SendCCNxPacket using egress connid " << egressFromForwarder->GetConnectionId () << " packet " << *wire);
+          m_txTrace (this, wire, ccnxPacket, egressFromForwarder->GetConnectionId ());
           bool result = egressFromForwarder->Send (ccnxPacket, ingress);
           if (!result)     //Send failed
             {
               NS_LOG_WARN ("Send failed!");
-              m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, -1, DROP_INTERFACE_DOWN);
+              m_dropTrace (this, wire, ccnxPacket, -1, DROP_INTERFACE_DOWN);
             }
         }
       else
         {
           NS_LOG_WARN ("Routing Error " << *ccnxPacket->GetMessage ()->GetName ());
-          m_dropTrace (this, ccnxPacket->CreateNs3Packet (), ccnxPacket, ingress->GetConnectionId (), DROP_NO_ROUTE);
+          m_dropTrace (this, wire, ccnxPacket, ingressId, DROP_NO_ROUTE);
         }
     }
 }
@@ -401,23 +416,23 @@ CCNxStandardLayer3::SendFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPack
   NS_LOG_FUNCTION (this << &protocol << ccnxPacket);
 
   // serialize it
-  Ptr<Packet> ns3Packet = ccnxPacket->CreateNs3Packet ();
+  Ptr<const Packet> ns3Packet = ccnxPacket->GetNs3Packet ();
 
   m_rxTrace (this, ns3Packet, ccnxPacket, id);
 
   // look up the incoming protocols Connection and receive it from there
   bool result = false;
-  L4MapType::iterator i = m_protocols.find (id);
-  if (i != m_protocols.end ())
+  Ptr<CCNxConnectionL4> *found = m_protocols.Find (id);
+  if (found)
     {
-      Ptr<CCNxConnectionL4> ingress = i->second;
+      Ptr<CCNxConnectionL4> ingress = *found;
       result = Layer4RouteOut (ccnxPacket, ingress, Ptr<CCNxConnection> (0));
     }
   else
     {
       NS_LOG_ERROR ("SendCCNxPacket " << *ccnxPacket << " l4id " << id << " : Could not find protocol id");
       m_dropTrace (this, ns3Packet, ccnxPacket, id, DROP_ROUTE_ERROR);
-      NS_ASSERT_MSG (i != m_protocols.end (), "Could not find protocol id " << id);
+      NS_ASSERT_MSG (found, "Could not find protocol id " << id);
     }
   return result;
 }
@@ -431,7 +446,7 @@ CCNxStandardLayer3::SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPa
   NS_LOG_FUNCTION (this << &protocol << ccnxPacket);
 
   // serialize it
-  Ptr<Packet> ns3Packet = ccnxPacket->CreateNs3Packet ();
+  Ptr<const Packet> ns3Packet = ccnxPacket->GetNs3Packet ();
 
   m_rxTrace (this, ns3Packet, ccnxPacket, id);
 
@@ -440,17 +455,17 @@ CCNxStandardLayer3::SendToFromLayer4 (const CCNxL4Protocol &protocol, Ptr<CCNxPa
     {
       // look up the incoming protocols Connection and receive it from there
       bool result = false;
-      L4MapType::iterator i = m_protocols.find (id);
-      if (i != m_protocols.end ())
+      Ptr<CCNxConnectionL4> *found = m_protocols.Find (id);
+      if (found)
         {
-          Ptr<CCNxConnectionL4> ingress = i->second;
+          Ptr<CCNxConnectionL4> ingress = *found;
           result = Layer4RouteOut (ccnxPacket, ingress, egress);
         }
       else
         {
           NS_LOG_ERROR ("SendCCNxPacket " << *ccnxPacket << " l4id " << id << " : Could not find protocol id");
           m_dropTrace (this, ns3Packet, ccnxPacket, id, DROP_ROUTE_ERROR);
-          NS_ASSERT_MSG (i != m_protocols.end (), "Could not find protocol id " << id);
+          NS_ASSERT_MSG (found, "Could not find protocol id " << id);
         }
     }
   else
@@ -467,11 +482,9 @@ CCNxStandardLayer3::ReceiveFromLayer2 (Ptr<NetDevice> device, Ptr<const Packet>
                                        uint16_t protocol, const Address &from,
                                        const Address &to, NetDevice::PacketType packetType)
 {
-  Ptr<Packet> packet = p->Copy ();
+  NS_LOG_FUNCTION (this << device << p << protocol << from << to << packetType);
 
-  NS_LOG_FUNCTION (this << device << packet << protocol << from << to << packetType);
-
-  NS_LOG_DEBUG ("Node " << m_node->GetId () << " Packet from " << from << " size " << packet->GetSize () << " packet " << *p);
+  NS_LOG_DEBUG ("Node " << m_node->GetId () << " Packet from " << from << " size " << p->GetSize () << " packet " << *p);
 
 
   // If the L3 interface is down, drop the packet
@@ -479,29 +492,20 @@ CCNxStandardLayer3::ReceiveFromLayer2 (Ptr<NetDevice> device, Ptr<const Packet>
     {
       // Lookup the incoming NetDevice's Connection and receive it from there
 
-      NbrMapType::const_iterator i = m_neighbors.find (from);
-      Ptr<CCNxConnectionDevice> ingress;
-      if (i == m_neighbors.end ())
-        {
-          // If we don't know about the neighor add him
-          Ptr<CCNxConnectionDevice> deviceConnection = AddNeighbor (from, device);
-          ingress = deviceConnection;
-        }
-      else
-        {
-          ingress = i->second;
-        }
+      // If we don't know about the neighbor add him
+      Ptr<CCNxConnectionDevice> ingress = GetNeighbor (from, device);
 
       // Deserialize the packet, then grab the output from the ccnxPacket, as that
       // will be properly trimed of any layer 3 bloat in the ns3 packet.
-      Ptr<CCNxPacket> ccnxPacket = CCNxPacket::CreateFromNs3Packet (packet);
-      packet = ccnxPacket->CreateNs3Packet ();
+      Ptr<CCNxPacket> ccnxPacket = CCNxPacket::CreateFromNs3Packet (p);
+      Ptr<const Packet> packet = ccnxPacket->GetNs3Packet ();
 
       NS_ASSERT_MSG (ccnxPacket->GetFixedHeader ()->GetPacketLength () == packet->GetSize (),
                      "Packet wrong size, FixedHeader = " << (uint32_t) ccnxPacket->GetFixedHeader ()->GetPacketLength () <<
                      ", packet->GetSize() = " << packet->GetSize () << ", packet = " << *packet);
 
       m_rxTrace (this, packet, ccnxPacket, ingress->GetConnectionId ());
+      ingress->ObserveReceive (ccnxPacket);
 
       m_forwarder->RouteInput (ccnxPacket, ingress);
     } //GetInterfaceForwarding
@@ -510,14 +514,92 @@ CCNxStandardLayer3::ReceiveFromLayer2 (Ptr<NetDevice> device, Ptr<const Packet>
 Ptr<CCNxConnection>
 CCNxStandardLayer3::GetConnection (CCNxConnection::ConnIdType id) const
 {
-  ConnMapType::const_iterator i = m_connections.find (id);
-  if (i != m_connections.end ())
+  const Ptr<CCNxConnection> *found = m_connections.Find (id);
+  if (found)
     {
-      return i->second;
+      return *found;
     }
   return (Ptr<CCNxConnection> ) 0;
 }
 
+size_t
+CCNxStandardLayer3::GetNNeighbors (void) const
+{
+  return m_neighbors.Size ();
+}
+
+CCNxStandardLayer3::NeighborTableStats
+CCNxStandardLayer3::GetNeighborTableStats (void) const
+{
+  NeighborTableStats stats;
+  stats.neighbors = m_neighbors.Size ();
+  stats.capacity = m_neighbors.Capacity ();
+  stats.lookups = m_neighbors.GetLookupCount ();
+  stats.probes = m_neighbors.GetProbeCount ();
+  stats.maxProbeLength = m_neighbors.GetMaxProbeLength ();
+  return stats;
+}
+
+void
+CCNxStandardLayer3::SetOutputQueueFactory (ObjectFactory factory)
+{
+  m_outputQueueFactory = factory;
+}
+
+void
+CCNxStandardLayer3::SetInterestShaperFactory (ObjectFactory factory)
+{
+  m_interestShaperFactory = factory;
+}
+
+void
+CCNxStandardLayer3::InterestShaperDrop (Ptr<CCNxPacket> interest, Ptr<CCNxConnection> egress)
+{
+  NS_LOG_FUNCTION (this << interest << egress->GetConnectionId ());
+  m_dropTrace (this, interest->GetNs3Packet (), interest, egress->GetConnectionId (), DROP_CONGESTION);
+
+  Ptr<CCNxConnectionDevice> device = DynamicCast<CCNxConnectionDevice> (egress);
+  if (m_forwarder && device && device->GetInterestShaper ()->GetNackOnDrop ())
+    {
+      Ptr<CCNxPacket> interestReturn = CCNxPacket::CreateInterestReturn (interest, CCNxInterestReturnCode_Congestion);
+      m_forwarder->RouteInput (interestReturn, egress);
+    }
+}
+
+void
+CCNxStandardLayer3::OutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason)
+{
+  if (m_forwarder)
+    {
+      m_forwarder->NotifyOutputQueueDrop (packet, reason);
+    }
+}
+
+void
+CCNxStandardLayer3::OutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn)
+{
+  if (m_forwarder)
+    {
+      m_forwarder->NotifyOutputQueueDequeue (packet, sojourn);
+    }
+}
+
+uint32_t
+CCNxStandardLayer3::AddressHash::operator() (const Address &address) const
+{
+  // FNV-1a over the serialized address, so the address type is part of the key as in Address::operator==
+  uint8_t buffer[Address::MAX_SIZE + 2];
+  uint32_t length = address.CopyAllTo (buffer, sizeof(buffer));
+
+  uint32_t hash = 2166136261U;
+  for (uint32_t i = 0; i < length; i++)
+    {
+      hash ^= buffer[i];
+      hash *= 16777619U;
+    }
+  return hash;
+}
+
 Ptr<CCNxConnectionDevice>
 CCNxStandardLayer3::AddNeighbor (Address nexthop, Ptr<NetDevice> device)
 {
@@ -531,10 +613,35 @@ CCNxStandardLayer3::AddNeighbor (Address nexthop, Ptr<NetDevice> device)
   conn->SetOutputDevice (device);
   conn->SetProtocolNumber (GetProtocolNumber ());
 
-  m_neighbors[nexthop] = conn;
-  m_connections[conn->GetConnectionId ()] = conn;
+  if (m_outputQueueFactory.GetTypeId ().GetUid () != 0)
+    {
+      Ptr<CCNxOutputQueue> queue = m_outputQueueFactory.Create<CCNxOutputQueue> ();
+      queue->SetDropCallback (MakeCallback (&CCNxStandardLayer3::OutputQueueDrop, this));
+      queue->SetDequeueCallback (MakeCallback (&CCNxStandardLayer3::OutputQueueDequeue, this));
+      conn->SetOutputQueue (queue);
+    }
+
+  if (m_interestShaperFactory.GetTypeId ().GetUid () != 0)
+    {
+      conn->SetInterestShaper (m_interestShaperFactory.Create<CCNxInterestShaper> ());
+      conn->SetInterestDropCallback (MakeCallback (&CCNxStandardLayer3::InterestShaperDrop, this));
+    }
+
+  m_neighbors.Insert (nexthop, conn);
+  m_connections.Insert (conn->GetConnectionId (), conn);
 
   NS_LOG_INFO ("AddNeighbor ConnId " << conn->GetConnectionId () << " address " << nexthop);
   return conn;
 }
 
+Ptr<CCNxConnectionDevice>
+CCNxStandardLayer3::GetNeighbor (Address nexthop, Ptr<NetDevice> device)
+{
+  Ptr<CCNxConnectionDevice> *found = m_neighbors.Find (nexthop);
+  if (found)
+    {
+      return *found;
+    }
+  return AddNeighbor (nexthop, device);
+}
+
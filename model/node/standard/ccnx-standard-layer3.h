@@ -58,14 +58,13 @@
 
 #include "ns3/ccnx-l3-protocol.h"
 
-#include <map>
-
 #include "ns3/object.h"
 #include "ns3/ptr.h"
 #include "ns3/net-device.h"
 #include "ns3/traced-callback.h"
 #include "ns3/nstime.h"
 #include "ns3/simulator.h"
+#include "ns3/object-factory.h"
 
 #include "ns3/ccnx-fixedheader.h"
 #include "ns3/ccnx-l3-interface.h"
@@ -76,6 +75,8 @@
 #include "ns3/ccnx-connection-l4.h"
 #include "ns3/ccnx-forwarder.h"
 #include "ns3/ccnx-routing-error.h"
+#include "ns3/ccnx-flat-hash-map.h"
+#include "ns3/ccnx-output-queue.h"
 
 namespace ns3 {
 
@@ -120,10 +121,15 @@ namespace ccnx {
 *
 *    m_connections: ConnId -> Ptr<CCNxConnection>
 *
+* The tables are `CCNxFlatHashMap` (open addressing), as `ReceiveFromLayer2()` looks up
+* the neighbor of every received frame.  GetNeighborTableStats() reports the size
+* and probe lengths of the neighbor table.
+*
 * To manage the tables from the configuration file:
 *
 *  # Address = L2 Address of Peer
 *  AddNeighbor(Address, Ptr<NetDevice>)
+*  GetNeighbor(Address, Ptr<NetDevice>)    (AddNeighbor only if not there yet)
 *  AddRoute(Address, Ptr<const CCNxName>)
 *
 *  # To add a L4 route, use RegisterPrefix via CCNxPortal.
@@ -339,11 +345,64 @@ public:
    */
   Ptr<CCNxConnectionDevice> AddNeighbor (Address nexthop, Ptr<NetDevice>);
 
+  /**
+   * Return the neighbor adjacency to `nexthop`, creating it with AddNeighbor() if there is none yet
+   *
+   * @param [in] nexthop Mac address of the neighbor's interface
+   * @param [in] device Device object through which neighbor is reachable
+   * @return Pointer to the ConnectionDevice object
+   */
+  Ptr<CCNxConnectionDevice> GetNeighbor (Address nexthop, Ptr<NetDevice>);
+
   /**
    * @return The connection object associated with the connection Id
    */
   Ptr<CCNxConnection> GetConnection (CCNxConnection::ConnIdType id) const;
 
+  /**
+   * Size and lookup statistics of the neighbor table (L2 Address -> CCNxConnectionDevice).
+   */
+  typedef struct
+  {
+    size_t neighbors;          /* Number of neighbors, including the broadcast neighbor of each interface */
+    size_t capacity;           /* Number of slots in the table */
+    uint64_t lookups;          /* Number of lookups since the table was created */
+    uint64_t probes;           /* Number of slots examined by those lookups */
+    size_t maxProbeLength;     /* Longest probe run of any entry in the table now */
+  } NeighborTableStats;
+
+  /**
+   * @return The number of 1-hop neighbors (including broadcast neighbors)
+   */
+  size_t GetNNeighbors (void) const;
+
+  /**
+   * @return The neighbor table statistics
+   */
+  NeighborTableStats GetNeighborTableStats (void) const;
+
+  /**
+   * Give each neighbor connection added from now on an output queue made by `factory`
+   * (e.g. a CCNxFqCoDelQueue).  The queue drops and delays are reported to the forwarder
+   * via CCNxForwarder::NotifyOutputQueueDrop() and CCNxForwarder::NotifyOutputQueueDequeue().
+   * Call before AddInterface().  Without an output queue factory, connections send
+   * straight to the NetDevice.
+   *
+   * @param factory The ObjectFactory of a CCNxOutputQueue
+   */
+  void SetOutputQueueFactory (ObjectFactory factory);
+
+  /**
+   * Give each neighbor connection added from now on a CCNxInterestShaper made by `factory`.
+   * An Interest refused by a full shaper is dropped (Drop trace with DROP_CONGESTION) and,
+   * if the shaper's "NackOnDrop" is set, a Congestion InterestReturn is given to the
+   * forwarder as if it came from the connection, so the PIT returns it downstream.
+   * Call before AddInterface().
+   *
+   * @param factory The ObjectFactory of a CCNxInterestShaper
+   */
+  void SetInterestShaperFactory (ObjectFactory factory);
+
 protected:
   /**
    * Route a packet received from Layer 4 to output device(s).  This function is called from Layer4Send() and
@@ -370,6 +429,21 @@ protected:
   void RouteCallback (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress,
                       enum CCNxRoutingError::RoutingErrno routingErrno, Ptr<CCNxConnectionList> egress);
 
+  /**
+   * Drop callback of the connection output queues.  Passes the drop to the forwarder.
+   */
+  void OutputQueueDrop (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason);
+
+  /**
+   * Dequeue callback of the connection output queues.  Passes the queueing delay to the forwarder.
+   */
+  void OutputQueueDequeue (Ptr<const CCNxPacket> packet, Time sojourn);
+
+  /**
+   * Drop callback of the Interest shapers.  Traces the drop and NACKs the Interest.
+   */
+  void InterestShaperDrop (Ptr<CCNxPacket> interest, Ptr<CCNxConnection> egress);
+
 protected:
   static const uint16_t m_protocolNumber;
 
@@ -380,23 +454,37 @@ protected:
   Ptr<CCNxRoutingProtocol> m_routingProtocol;
   Ptr<CCNxForwarder> m_forwarder;
 
+  /* Creates the output queue of each neighbor connection (if its TypeId is set) */
+  ObjectFactory m_outputQueueFactory;
+
+  /* Creates the Interest shaper of each neighbor connection (if its TypeId is set) */
+  ObjectFactory m_interestShaperFactory;
+
+  /**
+   * Hash of an L2 Address (type, length and bytes) for the neighbor table
+   */
+  struct AddressHash
+  {
+    uint32_t operator() (const Address &address) const;
+  };
+
   /* Our L4 protocols */
-  typedef std::map < CCNxL4Protocol::CCNxL4Id, Ptr<CCNxConnectionL4> > L4MapType;
+  typedef CCNxFlatHashMap < CCNxL4Protocol::CCNxL4Id, Ptr<CCNxConnectionL4> > L4MapType;
   L4MapType m_protocols;
 
   /* Our L2 devices */
-  typedef std::map < uint32_t, Ptr<CCNxL3Interface> > L2MapType;
+  typedef CCNxFlatHashMap < uint32_t, Ptr<CCNxL3Interface> > L2MapType;
   L2MapType m_devices;
 
   /* 1 hop neighbors on L2 devices */
-  typedef std::map < Address, Ptr<CCNxConnectionDevice> > NbrMapType;
+  typedef CCNxFlatHashMap < Address, Ptr<CCNxConnectionDevice>, AddressHash > NbrMapType;
   NbrMapType m_neighbors;
 
   /**
    * This holds both Local and Device connections for lookup by ConnId, which
    * is what we use in the FIB and PIT.
    */
-  typedef std::map < uint32_t, Ptr<CCNxConnection> > ConnMapType;
+  typedef CCNxFlatHashMap < CCNxConnection::ConnIdType, Ptr<CCNxConnection> > ConnMapType;
   ConnMapType m_connections;
 
 private:
@@ -55,6 +55,7 @@
 
 #include "ns3/tag.h"
 #include "ns3/ccnx-packet.h"
+#include "ns3/ccnx-virtual-payload-tag.h"
 #include "ns3/log.h"
 
 using namespace ns3;
@@ -62,6 +63,8 @@ using namespace ns3::ccnx;
 
 NS_LOG_COMPONENT_DEFINE ("CCNxPacket");
 
+const uint8_t CCNxPacket::DefaultHopLimit = 255;
+
 //static inline void
 //hexdump (const char *label, size_t size, const uint8_t *data)
 //{
@@ -103,6 +106,27 @@ CCNxPacket::CreateFromMessage (Ptr<CCNxMessage> message, Ptr<CCNxValidation> val
   return packet;
 }
 
+Ptr<CCNxPacket>
+CCNxPacket::CreateInterestReturn (Ptr<CCNxPacket> interestPacket, CCNxInterestReturnCode returnCode)
+{
+  NS_ASSERT_MSG (interestPacket->GetMessage ()->GetMessageType () == CCNxMessage::Interest,
+                 "InterestReturn must be created from an Interest: " << *interestPacket);
+
+  // We cannot use Create<CCNxPacket>() because the call to the protected method needs to be here.
+  Ptr<CCNxPacket> packet = Ptr<CCNxPacket> (new CCNxPacket (), false);
+  packet->m_message = interestPacket->m_message;
+  packet->m_validation = interestPacket->m_validation;
+
+  // Seed the fixed header with the PacketType and ReturnCode so GenerateFixedHeader() keeps them
+  Ptr<CCNxFixedHeader> fh = interestPacket->GetFixedHeader ();
+  packet->m_codecFixedHeader.SetFixedHeader (Create<CCNxFixedHeader> (fh->GetVersion (), CCNxFixedHeaderType_InterestReturn,
+                                                                      fh->GetPacketLength (), fh->GetHopLimit (),
+                                                                      returnCode, fh->GetHeaderLength ()));
+  packet->m_codecFixedHeader.SetFixedHeader (packet->GenerateFixedHeader (CCNxMessage::Interest));
+  packet->m_ns3Packet = 0;
+  return packet;
+}
+
 Ptr<CCNxPacket>
 CCNxPacket::CreateFromNs3Packet (Ptr<const Packet> ns3Packet)
 {
@@ -131,13 +155,19 @@ void CCNxPacket::DoDispose (void)
 
 Ptr<Packet>
 CCNxPacket::CreateNs3Packet ()
+{
+  return GetNs3Packet ()->Copy ();
+}
+
+Ptr<const Packet>
+CCNxPacket::GetNs3Packet ()
 {
   if (m_ns3Packet == NULL)
     {
       m_ns3Packet = GenerateNs3Packet ();
     }
 
-  return m_ns3Packet->Copy ();
+  return m_ns3Packet;
 }
 
 Ptr<CCNxFixedHeader>
@@ -185,7 +215,7 @@ CCNxPacket::ComputePacketSize () const
       Ptr<CCNxContentObject> content = DynamicCast<CCNxContentObject, CCNxMessage> (m_message);
       CCNxCodecContentObject codec;
       codec.SetHeader (content);
-      length += codec.GetSerializedSize ();
+      length += codec.GetSerializedSize () + codec.GetVirtualPayloadSize ();
     }
   else
     {
@@ -195,8 +225,9 @@ CCNxPacket::ComputePacketSize () const
 }
 
 /*
- * This will create a virtual packet that does not actually allocate any bytes for payload.
- * We tell it how big it is and attach the CCNxPacket as a tag.
+ * If the message has a virtual payload, this will create a packet that does not actually allocate
+ * any bytes for payload.  We tell ns3::Packet how big it is (a zero-filled area of the ns3::Buffer)
+ * and add the headers in front of it, then attach a CCNxVirtualPayloadTag.
  */
 Ptr<Packet>
 CCNxPacket::GenerateNs3Packet ()
@@ -204,7 +235,13 @@ CCNxPacket::GenerateNs3Packet ()
   Ptr<CCNxFixedHeader> fh = GenerateFixedHeader (m_message->GetMessageType ());
   m_codecFixedHeader.SetFixedHeader (fh);
 
-  Ptr<Packet> p = Create<Packet> ();
+  uint32_t virtualSize = 0;
+  if (m_message->HasVirtualPayload ())
+    {
+      virtualSize = m_message->GetPayloadSize ();
+    }
+
+  Ptr<Packet> p = Create<Packet> (virtualSize);
 
   CCNxMessage::MessageType messageType = m_message->GetMessageType ();
   if ( messageType == CCNxMessage::Interest)
@@ -234,6 +271,11 @@ CCNxPacket::GenerateNs3Packet ()
   NS_ASSERT_MSG (expectedSize == fh->GetPacketLength (), "Fixed Header size " << fh->GetPacketLength () <<
                  " does not match expected size " << expectedSize);
 
+  if (virtualSize > 0)
+    {
+      p->AddPacketTag (CCNxVirtualPayloadTag ());
+    }
+
   // TODO: Add PacketTag of the Hash
 
   return p;
@@ -245,6 +287,12 @@ CCNxPacket::GenerateFixedHeader (CCNxMessage::MessageType messageType) const
   NS_LOG_FUNCTION_NOARGS ();
   size_t packetLength = ComputePacketSize ();
   CCNxFixedHeaderType type = GetMessageTypeAsPacketType (messageType);
+  Ptr<CCNxFixedHeader> current = m_codecFixedHeader.GetFixedHeader ();
+  if (current && current->GetPacketType () == CCNxFixedHeaderType_InterestReturn && messageType == CCNxMessage::Interest)
+    {
+      // An InterestReturn carries the original Interest message
+      type = CCNxFixedHeaderType_InterestReturn;
+    }
   uint32_t headerLength = m_codecFixedHeader.GetSerializedSize ();
   uint8_t hopLimit = GetHopLimit ();
   uint8_t returnCode = GetReturnCode ();
@@ -271,15 +319,65 @@ CCNxPacket::GetMessageTypeAsPacketType (CCNxMessage::MessageType messageType = C
 uint8_t
 CCNxPacket::GetHopLimit (void) const
 {
-  // FIXME
-  return 0;
+  Ptr<CCNxFixedHeader> fh = m_codecFixedHeader.GetFixedHeader ();
+  if (fh)
+    {
+      return fh->GetHopLimit ();
+    }
+  return DefaultHopLimit;
+}
+
+bool
+CCNxPacket::DecrementHopLimit (void)
+{
+  Ptr<CCNxFixedHeader> fh = m_codecFixedHeader.GetFixedHeader ();
+  NS_ASSERT_MSG (fh, "Packet has no fixed header");
+
+  uint8_t hopLimit = fh->GetHopLimit ();
+  if (hopLimit == 0)
+    {
+      return false;
+    }
+
+  fh->SetHopLimit (hopLimit - 1);
+  if (m_ns3Packet)
+    {
+      PatchNs3PacketFixedHeader ();
+    }
+  return true;
+}
+
+void
+CCNxPacket::PatchNs3PacketFixedHeader ()
+{
+  /*
+   * Remove and re-add only the fixed header.  Because the header size does not change, ns3::Buffer
+   * writes it back in to the same bytes unless the buffer is shared with another ns3::Packet, in which
+   * case copy-on-write protects the other packet.  We use the same codec type so the PacketMetadata
+   * stays consistent when printing is enabled.
+   *
+   * GetNs3Packet() hands out m_ns3Packet itself (e.g. to the rx trace or a device queue), so if anyone
+   * else holds it we patch a copy (which shares the buffer until the header is re-written) and keep that.
+   */
+  if (m_ns3Packet->GetReferenceCount () > 1)
+    {
+      m_ns3Packet = m_ns3Packet->Copy ();
+    }
+
+  CCNxCodecFixedHeader scratch;
+  m_ns3Packet->RemoveHeader (scratch);
+  m_ns3Packet->AddHeader (m_codecFixedHeader);
 }
 
 uint8_t
 CCNxPacket::GetReturnCode (void) const
 {
-  // FIXME
-  return 0;
+  Ptr<CCNxFixedHeader> fh = m_codecFixedHeader.GetFixedHeader ();
+  if (fh)
+    {
+      return fh->GetReturnCode ();
+    }
+  return CCNxInterestReturnCode_None;
 }
 
 /**
@@ -315,6 +413,7 @@ CCNxPacket::Deserialize ()
   switch (m_codecFixedHeader.GetFixedHeader ()->GetPacketType ())
     {
     case CCNxFixedHeaderType_Interest:
+    case CCNxFixedHeaderType_InterestReturn:
       {
         uint32_t msgSize = copy->RemoveHeader (m_codecInterest);
         NS_LOG_DEBUG ("Deserialize: interest = " << msgSize);
@@ -323,6 +422,8 @@ CCNxPacket::Deserialize ()
       }
     case CCNxFixedHeaderType_Object:
       {
+        CCNxVirtualPayloadTag tag;
+        m_codecContentObject.SetDeserializeVirtualPayload (copy->PeekPacketTag (tag));
         uint32_t msgSize = copy->RemoveHeader (m_codecContentObject);
         NS_LOG_DEBUG ("Deserialize: content = " << msgSize);
         m_message = m_codecContentObject.GetHeader ();
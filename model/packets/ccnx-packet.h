@@ -105,9 +105,30 @@ namespace ccnx {
 class CCNxPacket : public SimpleRefCount<CCNxPacket>
 {
 public:
+  /**
+   * The HopLimit put in the FixedHeader of a packet created from a message.
+   */
+  static const uint8_t DefaultHopLimit;
+
   static Ptr<CCNxPacket> CreateFromMessage (Ptr<CCNxMessage> message);
   static Ptr<CCNxPacket> CreateFromMessage (Ptr<CCNxMessage> message, Ptr<CCNxValidation> validation);
 
+  /**
+   * Create an InterestReturn for an Interest packet.  The InterestReturn carries the same
+   * Interest message with the PacketType changed to CCNxFixedHeaderType_InterestReturn and
+   * the ReturnCode set.  Per hop headers are not copied.
+   *
+   * Example:
+   * @code
+   * Ptr<CCNxPacket> nack = CCNxPacket::CreateInterestReturn (interestPacket, CCNxInterestReturnCode_NoRoute);
+   * @endcode
+   *
+   * @param interestPacket [in] The Interest being returned (must have an Interest message)
+   * @param returnCode [in] The reason the Interest is returned
+   * @return A new InterestReturn packet
+   */
+  static Ptr<CCNxPacket> CreateInterestReturn (Ptr<CCNxPacket> interestPacket, CCNxInterestReturnCode returnCode);
+
   /**
    * Deserialize the packet and instantiate the CCNx objects.
    */
@@ -133,6 +154,30 @@ public:
    */
   Ptr<Packet> CreateNs3Packet ();
 
+  /**
+   * Returns the cached wire format of the packet without copying it.  The first call
+   * serializes the packet, subsequent calls return the same ns3::Packet.
+   *
+   * This is the fan-out path: encode once and share the immutable buffer between
+   * every egress connection and trace source.  A caller that needs to add headers
+   * (e.g. a NetDevice adding its link-layer header) must Copy() it first.  Because
+   * ns3::Packet::Copy() is copy-on-write, that copy only shares a reference to the
+   * encoded buffer.
+   *
+   * @return The shared, read-only ns3::Packet of this CCNxPacket
+   */
+  Ptr<const Packet> GetNs3Packet ();
+
+  /**
+   * Decrements the HopLimit in the FixedHeader by one.
+   *
+   * If the packet has already been serialized (e.g. it was received from Layer 2), the
+   * FixedHeader of the cached ns3::Packet is patched in place.  The message is not re-encoded.
+   *
+   * @return false if the HopLimit was already 0 (it is left at 0), true otherwise
+   */
+  bool DecrementHopLimit (void);
+
   /**
    * Set a virtual ContentObjectHash on the packet.  The hash is carried along with the packet to
    * allow "calculating" the hash without using a SHA.  It is carried in an ns3::Packet as a PacketTag.
@@ -160,8 +205,16 @@ protected:
 
   uint32_t GetPerHopHeaderLength (void) const;
 
+  /**
+   * The HopLimit to use when generating a FixedHeader.  If the packet already has a
+   * FixedHeader, its HopLimit is preserved, otherwise it is DefaultHopLimit.
+   */
   uint8_t GetHopLimit (void) const;
 
+  /**
+   * The ReturnCode to use when generating a FixedHeader.  If the packet already has a
+   * FixedHeader, its ReturnCode is preserved, otherwise it is 0.
+   */
   uint8_t GetReturnCode (void) const;
 
   size_t ComputePacketSize (void) const;
@@ -178,6 +231,13 @@ protected:
    */
   void TrimNs3Packet ();
 
+  /**
+   * Re-write the FixedHeader (and per hop headers) at the front of m_ns3Packet from
+   * m_codecFixedHeader.  The message and validation bytes are not touched.  If m_ns3Packet is
+   * shared with other holders, it is replaced by a patched copy so they keep the original bytes.
+   */
+  void PatchNs3PacketFixedHeader ();
+
   CCNxCodecFixedHeader m_codecFixedHeader;
   CCNxCodecInterest m_codecInterest;
   CCNxCodecContentObject m_codecContentObject;
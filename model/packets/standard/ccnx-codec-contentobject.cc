@@ -103,19 +103,44 @@ CCNxCodecContentObject::GetSerializedSize (void) const
     {
       bytes += CCNxTlv::GetTLSize () + m_content->GetPayload ()->GetSize ();
     }
+  else if (m_content->HasVirtualPayload ())
+    {
+      // Only the T_PAYLOAD TL, the value is the zero-filled area of the ns3::Packet
+      bytes += CCNxTlv::GetTLSize ();
+    }
+
+  return bytes;
+}
 
+uint32_t
+CCNxCodecContentObject::GetVirtualPayloadSize (void) const
+{
+  uint32_t bytes = 0;
+  if (m_content && m_content->HasVirtualPayload ())
+    {
+      bytes = m_content->GetPayloadSize ();
+    }
   return bytes;
 }
 
+void
+CCNxCodecContentObject::SetDeserializeVirtualPayload (bool virtualPayload)
+{
+  m_deserializeVirtualPayload = virtualPayload;
+}
+
 void
 CCNxCodecContentObject::Serialize (Buffer::Iterator outputIterator) const
 {
   NS_LOG_FUNCTION (this << &outputIterator);
 
-  uint16_t bytes = (uint16_t) GetSerializedSize ();
+  uint32_t virtualBytes = GetVirtualPayloadSize ();
+  NS_ASSERT_MSG (GetSerializedSize () + virtualBytes <= 0xFFFF, "Content Object too long");
+  uint16_t bytes = (uint16_t) (GetSerializedSize () + virtualBytes);
   NS_ASSERT_MSG (bytes >= CCNxTlv::GetTLSize (), "Serialized size must be at least 4 bytes");
 
-  // -4 because it includes the T_OBJECT TLV.
+  // -4 because it includes the T_OBJECT TLV.  The T_OBJECT length covers the virtual payload bytes
+  // that follow this header in the ns3::Packet.
   CCNxTlv::WriteTypeLength (outputIterator, CCNxSchemaV1::T_OBJECT, bytes - CCNxTlv::GetTLSize ());
 
   // The name codec includes the T_NAME TLV
@@ -144,6 +169,10 @@ CCNxCodecContentObject::Serialize (Buffer::Iterator outputIterator) const
       CCNxTlv::WriteTypeLength (outputIterator, CCNxSchemaV1::T_PAYLOAD, (uint16_t) payload->GetSize ());
       outputIterator.Write (payload->Begin (), payload->End ());
     }
+  else if (virtualBytes > 0)
+    {
+      CCNxTlv::WriteTypeLength (outputIterator, CCNxSchemaV1::T_PAYLOAD, (uint16_t) virtualBytes);
+    }
 }
 
 uint32_t
@@ -168,6 +197,7 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
       CCNxContentObjectPayloadType payloadType = CCNxContentObjectPayloadType_Data;
       Ptr<CCNxTime> expiryTime = Ptr<CCNxTime> (0);
       Ptr<CCNxBuffer> payload = Ptr<CCNxBuffer> (0);
+      uint16_t virtualLength = 0;
 
       while (bytesRead < messageLength)
         {
@@ -194,7 +224,16 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
               break;
 
             case CCNxSchemaV1::T_PAYLOAD:
-              payload = DeserializePayload (iterator, nestedLength);
+              if (m_deserializeVirtualPayload)
+                {
+                  // Do not copy the zero-filled area, just remember how long it is
+                  virtualLength = nestedLength;
+                  iterator.Next (nestedLength);
+                }
+              else
+                {
+                  payload = DeserializePayload (iterator, nestedLength);
+                }
               break;
 
             default:
@@ -204,7 +243,17 @@ CCNxCodecContentObject::Deserialize (Buffer::Iterator inputIterator)
           bytesRead += nestedLength;
         }
 
-      m_content = Create<CCNxContentObject> (name, payload, payloadType, expiryTime);
+      if (virtualLength > 0)
+        {
+          m_content = Create<CCNxContentObject> (name, virtualLength, payloadType, expiryTime);
+        }
+      else
+        {
+          m_content = Create<CCNxContentObject> (name, payload, payloadType, expiryTime);
+        }
+
+      // The virtual bytes are not part of this header, they stay in the ns3::Packet
+      bytesRead -= virtualLength;
     }
   else
     {
@@ -286,7 +335,7 @@ CCNxCodecContentObject::Print (std::ostream &os) const
     }
 }
 
-CCNxCodecContentObject::CCNxCodecContentObject () : m_content (0)
+CCNxCodecContentObject::CCNxCodecContentObject () : m_content (0), m_deserializeVirtualPayload (false)
 {
   // empty
 }
@@ -127,6 +127,24 @@ public:
    */
   void SetHeader (Ptr<CCNxContentObject> content);
 
+  /**
+   * The number of virtual payload bytes of the Content Object.  These bytes are
+   * not part of GetSerializedSize(), only the T_PAYLOAD TL is.  The caller must put
+   * this many (zero-filled) bytes after the header in the ns3::Packet.
+   *
+   * @return The virtual payload length, 0 if there is none.
+   */
+  uint32_t GetVirtualPayloadSize (void) const;
+
+  /**
+   * If true, Deserialize() treats the T_PAYLOAD value as virtual payload.  It
+   * records the length but does not copy the bytes, and the bytes are not counted
+   * in the value returned by Deserialize().
+   *
+   * @param [in] virtualPayload true if the packet carries a virtual payload
+   */
+  void SetDeserializeVirtualPayload (bool virtualPayload);
+
   /**
    * Maps the enum payload type to the schema value.
    */
@@ -144,6 +162,7 @@ private:
    */
   Ptr<CCNxContentObject> m_content;
   CCNxCodecName m_nameCodec;
+  bool m_deserializeVirtualPayload;
 
   /**
    * The start iterator points to the T_NAME Value.  It will be rewinded 4
@@ -134,4 +134,17 @@ CCNxPortal::NotifyRecv (void)
     }
 }
 
-
+size_t
+CCNxPortal::RecvBatch (PacketBatchType &batch, size_t maxPackets)
+{
+  NS_LOG_FUNCTION (this << maxPackets);
+  size_t count = 0;
+  Ptr<CCNxConnection> incoming;
+  Ptr<CCNxPacket> packet;
+  while (count < maxPackets && (packet = RecvFrom (incoming)))
+    {
+      batch.push_back (std::make_pair (packet, incoming));
+      count++;
+    }
+  return count;
+}
@@ -57,6 +57,8 @@
 #ifndef CCNS3_CCNXPORTAL_H
 #define CCNS3_CCNXPORTAL_H
 
+#include <vector>
+
 #include "ns3/object.h"
 #include "ns3/ccnx-l3-protocol.h"
 #include "ns3/ccnx-connection.h"
@@ -278,6 +280,37 @@ public:
    */
   virtual Ptr<CCNxPacket> RecvFrom (Ptr<CCNxConnection> & incomingConnection) = 0;
 
+  /**
+   * A batch of received packets, each with its in-coming connection.
+   */
+  typedef std::vector< std::pair< Ptr<CCNxPacket>, Ptr<CCNxConnection> > > PacketBatchType;
+
+  /**
+   * The application calls this to read up to `maxPackets` packets at once.  The packets
+   * and their in-coming connections are appended to `batch`, so an application can reuse
+   * the same vector (clear() it between calls) without re-allocating.
+   *
+   * The default implementation calls RecvFrom() in a loop.  A concrete portal may override it.
+   *
+   * Example:
+   * @code
+   * void ReceiveCallback(Ptr<CCNxPortal> portal)
+   * {
+   *    CCNxPortal::PacketBatchType batch;
+   *    while (portal->RecvBatch (batch, 64) > 0) {
+   *       for (size_t i = 0; i < batch.size (); i++) {
+   *          Process (batch[i].first, batch[i].second);
+   *       }
+   *       batch.clear ();
+   *    }
+   * }
+   * @endcode
+   *
+   * @param [out] batch The vector to append to
+   * @param [in] maxPackets The maximum number of packets to read
+   * @return The number of packets appended to batch
+   */
+  virtual size_t RecvBatch (PacketBatchType &batch, size_t maxPackets);
 };
 
 }
@@ -57,8 +57,12 @@
  *
  */
 
+#include <algorithm>
+
 #include "ns3/object.h"
 #include "ns3/log.h"
+#include "ns3/boolean.h"
+#include "ns3/simulator.h"
 
 #include "ns3/ccnx-message-portal.h"
 
@@ -69,18 +73,26 @@ NS_LOG_COMPONENT_DEFINE ("CCNxMessagePortal");
 
 NS_OBJECT_ENSURE_REGISTERED (CCNxMessagePortal);
 
+static const size_t _initialInputQueueSize = 16;
+
 TypeId
 CCNxMessagePortal::GetTypeId (void)
 {
   static TypeId tid = TypeId ("ns3::ccnx::CCNxMessagePortal")
     .SetParent<CCNxPortal> ()
     .SetGroupName ("CCNx")
-    .AddConstructor<CCNxMessagePortal> ();
+    .AddConstructor<CCNxMessagePortal> ()
+    .AddAttribute ("CoalesceNotifications",
+                   "Call the receive callback once for all packets that arrive in the same simulation instant",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&CCNxMessagePortal::m_coalesceNotifications),
+                   MakeBooleanChecker ());
   return tid;
 
 }
 
-CCNxMessagePortal::CCNxMessagePortal (void) : m_ccnx (NULL)
+CCNxMessagePortal::CCNxMessagePortal (void) : m_ccnx (NULL), m_inputQueue (_initialInputQueueSize),
+  m_inputHead (0), m_inputCount (0), m_coalesceNotifications (false)
 {
   NS_LOG_FUNCTION (this);
 }
@@ -88,6 +100,18 @@ CCNxMessagePortal::CCNxMessagePortal (void) : m_ccnx (NULL)
 CCNxMessagePortal::~CCNxMessagePortal (void)
 {
   NS_LOG_FUNCTION (this);
+  m_notifyEvent.Cancel ();
+}
+
+void
+CCNxMessagePortal::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  m_notifyEvent.Cancel ();
+  m_inputQueue.clear ();
+  m_inputHead = 0;
+  m_inputCount = 0;
+  CCNxPortal::DoDispose ();
 }
 
 void
@@ -104,11 +128,75 @@ CCNxMessagePortal::ReceiveFromLayer3 (Ptr<CCNxPacket> packet, Ptr<CCNxConnection
   NS_LOG_FUNCTION (this << packet << incoming);
   NS_LOG_DEBUG ("packet " << packet << ", incoming " << incoming);
 
-  m_inputQueue.push_back (new QueueEntryType (packet, incoming));
-  NotifyRecv ();
+  PushInput (packet, incoming);
+
+  if (!m_coalesceNotifications)
+    {
+      NotifyRecv ();
+    }
+  else if (!m_notifyEvent.IsRunning ())
+    {
+      m_notifyEvent = Simulator::ScheduleNow (&CCNxMessagePortal::DeliverNotification, this);
+    }
   return true;
 }
 
+void
+CCNxMessagePortal::DeliverNotification (void)
+{
+  NS_LOG_FUNCTION (this << m_inputCount);
+  if (m_inputCount > 0)
+    {
+      NotifyRecv ();
+    }
+}
+
+void
+CCNxMessagePortal::PushInput (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming)
+{
+  if (m_inputCount == m_inputQueue.size ())
+    {
+      // Full (or disposed), unroll the ring into a buffer twice the size
+      QueueType larger (std::max (_initialInputQueueSize, 2 * m_inputQueue.size ()));
+      for (size_t i = 0; i < m_inputCount; i++)
+        {
+          larger[i] = m_inputQueue[(m_inputHead + i) & (m_inputQueue.size () - 1)];
+        }
+      m_inputQueue.swap (larger);
+      m_inputHead = 0;
+    }
+
+  QueueEntryType &slot = m_inputQueue[(m_inputHead + m_inputCount) & (m_inputQueue.size () - 1)];
+  slot.first = packet;
+  slot.second = incoming;
+  m_inputCount++;
+}
+
+bool
+CCNxMessagePortal::PopInput (QueueEntryType &entry)
+{
+  if (m_inputCount == 0)
+    {
+      return false;
+    }
+
+  QueueEntryType &slot = m_inputQueue[m_inputHead];
+  entry.first = slot.first;
+  entry.second = slot.second;
+  slot.first = 0;
+  slot.second = 0;
+
+  m_inputHead = (m_inputHead + 1) & (m_inputQueue.size () - 1);
+  m_inputCount--;
+  return true;
+}
+
+size_t
+CCNxMessagePortal::GetInputQueueSize (void) const
+{
+  return m_inputCount;
+}
+
 Ptr<CCNxL3Protocol>
 CCNxMessagePortal::GetCCNx (void) const
 {
@@ -152,6 +240,8 @@ CCNxMessagePortal::Close (void)
 {
   NS_LOG_FUNCTION (this);
 
+  // The application may release the portal right after Close(), so do not call back later
+  m_notifyEvent.Cancel ();
   m_ccnx->UnregisterProtocol (*this);
   m_ccnx = 0;
 
@@ -203,17 +293,9 @@ CCNxMessagePortal::Recv (void)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<CCNxPacket> packet;
-  if (!m_inputQueue.empty ())
-    {
-      QueueEntryType *entry = m_inputQueue.front ();
-      m_inputQueue.pop_front ();
-
-      packet = entry->first;
-      delete entry;
-    }
-
-  return packet;
+  QueueEntryType entry;
+  PopInput (entry);
+  return entry.first;
 }
 
 Ptr<CCNxPacket>
@@ -221,16 +303,26 @@ CCNxMessagePortal::RecvFrom (Ptr<CCNxConnection> &incomingConnection)
 {
   NS_LOG_FUNCTION (this);
 
-  Ptr<CCNxPacket> packet;
-  if (!m_inputQueue.empty ())
+  QueueEntryType entry;
+  if (PopInput (entry))
     {
-      QueueEntryType *entry = m_inputQueue.front ();
-      m_inputQueue.pop_front ();
-
-      packet = entry->first;
-      incomingConnection = entry->second;
-      delete entry;
+      incomingConnection = entry.second;
     }
+  return entry.first;
+}
+
+size_t
+CCNxMessagePortal::RecvBatch (PacketBatchType &batch, size_t maxPackets)
+{
+  NS_LOG_FUNCTION (this << maxPackets);
 
-  return packet;
+  size_t count = std::min (maxPackets, m_inputCount);
+  batch.reserve (batch.size () + count);
+  QueueEntryType entry;
+  for (size_t i = 0; i < count; i++)
+    {
+      PopInput (entry);
+      batch.push_back (entry);
+    }
+  return count;
 }
@@ -60,9 +60,10 @@
 #ifndef CCNS3_CCNXMESSAGEPORTAL_H
 #define CCNS3_CCNXMESSAGEPORTAL_H
 
-#include <deque>
+#include <vector>
 
 #include "ns3/node.h"
+#include "ns3/event-id.h"
 #include "ns3/ccnx-l3-protocol.h"
 #include "ns3/ccnx-name.h"
 #include "ns3/ccnx-portal.h"
@@ -76,6 +77,13 @@ namespace ccnx {
  *
  * A Message portal does no L4 processing on packets, it passes them one for one.
  *
+ * Packets from L3 wait in a ring buffer until the application reads them, so queueing
+ * a packet does not allocate once the ring has grown to the working size.  By default the
+ * receive callback is called from inside ReceiveFromLayer3() for every packet.  With the
+ * CoalesceNotifications attribute set, the notification is coalesced instead: when several
+ * packets arrive in the same simulation instant, the application's receive callback runs once
+ * (at the end of that instant) and can drain them all, for example with RecvBatch().
+ *
  * @see CCNxMessagePortalFactory
  */
 class CCNxMessagePortal : public CCNxPortal,
@@ -113,8 +121,10 @@ public:
    * When the L4 protocol receives a packet, it will call NotifyRecv(), which the
    * base class CCNxPortal will use to notify the applications receive callback.
    *
-   * Usually when the L3 protocol calls this function, it makes a tight call loop of
-   * Receive() -> NotifyRecv() -> m_receiveCallback() -> Recv().
+   * Without CoalesceNotifications, when the L3 protocol calls this function, it makes a tight
+   * call loop of Receive() -> NotifyRecv() -> m_receiveCallback() -> Recv().  With
+   * CoalesceNotifications, NotifyRecv() is scheduled once for all the packets that arrive
+   * in the same simulation instant.
    *
    * @param [in] packet CCNx packet to be received
    * @param [in] incoming Connection to receive packet from
@@ -224,19 +234,58 @@ public:
    */
   virtual Ptr<CCNxPacket> RecvFrom (Ptr<CCNxConnection> &incomingConnection);
 
+  /**
+   * Reads up to `maxPackets` packets from the input queue in one call.
+   *
+   * @see CCNxPortal::RecvBatch
+   */
+  virtual size_t RecvBatch (PacketBatchType &batch, size_t maxPackets);
+
+  /**
+   * The number of packets waiting to be read by the application.
+   */
+  size_t GetInputQueueSize (void) const;
+
+protected:
+  virtual void DoDispose (void);
+
 private:
   friend class CCNxMessagePortalFactory;
 
   Ptr<CCNxL3Protocol> m_ccnx;
 
   typedef std::pair< Ptr<CCNxPacket>, Ptr<CCNxConnection> > QueueEntryType;
-  typedef std::deque< QueueEntryType  * > QueueType;
+  typedef std::vector< QueueEntryType > QueueType;
+
+  /**
+   * Append to the tail of the input ring, doubling its size if it is full.
+   */
+  void PushInput (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming);
+
+  /**
+   * Remove the head of the input ring.  The slot is cleared so the ring does not
+   * hold references to packets the application has read.
+   *
+   * @return false if the ring is empty
+   */
+  bool PopInput (QueueEntryType &entry);
+
+  /**
+   * Runs at the end of the simulation instant when a coalesced notification is pending.
+   */
+  void DeliverNotification (void);
 
   /**
    * The L4 protocol queues packets from L3 until the application reads them via the
-   * Recv() or RecvFrom() functions.
+   * Recv(), RecvFrom() or RecvBatch() functions.  This is a ring buffer: m_inputHead is the
+   * oldest entry and there are m_inputCount entries.  Its size is always a power of 2.
    */
   QueueType m_inputQueue;
+  size_t m_inputHead;
+  size_t m_inputCount;
+
+  bool m_coalesceNotifications;
+  EventId m_notifyEvent;
 };
 }
 }
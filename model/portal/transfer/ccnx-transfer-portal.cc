@@ -0,0 +1,610 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <cstdio>
+
+#include "ns3/log.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-name-builder.h"
+#include "ns3/ccnx-interest.h"
+
+#include "ns3/ccnx-transfer-portal.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxTransferPortal");
+
+NS_OBJECT_ENSURE_REGISTERED (CCNxTransferPortal);
+
+/**
+ * The outstanding index of the metadata Interest
+ */
+static const uint32_t _metadataIndex = 0xFFFFFFFF;
+
+/**
+ * Object size (U64) + segment size (U32)
+ */
+static const uint32_t _metadataLength = 12;
+
+TypeId
+CCNxTransferPortal::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxTransferPortal")
+    .SetParent<CCNxMessagePortal> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxTransferPortal> ()
+    .AddAttribute ("SegmentSize",
+                   "The payload bytes per Content Object of a published object",
+                   UintegerValue (1200),
+                   MakeUintegerAccessor (&CCNxTransferPortal::m_segmentSize),
+                   MakeUintegerChecker<uint32_t> (1, 0xFFFF - 1024))
+    .AddAttribute ("WindowSize",
+                   "The number of chunks a Fetch() may request beyond the last chunk delivered in order",
+                   UintegerValue (8),
+                   MakeUintegerAccessor (&CCNxTransferPortal::m_windowSize),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("RetransmitTimeout",
+                   "How long to wait for a Content Object before sending the Interest again",
+                   TimeValue (Seconds (1)),
+                   MakeTimeAccessor (&CCNxTransferPortal::m_retransmitTimeout),
+                   MakeTimeChecker ())
+    .AddAttribute ("MaxRetries",
+                   "The number of times an Interest is sent again before the transfer fails",
+                   UintegerValue (3),
+                   MakeUintegerAccessor (&CCNxTransferPortal::m_maxRetries),
+                   MakeUintegerChecker<uint32_t> ());
+  return tid;
+}
+
+CCNxTransferPortal::CCNxTransferPortal (void) : m_segmentSize (1200), m_windowSize (8),
+  m_retransmitTimeout (Seconds (1)), m_maxRetries (3), m_retransmissions (0)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+CCNxTransferPortal::~CCNxTransferPortal (void)
+{
+  NS_LOG_FUNCTION (this);
+}
+
+void
+CCNxTransferPortal::DoDispose (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_transfers.empty ())
+    {
+      CancelFetch (m_transfers.begin ()->first);
+    }
+  m_published.clear ();
+  m_completeCallback = TransferCompleteCallback ();
+  m_segmentCallback = SegmentCallback ();
+  m_failedCallback = TransferFailedCallback ();
+  CCNxMessagePortal::DoDispose ();
+}
+
+bool
+CCNxTransferPortal::Close (void)
+{
+  NS_LOG_FUNCTION (this);
+  while (!m_transfers.empty ())
+    {
+      CancelFetch (m_transfers.begin ()->first);
+    }
+  while (!m_published.empty ())
+    {
+      Unpublish (m_published.begin ()->first);
+    }
+  return CCNxMessagePortal::Close ();
+}
+
+void
+CCNxTransferPortal::SetTransferCompleteCallback (TransferCompleteCallback callback)
+{
+  m_completeCallback = callback;
+}
+
+void
+CCNxTransferPortal::SetSegmentCallback (SegmentCallback callback)
+{
+  m_segmentCallback = callback;
+}
+
+void
+CCNxTransferPortal::SetTransferFailedCallback (TransferFailedCallback callback)
+{
+  m_failedCallback = callback;
+}
+
+uint64_t
+CCNxTransferPortal::GetRetransmissionCount (void) const
+{
+  return m_retransmissions;
+}
+
+// ====================================================
+// Producer side
+
+void
+CCNxTransferPortal::Publish (Ptr<const CCNxName> name, Ptr<CCNxBuffer> object)
+{
+  NS_LOG_FUNCTION (this << name << object->GetSize ());
+  DoPublish (name, object, object->GetSize ());
+}
+
+void
+CCNxTransferPortal::PublishVirtual (Ptr<const CCNxName> name, uint64_t size)
+{
+  NS_LOG_FUNCTION (this << name << size);
+  DoPublish (name, Ptr<CCNxBuffer> (0), size);
+}
+
+void
+CCNxTransferPortal::DoPublish (Ptr<const CCNxName> name, Ptr<CCNxBuffer> data, uint64_t size)
+{
+  uint64_t chunkCount = (size + m_segmentSize - 1) / m_segmentSize;
+  NS_ASSERT_MSG (chunkCount < _metadataIndex, "Object " << *name << " has too many segments");
+
+  PublishedObjectType object;
+  object.data = data;
+  object.size = size;
+  object.segmentSize = m_segmentSize;
+
+  std::pair<PublishedMapType::iterator, bool> result = m_published.insert (std::make_pair (name, object));
+  if (result.second)
+    {
+      RegisterAnchor (name);
+    }
+  else
+    {
+      // Re-publishing replaces the object, the anchor is already registered
+      result.first->second = object;
+    }
+}
+
+void
+CCNxTransferPortal::Unpublish (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+  PublishedMapType::iterator i = m_published.find (name);
+  if (i != m_published.end ())
+    {
+      Ptr<const CCNxName> anchor = i->first;
+      m_published.erase (i);
+      UnregisterAnchor (anchor);
+    }
+}
+
+bool
+CCNxTransferPortal::ServeInterest (Ptr<const CCNxName> name)
+{
+  Ptr<CCNxContentObject> response;
+
+  PublishedMapType::const_iterator i = m_published.find (name);
+  if (i != m_published.end ())
+    {
+      Ptr<CCNxBuffer> payload = Create<CCNxBuffer> (_metadataLength, true);
+      Buffer::Iterator writer = payload->Begin ();
+      writer.WriteHtonU64 (i->second.size);
+      writer.WriteHtonU32 (i->second.segmentSize);
+      response = Create<CCNxContentObject> (name, payload, CCNxContentObjectPayloadType_Manifest, Ptr<CCNxTime> (0));
+    }
+  else
+    {
+      Ptr<const CCNxName> prefix;
+      uint32_t index;
+      if (!ParseChunkName (name, prefix, index) || (i = m_published.find (prefix)) == m_published.end ())
+        {
+          return false;
+        }
+
+      const PublishedObjectType &object = i->second;
+      uint64_t offset = (uint64_t) index * object.segmentSize;
+      if (offset >= object.size)
+        {
+          NS_LOG_INFO ("Interest " << *name << " beyond the end of the object");
+          return false;
+        }
+
+      uint32_t length = (uint32_t) std::min<uint64_t> (object.segmentSize, object.size - offset);
+      if (object.data)
+        {
+          // The fragment shares the object's bytes
+          Buffer fragment = object.data->GetBuffer ().CreateFragment ((uint32_t) offset, length);
+          response = Create<CCNxContentObject> (name, Create<CCNxBuffer> (fragment));
+        }
+      else
+        {
+          response = Create<CCNxContentObject> (name, (size_t) length);
+        }
+    }
+
+  NS_LOG_DEBUG ("Serving " << *name);
+  Send (CCNxPacket::CreateFromMessage (response));
+  return true;
+}
+
+// ====================================================
+// Consumer side
+
+bool
+CCNxTransferPortal::Fetch (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+  if (m_transfers.find (name) != m_transfers.end ())
+    {
+      return false;
+    }
+
+  TransferType &transfer = m_transfers[name];
+  transfer.haveMetadata = false;
+  transfer.size = 0;
+  transfer.segmentSize = 0;
+  transfer.chunkCount = 0;
+  transfer.nextRequest = 0;
+  transfer.nextDeliver = 0;
+  transfer.bytesDelivered = 0;
+  transfer.physical = m_segmentCallback.IsNull ();
+
+  Request (name, transfer, _metadataIndex);
+  return true;
+}
+
+void
+CCNxTransferPortal::CancelFetch (Ptr<const CCNxName> name)
+{
+  NS_LOG_FUNCTION (this << name);
+  TransferMapType::iterator i = m_transfers.find (name);
+  if (i != m_transfers.end ())
+    {
+      std::map<uint32_t, OutstandingType>::iterator j;
+      for (j = i->second.outstanding.begin (); j != i->second.outstanding.end (); ++j)
+        {
+          j->second.timeout.Cancel ();
+        }
+      m_transfers.erase (i);
+    }
+}
+
+void
+CCNxTransferPortal::Request (Ptr<const CCNxName> name, TransferType &transfer, uint32_t index)
+{
+  Ptr<const CCNxName> interestName = (index == _metadataIndex) ? name : CreateChunkName (name, index);
+  NS_LOG_DEBUG ("Requesting " << *interestName);
+
+  // Keep the name from the transfer map so the timeout finds the transfer without copying it
+  TransferMapType::iterator i = m_transfers.find (name);
+  NS_ASSERT_MSG (i != m_transfers.end (), "Request for unknown transfer " << *name);
+
+  OutstandingType &outstanding = transfer.outstanding[index];
+  outstanding.timeout = Simulator::Schedule (m_retransmitTimeout, &CCNxTransferPortal::Timeout, this, i->first, index);
+  Send (CCNxPacket::CreateFromMessage (Create<CCNxInterest> (interestName)));
+}
+
+void
+CCNxTransferPortal::FillWindow (Ptr<const CCNxName> name, TransferType &transfer)
+{
+  while (transfer.nextRequest < transfer.chunkCount
+         && transfer.nextRequest - transfer.nextDeliver < m_windowSize)
+    {
+      uint32_t index = transfer.nextRequest++;
+      transfer.outstanding[index].retries = 0;
+      Request (name, transfer, index);
+    }
+}
+
+void
+CCNxTransferPortal::Timeout (Ptr<const CCNxName> name, uint32_t index)
+{
+  NS_LOG_FUNCTION (this << name << index);
+  TransferMapType::iterator i = m_transfers.find (name);
+  if (i == m_transfers.end ())
+    {
+      return;
+    }
+
+  TransferType &transfer = i->second;
+  std::map<uint32_t, OutstandingType>::iterator j = transfer.outstanding.find (index);
+  if (j == transfer.outstanding.end ())
+    {
+      return;
+    }
+
+  if (j->second.retries >= m_maxRetries)
+    {
+      NS_LOG_INFO ("Transfer " << *name << " failed, no answer for index " << index);
+      FinishTransfer (name, false);
+      return;
+    }
+
+  j->second.retries++;
+  m_retransmissions++;
+  Request (i->first, transfer, index);
+}
+
+bool
+CCNxTransferPortal::ReceiveContentObject (Ptr<CCNxContentObject> content)
+{
+  Ptr<const CCNxName> name = content->GetName ();
+
+  TransferMapType::iterator i = m_transfers.find (name);
+  if (i != m_transfers.end ())
+    {
+      if (i->second.haveMetadata || content->GetPayloadType () != CCNxContentObjectPayloadType_Manifest)
+        {
+          return false;
+        }
+      ReceiveMetadata (i->first, i->second, content);
+      return true;
+    }
+
+  Ptr<const CCNxName> prefix;
+  uint32_t index;
+  if (!ParseChunkName (name, prefix, index) || (i = m_transfers.find (prefix)) == m_transfers.end ())
+    {
+      return false;
+    }
+
+  std::map<uint32_t, OutstandingType>::iterator j = i->second.outstanding.find (index);
+  if (j == i->second.outstanding.end ())
+    {
+      // A duplicate of a chunk we already have, it still belongs to the transfer
+      return true;
+    }
+  j->second.timeout.Cancel ();
+  i->second.outstanding.erase (j);
+
+  ReceiveSegment (i->first, i->second, index, content);
+  return true;
+}
+
+void
+CCNxTransferPortal::ReceiveMetadata (Ptr<const CCNxName> name, TransferType &transfer, Ptr<CCNxContentObject> content)
+{
+  Ptr<CCNxBuffer> payload = content->GetPayload ();
+  if (!payload || payload->GetSize () < _metadataLength)
+    {
+      NS_LOG_ERROR ("Bad metadata object for " << *name);
+      return;
+    }
+
+  Buffer::Iterator reader = payload->Begin ();
+  transfer.size = reader.ReadNtohU64 ();
+  transfer.segmentSize = reader.ReadNtohU32 ();
+  if (transfer.segmentSize == 0)
+    {
+      NS_LOG_ERROR ("Bad segment size in metadata object for " << *name);
+      return;
+    }
+  transfer.chunkCount = (uint32_t) ((transfer.size + transfer.segmentSize - 1) / transfer.segmentSize);
+  transfer.haveMetadata = true;
+  NS_LOG_INFO ("Transfer " << *name << " size " << transfer.size << " chunks " << transfer.chunkCount);
+
+  transfer.outstanding[_metadataIndex].timeout.Cancel ();
+  transfer.outstanding.erase (_metadataIndex);
+
+  if (transfer.chunkCount == 0)
+    {
+      FinishTransfer (name, true);
+      return;
+    }
+  FillWindow (name, transfer);
+}
+
+void
+CCNxTransferPortal::ReceiveSegment (Ptr<const CCNxName> name, TransferType &transfer, uint32_t index, Ptr<CCNxContentObject> content)
+{
+  transfer.received[index] = content;
+
+  // Deliver in order.  A callback may cancel the transfer, so look it up again each time.
+  TransferMapType::iterator i = m_transfers.find (name);
+  while (i != m_transfers.end ())
+    {
+      TransferType &current = i->second;
+      std::map<uint32_t, Ptr<CCNxContentObject> >::iterator next = current.received.find (current.nextDeliver);
+      if (next == current.received.end ())
+        {
+          break;
+        }
+
+      Ptr<CCNxContentObject> segment = next->second;
+      current.received.erase (next);
+      uint64_t offset = current.bytesDelivered;
+      current.bytesDelivered += segment->GetPayloadSize ();
+      current.nextDeliver++;
+
+      if (segment->GetPayload () && current.physical)
+        {
+          current.data.AddAtEnd (segment->GetPayload ()->GetBuffer ());
+        }
+      else
+        {
+          current.physical = false;
+        }
+
+      if (!m_segmentCallback.IsNull ())
+        {
+          Ptr<const CCNxName> key = i->first;
+          m_segmentCallback (this, key, offset, segment);
+          i = m_transfers.find (key);
+        }
+    }
+
+  if (i == m_transfers.end ())
+    {
+      return;
+    }
+
+  if (i->second.nextDeliver == i->second.chunkCount)
+    {
+      FinishTransfer (i->first, true);
+    }
+  else
+    {
+      FillWindow (i->first, i->second);
+    }
+}
+
+void
+CCNxTransferPortal::FinishTransfer (Ptr<const CCNxName> name, bool success)
+{
+  TransferMapType::iterator i = m_transfers.find (name);
+  NS_ASSERT_MSG (i != m_transfers.end (), "Finishing unknown transfer " << *name);
+
+  // Keep what the callbacks need, then remove the transfer before calling them
+  Ptr<const CCNxName> key = i->first;
+  uint64_t bytes = i->second.bytesDelivered;
+  Ptr<CCNxBuffer> object;
+  if (success && i->second.physical)
+    {
+      object = Create<CCNxBuffer> (i->second.data);
+    }
+  CancelFetch (key);
+
+  if (success)
+    {
+      NS_LOG_INFO ("Transfer " << *key << " complete, " << bytes << " bytes");
+      if (!m_completeCallback.IsNull ())
+        {
+          m_completeCallback (this, key, object, bytes);
+        }
+    }
+  else if (!m_failedCallback.IsNull ())
+    {
+      m_failedCallback (this, key);
+    }
+}
+
+// ====================================================
+
+bool
+CCNxTransferPortal::ReceiveFromLayer3 (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming)
+{
+  NS_LOG_FUNCTION (this << packet << incoming);
+
+  bool consumed = false;
+  switch (packet->GetFixedHeader ()->GetPacketType ())
+    {
+    case CCNxFixedHeaderType_Interest:
+      consumed = ServeInterest (packet->GetMessage ()->GetName ());
+      break;
+
+    case CCNxFixedHeaderType_Object:
+      consumed = ReceiveContentObject (DynamicCast<CCNxContentObject, CCNxMessage> (packet->GetMessage ()));
+      break;
+
+    default:
+      break;
+    }
+
+  if (!consumed)
+    {
+      return CCNxMessagePortal::ReceiveFromLayer3 (packet, incoming);
+    }
+  return true;
+}
+
+bool
+CCNxTransferPortal::ParseChunkName (Ptr<const CCNxName> name, Ptr<const CCNxName> &prefix, uint32_t &index)
+{
+  size_t count = name->GetSegmentCount ();
+  if (count == 0)
+    {
+      return false;
+    }
+
+  Ptr<const CCNxNameSegment> segment = name->GetSegment (count - 1);
+  if (segment->GetType () != CCNxNameSegment_Chunk)
+    {
+      return false;
+    }
+
+  const std::string &value = segment->GetValue ();
+  if (value.empty () || value.size () > 10)
+    {
+      return false;
+    }
+  uint64_t parsed = 0;
+  for (size_t i = 0; i < value.size (); ++i)
+    {
+      if (value[i] < '0' || value[i] > '9')
+        {
+          return false;
+        }
+      parsed = parsed * 10 + (value[i] - '0');
+    }
+  if (parsed >= _metadataIndex)
+    {
+      return false;
+    }
+
+  CCNxNameBuilder builder (*name);
+  builder.Trim ();
+  prefix = builder.CreateName ();
+  index = (uint32_t) parsed;
+  return true;
+}
+
+Ptr<const CCNxName>
+CCNxTransferPortal::CreateChunkName (Ptr<const CCNxName> prefix, uint32_t index)
+{
+  char buffer[16];
+  snprintf (buffer, sizeof(buffer), "%u", index);
+  CCNxNameBuilder builder (*prefix);
+  builder.Append (Create<CCNxNameSegment> (CCNxNameSegment_Chunk, buffer));
+  return builder.CreateName ();
+}
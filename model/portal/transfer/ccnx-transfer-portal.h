@@ -0,0 +1,285 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+/*
+ * Segmenting transfer portal.
+ */
+
+#ifndef CCNS3_CCNXTRANSFERPORTAL_H
+#define CCNS3_CCNXTRANSFERPORTAL_H
+
+#include <map>
+
+#include "ns3/nstime.h"
+#include "ns3/event-id.h"
+#include "ns3/callback.h"
+#include "ns3/ccnx-message-portal.h"
+#include "ns3/ccnx-contentobject.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-portal
+ *
+ * A Transfer portal moves objects of any size.  A producer publishes an object under a name,
+ * and the portal answers Interests for it.  A consumer calls Fetch() with the same name and
+ * the portal retrieves and reassembles the object.
+ *
+ * An object `name` of S bytes is carried as ceil(S / SegmentSize) Content Objects named
+ * `name/chunk=0` ... `name/chunk=N-1`.  The Content Object named `name` itself is a small
+ * metadata object (PayloadType Manifest) that holds the object size (8 bytes) and
+ * the segment size (4 bytes), both in network byte order.  Fetch() requests the metadata,
+ * then keeps up to WindowSize chunks in flight beyond the last chunk delivered in order.
+ * An unanswered Interest is sent again after RetransmitTimeout, up to MaxRetries times. After
+ * that the transfer fails.
+ *
+ * The consumer either gets the whole object in one CCNxBuffer (TransferCompleteCallback) or,
+ * if a SegmentCallback is set, each segment in order as it arrives without any reassembly.
+ * An object published with PublishVirtual() uses virtual payloads, so it has no bytes to
+ * reassemble and the complete callback gets a null buffer.
+ *
+ * Packets that are not part of a transfer are queued for Recv() like in CCNxMessagePortal.
+ *
+ * Example:
+ * @code
+ * Ptr<CCNxTransferPortal> producer = DynamicCast<CCNxTransferPortal> (
+ *     CCNxPortal::CreatePortal (node, TypeId::LookupByName ("ns3::ccnx::CCNxTransferPortalFactory")));
+ * producer->PublishVirtual (Create<CCNxName> ("ccnx:/name=movie"), 100000000);
+ *
+ * Ptr<CCNxTransferPortal> consumer = ...
+ * consumer->SetTransferCompleteCallback (MakeCallback (&Foo::Done, this));
+ * consumer->Fetch (Create<CCNxName> ("ccnx:/name=movie"));
+ * @endcode
+ *
+ * @see CCNxTransferPortalFactory
+ */
+class CCNxTransferPortal : public CCNxMessagePortal
+{
+public:
+  static TypeId GetTypeId (void);
+
+  /**
+   * Constructor to create CCNxTransferPortal.
+   */
+  CCNxTransferPortal (void);
+
+  /**
+   * Destructor for CCNxTransferPortal.
+   */
+  virtual ~CCNxTransferPortal (void);
+
+  /**
+   * Called with (portal, name, object, bytes) when a Fetch() finishes.  `object` is null
+   * if the segments were delivered to the SegmentCallback or had virtual payloads.
+   */
+  typedef Callback<void, Ptr<CCNxTransferPortal>, Ptr<const CCNxName>, Ptr<CCNxBuffer>, uint64_t> TransferCompleteCallback;
+
+  /**
+   * Called with (portal, name, offset, segment) for each segment, in order.
+   */
+  typedef Callback<void, Ptr<CCNxTransferPortal>, Ptr<const CCNxName>, uint64_t, Ptr<CCNxContentObject> > SegmentCallback;
+
+  /**
+   * Called with (portal, name) when a Fetch() gives up.
+   */
+  typedef Callback<void, Ptr<CCNxTransferPortal>, Ptr<const CCNxName> > TransferFailedCallback;
+
+  /**
+   * Publish `object` under `name` and register `name` as an anchor.  The object is
+   * segmented when Interests arrive, the segments share the object's bytes.
+   *
+   * @param [in] name The object name (without a chunk segment)
+   * @param [in] object The object bytes
+   */
+  void Publish (Ptr<const CCNxName> name, Ptr<CCNxBuffer> object);
+
+  /**
+   * Publish an object of `size` bytes under `name` whose segments have virtual payloads.
+   *
+   * @param [in] name The object name (without a chunk segment)
+   * @param [in] size The object length in bytes
+   */
+  void PublishVirtual (Ptr<const CCNxName> name, uint64_t size);
+
+  /**
+   * Stop answering Interests for `name` and unregister the anchor.
+   */
+  void Unpublish (Ptr<const CCNxName> name);
+
+  /**
+   * Start retrieving the object `name`.
+   *
+   * @return false if a transfer of `name` is already running
+   */
+  bool Fetch (Ptr<const CCNxName> name);
+
+  /**
+   * Stop a running Fetch() without calling any callback.
+   */
+  void CancelFetch (Ptr<const CCNxName> name);
+
+  void SetTransferCompleteCallback (TransferCompleteCallback callback);
+
+  void SetSegmentCallback (SegmentCallback callback);
+
+  void SetTransferFailedCallback (TransferFailedCallback callback);
+
+  /**
+   * The number of chunk and metadata Interests sent again after a timeout.
+   */
+  uint64_t GetRetransmissionCount (void) const;
+
+  /**
+   * From CCNxL4Protocol
+   *
+   * Answers Interests for published objects and consumes Content Objects of running
+   * transfers.  Everything else goes to the input queue of CCNxMessagePortal.
+   */
+  virtual bool ReceiveFromLayer3 (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> incoming);
+
+  virtual bool Close (void);
+
+protected:
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * An object served by this portal.  `data` is null for a virtual object.
+   */
+  typedef struct
+  {
+    Ptr<CCNxBuffer> data;
+    uint64_t size;
+    uint32_t segmentSize;
+  } PublishedObjectType;
+
+  typedef std::map< Ptr<const CCNxName>, PublishedObjectType, CCNxName::isLessPtrCCNxName > PublishedMapType;
+
+  typedef struct
+  {
+    uint32_t retries;
+    EventId timeout;
+  } OutstandingType;
+
+  /**
+   * The state of one Fetch().  `outstanding` is keyed by chunk number (or _metadataIndex),
+   * `received` holds segments that arrived ahead of `nextDeliver`.
+   */
+  typedef struct
+  {
+    bool haveMetadata;
+    uint64_t size;
+    uint32_t segmentSize;
+    uint32_t chunkCount;
+    uint32_t nextRequest;
+    uint32_t nextDeliver;
+    uint64_t bytesDelivered;
+    bool physical;
+    Buffer data;
+    std::map<uint32_t, OutstandingType> outstanding;
+    std::map<uint32_t, Ptr<CCNxContentObject> > received;
+  } TransferType;
+
+  typedef std::map< Ptr<const CCNxName>, TransferType, CCNxName::isLessPtrCCNxName > TransferMapType;
+
+  void DoPublish (Ptr<const CCNxName> name, Ptr<CCNxBuffer> data, uint64_t size);
+
+  /**
+   * If `name` is `prefix/chunk=N`, set prefix and index.
+   */
+  static bool ParseChunkName (Ptr<const CCNxName> name, Ptr<const CCNxName> &prefix, uint32_t &index);
+
+  static Ptr<const CCNxName> CreateChunkName (Ptr<const CCNxName> prefix, uint32_t index);
+
+  bool ServeInterest (Ptr<const CCNxName> name);
+
+  bool ReceiveContentObject (Ptr<CCNxContentObject> content);
+
+  void ReceiveMetadata (Ptr<const CCNxName> name, TransferType &transfer, Ptr<CCNxContentObject> content);
+
+  void ReceiveSegment (Ptr<const CCNxName> name, TransferType &transfer, uint32_t index, Ptr<CCNxContentObject> content);
+
+  /**
+   * Send the Interest for `index` (a chunk or _metadataIndex) and arm its timeout.
+   */
+  void Request (Ptr<const CCNxName> name, TransferType &transfer, uint32_t index);
+
+  void FillWindow (Ptr<const CCNxName> name, TransferType &transfer);
+
+  void Timeout (Ptr<const CCNxName> name, uint32_t index);
+
+  /**
+   * Remove the transfer and cancel its timers.
+   */
+  void FinishTransfer (Ptr<const CCNxName> name, bool success);
+
+  PublishedMapType m_published;
+  TransferMapType m_transfers;
+
+  uint32_t m_segmentSize;
+  uint32_t m_windowSize;
+  Time m_retransmitTimeout;
+  uint32_t m_maxRetries;
+  uint64_t m_retransmissions;
+
+  TransferCompleteCallback m_completeCallback;
+  SegmentCallback m_segmentCallback;
+  TransferFailedCallback m_failedCallback;
+};
+}
+}
+
+#endif //CCNS3_CCNXTRANSFERPORTAL_H
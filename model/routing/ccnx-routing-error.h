@@ -73,7 +73,9 @@ public:
   enum RoutingErrno
   {
     CCNxRoutingError_NoError = 0,
-    CCNxRoutingError_NoRoute
+    CCNxRoutingError_NoRoute,
+    CCNxRoutingError_HopLimitExceeded,
+    CCNxRoutingError_Congestion
   };
 };
 
@@ -0,0 +1,297 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <functional>
+#include <iterator>
+#include <queue>
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+
+#ifdef CCNS3SIM_THREADING
+#include "ns3/simple-ref-count.h"
+#include "ns3/ptr.h"
+#include "ns3/system-thread.h"
+#endif
+
+#include "ccnx-global-routing-graph.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxGlobalRoutingGraph");
+
+const uint32_t CCNxGlobalRoutingGraph::INFINITE;
+
+#ifdef CCNS3SIM_THREADING
+namespace {
+/**
+ * The work of one thread in CCNxGlobalRoutingGraph::Compute()
+ */
+class ComputeJob : public SimpleRefCount<ComputeJob>
+{
+public:
+  typedef void (CCNxGlobalRoutingGraph::*RangeFunction)(uint32_t, uint32_t);
+
+  ComputeJob (CCNxGlobalRoutingGraph *graph, RangeFunction function, uint32_t begin, uint32_t end)
+    : m_graph (graph), m_function (function), m_begin (begin), m_end (end)
+  {
+  }
+
+  void Run (void)
+  {
+    (m_graph->*m_function)(m_begin, m_end);
+  }
+
+private:
+  CCNxGlobalRoutingGraph *m_graph;
+  RangeFunction m_function;
+  uint32_t m_begin;
+  uint32_t m_end;
+};
+}
+#endif
+
+CCNxGlobalRoutingGraph::CCNxGlobalRoutingGraph (uint32_t nodeCount)
+  : m_nodeCount (nodeCount), m_outEdges (nodeCount)
+{
+  // empty
+}
+
+CCNxGlobalRoutingGraph::~CCNxGlobalRoutingGraph ()
+{
+  // empty
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::GetNodeCount (void) const
+{
+  return m_nodeCount;
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::AddEdge (uint32_t from, uint32_t to, uint32_t cost)
+{
+  NS_ASSERT_MSG (from < m_nodeCount && to < m_nodeCount, "Edge node out of range " << from << " " << to);
+  NS_ASSERT_MSG (cost > 0, "Edge cost must be positive");
+
+  Edge edge;
+  edge.to = to;
+  edge.cost = cost;
+
+  uint32_t index = m_edges.size ();
+  m_edges.push_back (edge);
+  m_edgeFrom.push_back (from);
+  m_outEdges[from].push_back (index);
+  return index;
+}
+
+size_t
+CCNxGlobalRoutingGraph::GetEdgeCount (void) const
+{
+  return m_edges.size ();
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::GetEdgeFrom (uint32_t edge) const
+{
+  return m_edgeFrom[edge];
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::GetEdgeTo (uint32_t edge) const
+{
+  return m_edges[edge].to;
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::GetEdgeCost (uint32_t edge) const
+{
+  return m_edges[edge].cost;
+}
+
+void
+CCNxGlobalRoutingGraph::Compute (const std::vector<uint32_t> &targets, uint32_t threads)
+{
+  NS_LOG_FUNCTION (this << targets.size () << threads);
+
+  m_targets = targets;
+  m_results.assign (m_nodeCount, PathVectorType ());
+
+  threads = std::max (threads, (uint32_t) 1);
+  threads = std::min (threads, std::max (m_nodeCount, (uint32_t) 1));
+
+#ifdef CCNS3SIM_THREADING
+  if (threads > 1)
+    {
+      std::vector< Ptr<ComputeJob> > jobs;
+      std::vector< Ptr<SystemThread> > workers;
+      uint32_t chunk = (m_nodeCount + threads - 1) / threads;
+      for (uint32_t begin = 0; begin < m_nodeCount; begin += chunk)
+        {
+          Ptr<ComputeJob> job = Create<ComputeJob> (this, &CCNxGlobalRoutingGraph::ComputeRange,
+                                                    begin, std::min (begin + chunk, m_nodeCount));
+          Ptr<SystemThread> worker = Create<SystemThread> (MakeCallback (&ComputeJob::Run, job));
+          jobs.push_back (job);
+          workers.push_back (worker);
+          worker->Start ();
+        }
+
+      for (size_t i = 0; i < workers.size (); i++)
+        {
+          workers[i]->Join ();
+        }
+      return;
+    }
+#endif
+
+  ComputeRange (0, m_nodeCount);
+}
+
+void
+CCNxGlobalRoutingGraph::ComputeRange (uint32_t begin, uint32_t end)
+{
+  // No logging here, this runs in the worker threads
+  for (uint32_t source = begin; source < end; source++)
+    {
+      ComputeSource (source);
+    }
+}
+
+void
+CCNxGlobalRoutingGraph::ComputeSource (uint32_t source)
+{
+  typedef std::pair<uint32_t, uint32_t> HeapEntryType;
+  typedef std::priority_queue< HeapEntryType, std::vector<HeapEntryType>, std::greater<HeapEntryType> > HeapType;
+
+  std::vector<uint32_t> distance (m_nodeCount, INFINITE);
+  std::vector< std::vector<uint32_t> > firstHops (m_nodeCount);
+  std::vector<bool> settled (m_nodeCount, false);
+
+  HeapType heap;
+  distance[source] = 0;
+  heap.push (HeapEntryType (0, source));
+
+  while (!heap.empty ())
+    {
+      uint32_t node = heap.top ().second;
+      heap.pop ();
+      if (settled[node])
+        {
+          continue;
+        }
+      settled[node] = true;
+
+      const std::vector<uint32_t> &out = m_outEdges[node];
+      for (size_t i = 0; i < out.size (); i++)
+        {
+          const Edge &edge = m_edges[out[i]];
+          uint32_t candidate = distance[node] + edge.cost;
+          if (settled[edge.to] || candidate > distance[edge.to])
+            {
+              continue;
+            }
+
+          // The first hops through `node`.  Out of the source, it is the edge itself.
+          std::vector<uint32_t> hops;
+          if (node == source)
+            {
+              hops.push_back (out[i]);
+            }
+          else
+            {
+              hops = firstHops[node];
+            }
+
+          if (candidate < distance[edge.to])
+            {
+              distance[edge.to] = candidate;
+              firstHops[edge.to].swap (hops);
+              heap.push (HeapEntryType (candidate, edge.to));
+            }
+          else
+            {
+              // Equal cost, merge the first hops
+              std::vector<uint32_t> merged;
+              std::set_union (firstHops[edge.to].begin (), firstHops[edge.to].end (),
+                              hops.begin (), hops.end (), std::back_inserter (merged));
+              firstHops[edge.to].swap (merged);
+            }
+        }
+    }
+
+  PathVectorType &paths = m_results[source];
+  paths.resize (m_targets.size ());
+  for (size_t i = 0; i < m_targets.size (); i++)
+    {
+      paths[i].distance = distance[m_targets[i]];
+      paths[i].firstHops = firstHops[m_targets[i]];
+    }
+}
+
+uint32_t
+CCNxGlobalRoutingGraph::GetDistance (uint32_t source, size_t targetIndex) const
+{
+  NS_ASSERT_MSG (source < m_results.size () && targetIndex < m_results[source].size (), "Call Compute() first");
+  return m_results[source][targetIndex].distance;
+}
+
+const std::vector<uint32_t> &
+CCNxGlobalRoutingGraph::GetFirstHops (uint32_t source, size_t targetIndex) const
+{
+  NS_ASSERT_MSG (source < m_results.size () && targetIndex < m_results[source].size (), "Call Compute() first");
+  return m_results[source][targetIndex].firstHops;
+}
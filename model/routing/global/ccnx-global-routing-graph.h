@@ -0,0 +1,186 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_CCNX_GLOBAL_ROUTING_GRAPH_H
+#define CCNS3SIM_CCNX_GLOBAL_ROUTING_GRAPH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <vector>
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup ccnx-global-routing
+ *
+ * A directed graph of the whole network used by CCNxGlobalRoutingHelper.  Nodes are numbered
+ * 0 to `nodeCount - 1` (the ns-3 node ids) and each edge has a positive cost.
+ *
+ * Compute() runs one Dijkstra per source node and keeps, for each target node, the distance
+ * and the equal cost first-hop edges out of the source.  Only the targets (the anchor nodes)
+ * are kept, so the memory is sources times targets rather than sources times nodes.
+ *
+ * The sources are independent, so Compute() can split them over several threads.  The graph
+ * is only read while computing and each thread writes only the results of its own sources.
+ */
+class CCNxGlobalRoutingGraph
+{
+public:
+  /**
+   * The distance to a target that cannot be reached
+   */
+  static const uint32_t INFINITE = 0xFFFFFFFF;
+
+  /**
+   * @param nodeCount The number of nodes in the graph
+   */
+  CCNxGlobalRoutingGraph (uint32_t nodeCount);
+
+  virtual ~CCNxGlobalRoutingGraph ();
+
+  uint32_t GetNodeCount (void) const;
+
+  /**
+   * Adds an edge.  Parallel edges are allowed (e.g. two links between the same nodes).
+   *
+   * @param from The tail node
+   * @param to The head node
+   * @param cost Must be positive
+   * @return The edge index, used by GetFirstHops()
+   */
+  uint32_t AddEdge (uint32_t from, uint32_t to, uint32_t cost);
+
+  size_t GetEdgeCount (void) const;
+
+  uint32_t GetEdgeFrom (uint32_t edge) const;
+
+  uint32_t GetEdgeTo (uint32_t edge) const;
+
+  uint32_t GetEdgeCost (uint32_t edge) const;
+
+  /**
+   * Computes the shortest paths from every node to every target.
+   *
+   * @param targets The nodes we need paths to
+   * @param threads The number of threads to use.  If the module was built without threading
+   *                support, it always uses 1.
+   */
+  void Compute (const std::vector<uint32_t> &targets, uint32_t threads);
+
+  /**
+   * @param source A node
+   * @param targetIndex An index into the `targets` given to Compute()
+   * @return The distance, or INFINITE
+   */
+  uint32_t GetDistance (uint32_t source, size_t targetIndex) const;
+
+  /**
+   * @param source A node
+   * @param targetIndex An index into the `targets` given to Compute()
+   * @return The sorted edges out of `source` that start a shortest path to the target
+   */
+  const std::vector<uint32_t> & GetFirstHops (uint32_t source, size_t targetIndex) const;
+
+private:
+  struct Edge
+  {
+    uint32_t to;
+    uint32_t cost;
+  };
+
+  struct Path
+  {
+    uint32_t distance;
+    std::vector<uint32_t> firstHops;
+  };
+
+  typedef std::vector<Path> PathVectorType;
+
+  /**
+   * Runs Compute() for the sources `begin` to `end - 1`.  Called from the worker threads.
+   */
+  void ComputeRange (uint32_t begin, uint32_t end);
+
+  /**
+   * One Dijkstra from `source`, storing the paths to m_targets in m_results[source]
+   */
+  void ComputeSource (uint32_t source);
+
+  uint32_t m_nodeCount;
+
+  /**
+   * All edges, indexed by edge index
+   */
+  std::vector<uint32_t> m_edgeFrom;
+  std::vector<Edge> m_edges;
+
+  /**
+   * The out edges of each node
+   */
+  std::vector< std::vector<uint32_t> > m_outEdges;
+
+  std::vector<uint32_t> m_targets;
+
+  /**
+   * Indexed by source, then by target index
+   */
+  std::vector<PathVectorType> m_results;
+};
+
+}
+}
+
+#endif //CCNS3SIM_CCNX_GLOBAL_ROUTING_GRAPH_H
@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <vector>
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/node-list.h"
+#include "ns3/net-device.h"
+#include "ns3/ccnx-l3-protocol.h"
+#include "ns3/ccnx-route-entry.h"
+#include "ccnx-global-routing-helper.h"
+#include "ccnx-global-routing-protocol.h"
+#include "ccnx-global-routing-graph.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxGlobalRoutingHelper");
+
+CCNxGlobalRoutingHelper::CCNxGlobalRoutingHelper ()
+{
+  m_routerFactory.SetTypeId ("ns3::ccnx::CCNxGlobalRoutingProtocol");
+}
+
+CCNxGlobalRoutingHelper::CCNxGlobalRoutingHelper (CCNxGlobalRoutingHelper const &copy)
+{
+  m_routerFactory = copy.m_routerFactory;
+}
+
+CCNxGlobalRoutingHelper::~CCNxGlobalRoutingHelper ()
+{
+  // empty
+}
+
+CCNxRoutingHelper *
+CCNxGlobalRoutingHelper::Copy (void) const
+{
+  return new CCNxGlobalRoutingHelper (*this);
+}
+
+Ptr<CCNxRoutingProtocol>
+CCNxGlobalRoutingHelper::Create (Ptr<Node> node) const
+{
+  Ptr<CCNxGlobalRoutingProtocol> protocol = m_routerFactory.Create<CCNxGlobalRoutingProtocol> ();
+  protocol->SetNode (node);
+  node->AggregateObject (protocol);
+  protocol->Initialize ();
+  return protocol;
+}
+
+void
+CCNxGlobalRoutingHelper::Set (std::string name, const AttributeValue &value)
+{
+  m_routerFactory.Set (name, value);
+}
+
+int64_t
+CCNxGlobalRoutingHelper::SetSteams (NodeContainer &c, int64_t stream)
+{
+  int64_t currentStream = stream;
+  for (NodeContainer::Iterator i = c.Begin (); i != c.End (); ++i)
+    {
+      Ptr<CCNxRoutingProtocol> routing = (*i)->GetObject<CCNxRoutingProtocol> ();
+      NS_ASSERT_MSG (routing, "CCNxRoutingProtocol not installed on node");
+      currentStream += routing->AssignStreams (currentStream);
+    }
+  return (currentStream - stream);
+}
+
+void
+CCNxGlobalRoutingHelper::PopulateRoutingTables (uint32_t threads)
+{
+  NS_LOG_FUNCTION (threads);
+
+  // The graph of CCNx interfaces that share a channel.  Edge i goes out of
+  // edgeDevices[i] towards the neighbor at edgePeers[i].
+  uint32_t nodeCount = NodeList::GetNNodes ();
+  CCNxGlobalRoutingGraph graph (nodeCount);
+  std::vector< Ptr<NetDevice> > edgeDevices;
+  std::vector<Address> edgePeers;
+
+  for (uint32_t id = 0; id < nodeCount; id++)
+    {
+      Ptr<Node> node = NodeList::GetNode (id);
+      for (uint32_t d = 0; d < node->GetNDevices (); d++)
+        {
+          Ptr<NetDevice> device = node->GetDevice (d);
+          std::vector< Ptr<NetDevice> > peers = GetUpPeers (device);
+          for (size_t k = 0; k < peers.size (); k++)
+            {
+              graph.AddEdge (id, peers[k]->GetNode ()->GetId (), 1);
+              edgeDevices.push_back (device);
+              edgePeers.push_back (peers[k]->GetAddress ());
+            }
+        }
+    }
+
+  // The anchors of each prefix, and the list of anchor nodes as the SPF targets
+  typedef std::map< Ptr<const CCNxName>, std::vector<uint32_t>, CCNxName::isLessPtrCCNxName > PrefixAnchorMapType;
+  PrefixAnchorMapType prefixAnchors;
+  std::vector<uint32_t> targets;
+  std::map<uint32_t, size_t> targetIndex;
+
+  for (uint32_t id = 0; id < nodeCount; id++)
+    {
+      Ptr<CCNxGlobalRoutingProtocol> protocol = NodeList::GetNode (id)->GetObject<CCNxGlobalRoutingProtocol> ();
+      if (!protocol)
+        {
+          continue;
+        }
+
+      std::vector< Ptr<const CCNxName> > prefixes = protocol->GetAnchorPrefixes ();
+      for (size_t i = 0; i < prefixes.size (); i++)
+        {
+          prefixAnchors[prefixes[i]].push_back (id);
+        }
+      if (!prefixes.empty ())
+        {
+          targetIndex[id] = targets.size ();
+          targets.push_back (id);
+        }
+    }
+
+  NS_LOG_INFO ("Global routing nodes " << nodeCount << " edges " << graph.GetEdgeCount ()
+                                       << " anchors " << targets.size () << " prefixes " << prefixAnchors.size ());
+
+  graph.Compute (targets, threads);
+
+  // The forwarders are not thread safe, so install the routes from this thread
+  size_t routeCount = 0;
+  for (uint32_t id = 0; id < nodeCount; id++)
+    {
+      Ptr<Node> node = NodeList::GetNode (id);
+      Ptr<CCNxGlobalRoutingProtocol> protocol = node->GetObject<CCNxGlobalRoutingProtocol> ();
+      if (!protocol)
+        {
+          continue;
+        }
+
+      protocol->ClearRoutes ();
+      Ptr<CCNxL3Protocol> ccnx = node->GetObject<CCNxL3Protocol> ();
+
+      for (PrefixAnchorMapType::const_iterator i = prefixAnchors.begin (); i != prefixAnchors.end (); ++i)
+        {
+          // The closest anchors, or none if we are an anchor ourselves
+          uint32_t best = CCNxGlobalRoutingGraph::INFINITE;
+          const std::vector<uint32_t> &anchors = i->second;
+          for (size_t j = 0; j < anchors.size (); j++)
+            {
+              best = std::min (best, graph.GetDistance (id, targetIndex[anchors[j]]));
+            }
+
+          if (best == 0 || best == CCNxGlobalRoutingGraph::INFINITE)
+            {
+              continue;
+            }
+
+          std::set<uint32_t> edges;
+          for (size_t j = 0; j < anchors.size (); j++)
+            {
+              size_t target = targetIndex[anchors[j]];
+              if (graph.GetDistance (id, target) == best)
+                {
+                  const std::vector<uint32_t> &hops = graph.GetFirstHops (id, target);
+                  edges.insert (hops.begin (), hops.end ());
+                }
+            }
+
+          Ptr<CCNxRoute> route = Create<CCNxRoute> (i->first);
+          for (std::set<uint32_t>::const_iterator edge = edges.begin (); edge != edges.end (); ++edge)
+            {
+              // The connection the node already has to the neighbor, so repeated calls do not add more
+              Ptr<CCNxConnection> connection = ccnx->GetNeighbor (edgePeers[*edge], edgeDevices[*edge]);
+              route->AddNexthop (Create<CCNxRouteEntry> (i->first, best, connection));
+            }
+
+          protocol->SetRoute (i->first, route);
+          routeCount++;
+        }
+    }
+
+  NS_LOG_INFO ("Global routing installed " << routeCount << " routes");
+}
@@ -0,0 +1,255 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <iomanip>
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/ccnx-forwarder.h"
+#include "ccnx-global-routing-protocol.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("CCNxGlobalRoutingProtocol");
+NS_OBJECT_ENSURE_REGISTERED (CCNxGlobalRoutingProtocol);
+
+TypeId
+CCNxGlobalRoutingProtocol::GetTypeId (void)
+{
+  static TypeId tid = TypeId ("ns3::ccnx::CCNxGlobalRoutingProtocol")
+    .SetParent<CCNxRoutingProtocol> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<CCNxGlobalRoutingProtocol> ();
+  return tid;
+}
+
+CCNxGlobalRoutingProtocol::CCNxGlobalRoutingProtocol ()
+{
+  // empty
+}
+
+CCNxGlobalRoutingProtocol::~CCNxGlobalRoutingProtocol ()
+{
+  // empty
+}
+
+void
+CCNxGlobalRoutingProtocol::NotifyInterfaceUp (uint32_t interface)
+{
+  // Routes only change when the helper populates them again
+}
+
+void
+CCNxGlobalRoutingProtocol::NotifyInterfaceDown (uint32_t interface)
+{
+  // Routes only change when the helper populates them again
+}
+
+void
+CCNxGlobalRoutingProtocol::SetNode (Ptr<Node> node)
+{
+  NS_LOG_FUNCTION (this << node);
+  NS_ASSERT_MSG ((!m_node), "Re-assigning the node pointer once it was already set.");
+  m_node = node;
+}
+
+void
+CCNxGlobalRoutingProtocol::AddAnchorPrefix (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << prefix);
+
+  AnchorNameMapType::iterator i = m_anchorNames.find (prefix);
+  if (i != m_anchorNames.end ())
+    {
+      i->second++;
+    }
+  else
+    {
+      NS_LOG_INFO ("Add anchor prefix " << *prefix);
+      m_anchorNames[prefix] = 1;
+    }
+}
+
+void
+CCNxGlobalRoutingProtocol::RemoveAnchorPrefix (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << prefix);
+
+  AnchorNameMapType::iterator i = m_anchorNames.find (prefix);
+  if (i == m_anchorNames.end ())
+    {
+      NS_LOG_WARN ("Could not find Anchor name " << *prefix);
+      return;
+    }
+
+  NS_ASSERT_MSG (i->second > 0, "Found a map entry with a 0 ref count");
+  i->second--;
+  if (i->second == 0)
+    {
+      NS_LOG_INFO ("Removing Anchor name " << *prefix);
+      m_anchorNames.erase (i);
+    }
+}
+
+std::vector< Ptr<const CCNxName> >
+CCNxGlobalRoutingProtocol::GetAnchorPrefixes (void) const
+{
+  std::vector< Ptr<const CCNxName> > prefixes;
+  prefixes.reserve (m_anchorNames.size ());
+  for (AnchorNameMapType::const_iterator i = m_anchorNames.begin (); i != m_anchorNames.end (); ++i)
+    {
+      prefixes.push_back (i->first);
+    }
+  return prefixes;
+}
+
+void
+CCNxGlobalRoutingProtocol::SetRoute (Ptr<const CCNxName> prefix, Ptr<const CCNxRoute> route)
+{
+  NS_LOG_FUNCTION (this << *route);
+  NS_ASSERT_MSG (m_node, "SetNode() must be called first");
+
+  Ptr<CCNxForwarder> forwarder = m_node->GetObject<CCNxForwarder> ();
+  RouteMapType::iterator found = m_routes.find (prefix);
+  if (found != m_routes.end ())
+    {
+      if (found->second->Equals (*route))
+        {
+          return;
+        }
+      forwarder->RemoveRoute (found->second);
+      m_routes.erase (found);
+    }
+
+  if (!route->empty ())
+    {
+      forwarder->AddRoute (route);
+      m_routes[prefix] = route;
+    }
+}
+
+void
+CCNxGlobalRoutingProtocol::ClearRoutes (void)
+{
+  Ptr<CCNxForwarder> forwarder = m_node->GetObject<CCNxForwarder> ();
+  for (RouteMapType::const_iterator i = m_routes.begin (); i != m_routes.end (); ++i)
+    {
+      forwarder->RemoveRoute (i->second);
+    }
+  m_routes.clear ();
+}
+
+Ptr<const CCNxRoute>
+CCNxGlobalRoutingProtocol::GetRoute (Ptr<const CCNxName> prefix) const
+{
+  RouteMapType::const_iterator i = m_routes.find (prefix);
+  if (i != m_routes.end ())
+    {
+      return i->second;
+    }
+  return 0;
+}
+
+size_t
+CCNxGlobalRoutingProtocol::GetRouteCount (void) const
+{
+  return m_routes.size ();
+}
+
+void
+CCNxGlobalRoutingProtocol::PrintNeighborTable (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  *(streamWrapper->GetStream ()) << "Global routing does not maintain a neighbor table" << std::endl;
+}
+
+void
+CCNxGlobalRoutingProtocol::PrintRoutingTable (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Global routing table" << std::endl;
+  for (RouteMapType::const_iterator i = m_routes.begin (); i != m_routes.end (); ++i)
+    {
+      *stream << "      " << *i->second << std::endl;
+    }
+
+  PrintAnchorPrefixes (streamWrapper);
+}
+
+void
+CCNxGlobalRoutingProtocol::PrintAnchorPrefixes (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Anchor table" << std::endl;
+  for (AnchorNameMapType::const_iterator i = m_anchorNames.begin (); i != m_anchorNames.end (); ++i)
+    {
+      *stream << "      " << *i->first << std::endl;
+    }
+}
+
+int64_t
+CCNxGlobalRoutingProtocol::AssignStreams (int64_t stream)
+{
+  // We do not use any random numbers.
+  return 0;
+}
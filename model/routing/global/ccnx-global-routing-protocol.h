@@ -0,0 +1,162 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_CCNX_GLOBAL_ROUTING_PROTOCOL_H
+#define CCNS3SIM_CCNX_GLOBAL_ROUTING_PROTOCOL_H
+
+#include <map>
+#include <vector>
+
+#include "ns3/ccnx-routing-protocol.h"
+#include "ns3/ccnx-route.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \defgroup ccnx-global-routing Global Routing
+ * \ingroup ccnx-routing
+ *
+ * Routes computed once from the whole topology by CCNxGlobalRoutingHelper, with no
+ * control traffic.  It is meant for data plane studies that do not want to wait for
+ * (or simulate) a routing protocol converging.
+ */
+
+/**
+ * \ingroup ccnx-global-routing
+ *
+ * CCNxGlobalRoutingProtocol does not send any messages.  It remembers the anchor prefixes
+ * registered on its node, so CCNxGlobalRoutingHelper::PopulateRoutingTables() can find them,
+ * and installs the routes the helper computes in the node's forwarder.
+ */
+class CCNxGlobalRoutingProtocol : public CCNxRoutingProtocol
+{
+public:
+  static TypeId GetTypeId (void);
+
+  CCNxGlobalRoutingProtocol ();
+
+  virtual ~CCNxGlobalRoutingProtocol ();
+
+  // Inherited from CCNxRoutingProtocol
+
+  virtual void NotifyInterfaceUp (uint32_t interface);
+
+  virtual void NotifyInterfaceDown (uint32_t interface);
+
+  virtual void SetNode (Ptr<Node> node);
+
+  virtual void AddAnchorPrefix (Ptr<const CCNxName> prefix);
+
+  virtual void RemoveAnchorPrefix (Ptr<const CCNxName> prefix);
+
+  virtual void PrintNeighborTable (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  virtual void PrintRoutingTable (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  virtual void PrintAnchorPrefixes (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  virtual int64_t AssignStreams (int64_t stream);
+
+  /**
+   * Returns the anchor prefixes currently registered on this node
+   */
+  std::vector< Ptr<const CCNxName> > GetAnchorPrefixes (void) const;
+
+  /**
+   * Replaces the route to `prefix` in the forwarder.  An empty route removes it.
+   *
+   * @param prefix [in] The prefix of `route`
+   * @param route [in] The new route
+   */
+  void SetRoute (Ptr<const CCNxName> prefix, Ptr<const CCNxRoute> route);
+
+  /**
+   * Removes every route this protocol installed
+   */
+  void ClearRoutes (void);
+
+  /**
+   * @return The route installed for `prefix`, or null
+   */
+  Ptr<const CCNxRoute> GetRoute (Ptr<const CCNxName> prefix) const;
+
+  /**
+   * @return The number of prefixes with a route
+   */
+  size_t GetRouteCount (void) const;
+
+private:
+  Ptr<Node> m_node;
+
+  typedef std::map< Ptr<const CCNxName>, uint32_t, CCNxName::isLessPtrCCNxName > AnchorNameMapType;
+
+  /**
+   * The anchor prefixes and their reference count
+   */
+  AnchorNameMapType m_anchorNames;
+
+  typedef std::map< Ptr<const CCNxName>, Ptr<const CCNxRoute>, CCNxName::isLessPtrCCNxName > RouteMapType;
+
+  /**
+   * A copy of what we put in the forwarder, so we can remove it
+   */
+  RouteMapType m_routes;
+};
+
+}
+}
+
+#endif //CCNS3SIM_CCNX_GLOBAL_ROUTING_PROTOCOL_H
@@ -0,0 +1,506 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/abort.h"
+#include "ns3/ccnx-tlv.h"
+#include "ns3/ccnx-codec-name.h"
+#include "ns3/nfp-seqnum.h"
+
+#include "lsr-lsa.h"
+#include "lsr-schema.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("LsrLsa");
+
+LsrLsa::LsrLsa ()
+  : m_seqnum (0), m_fragmentIndex (0), m_fragmentCount (1)
+{
+  // empty
+}
+
+LsrLsa::LsrLsa (Ptr<const CCNxName> routerName, uint32_t seqnum)
+  : m_routerName (routerName), m_seqnum (seqnum), m_fragmentIndex (0), m_fragmentCount (1)
+{
+  NS_ASSERT_MSG (routerName, "Router name must not be null");
+}
+
+LsrLsa::~LsrLsa ()
+{
+  // empty
+}
+
+Ptr<const CCNxName>
+LsrLsa::GetRouterName (void) const
+{
+  return m_routerName;
+}
+
+uint32_t
+LsrLsa::GetSeqnum (void) const
+{
+  return m_seqnum;
+}
+
+void
+LsrLsa::AddLink (Ptr<const CCNxName> neighborName, uint32_t cost)
+{
+  NS_ASSERT_MSG (neighborName, "Neighbor name must not be null");
+  NS_ASSERT_MSG (cost > 0, "Link cost must be positive");
+  m_links.push_back (LinkType (neighborName, cost));
+}
+
+size_t
+LsrLsa::GetLinkCount (void) const
+{
+  return m_links.size ();
+}
+
+Ptr<const CCNxName>
+LsrLsa::GetLinkName (size_t index) const
+{
+  NS_ASSERT_MSG (index < m_links.size (), "Index beyond end of link array");
+  return m_links[index].first;
+}
+
+uint32_t
+LsrLsa::GetLinkCost (size_t index) const
+{
+  NS_ASSERT_MSG (index < m_links.size (), "Index beyond end of link array");
+  return m_links[index].second;
+}
+
+bool
+LsrLsa::FindLink (Ptr<const CCNxName> neighborName, uint32_t &cost) const
+{
+  for (size_t i = 0; i < m_links.size (); i++)
+    {
+      if (m_links[i].first->Equals (*neighborName))
+        {
+          cost = m_links[i].second;
+          return true;
+        }
+    }
+  return false;
+}
+
+void
+LsrLsa::AddPrefix (Ptr<const CCNxName> prefix)
+{
+  NS_ASSERT_MSG (prefix, "Prefix must not be null");
+  m_prefixes.push_back (prefix);
+}
+
+size_t
+LsrLsa::GetPrefixCount (void) const
+{
+  return m_prefixes.size ();
+}
+
+Ptr<const CCNxName>
+LsrLsa::GetPrefix (size_t index) const
+{
+  NS_ASSERT_MSG (index < m_prefixes.size (), "Index beyond end of prefix array");
+  return m_prefixes[index];
+}
+
+void
+LsrLsa::SetFragment (uint16_t index, uint16_t count)
+{
+  NS_ASSERT_MSG (index < count, "Fragment index " << index << " must be less than count " << count);
+  m_fragmentIndex = index;
+  m_fragmentCount = count;
+}
+
+uint16_t
+LsrLsa::GetFragmentIndex (void) const
+{
+  return m_fragmentIndex;
+}
+
+uint16_t
+LsrLsa::GetFragmentCount (void) const
+{
+  return m_fragmentCount;
+}
+
+std::vector< Ptr<const LsrLsa> >
+LsrLsa::Fragment (uint32_t maxSize) const
+{
+  std::vector< Ptr<const LsrLsa> > fragments;
+  if (GetSerializedSize () <= maxSize)
+    {
+      fragments.push_back (Ptr<const LsrLsa> (this));
+      return fragments;
+    }
+
+  // Every fragment carries the header and a T_LSA_FRAGMENT
+  std::vector< Ptr<LsrLsa> > building;
+  building.push_back (Create<LsrLsa> (m_routerName, m_seqnum));
+  building.back ()->SetFragment (0, 2);
+  uint32_t headerSize = building.back ()->GetHeaderSerializedSize ();
+  NS_ABORT_MSG_IF (headerSize > maxSize, "LSA header of " << *m_routerName << " does not fit in " << maxSize << " bytes");
+  uint32_t size = headerSize;
+
+  for (size_t i = 0; i < m_links.size (); i++)
+    {
+      uint32_t linkSize = GetLinkSerializedSize (m_links[i]);
+      NS_ABORT_MSG_IF (headerSize + linkSize > maxSize, "LSA link to " << *m_links[i].first << " does not fit in " << maxSize << " bytes");
+      if (size + linkSize > maxSize)
+        {
+          building.push_back (Create<LsrLsa> (m_routerName, m_seqnum));
+          size = headerSize;
+        }
+      building.back ()->m_links.push_back (m_links[i]);
+      size += linkSize;
+    }
+
+  for (size_t i = 0; i < m_prefixes.size (); i++)
+    {
+      uint32_t prefixSize = GetPrefixSerializedSize (m_prefixes[i]);
+      NS_ABORT_MSG_IF (headerSize + prefixSize > maxSize, "LSA prefix " << *m_prefixes[i] << " does not fit in " << maxSize << " bytes");
+      if (size + prefixSize > maxSize)
+        {
+          building.push_back (Create<LsrLsa> (m_routerName, m_seqnum));
+          size = headerSize;
+        }
+      building.back ()->m_prefixes.push_back (m_prefixes[i]);
+      size += prefixSize;
+    }
+
+  NS_ABORT_MSG_IF (building.size () > 0xFFFF, "LSA of " << *m_routerName << " needs too many fragments");
+  for (size_t i = 0; i < building.size (); i++)
+    {
+      building[i]->SetFragment ((uint16_t) i, (uint16_t) building.size ());
+      fragments.push_back (building[i]);
+    }
+  return fragments;
+}
+
+void
+LsrLsa::Merge (const LsrLsa &fragment)
+{
+  m_links.insert (m_links.end (), fragment.m_links.begin (), fragment.m_links.end ());
+  m_prefixes.insert (m_prefixes.end (), fragment.m_prefixes.begin (), fragment.m_prefixes.end ());
+}
+
+bool
+LsrLsa::IsNewerThan (const LsrLsa &other) const
+{
+  return NfpSeqnum::Compare (m_seqnum, other.m_seqnum) > 0;
+}
+
+uint32_t
+LsrLsa::GetHeaderSerializedSize (void) const
+{
+  CCNxCodecName codec;
+  codec.SetHeader (m_routerName);
+
+  uint32_t size = CCNxTlv::GetTLSize () + codec.GetSerializedSize () + CCNxTlv::GetTLSize () + sizeof(uint32_t);
+  if (m_fragmentCount > 1)
+    {
+      size += CCNxTlv::GetTLSize () + 2 * sizeof(uint16_t);
+    }
+  return size;
+}
+
+uint32_t
+LsrLsa::GetLinkSerializedSize (const LinkType &link) const
+{
+  CCNxCodecName codec;
+  codec.SetHeader (link.first);
+  return CCNxTlv::GetTLSize () + codec.GetSerializedSize () + CCNxTlv::GetTLSize () + sizeof(uint32_t);
+}
+
+uint32_t
+LsrLsa::GetPrefixSerializedSize (Ptr<const CCNxName> prefix) const
+{
+  CCNxCodecName codec;
+  codec.SetHeader (prefix);
+  return CCNxTlv::GetTLSize () + codec.GetSerializedSize ();
+}
+
+uint32_t
+LsrLsa::GetSerializedSize (void) const
+{
+  uint32_t size = GetHeaderSerializedSize ();
+  for (size_t i = 0; i < m_links.size (); i++)
+    {
+      size += GetLinkSerializedSize (m_links[i]);
+    }
+  for (size_t i = 0; i < m_prefixes.size (); i++)
+    {
+      size += GetPrefixSerializedSize (m_prefixes[i]);
+    }
+  return size;
+}
+
+void
+LsrLsa::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  uint32_t totalSize = GetSerializedSize ();
+  NS_ASSERT_MSG (totalSize <= 0xFFFF, "Total size too large");
+
+  CCNxTlv::WriteTypeLength (start, LsrSchema::T_LSA, (uint16_t) (totalSize - CCNxTlv::GetTLSize ()));
+
+  CCNxCodecName routerCodec;
+  routerCodec.SetHeader (m_routerName);
+  routerCodec.Serialize (start);
+  start.Next (routerCodec.GetSerializedSize ());
+
+  CCNxTlv::WriteTypeLength (start, LsrSchema::T_LSA_SEQNUM, sizeof(uint32_t));
+  start.WriteHtonU32 (m_seqnum);
+
+  if (m_fragmentCount > 1)
+    {
+      CCNxTlv::WriteTypeLength (start, LsrSchema::T_LSA_FRAGMENT, 2 * sizeof(uint16_t));
+      start.WriteHtonU16 (m_fragmentIndex);
+      start.WriteHtonU16 (m_fragmentCount);
+    }
+
+  for (size_t i = 0; i < m_links.size (); i++)
+    {
+      CCNxCodecName codec;
+      codec.SetHeader (m_links[i].first);
+      CCNxTlv::WriteTypeLength (start, LsrSchema::T_LINK, (uint16_t) (GetLinkSerializedSize (m_links[i]) - CCNxTlv::GetTLSize ()));
+      codec.Serialize (start);
+      start.Next (codec.GetSerializedSize ());
+      CCNxTlv::WriteTypeLength (start, LsrSchema::T_LINK_COST, sizeof(uint32_t));
+      start.WriteHtonU32 (m_links[i].second);
+    }
+
+  for (size_t i = 0; i < m_prefixes.size (); i++)
+    {
+      CCNxCodecName codec;
+      codec.SetHeader (m_prefixes[i]);
+      CCNxTlv::WriteTypeLength (start, LsrSchema::T_PREFIX, (uint16_t) codec.GetSerializedSize ());
+      codec.Serialize (start);
+      start.Next (codec.GetSerializedSize ());
+    }
+}
+
+uint32_t
+LsrLsa::DeserializeLink (Buffer::Iterator start)
+{
+  uint16_t type = CCNxTlv::ReadType (start);
+  uint16_t length = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (type == LsrSchema::T_LINK, "TLV type must be T_LINK");
+
+  CCNxCodecName codec;
+  uint32_t nameSize = codec.Deserialize (start);
+  start.Next (nameSize);
+
+  uint16_t costType = CCNxTlv::ReadType (start);
+  uint16_t costLength = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (costType == LsrSchema::T_LINK_COST, "TLV type must be T_LINK_COST");
+  NS_ASSERT_MSG (costLength == sizeof(uint32_t), "TLV length must be " << sizeof(uint32_t));
+  uint32_t cost = start.ReadNtohU32 ();
+
+  NS_ASSERT_MSG (nameSize + CCNxTlv::GetTLSize () + costLength == length, "Did not consume all bytes of T_LINK");
+  AddLink (codec.GetHeader (), cost);
+  return length + CCNxTlv::GetTLSize ();
+}
+
+uint32_t
+LsrLsa::DeserializePrefix (Buffer::Iterator start)
+{
+  uint16_t type = CCNxTlv::ReadType (start);
+  uint16_t length = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (type == LsrSchema::T_PREFIX, "TLV type must be T_PREFIX");
+
+  CCNxCodecName codec;
+  uint32_t nameSize = codec.Deserialize (start);
+  NS_ASSERT_MSG (nameSize == length, "Did not consume all bytes of T_PREFIX");
+  AddPrefix (codec.GetHeader ());
+  return length + CCNxTlv::GetTLSize ();
+}
+
+uint32_t
+LsrLsa::DeserializeFragment (Buffer::Iterator start)
+{
+  uint16_t type = CCNxTlv::ReadType (start);
+  uint16_t length = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (type == LsrSchema::T_LSA_FRAGMENT, "TLV type must be T_LSA_FRAGMENT");
+  NS_ASSERT_MSG (length == 2 * sizeof(uint16_t), "TLV length must be " << 2 * sizeof(uint16_t));
+
+  uint16_t index = start.ReadNtohU16 ();
+  uint16_t count = start.ReadNtohU16 ();
+  SetFragment (index, count);
+  return length + CCNxTlv::GetTLSize ();
+}
+
+uint32_t
+LsrLsa::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  NS_ASSERT_MSG (start.GetSize () >= CCNxTlv::GetTLSize (), "Must have at least 4 bytes in buffer");
+
+  m_links.clear ();
+  m_prefixes.clear ();
+  m_fragmentIndex = 0;
+  m_fragmentCount = 1;
+
+  // don't count the outer T_LSA bytes until the end so we can compare directly against outerLength
+  uint32_t bytesRead = 0;
+  uint16_t outerType = CCNxTlv::ReadType (start);
+  uint16_t outerLength = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (outerType == LsrSchema::T_LSA, "Outer type must be T_LSA");
+
+  CCNxCodecName routerCodec;
+  uint32_t routerSize = routerCodec.Deserialize (start);
+  start.Next (routerSize);
+  bytesRead += routerSize;
+  m_routerName = routerCodec.GetHeader ();
+
+  uint16_t seqnumType = CCNxTlv::ReadType (start);
+  uint16_t seqnumLength = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (seqnumType == LsrSchema::T_LSA_SEQNUM, "TLV type must be T_LSA_SEQNUM");
+  NS_ASSERT_MSG (seqnumLength == sizeof(uint32_t), "TLV length must be " << sizeof(uint32_t));
+  m_seqnum = start.ReadNtohU32 ();
+  bytesRead += CCNxTlv::GetTLSize () + seqnumLength;
+
+  while (bytesRead < outerLength)
+    {
+      uint16_t innerType = CCNxTlv::ReadType (start);
+      uint16_t innerLength = CCNxTlv::ReadLength (start);
+
+      // the Deserialize functions read the TL block again
+      start.Prev (CCNxTlv::GetTLSize ());
+
+      uint32_t readLength = 0;
+      switch (innerType)
+        {
+        case LsrSchema::T_LINK:
+          readLength = DeserializeLink (start);
+          break;
+
+        case LsrSchema::T_PREFIX:
+          readLength = DeserializePrefix (start);
+          break;
+
+        case LsrSchema::T_LSA_FRAGMENT:
+          readLength = DeserializeFragment (start);
+          break;
+
+        default:
+          NS_ASSERT_MSG (false, "Unsupported LSA field " << innerType);
+          std::terminate ();
+        }
+
+      NS_ASSERT_MSG (readLength == innerLength + CCNxTlv::GetTLSize (), "Wrong length of LSA field " << innerType);
+      start.Next (readLength);
+      bytesRead += readLength;
+    }
+
+  NS_ASSERT_MSG (bytesRead == outerLength, "Read beyond end of LSA");
+
+  // Add in the initial 4 bytes from the T_LSA bytes
+  return bytesRead + CCNxTlv::GetTLSize ();
+}
+
+bool
+LsrLsa::Equals (const LsrLsa &other) const
+{
+  if (m_seqnum != other.m_seqnum || !m_routerName->Equals (*other.m_routerName)
+      || m_fragmentIndex != other.m_fragmentIndex || m_fragmentCount != other.m_fragmentCount
+      || m_links.size () != other.m_links.size () || m_prefixes.size () != other.m_prefixes.size ())
+    {
+      return false;
+    }
+
+  for (size_t i = 0; i < m_links.size (); i++)
+    {
+      if (m_links[i].second != other.m_links[i].second || !m_links[i].first->Equals (*other.m_links[i].first))
+        {
+          return false;
+        }
+    }
+
+  for (size_t i = 0; i < m_prefixes.size (); i++)
+    {
+      if (!m_prefixes[i]->Equals (*other.m_prefixes[i]))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream &os, const LsrLsa &lsa)
+{
+  os << "{ LSA: " << *lsa.m_routerName << " seqnum " << lsa.m_seqnum;
+  if (lsa.m_fragmentCount > 1)
+    {
+      os << " fragment " << lsa.m_fragmentIndex << "/" << lsa.m_fragmentCount;
+    }
+  os << " links {";
+  for (size_t i = 0; i < lsa.m_links.size (); i++)
+    {
+      os << " " << *lsa.m_links[i].first << " cost " << lsa.m_links[i].second;
+    }
+  os << " } prefixes {";
+  for (size_t i = 0; i < lsa.m_prefixes.size (); i++)
+    {
+      os << " " << *lsa.m_prefixes[i];
+    }
+  os << " } }";
+  return os;
+}
@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSA_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSA_H_
+
+#include <utility>
+#include <vector>
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/buffer.h"
+#include "ns3/ccnx-name.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \ingroup lsr-routing
+ *
+ * A link state advertisement.  It is originated by one router and lists that router's
+ * neighbor adjacencies (with the cost of the link to each neighbor) and its anchor prefixes.
+ *
+ * An LSA replaces any older LSA from the same router.  A router increments the sequence
+ * number each time it originates a new LSA, so the newest LSA has the largest sequence
+ * number (RFC 1982 comparison).
+ *
+ * An LSA larger than a packet is sent as several fragments, see Fragment().  Only a complete
+ * LSA is installed in the LSDB.
+ *
+ * \see lsr-schema.h for packet formats
+ */
+class LsrLsa : public SimpleRefCount<LsrLsa>
+{
+public:
+  /**
+   * Creates an empty LSA, used to Deserialize()
+   */
+  LsrLsa ();
+
+  /**
+   * Creates an LSA without links or prefixes.
+   *
+   * @param routerName The origin router
+   * @param seqnum The LSA sequence number
+   */
+  LsrLsa (Ptr<const CCNxName> routerName, uint32_t seqnum);
+
+  virtual ~LsrLsa ();
+
+  Ptr<const CCNxName> GetRouterName (void) const;
+
+  uint32_t GetSeqnum (void) const;
+
+  /**
+   * Adds a neighbor adjacency.
+   *
+   * @param neighborName The router name of the neighbor
+   * @param cost The positive cost of the link to the neighbor
+   */
+  void AddLink (Ptr<const CCNxName> neighborName, uint32_t cost);
+
+  size_t GetLinkCount (void) const;
+
+  Ptr<const CCNxName> GetLinkName (size_t index) const;
+
+  uint32_t GetLinkCost (size_t index) const;
+
+  /**
+   * Looks up the link to a neighbor.
+   *
+   * @param [in] neighborName The neighbor router name
+   * @param [out] cost The link cost, if found
+   * @return true if the LSA has a link to the neighbor
+   */
+  bool FindLink (Ptr<const CCNxName> neighborName, uint32_t &cost) const;
+
+  /**
+   * Adds an anchor prefix of the origin router
+   */
+  void AddPrefix (Ptr<const CCNxName> prefix);
+
+  size_t GetPrefixCount (void) const;
+
+  Ptr<const CCNxName> GetPrefix (size_t index) const;
+
+  /**
+   * Marks this LSA as fragment `index` of `count` fragments of one LSA.  A count of 1
+   * (the default) means the LSA is complete.
+   */
+  void SetFragment (uint16_t index, uint16_t count);
+
+  uint16_t GetFragmentIndex (void) const;
+
+  uint16_t GetFragmentCount (void) const;
+
+  /**
+   * Splits this LSA into fragments that each serialize in at most `maxSize` bytes.  The fragments
+   * have the same router name and seqnum, and the links and prefixes in the same order, so
+   * appending them with Merge() in index order gives back this LSA.
+   *
+   * If the LSA fits, the only fragment is this LSA.  A link or prefix that does not fit in
+   * `maxSize` even alone is a fatal error.
+   */
+  std::vector< Ptr<const LsrLsa> > Fragment (uint32_t maxSize) const;
+
+  /**
+   * Appends the links and prefixes of `fragment`, for reassembly
+   */
+  void Merge (const LsrLsa &fragment);
+
+  /**
+   * @return true if this LSA has a larger sequence number than `other`
+   */
+  bool IsNewerThan (const LsrLsa &other) const;
+
+  uint32_t GetSerializedSize (void) const;
+
+  void Serialize (Buffer::Iterator start) const;
+
+  uint32_t Deserialize (Buffer::Iterator start);
+
+  /**
+   * Two LSAs are equal if they have the same router name, seqnum, links, and prefixes
+   * in the same order.
+   */
+  bool Equals (const LsrLsa &other) const;
+
+  friend std::ostream & operator << (std::ostream &os, const LsrLsa &lsa);
+
+private:
+  Ptr<const CCNxName> m_routerName;
+  uint32_t m_seqnum;
+  uint16_t m_fragmentIndex;
+  uint16_t m_fragmentCount;
+
+  typedef std::pair< Ptr<const CCNxName>, uint32_t > LinkType;
+  std::vector<LinkType> m_links;
+  std::vector< Ptr<const CCNxName> > m_prefixes;
+
+  /**
+   * The size of the LSA without any links or prefixes
+   */
+  uint32_t GetHeaderSerializedSize (void) const;
+  uint32_t GetLinkSerializedSize (const LinkType &link) const;
+  uint32_t GetPrefixSerializedSize (Ptr<const CCNxName> prefix) const;
+  uint32_t DeserializeLink (Buffer::Iterator start);
+  uint32_t DeserializePrefix (Buffer::Iterator start);
+  uint32_t DeserializeFragment (Buffer::Iterator start);
+};
+
+std::ostream & operator << (std::ostream &os, const LsrLsa &lsa);
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSA_H_ */
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/assert.h"
+
+#include "lsr-lsdb.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+LsrLsdb::LsrLsdb ()
+  : m_size (0)
+{
+  // empty
+}
+
+LsrLsdb::~LsrLsdb ()
+{
+  // empty
+}
+
+uint32_t
+LsrLsdb::GetIndex (Ptr<const CCNxName> routerName)
+{
+  uint32_t *found = m_indices.Find (routerName);
+  if (found)
+    {
+      return *found;
+    }
+
+  uint32_t index = m_names.size ();
+  m_indices.Insert (routerName, index);
+  m_names.push_back (routerName);
+  m_lsas.push_back (Ptr<const LsrLsa> ());
+  m_installTimes.push_back (Time (0));
+  return index;
+}
+
+bool
+LsrLsdb::FindIndex (Ptr<const CCNxName> routerName, uint32_t &index) const
+{
+  const uint32_t *found = m_indices.Find (routerName);
+  if (found)
+    {
+      index = *found;
+      return true;
+    }
+  return false;
+}
+
+Ptr<const CCNxName>
+LsrLsdb::GetRouterName (uint32_t index) const
+{
+  NS_ASSERT_MSG (index < m_names.size (), "Unknown router index " << index);
+  return m_names[index];
+}
+
+uint32_t
+LsrLsdb::GetIndexCount (void) const
+{
+  return m_names.size ();
+}
+
+LsrLsdb::InstallResult
+LsrLsdb::Install (Ptr<const LsrLsa> lsa, Time now)
+{
+  uint32_t index = GetIndex (lsa->GetRouterName ());
+  Ptr<const LsrLsa> current = m_lsas[index];
+  if (current)
+    {
+      if (current->IsNewerThan (*lsa))
+        {
+          return OLDER;
+        }
+      if (!lsa->IsNewerThan (*current))
+        {
+          return DUPLICATE;
+        }
+    }
+  else
+    {
+      m_size++;
+    }
+
+  m_lsas[index] = lsa;
+  m_installTimes[index] = now;
+  return INSTALLED;
+}
+
+Ptr<const LsrLsa>
+LsrLsdb::Get (uint32_t index) const
+{
+  NS_ASSERT_MSG (index < m_lsas.size (), "Unknown router index " << index);
+  return m_lsas[index];
+}
+
+Time
+LsrLsdb::GetInstallTime (uint32_t index) const
+{
+  NS_ASSERT_MSG (index < m_installTimes.size (), "Unknown router index " << index);
+  return m_installTimes[index];
+}
+
+void
+LsrLsdb::Remove (uint32_t index)
+{
+  NS_ASSERT_MSG (index < m_lsas.size (), "Unknown router index " << index);
+  if (m_lsas[index])
+    {
+      m_lsas[index] = 0;
+      m_size--;
+    }
+}
+
+size_t
+LsrLsdb::GetSize (void) const
+{
+  return m_size;
+}
+
+std::vector<uint32_t>
+LsrLsdb::GetInstalledBefore (Time time) const
+{
+  std::vector<uint32_t> result;
+  for (uint32_t index = 0; index < m_lsas.size (); index++)
+    {
+      if (m_lsas[index] && m_installTimes[index] < time)
+        {
+          result.push_back (index);
+        }
+    }
+  return result;
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSDB_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSDB_H_
+
+#include <vector>
+
+#include "ns3/nstime.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-flat-hash-map.h"
+#include "ns3/lsr-lsa.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \ingroup lsr-routing
+ *
+ * The link state database: the newest LSA of each router.
+ *
+ * Each router name is given a small integer index the first time it is seen (as the origin of
+ * an LSA or as a neighbor in a link).  The index is used as the node id in LsrSpf and is never
+ * re-used, even if the router's LSA is removed.
+ */
+class LsrLsdb
+{
+public:
+  /**
+   * The result of Install()
+   */
+  enum InstallResult
+  {
+    INSTALLED,      //!< The LSA is new or newer than the stored one, and was stored
+    DUPLICATE,      //!< The LSA has the same seqnum as the stored one
+    OLDER           //!< The stored LSA is newer
+  };
+
+  LsrLsdb ();
+
+  virtual ~LsrLsdb ();
+
+  /**
+   * Returns the index of a router, assigning the next index if the router is new.
+   */
+  uint32_t GetIndex (Ptr<const CCNxName> routerName);
+
+  /**
+   * @param [out] index The index of the router, if found
+   * @return true if the router has an index
+   */
+  bool FindIndex (Ptr<const CCNxName> routerName, uint32_t &index) const;
+
+  Ptr<const CCNxName> GetRouterName (uint32_t index) const;
+
+  /**
+   * The number of router indices assigned
+   */
+  uint32_t GetIndexCount (void) const;
+
+  /**
+   * Stores `lsa` if there is no LSA from its router or it is newer than the stored one.
+   *
+   * @param lsa The LSA
+   * @param now The current time, kept to age the LSA
+   */
+  InstallResult Install (Ptr<const LsrLsa> lsa, Time now);
+
+  /**
+   * @return The LSA of the router, or null
+   */
+  Ptr<const LsrLsa> Get (uint32_t index) const;
+
+  /**
+   * The time the LSA of the router was installed
+   */
+  Time GetInstallTime (uint32_t index) const;
+
+  /**
+   * Removes the LSA of the router.  The router keeps its index.
+   */
+  void Remove (uint32_t index);
+
+  /**
+   * The number of LSAs stored
+   */
+  size_t GetSize (void) const;
+
+  /**
+   * The indices of routers with an LSA installed before `time`
+   */
+  std::vector<uint32_t> GetInstalledBefore (Time time) const;
+
+private:
+  typedef CCNxFlatHashMap< Ptr<const CCNxName>, uint32_t, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > IndexMapType;
+  IndexMapType m_indices;
+
+  std::vector< Ptr<const CCNxName> > m_names;
+  std::vector< Ptr<const LsrLsa> > m_lsas;
+  std::vector<Time> m_installTimes;
+  size_t m_size;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_LSDB_H_ */
@@ -0,0 +1,215 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/abort.h"
+#include "ns3/ccnx-tlv.h"
+
+#include "lsr-payload.h"
+#include "lsr-schema.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("LsrPayload");
+
+LsrPayload::LsrPayload ()
+  : m_capacity (0), m_remaining (0)
+{
+  // empty
+}
+
+LsrPayload::LsrPayload (size_t capacity, Ptr<const CCNxName> routerName)
+  : m_capacity (capacity)
+{
+  NS_LOG_FUNCTION (this << capacity << routerName);
+
+  m_routerNameCodec.SetHeader (routerName);
+
+  size_t fixedOverhead = CCNxTlv::GetTLSize () + m_routerNameCodec.GetSerializedSize ();
+  NS_ASSERT_MSG (fixedOverhead <= m_capacity, "Fixed overhead of RouterName exceeds capacity");
+
+  m_remaining = capacity - fixedOverhead;
+}
+
+LsrPayload::~LsrPayload ()
+{
+  // empty
+}
+
+Ptr<const CCNxName>
+LsrPayload::GetRouterName (void) const
+{
+  return m_routerNameCodec.GetHeader ();
+}
+
+void
+LsrPayload::AppendLsa (Ptr<const LsrLsa> lsa)
+{
+  NS_LOG_FUNCTION (this << lsa);
+
+  size_t lsaSize = lsa->GetSerializedSize ();
+  // Checked in optimized builds too, m_remaining would wrap around and Serialize() write past the buffer
+  NS_ABORT_MSG_IF (lsaSize > GetRemaining (), "LSA of " << lsaSize << " bytes does not fit in payload, " << GetRemaining () << " remaining");
+
+  m_remaining -= lsaSize;
+  m_lsas.push_back (lsa);
+}
+
+size_t
+LsrPayload::GetLsaCount (void) const
+{
+  return m_lsas.size ();
+}
+
+Ptr<const LsrLsa>
+LsrPayload::GetLsa (size_t index) const
+{
+  NS_ASSERT_MSG (index < m_lsas.size (), "Index beyond end of LSA array");
+  return m_lsas[index];
+}
+
+size_t
+LsrPayload::GetRemaining (void) const
+{
+  return m_remaining;
+}
+
+uint32_t
+LsrPayload::GetSerializedSize (void) const
+{
+  return (uint32_t) (m_capacity - m_remaining);
+}
+
+void
+LsrPayload::Serialize (Buffer::Iterator start) const
+{
+  NS_LOG_FUNCTION (this << &start);
+
+  uint32_t totalSize = GetSerializedSize ();
+  NS_ASSERT_MSG (totalSize <= 0xFFFF, "Total size too large");
+
+  CCNxTlv::WriteTypeLength (start, LsrSchema::T_MSG, (uint16_t) (totalSize - CCNxTlv::GetTLSize ()));
+  m_routerNameCodec.Serialize (start);
+  start.Next (m_routerNameCodec.GetSerializedSize ());
+
+  for (size_t i = 0; i < m_lsas.size (); i++)
+    {
+      m_lsas[i]->Serialize (start);
+      start.Next (m_lsas[i]->GetSerializedSize ());
+    }
+}
+
+uint32_t
+LsrPayload::Deserialize (Buffer::Iterator start)
+{
+  NS_LOG_FUNCTION (this << &start);
+  NS_ASSERT_MSG (start.GetSize () >= CCNxTlv::GetTLSize (), "Must have at least 4 bytes in buffer");
+
+  m_lsas.clear ();
+
+  // don't count the outer T_MSG bytes until the end so we can compare directly against outerLength
+  uint32_t bytesRead = 0;
+  uint16_t outerType = CCNxTlv::ReadType (start);
+  uint16_t outerLength = CCNxTlv::ReadLength (start);
+  NS_ASSERT_MSG (outerType == LsrSchema::T_MSG, "Outer type must be T_MSG");
+
+  uint32_t routerNameSize = m_routerNameCodec.Deserialize (start);
+  start.Next (routerNameSize);
+  bytesRead += routerNameSize;
+
+  while (bytesRead < outerLength)
+    {
+      Ptr<LsrLsa> lsa = Create<LsrLsa> ();
+      uint32_t readLength = lsa->Deserialize (start);
+      start.Next (readLength);
+      bytesRead += readLength;
+      m_lsas.push_back (lsa);
+    }
+
+  NS_ASSERT_MSG (bytesRead == outerLength, "Read beyond end of message!");
+
+  m_capacity = bytesRead + CCNxTlv::GetTLSize ();
+  m_remaining = 0;
+
+  // Add in the initial 4 bytes from the T_MSG bytes
+  return bytesRead + CCNxTlv::GetTLSize ();
+}
+
+bool
+LsrPayload::Equals (const LsrPayload &other) const
+{
+  if (!m_routerNameCodec.Equals (other.m_routerNameCodec) || m_lsas.size () != other.m_lsas.size ())
+    {
+      return false;
+    }
+
+  for (size_t i = 0; i < m_lsas.size (); i++)
+    {
+      if (!m_lsas[i]->Equals (*other.m_lsas[i]))
+        {
+          return false;
+        }
+    }
+  return true;
+}
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream &os, const LsrPayload &payload)
+{
+  os << "{ LsrPayload: " << *payload.GetRouterName () << " lsas " << payload.m_lsas.size () << " }";
+  return os;
+}
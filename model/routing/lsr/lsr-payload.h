@@ -0,0 +1,138 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_PAYLOAD_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_PAYLOAD_H_
+
+#include <vector>
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/buffer.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-codec-name.h"
+#include "ns3/lsr-lsa.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \ingroup lsr-routing
+ *
+ * The payload of an LSR packet.  It carries the name of the sending router and zero or more
+ * LSAs.  A payload without LSAs is a Hello.
+ *
+ * Like NfpPayload, a payload is created with a capacity (the MTU less the packet overhead)
+ * and LSAs are appended while they fit.
+ *
+ * \see lsr-schema.h for packet formats
+ */
+class LsrPayload : public SimpleRefCount<LsrPayload>
+{
+public:
+  /**
+   * Creates an empty payload, used to Deserialize()
+   */
+  LsrPayload ();
+
+  /**
+   * @param capacity The maximum serialized size of the payload
+   * @param routerName The name of the sending router
+   */
+  LsrPayload (size_t capacity, Ptr<const CCNxName> routerName);
+
+  virtual ~LsrPayload ();
+
+  Ptr<const CCNxName> GetRouterName (void) const;
+
+  /**
+   * Appends an LSA.
+   *
+   * PRECONDITION: The LSA must fit in GetRemaining().  A larger LSA must be split with
+   * LsrLsa::Fragment() first.
+   */
+  void AppendLsa (Ptr<const LsrLsa> lsa);
+
+  size_t GetLsaCount (void) const;
+
+  Ptr<const LsrLsa> GetLsa (size_t index) const;
+
+  /**
+   * The number of bytes that may still be appended
+   */
+  size_t GetRemaining (void) const;
+
+  uint32_t GetSerializedSize (void) const;
+
+  void Serialize (Buffer::Iterator start) const;
+
+  uint32_t Deserialize (Buffer::Iterator start);
+
+  bool Equals (const LsrPayload &other) const;
+
+  friend std::ostream & operator << (std::ostream &os, const LsrPayload &payload);
+
+private:
+  CCNxCodecName m_routerNameCodec;
+  size_t m_capacity;
+  size_t m_remaining;
+  std::vector< Ptr<const LsrLsa> > m_lsas;
+};
+
+std::ostream & operator << (std::ostream &os, const LsrPayload &payload);
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_PAYLOAD_H_ */
@@ -0,0 +1,1042 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <iomanip>
+#include <limits>
+#include <algorithm>
+
+#include "ns3/assert.h"
+#include "ns3/abort.h"
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "ns3/pointer.h"
+#include "ns3/uinteger.h"
+#include "ns3/buffer.h"
+#include "ns3/ccnx-name-builder.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-forwarder.h"
+#include "ns3/ccnx-route-entry.h"
+#include "ns3/nfp-seqnum.h"
+
+#include "lsr-routing-protocol.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("LsrRoutingProtocol");
+NS_OBJECT_ENSURE_REGISTERED (LsrRoutingProtocol);
+
+TypeId
+LsrRoutingProtocol::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ccnx::LsrRoutingProtocol")
+    .SetParent<CCNxRoutingProtocol> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<LsrRoutingProtocol> ()
+    .AddAttribute ("HelloInterval", "HELLO messages emission interval.",
+                   TimeValue (Seconds (2)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_helloInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("NeighborTimeout", "Remove a neighbor if not heard in this period.",
+                   TimeValue (Seconds (6)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_neighborTimeout),
+                   MakeTimeChecker ())
+    .AddAttribute ("LsaRefreshInterval", "Originate our LSA again after this period.",
+                   TimeValue (Seconds (30)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_lsaRefreshInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("LsaMaxAge", "Remove an LSA if not refreshed in this period.",
+                   TimeValue (Seconds (90)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_lsaMaxAge),
+                   MakeTimeChecker ())
+    .AddAttribute ("LsaOriginateDelay", "Delay from a change of our neighbors or anchor prefixes to originating our LSA.",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_lsaOriginateDelay),
+                   MakeTimeChecker ())
+    .AddAttribute ("Jitter", "Subtractive jitter to messages from interval.",
+                   TimeValue (MilliSeconds (100)),
+                   MakeTimeAccessor (&LsrRoutingProtocol::m_jitter),
+                   MakeTimeChecker ())
+    .AddAttribute ("LinkCost", "The cost we advertise for the link to each neighbor.",
+                   UintegerValue (1),
+                   MakeUintegerAccessor (&LsrRoutingProtocol::m_linkCost),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("ConvergenceObserver", "An NfpConvergenceObserver shared by all nodes to measure convergence time.",
+                   PointerValue (),
+                   MakePointerAccessor (&LsrRoutingProtocol::m_convergenceObserver),
+                   MakePointerChecker<NfpConvergenceObserver> ());
+  return tid;
+}
+
+LsrRoutingProtocol::LsrRoutingProtocol ()
+  : m_spf (0)
+{
+  m_lsaSeqnum = 1;
+  m_payloadsSent = 0;
+  m_bytesSent = 0;
+  m_lsasOriginated = 0;
+  m_lsasReceived = 0;
+  m_lsasInstalled = 0;
+  m_helloTimer = Timer (Timer::REMOVE_ON_DESTROY);
+  m_refreshTimer = Timer (Timer::REMOVE_ON_DESTROY);
+  m_originateTimer = Timer (Timer::REMOVE_ON_DESTROY);
+
+  m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  m_lsrPrefix = Create<CCNxName> ("ccnx:/name=lsr");
+  m_minimumMtu = GetMinimumMtu ();
+  m_packetOverhead = 0;
+
+  // the specific name will be added in SetNode()
+  m_routerName = 0;
+}
+
+LsrRoutingProtocol::~LsrRoutingProtocol ()
+{
+  m_uniformRandomVariable = 0;
+}
+
+void
+LsrRoutingProtocol::SetRouterName (void)
+{
+  Buffer buffer (0);
+  buffer.AddAtStart (32);
+
+  Buffer::Iterator i = buffer.Begin ();
+  i.WriteHtonU64 (m_node->GetId ());
+  i.WriteU8 (0, 24);
+  std::string s ((const char *) buffer.PeekData (), buffer.GetSize ());
+
+  Ptr<CCNxNameSegment> segment = Create<CCNxNameSegment> (CCNxNameSegment_Name, s);
+  CCNxNameBuilder builder;
+  builder.Append (segment);
+  m_routerName = builder.CreateName ();
+
+  // We are the root of the SPF tree
+  uint32_t index = m_lsdb.GetIndex (m_routerName);
+  NS_ASSERT_MSG (index == m_spf.GetRoot (), "Our router index must be the SPF root");
+  NS_LOG_INFO ("Node " << m_node->GetId () << " lsr router name: " << *m_routerName);
+
+  m_packetOverhead = ComputePacketOverhead ();
+}
+
+void
+LsrRoutingProtocol::DoInitialize (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  m_portal = CCNxPortal::CreatePortal (m_node, TypeId::LookupByName ("ns3::ccnx::CCNxMessagePortalFactory"));
+  NS_ASSERT_MSG (m_portal, "Failed to create CCNxMessagePortal on node " << m_node);
+  m_portal->SetRecvCallback (MakeCallback (&LsrRoutingProtocol::ReceiveNotify, this));
+  m_portal->RegisterPrefix (m_lsrPrefix);
+
+  m_helloTimer.SetFunction (&LsrRoutingProtocol::HelloTimerExpired, this);
+  m_refreshTimer.SetFunction (&LsrRoutingProtocol::RefreshTimerExpired, this);
+  m_originateTimer.SetFunction (&LsrRoutingProtocol::OriginateLsa, this);
+
+  // Set the hello and refresh timers to start in 1 jitter interval with 25% jitter
+  SetTimer (m_helloTimer, m_jitter, m_jitter / 4);
+  SetTimer (m_refreshTimer, m_jitter, m_jitter / 4);
+
+  CCNxRoutingProtocol::DoInitialize ();
+}
+
+void
+LsrRoutingProtocol::DoDispose (void)
+{
+  m_helloTimer.Cancel ();
+  m_refreshTimer.Cancel ();
+  m_originateTimer.Cancel ();
+  m_reassembly.clear ();
+  m_portal = 0;
+  m_convergenceObserver = 0;
+  CCNxRoutingProtocol::DoDispose ();
+}
+
+Time
+LsrRoutingProtocol::CalculateJitteredTime (Time interval, Time jitter)
+{
+  NS_ASSERT_MSG (interval > 0, "Interval must be positive");
+  NS_ASSERT_MSG (jitter >= 0, "Jitter must be non-negative");
+
+  Time offset (0);
+  if (jitter.IsPositive ())
+    {
+      uint32_t r = m_uniformRandomVariable->GetInteger (0, jitter.GetNanoSeconds ());
+      offset = Time (NanoSeconds (r));
+    }
+
+  Time t = interval - offset;
+  NS_ASSERT_MSG (t > 0, "Negative time!  interval = " << interval << " jitter = " << jitter << " offset = " << offset);
+  return t;
+}
+
+void
+LsrRoutingProtocol::SetTimer (Timer &timer, Time interval, Time jitter)
+{
+  Time final = CalculateJitteredTime (interval, jitter);
+  timer.SetDelay (final);
+  timer.Schedule ();
+}
+
+// ========================================
+// Timers
+
+void
+LsrRoutingProtocol::HelloTimerExpired (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  Broadcast (CreatePacket (CreatePayload ()));
+
+  // Remove neighbors we have not heard from
+  Time now = GetCurrentTime ();
+  bool neighborRemoved = false;
+  NeighborMapType::iterator i = m_neighbors.begin ();
+  while (i != m_neighbors.end ())
+    {
+      if (i->second.lastHeard + m_neighborTimeout <= now)
+        {
+          NS_LOG_INFO ("Neighbor timeout " << *m_lsdb.GetRouterName (i->first));
+          m_neighbors.erase (i++);
+          neighborRemoved = true;
+        }
+      else
+        {
+          ++i;
+        }
+    }
+
+  if (neighborRemoved)
+    {
+      ScheduleOriginate ();
+    }
+
+  // Remove LSAs that were not refreshed.  Ours is refreshed by m_refreshTimer.
+  if (now > m_lsaMaxAge)
+    {
+      std::vector<uint32_t> expired = m_lsdb.GetInstalledBefore (now - m_lsaMaxAge);
+      for (size_t j = 0; j < expired.size (); j++)
+        {
+          if (expired[j] != m_spf.GetRoot ())
+            {
+              NS_LOG_INFO ("LSA max age " << *m_lsdb.GetRouterName (expired[j]));
+              Ptr<const LsrLsa> oldLsa = m_lsdb.Get (expired[j]);
+              m_lsdb.Remove (expired[j]);
+              LsaChanged (expired[j], oldLsa, 0);
+            }
+        }
+    }
+
+  // Drop LSAs that lost a fragment, the next refresh sends all of them again
+  ReassemblyMapType::iterator r = m_reassembly.begin ();
+  while (r != m_reassembly.end ())
+    {
+      if (r->second.firstHeard + m_lsaMaxAge <= now)
+        {
+          NS_LOG_INFO ("Incomplete LSA " << *m_lsdb.GetRouterName (r->first) << " seqnum " << r->second.seqnum);
+          m_reassembly.erase (r++);
+        }
+      else
+        {
+          ++r;
+        }
+    }
+
+  SetTimer (m_helloTimer, m_helloInterval, m_jitter);
+}
+
+void
+LsrRoutingProtocol::RefreshTimerExpired (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+  m_originateTimer.Cancel ();
+  OriginateLsa ();
+  SetTimer (m_refreshTimer, m_lsaRefreshInterval, m_jitter);
+}
+
+void
+LsrRoutingProtocol::ScheduleOriginate (void)
+{
+  if (!m_originateTimer.IsRunning ())
+    {
+      m_originateTimer.SetDelay (m_lsaOriginateDelay);
+      m_originateTimer.Schedule ();
+    }
+}
+
+void
+LsrRoutingProtocol::OriginateLsa (void)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  Ptr<LsrLsa> lsa = Create<LsrLsa> (m_routerName, m_lsaSeqnum++);
+  for (NeighborMapType::const_iterator i = m_neighbors.begin (); i != m_neighbors.end (); ++i)
+    {
+      lsa->AddLink (m_lsdb.GetRouterName (i->first), m_linkCost);
+    }
+  for (AnchorNameMapType::const_iterator i = m_anchorNames.begin (); i != m_anchorNames.end (); ++i)
+    {
+      lsa->AddPrefix (i->first);
+    }
+
+  NS_LOG_DEBUG ("Originate " << *lsa);
+  m_lsasOriginated++;
+
+  uint32_t root = m_spf.GetRoot ();
+  Ptr<const LsrLsa> oldLsa = m_lsdb.Get (root);
+  LsrLsdb::InstallResult result = m_lsdb.Install (lsa, GetCurrentTime ());
+  NS_ASSERT_MSG (result == LsrLsdb::INSTALLED, "Our own LSA must be the newest");
+  LsaChanged (root, oldLsa, lsa);
+  Flood (lsa);
+}
+
+// ========================================
+// Sending
+
+uint32_t
+LsrRoutingProtocol::GetMinimumMtu (void) const
+{
+  uint32_t minimum = std::numeric_limits<uint32_t>::max ();
+  for (InterfaceMapType::const_iterator i = m_interfaces.begin (); i != m_interfaces.end (); ++i)
+    {
+      if (i->second->IsUp () && i->second->GetMtu () < minimum)
+        {
+          minimum = i->second->GetMtu ();
+        }
+    }
+  return minimum;
+}
+
+Ptr<LsrPayload>
+LsrRoutingProtocol::CreatePayload (void)
+{
+  NS_ABORT_MSG_IF (m_minimumMtu <= m_packetOverhead,
+                   "MTU " << m_minimumMtu << " is too small for the " << m_packetOverhead << " byte LSR packet overhead");
+  return Create<LsrPayload> (m_minimumMtu - m_packetOverhead, m_routerName);
+}
+
+uint32_t
+LsrRoutingProtocol::ComputePacketOverhead (void)
+{
+  // All lengths are fixed size TLVs, so the overhead of a Hello is the overhead of every packet
+  Ptr<LsrPayload> hello = Create<LsrPayload> (std::numeric_limits<uint16_t>::max (), m_routerName);
+  Ptr<CCNxPacket> packet = CreatePacket (hello);
+  uint32_t overhead = packet->GetNs3Packet ()->GetSize () - hello->GetSerializedSize ();
+  NS_LOG_DEBUG ("Packet overhead " << overhead << " bytes");
+  return overhead;
+}
+
+std::vector< Ptr<const LsrLsa> >
+LsrRoutingProtocol::FragmentLsa (Ptr<const LsrLsa> lsa)
+{
+  // The T_LSA length is 16 bits, whatever the MTU
+  size_t maxSize = std::min (CreatePayload ()->GetRemaining (), (size_t) std::numeric_limits<uint16_t>::max ());
+  std::vector< Ptr<const LsrLsa> > fragments = lsa->Fragment (maxSize);
+  if (fragments.size () > 1)
+    {
+      NS_LOG_DEBUG ("LSA of " << *lsa->GetRouterName () << " seqnum " << lsa->GetSeqnum () << " in " << fragments.size () << " fragments");
+    }
+  return fragments;
+}
+
+Ptr<CCNxPacket>
+LsrRoutingProtocol::CreatePacket (Ptr<LsrPayload> payload)
+{
+  Ptr<CCNxBuffer> buffer = Create<CCNxBuffer> (0);
+  buffer->AddAtStart (payload->GetSerializedSize ());
+  payload->Serialize (buffer->Begin ());
+
+  CCNxNameBuilder builder (*m_lsrPrefix);
+  builder.Append (m_routerName->GetSegment (0));
+
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (builder.CreateName (), buffer);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+  packet->GetFixedHeader ()->SetHopLimit (1);
+  return packet;
+}
+
+void
+LsrRoutingProtocol::Broadcast (Ptr<CCNxPacket> packet)
+{
+  for (InterfaceMapType::const_iterator i = m_interfaces.begin (); i != m_interfaces.end (); ++i)
+    {
+      SendTo (packet, i->second->GetBroadcastConnection ());
+    }
+}
+
+void
+LsrRoutingProtocol::SendTo (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> connection)
+{
+  uint32_t bytes = packet->GetMessage ()->GetPayload ()->GetSize ();
+  m_payloadsSent++;
+  m_bytesSent += bytes;
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->ControlBytesSent (bytes);
+    }
+
+  NS_LOG_DEBUG ("SendTo(" << *packet << ", " << connection->GetConnectionId () << ")");
+  m_portal->SendTo (packet, connection->GetConnectionId ());
+}
+
+void
+LsrRoutingProtocol::Flood (Ptr<const LsrLsa> lsa)
+{
+  std::vector< Ptr<const LsrLsa> > fragments = FragmentLsa (lsa);
+  for (size_t i = 0; i < fragments.size (); i++)
+    {
+      Ptr<LsrPayload> payload = CreatePayload ();
+      payload->AppendLsa (fragments[i]);
+      Broadcast (CreatePacket (payload));
+    }
+}
+
+void
+LsrRoutingProtocol::SendLsa (Ptr<const LsrLsa> lsa, Ptr<CCNxConnection> connection)
+{
+  std::vector< Ptr<const LsrLsa> > fragments = FragmentLsa (lsa);
+  for (size_t i = 0; i < fragments.size (); i++)
+    {
+      Ptr<LsrPayload> payload = CreatePayload ();
+      payload->AppendLsa (fragments[i]);
+      SendTo (CreatePacket (payload), connection);
+    }
+}
+
+void
+LsrRoutingProtocol::SendDatabase (Ptr<CCNxConnection> connection)
+{
+  Ptr<LsrPayload> payload = CreatePayload ();
+  for (uint32_t index = 0; index < m_lsdb.GetIndexCount (); index++)
+    {
+      Ptr<const LsrLsa> lsa = m_lsdb.Get (index);
+      if (!lsa)
+        {
+          continue;
+        }
+
+      // Each fragment fits in an empty payload
+      std::vector< Ptr<const LsrLsa> > fragments = FragmentLsa (lsa);
+      for (size_t i = 0; i < fragments.size (); i++)
+        {
+          if (fragments[i]->GetSerializedSize () > payload->GetRemaining ())
+            {
+              SendTo (CreatePacket (payload), connection);
+              payload = CreatePayload ();
+            }
+          payload->AppendLsa (fragments[i]);
+        }
+    }
+
+  if (payload->GetLsaCount () > 0)
+    {
+      SendTo (CreatePacket (payload), connection);
+    }
+}
+
+// ========================================
+// Receiving
+
+void
+LsrRoutingProtocol::ReceiveNotify (Ptr<CCNxPortal> portal)
+{
+  NS_LOG_FUNCTION (this << portal);
+
+  Ptr<CCNxPacket> packet;
+  Ptr<CCNxConnection> ingressConnection;
+  while ( (packet = portal->RecvFrom (ingressConnection)) )
+    {
+      NS_ASSERT_MSG (ingressConnection, "Received portal message with NULL ingress connection");
+
+      Ptr<CCNxBuffer> interestPayload = packet->GetMessage ()->GetPayload ();
+      NS_ASSERT_MSG (interestPayload, "Got null payload from ccnx Message");
+
+      Ptr<LsrPayload> payload = Create<LsrPayload> ();
+      payload->Deserialize (interestPayload->Begin ());
+      ReceivePayload (payload, ingressConnection);
+    }
+}
+
+void
+LsrRoutingProtocol::ReceivePayload (Ptr<LsrPayload> payload, Ptr<CCNxConnection> ingressConnection)
+{
+  NS_LOG_FUNCTION (this << *payload << ingressConnection->GetConnectionId ());
+
+  if (m_routerName->Equals (*payload->GetRouterName ()))
+    {
+      NS_LOG_WARN ("Received payload from neighbor with our name.  Ignoring.");
+      return;
+    }
+
+  ReceiveHello (payload->GetRouterName (), ingressConnection);
+  for (size_t i = 0; i < payload->GetLsaCount (); i++)
+    {
+      Ptr<const LsrLsa> lsa = payload->GetLsa (i);
+      if (lsa->GetFragmentCount () > 1)
+        {
+          ReceiveFragment (lsa, ingressConnection);
+        }
+      else
+        {
+          ReceiveLsa (lsa, ingressConnection);
+        }
+    }
+}
+
+void
+LsrRoutingProtocol::ReceiveHello (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> ingressConnection)
+{
+  uint32_t index = m_lsdb.GetIndex (neighborName);
+  NeighborMapType::iterator i = m_neighbors.find (index);
+  if (i != m_neighbors.end ())
+    {
+      i->second.lastHeard = GetCurrentTime ();
+      return;
+    }
+
+  NS_LOG_INFO ("New neighbor " << *neighborName << " ConnId " << ingressConnection->GetConnectionId ());
+  Neighbor neighbor;
+  neighbor.connection = ingressConnection;
+  neighbor.lastHeard = GetCurrentTime ();
+  m_neighbors[index] = neighbor;
+
+  SendDatabase (ingressConnection);
+  ScheduleOriginate ();
+}
+
+void
+LsrRoutingProtocol::ReceiveLsa (Ptr<const LsrLsa> lsa, Ptr<CCNxConnection> ingressConnection)
+{
+  NS_LOG_FUNCTION (this << *lsa);
+  m_lsasReceived++;
+
+  uint32_t index = m_lsdb.GetIndex (lsa->GetRouterName ());
+  if (index == m_spf.GetRoot ())
+    {
+      // Our own flood coming back is ignored.  An LSA of ours newer than the one we have is from
+      // before a restart, so continue after its seqnum.
+      Ptr<const LsrLsa> ours = m_lsdb.Get (index);
+      if (!ours || lsa->IsNewerThan (*ours))
+        {
+          NS_LOG_INFO ("Received our own LSA with seqnum " << lsa->GetSeqnum () << ", jump ahead");
+          m_lsaSeqnum = lsa->GetSeqnum () + 1;
+          ScheduleOriginate ();
+        }
+      return;
+    }
+
+  Ptr<const LsrLsa> oldLsa = m_lsdb.Get (index);
+  switch (m_lsdb.Install (lsa, GetCurrentTime ()))
+    {
+    case LsrLsdb::INSTALLED:
+      m_lsasInstalled++;
+      Flood (lsa);
+      LsaChanged (index, oldLsa, lsa);
+      break;
+
+    case LsrLsdb::OLDER:
+      // The sender is behind, so send it ours
+      SendLsa (oldLsa, ingressConnection);
+      break;
+
+    case LsrLsdb::DUPLICATE:
+      break;
+    }
+}
+
+void
+LsrRoutingProtocol::ReceiveFragment (Ptr<const LsrLsa> fragment, Ptr<CCNxConnection> ingressConnection)
+{
+  NS_LOG_FUNCTION (this << *fragment);
+
+  // A fragment of an LSA we already have, or of an older one, is not collected
+  uint32_t index = m_lsdb.GetIndex (fragment->GetRouterName ());
+  Ptr<const LsrLsa> stored = m_lsdb.Get (index);
+  if (stored && !fragment->IsNewerThan (*stored))
+    {
+      if (index != m_spf.GetRoot () && stored->IsNewerThan (*fragment) && fragment->GetFragmentIndex () == 0)
+        {
+          // The sender is behind, so send it ours, once for all its fragments
+          SendLsa (stored, ingressConnection);
+        }
+      return;
+    }
+
+  ReassemblyMapType::iterator i = m_reassembly.find (index);
+  if (i != m_reassembly.end ())
+    {
+      int compare = NfpSeqnum::Compare (fragment->GetSeqnum (), i->second.seqnum);
+      if (compare < 0)
+        {
+          return;
+        }
+      if (compare > 0 || i->second.fragments.size () != fragment->GetFragmentCount ())
+        {
+          m_reassembly.erase (i);
+          i = m_reassembly.end ();
+        }
+    }
+
+  if (i == m_reassembly.end ())
+    {
+      Reassembly reassembly;
+      reassembly.seqnum = fragment->GetSeqnum ();
+      reassembly.fragments.resize (fragment->GetFragmentCount ());
+      reassembly.received = 0;
+      reassembly.firstHeard = GetCurrentTime ();
+      i = m_reassembly.insert (std::make_pair (index, reassembly)).first;
+    }
+
+  Ptr<const LsrLsa> &slot = i->second.fragments[fragment->GetFragmentIndex ()];
+  if (slot)
+    {
+      return;
+    }
+  slot = fragment;
+  i->second.received++;
+  if (i->second.received < i->second.fragments.size ())
+    {
+      return;
+    }
+
+  Ptr<LsrLsa> lsa = Create<LsrLsa> (fragment->GetRouterName (), fragment->GetSeqnum ());
+  for (size_t j = 0; j < i->second.fragments.size (); j++)
+    {
+      lsa->Merge (*i->second.fragments[j]);
+    }
+  m_reassembly.erase (i);
+
+  NS_LOG_DEBUG ("Reassembled " << *lsa);
+  ReceiveLsa (lsa, ingressConnection);
+}
+
+// ========================================
+// SPF and routes
+
+void
+LsrRoutingProtocol::LsaChanged (uint32_t index, Ptr<const LsrLsa> oldLsa, Ptr<const LsrLsa> newLsa)
+{
+  NS_LOG_FUNCTION (this << index);
+
+  // Update the edges to and from every router linked in the old or new LSA
+  std::set<uint32_t> linked;
+  if (oldLsa)
+    {
+      for (size_t i = 0; i < oldLsa->GetLinkCount (); i++)
+        {
+          linked.insert (m_lsdb.GetIndex (oldLsa->GetLinkName (i)));
+        }
+    }
+  if (newLsa)
+    {
+      for (size_t i = 0; i < newLsa->GetLinkCount (); i++)
+        {
+          linked.insert (m_lsdb.GetIndex (newLsa->GetLinkName (i)));
+        }
+    }
+
+  for (std::set<uint32_t>::const_iterator i = linked.begin (); i != linked.end (); ++i)
+    {
+      UpdateEdge (index, *i);
+      UpdateEdge (*i, index);
+    }
+
+  std::set< Ptr<const CCNxName>, CCNxName::isLessPtrCCNxName > dirty;
+
+  // Our own prefixes are local, we do not route to them
+  if (index != m_spf.GetRoot ())
+    {
+      if (oldLsa)
+        {
+          for (size_t i = 0; i < oldLsa->GetPrefixCount (); i++)
+            {
+              m_prefixOrigins[oldLsa->GetPrefix (i)].erase (index);
+              dirty.insert (oldLsa->GetPrefix (i));
+            }
+        }
+      if (newLsa)
+        {
+          for (size_t i = 0; i < newLsa->GetPrefixCount (); i++)
+            {
+              m_prefixOrigins[newLsa->GetPrefix (i)].insert (index);
+              dirty.insert (newLsa->GetPrefix (i));
+            }
+        }
+    }
+
+  // The prefixes of routers whose distance or first hop changed
+  std::vector<uint32_t> changed = m_spf.TakeChanged ();
+  for (size_t i = 0; i < changed.size (); i++)
+    {
+      Ptr<const LsrLsa> lsa = m_lsdb.Get (changed[i]);
+      if (lsa && changed[i] != m_spf.GetRoot ())
+        {
+          for (size_t j = 0; j < lsa->GetPrefixCount (); j++)
+            {
+              dirty.insert (lsa->GetPrefix (j));
+            }
+        }
+    }
+
+  for (std::set< Ptr<const CCNxName>, CCNxName::isLessPtrCCNxName >::const_iterator i = dirty.begin (); i != dirty.end (); ++i)
+    {
+      UpdateRoute (*i);
+    }
+}
+
+void
+LsrRoutingProtocol::UpdateEdge (uint32_t from, uint32_t to)
+{
+  Ptr<const LsrLsa> fromLsa = m_lsdb.Get (from);
+  Ptr<const LsrLsa> toLsa = m_lsdb.Get (to);
+
+  uint32_t cost;
+  uint32_t reverseCost;
+  if (fromLsa && toLsa && fromLsa->FindLink (m_lsdb.GetRouterName (to), cost)
+      && toLsa->FindLink (m_lsdb.GetRouterName (from), reverseCost))
+    {
+      m_spf.SetEdge (from, to, cost);
+    }
+  else
+    {
+      m_spf.RemoveEdge (from, to);
+    }
+}
+
+void
+LsrRoutingProtocol::UpdateRoute (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << *prefix);
+
+  // The anchors we can reach through a neighbor, and the distance to the closest
+  RouterSetType &origins = m_prefixOrigins[prefix];
+  RouterSetType reachable;
+  uint32_t best = LsrSpf::INFINITE;
+  for (RouterSetType::const_iterator i = origins.begin (); i != origins.end (); ++i)
+    {
+      if (m_neighbors.find (m_spf.GetFirstHop (*i)) != m_neighbors.end ())
+        {
+          reachable.insert (*i);
+          best = std::min (best, m_spf.GetDistance (*i));
+        }
+    }
+
+  if (origins.empty ())
+    {
+      m_prefixOrigins.erase (prefix);
+    }
+
+  // Equal cost multipath to the closest anchors
+  Ptr<CCNxRoute> route = Create<CCNxRoute> (prefix);
+  for (RouterSetType::const_iterator i = reachable.begin (); i != reachable.end (); ++i)
+    {
+      if (m_spf.GetDistance (*i) == best)
+        {
+          Ptr<CCNxConnection> connection = m_neighbors.find (m_spf.GetFirstHop (*i))->second.connection;
+          route->AddNexthop (Create<CCNxRouteEntry> (prefix, best, connection));
+        }
+    }
+
+  RouteMapType::iterator found = m_modelFib.find (prefix);
+  if (found == m_modelFib.end () || !found->second->Equals (*route))
+    {
+      NS_LOG_DEBUG ("Update route " << *route);
+      Ptr<CCNxForwarder> forwarder = m_node->GetObject<CCNxForwarder> ();
+      if (found != m_modelFib.end ())
+        {
+          forwarder->RemoveRoute (found->second);
+          m_modelFib.erase (found);
+        }
+
+      if (!route->empty ())
+        {
+          forwarder->AddRoute (route);
+          m_modelFib[prefix] = route;
+        }
+    }
+
+  if (m_convergenceObserver)
+    {
+      ReportOrigins (prefix, reachable);
+    }
+}
+
+void
+LsrRoutingProtocol::ReportOrigins (Ptr<const CCNxName> prefix, const RouterSetType &reachable)
+{
+  RouterSetType &previous = m_routedOrigins[prefix];
+  for (RouterSetType::const_iterator i = previous.begin (); i != previous.end (); ++i)
+    {
+      if (reachable.find (*i) == reachable.end ())
+        {
+          m_convergenceObserver->FibRouteRemoved (m_node->GetId (), prefix, m_lsdb.GetRouterName (*i));
+        }
+    }
+  for (RouterSetType::const_iterator i = reachable.begin (); i != reachable.end (); ++i)
+    {
+      if (previous.find (*i) == previous.end ())
+        {
+          m_convergenceObserver->FibRouteAdded (m_node->GetId (), prefix, m_lsdb.GetRouterName (*i));
+        }
+    }
+
+  if (reachable.empty ())
+    {
+      m_routedOrigins.erase (prefix);
+    }
+  else
+    {
+      previous = reachable;
+    }
+}
+
+// ========================================
+// === Inherited from CCNxRoutingProtocol
+
+void
+LsrRoutingProtocol::NotifyInterfaceUp (uint32_t interface)
+{
+  NS_LOG_FUNCTION (this << interface);
+  Ptr<CCNxL3Interface> l3interface = m_ccnx->GetInterface (interface);
+  m_interfaces[interface] = l3interface;
+  m_minimumMtu = GetMinimumMtu ();
+}
+
+void
+LsrRoutingProtocol::NotifyInterfaceDown (uint32_t interface)
+{
+  NS_LOG_FUNCTION (this << interface);
+  m_interfaces.erase (interface);
+  m_minimumMtu = GetMinimumMtu ();
+}
+
+void
+LsrRoutingProtocol::SetNode (Ptr<Node> node)
+{
+  NS_LOG_FUNCTION (this << node);
+  NS_ASSERT_MSG ((!m_node), "Re-assigning the node pointer once it was already set.");
+  m_node = node;
+
+  m_ccnx = m_node->GetObject<CCNxL3Protocol> ();
+  NS_ASSERT_MSG (m_ccnx, "Failed to lookup the CCNxL3Protocol on this node");
+
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->RegisterNode (node->GetId ());
+    }
+
+  SetRouterName ();
+}
+
+void
+LsrRoutingProtocol::AddAnchorPrefix (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << prefix);
+
+  AnchorNameMapType::iterator i = m_anchorNames.find (prefix);
+  if (i != m_anchorNames.end ())
+    {
+      i->second++;
+      return;
+    }
+
+  NS_LOG_INFO ("Add anchor prefix " << *prefix);
+  m_anchorNames[prefix] = 1;
+  if (m_convergenceObserver)
+    {
+      // Our own FIB already has the prefix from RegisterPrefix()
+      m_convergenceObserver->AnchorPrefixAdded (prefix, m_routerName);
+      m_convergenceObserver->FibRouteAdded (m_node->GetId (), prefix, m_routerName);
+    }
+  ScheduleOriginate ();
+}
+
+void
+LsrRoutingProtocol::RemoveAnchorPrefix (Ptr<const CCNxName> prefix)
+{
+  NS_LOG_FUNCTION (this << prefix);
+
+  AnchorNameMapType::iterator i = m_anchorNames.find (prefix);
+  if (i == m_anchorNames.end ())
+    {
+      NS_LOG_WARN ("Could not find Anchor name " << *prefix);
+      return;
+    }
+
+  NS_ASSERT_MSG (i->second > 0, "Found a map entry with a 0 ref count");
+  i->second--;
+  if (i->second == 0)
+    {
+      NS_LOG_INFO ("Removing Anchor name " << *prefix);
+      m_anchorNames.erase (i);
+      if (m_convergenceObserver)
+        {
+          m_convergenceObserver->AnchorPrefixRemoved (prefix, m_routerName);
+          m_convergenceObserver->FibRouteRemoved (m_node->GetId (), prefix, m_routerName);
+        }
+      ScheduleOriginate ();
+    }
+}
+
+int64_t
+LsrRoutingProtocol::AssignStreams (int64_t stream)
+{
+  NS_LOG_FUNCTION (this << stream);
+  m_uniformRandomVariable->SetStream (stream);
+  return 1;
+}
+
+void
+LsrRoutingProtocol::PrintNeighborTable (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Neighbor table for " << *m_routerName << std::endl;
+  for (NeighborMapType::const_iterator i = m_neighbors.begin (); i != m_neighbors.end (); ++i)
+    {
+      *stream << "      " << *m_lsdb.GetRouterName (i->first)
+              << " connId " << i->second.connection->GetConnectionId ()
+              << " lastHeard " << i->second.lastHeard.GetSeconds () << std::endl;
+    }
+}
+
+void
+LsrRoutingProtocol::PrintRoutingTable (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Routing stats payloads sent " << m_payloadsSent << " bytes sent " << m_bytesSent
+          << " lsa orig " << m_lsasOriginated << " recv " << m_lsasReceived << " installed " << m_lsasInstalled
+          << " spf visits " << m_spf.GetVisitCount () << std::endl;
+
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Routing table for " << *m_routerName << " lsdb size " << m_lsdb.GetSize () << std::endl;
+  for (RouteMapType::const_iterator i = m_modelFib.begin (); i != m_modelFib.end (); ++i)
+    {
+      *stream << "      " << *i->second << std::endl;
+    }
+
+  PrintAnchorPrefixes (streamWrapper);
+}
+
+void
+LsrRoutingProtocol::PrintAnchorPrefixes (Ptr<OutputStreamWrapper> streamWrapper) const
+{
+  std::ostream *stream = streamWrapper->GetStream ();
+  ns3::LogTimePrinter timePrinter = ns3::LogGetTimePrinter ();
+  (*timePrinter)(*stream);
+  *stream << std::setw (5) << m_node->GetId ();
+  *stream << " Anchor table for " << *m_routerName << std::endl;
+  for (AnchorNameMapType::const_iterator i = m_anchorNames.begin (); i != m_anchorNames.end (); ++i)
+    {
+      *stream << "      " << *i->first << std::endl;
+    }
+}
+
+// ========================================
+// Getters
+
+Time
+LsrRoutingProtocol::GetHelloInterval (void) const
+{
+  return m_helloInterval;
+}
+
+Ptr<const CCNxName>
+LsrRoutingProtocol::GetRouterName (void) const
+{
+  return m_routerName;
+}
+
+Ptr<const CCNxRoute>
+LsrRoutingProtocol::GetRoute (Ptr<const CCNxName> prefix) const
+{
+  RouteMapType::const_iterator i = m_modelFib.find (prefix);
+  if (i != m_modelFib.end ())
+    {
+      return i->second;
+    }
+  return 0;
+}
+
+size_t
+LsrRoutingProtocol::GetLsdbSize (void) const
+{
+  return m_lsdb.GetSize ();
+}
+
+uint64_t
+LsrRoutingProtocol::GetSpfVisitCount (void) const
+{
+  return m_spf.GetVisitCount ();
+}
+
+uint64_t
+LsrRoutingProtocol::GetBytesSent (void) const
+{
+  return m_bytesSent;
+}
+
+Time
+LsrRoutingProtocol::GetCurrentTime (void) const
+{
+  return Simulator::Now ();
+}
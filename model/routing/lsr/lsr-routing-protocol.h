@@ -0,0 +1,422 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_ROUTING_PROTOCOL_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_ROUTING_PROTOCOL_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "ns3/ccnx-l3-protocol.h"
+#include "ns3/ccnx-routing-protocol.h"
+#include "ns3/nstime.h"
+#include "ns3/ccnx-portal.h"
+#include "ns3/ccnx-route.h"
+#include "ns3/timer.h"
+#include "ns3/random-variable-stream.h"
+#include "ns3/lsr-lsa.h"
+#include "ns3/lsr-lsdb.h"
+#include "ns3/lsr-payload.h"
+#include "ns3/lsr-spf.h"
+#include "ns3/nfp-convergence-observer.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \defgroup lsr-routing Link State Routing for CCNx
+ * \ingroup ccnx-routing
+ *
+ * A link state routing protocol for CCNx names.  It is implemented in the class
+ * LsrRoutingProtocol that inherits from CCNxRoutingProtocol, as an alternative to NFP.
+ *
+ * - Each router floods an LSA with its neighbor adjacencies, the cost of each link, and its
+ *   anchor prefixes.  Every router keeps the newest LSA of each router in its link state
+ *   database (LsrLsdb).
+ *
+ * - Each router computes a shortest path tree rooted at itself (LsrSpf).  A link is used only
+ *   if both ends list each other.  When an LSA changes, only the affected part of the tree
+ *   is recomputed.
+ *
+ * - The route to a prefix goes to the closest routers anchoring it, through the first hop
+ *   neighbor on the shortest path.  Equally close anchors give multiple nexthops.
+ *
+ * - All messages are sent as an Interest with payload and a hop limit of 1.  The name is
+ * @code
+ *         ccnx:/name=lsr/name=<router>
+ * @endcode
+ */
+
+/**
+ * \ingroup lsr-routing
+ *
+ * A link state routing protocol with incremental SPF.
+ *
+ * @section neighbors Neighbors
+ *      Every payload is a Hello.  A router sends an empty payload every HelloInterval.  A neighbor
+ *      not heard for NeighborTimeout is removed.  When a neighbor is added or removed, we
+ *      originate a new LSA.  When a neighbor is added, we also send it our whole LSDB.
+ *
+ * @section flooding Flooding
+ *      An LSA newer than the one in our LSDB is installed and broadcast on all interfaces.  If we
+ *      receive an LSA older than ours, we send ours back to the sender.  We originate a new LSA
+ *      LsaOriginateDelay after a change (to batch changes) and every LsaRefreshInterval.
+ *      An LSA not refreshed within LsaMaxAge is removed.
+ *
+ *      An LSA that does not fit in one packet is sent as fragments (LsrLsa::Fragment()).  We keep
+ *      the fragments of the newest seqnum of each router until all have arrived, then handle the
+ *      reassembled LSA like any other.  An incomplete set is dropped after LsaMaxAge; the next
+ *      refresh sends all the fragments again.
+ *
+ * @section spf Incremental SPF
+ *      Each router is an index in m_lsdb and a node in m_spf, where we are index 0.  When an LSA
+ *      is installed or removed, we update the edges to and from its router, then update the
+ *      routes of the prefixes anchored by the routers whose distance or first hop changed, and
+ *      of the prefixes the LSA added or removed.
+ *
+ * @section fib FIB
+ *      Like NFP, we keep the route installed in the forwarder for each prefix (m_modelFib) and
+ *      replace it with CCNxForwarder::RemoveRoute() and CCNxForwarder::AddRoute() when it changes.
+ *
+ * @section convergence Convergence Observer
+ *      The attribute ConvergenceObserver takes the same NfpConvergenceObserver as NFP, so the
+ *      convergence time and control bytes of the two protocols can be compared.
+ *
+ * @see LsrLsa, LsrLsdb, LsrSpf, LsrPayload
+ */
+class LsrRoutingProtocol : public CCNxRoutingProtocol
+{
+public:
+  static TypeId GetTypeId ();
+
+  LsrRoutingProtocol ();
+
+  virtual ~LsrRoutingProtocol ();
+
+  // ========================================
+  // === Inherited from CCNxRoutingProtocol
+
+  virtual void NotifyInterfaceUp (uint32_t interface);
+
+  virtual void NotifyInterfaceDown (uint32_t interface);
+
+  virtual void SetNode (Ptr<Node> node);
+
+  virtual void AddAnchorPrefix (Ptr<const CCNxName> prefix);
+
+  virtual void RemoveAnchorPrefix (Ptr<const CCNxName> prefix);
+
+  virtual int64_t AssignStreams (int64_t stream);
+
+  virtual void PrintNeighborTable (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  virtual void PrintRoutingTable (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  virtual void PrintAnchorPrefixes (Ptr<OutputStreamWrapper> streamWrapper) const;
+
+  // ========================================
+  // === Getters
+
+  /**
+   * Return the HelloInterval
+   */
+  Time GetHelloInterval (void) const;
+
+  /**
+   * Our router name
+   */
+  Ptr<const CCNxName> GetRouterName (void) const;
+
+  /**
+   * The route we installed in the forwarder for `prefix`, or null
+   */
+  Ptr<const CCNxRoute> GetRoute (Ptr<const CCNxName> prefix) const;
+
+  /**
+   * The number of LSAs in our LSDB (including our own)
+   */
+  size_t GetLsdbSize (void) const;
+
+  /**
+   * The number of routers settled by SPF so far, a measure of the SPF work
+   */
+  uint64_t GetSpfVisitCount (void) const;
+
+  /**
+   * The payload bytes we sent on all interfaces
+   */
+  uint64_t GetBytesSent (void) const;
+
+protected:
+  virtual void DoInitialize (void);
+  virtual void DoDispose (void);
+
+private:
+  /**
+   * Set the router name from the node id.  Called from SetNode().
+   */
+  void SetRouterName (void);
+
+  Time CalculateJitteredTime (Time interval, Time jitter);
+
+  void SetTimer (Timer &timer, Time interval, Time jitter);
+
+  /**
+   * Sends a Hello, removes neighbors that timed out, and removes LSAs that aged out.
+   */
+  void HelloTimerExpired (void);
+
+  /**
+   * Originates our LSA again so it does not age out
+   */
+  void RefreshTimerExpired (void);
+
+  /**
+   * Originate our LSA LsaOriginateDelay from now, if not already scheduled
+   */
+  void ScheduleOriginate (void);
+
+  /**
+   * Create a new LSA with our neighbors and anchor prefixes, install and flood it.
+   */
+  void OriginateLsa (void);
+
+  Ptr<LsrPayload> CreatePayload (void);
+
+  /**
+   * The bytes a packet from CreatePacket() adds to the payload: the fixed header, the
+   * Interest with our name and the payload TLV.  Called from SetRouterName().
+   */
+  uint32_t ComputePacketOverhead (void);
+
+  /**
+   * Splits `lsa` into fragments that each fit in an empty payload
+   */
+  std::vector< Ptr<const LsrLsa> > FragmentLsa (Ptr<const LsrLsa> lsa);
+
+  Ptr<CCNxPacket> CreatePacket (Ptr<LsrPayload> payload);
+
+  /**
+   * Send a packet on the broadcast connection of every interface
+   */
+  void Broadcast (Ptr<CCNxPacket> packet);
+
+  /**
+   * Send a packet on one connection
+   */
+  void SendTo (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> connection);
+
+  /**
+   * Broadcast one LSA
+   */
+  void Flood (Ptr<const LsrLsa> lsa);
+
+  /**
+   * Send one LSA on one connection
+   */
+  void SendLsa (Ptr<const LsrLsa> lsa, Ptr<CCNxConnection> connection);
+
+  /**
+   * Send all the LSAs of our LSDB to a new neighbor
+   */
+  void SendDatabase (Ptr<CCNxConnection> connection);
+
+  void ReceiveNotify (Ptr<CCNxPortal> portal);
+
+  void ReceivePayload (Ptr<LsrPayload> payload, Ptr<CCNxConnection> ingressConnection);
+
+  void ReceiveHello (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> ingressConnection);
+
+  void ReceiveLsa (Ptr<const LsrLsa> lsa, Ptr<CCNxConnection> ingressConnection);
+
+  /**
+   * Keeps a fragment until all the fragments of its LSA have arrived, then passes the
+   * reassembled LSA to ReceiveLsa().
+   */
+  void ReceiveFragment (Ptr<const LsrLsa> fragment, Ptr<CCNxConnection> ingressConnection);
+
+  /**
+   * The LSA of a router was installed or removed.  Updates the SPF edges and the routes.
+   *
+   * @param index The router index
+   * @param oldLsa The previous LSA, may be null
+   * @param newLsa The new LSA, null if removed
+   */
+  void LsaChanged (uint32_t index, Ptr<const LsrLsa> oldLsa, Ptr<const LsrLsa> newLsa);
+
+  /**
+   * Sets or removes the SPF edge (from, to) from the LSDB.  The edge exists if the LSA of
+   * `from` has a link to `to` and the LSA of `to` has a link to `from`.
+   */
+  void UpdateEdge (uint32_t from, uint32_t to);
+
+  /**
+   * Computes the route to `prefix` and updates the forwarder if it changed
+   */
+  void UpdateRoute (Ptr<const CCNxName> prefix);
+
+  Time GetCurrentTime (void) const;
+
+  Ptr<Node> m_node;
+  Ptr<CCNxL3Protocol> m_ccnx;
+  Ptr<CCNxPortal> m_portal;
+  Ptr<const CCNxName> m_routerName;
+  Ptr<const CCNxName> m_lsrPrefix;
+  Ptr<UniformRandomVariable> m_uniformRandomVariable;
+
+  Time m_helloInterval;
+  Time m_neighborTimeout;
+  Time m_lsaRefreshInterval;
+  Time m_lsaMaxAge;
+  Time m_lsaOriginateDelay;
+  Time m_jitter;
+  uint32_t m_linkCost;
+  Ptr<NfpConvergenceObserver> m_convergenceObserver;
+
+  Timer m_helloTimer;
+  Timer m_refreshTimer;
+  Timer m_originateTimer;
+
+  typedef std::map< uint32_t, Ptr<CCNxL3Interface> > InterfaceMapType;
+  InterfaceMapType m_interfaces;
+  uint32_t m_minimumMtu;
+  uint32_t m_packetOverhead;
+
+  uint32_t GetMinimumMtu (void) const;
+
+  /**
+   * A 1-hop neighbor.  We keep the first connection we hear it on.
+   */
+  struct Neighbor
+  {
+    Ptr<CCNxConnection> connection;
+    Time lastHeard;
+  };
+
+  /**
+   * Neighbors by router index
+   */
+  typedef std::map< uint32_t, Neighbor > NeighborMapType;
+  NeighborMapType m_neighbors;
+
+  typedef std::map< Ptr<const CCNxName>, uint32_t, CCNxName::isLessPtrCCNxName > AnchorNameMapType;
+
+  /**
+   * Our anchor prefixes with a reference count
+   */
+  AnchorNameMapType m_anchorNames;
+
+  /**
+   * Sequence number of our next LSA
+   */
+  uint32_t m_lsaSeqnum;
+
+  LsrLsdb m_lsdb;
+  LsrSpf m_spf;
+
+  /**
+   * The fragments received so far of the newest LSA seqnum of a router
+   */
+  struct Reassembly
+  {
+    uint32_t seqnum;
+    std::vector< Ptr<const LsrLsa> > fragments;
+    size_t received;
+    Time firstHeard;
+  };
+
+  /**
+   * Reassemblies in progress by router index
+   */
+  typedef std::map< uint32_t, Reassembly > ReassemblyMapType;
+  ReassemblyMapType m_reassembly;
+
+  typedef std::set<uint32_t> RouterSetType;
+  typedef std::map< Ptr<const CCNxName>, RouterSetType, CCNxName::isLessPtrCCNxName > PrefixOriginMapType;
+
+  /**
+   * The other routers anchoring each prefix, from the LSDB
+   */
+  PrefixOriginMapType m_prefixOrigins;
+
+  /**
+   * The anchors of each prefix that we last reported reachable to the convergence observer
+   */
+  PrefixOriginMapType m_routedOrigins;
+
+  /**
+   * Reports the anchors of `prefix` that became reachable or unreachable to the convergence observer
+   */
+  void ReportOrigins (Ptr<const CCNxName> prefix, const RouterSetType &reachable);
+
+  typedef std::map< Ptr<const CCNxName>, Ptr<CCNxRoute>, CCNxName::isLessPtrCCNxName > RouteMapType;
+
+  /**
+   * The routes we installed in the forwarder
+   */
+  RouteMapType m_modelFib;
+
+  uint64_t m_payloadsSent;
+  uint64_t m_bytesSent;
+  uint64_t m_lsasOriginated;
+  uint64_t m_lsasReceived;
+  uint64_t m_lsasInstalled;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_ROUTING_PROTOCOL_H_ */
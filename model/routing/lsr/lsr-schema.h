@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_SCHEMA_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_SCHEMA_H_
+
+#include <stdint.h>
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \ingroup lsr-routing
+ *
+ * TLV type values for the LSR messages.
+ *
+ * Hello message
+ *   There is no explicit hello message.  Any message header counts as a Hello.
+ *   A "Hello Packet" is a message header without any LSAs.
+ *
+ * Message header
+ *   +------------------+------------------+
+ *   | T_MSG            |     length       |
+ *   +------------------+------------------+
+ *   | T_NAME           |     length       |
+ *   +------------------+------------------+
+ *   ~ Router Name Components              ~
+ *   +------------------+------------------+
+ *
+ *   Then comes a list of T_LSA
+ *
+ *   +------------------+------------------+
+ *   | T_LSA            |     length       |
+ *   +------------------+------------------+
+ *   | T_NAME           |     length       |
+ *   +------------------+------------------+
+ *   ~ Origin Router Name                  ~
+ *   +------------------+------------------+
+ *   | T_LSA_SEQNUM     |     4            |
+ *   +------------------+------------------+
+ *   |    seqnum  (uint32)                 |
+ *   +------------------+------------------+
+ *
+ *   An LSA too large for one packet is split into fragments with the same seqnum.  Each
+ *   fragment then has a T_LSA_FRAGMENT, with its 0-based index and the number of fragments.
+ *   An LSA without T_LSA_FRAGMENT is complete.
+ *
+ *   +------------------+------------------+
+ *   | T_LSA_FRAGMENT   |     4            |
+ *   +------------------+------------------+
+ *   | index (uint16)   |  count (uint16)  |
+ *   +------------------+------------------+
+ *
+ *   Then a list of T_LINK followed by a list of T_PREFIX
+ *
+ *   +------------------+------------------+
+ *   | T_LINK           |     length       |
+ *   +------------------+------------------+
+ *   | T_NAME           |     length       |
+ *   +------------------+------------------+
+ *   ~ Neighbor Router Name                ~
+ *   +------------------+------------------+
+ *   | T_LINK_COST      |     4            |
+ *   +------------------+------------------+
+ *   |    cost  (uint32)                   |
+ *   +------------------+------------------+
+ *
+ *   +------------------+------------------+
+ *   | T_PREFIX         |     length       |
+ *   +------------------+------------------+
+ *   | T_NAME           |     length       |
+ *   +------------------+------------------+
+ *   ~ Anchor Prefix                       ~
+ *   +------------------+------------------+
+ */
+class LsrSchema
+{
+public:
+  static const uint16_t T_NAME = 0x0001;
+  static const uint16_t T_MSG = 0x0002;
+  static const uint16_t T_LSA = 0x0003;
+  static const uint16_t T_LSA_SEQNUM = 0x0004;
+  static const uint16_t T_LINK = 0x0005;
+  static const uint16_t T_LINK_COST = 0x0006;
+  static const uint16_t T_PREFIX = 0x0007;
+  static const uint16_t T_LSA_FRAGMENT = 0x0008;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_SCHEMA_H_ */
@@ -0,0 +1,364 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/assert.h"
+
+#include "lsr-spf.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+const uint32_t LsrSpf::INFINITE;
+
+LsrSpf::LsrSpf (uint32_t root)
+  : m_root (root), m_visitCount (0)
+{
+  EnsureNode (root);
+  m_distance[root] = 0;
+}
+
+LsrSpf::~LsrSpf ()
+{
+  // empty
+}
+
+uint32_t
+LsrSpf::GetRoot (void) const
+{
+  return m_root;
+}
+
+void
+LsrSpf::EnsureNode (uint32_t node)
+{
+  NS_ASSERT_MSG (node != INFINITE, "Node id reserved for INFINITE");
+  if (node >= m_distance.size ())
+    {
+      size_t size = node + 1;
+      m_out.resize (size);
+      m_in.resize (size);
+      m_distance.resize (size, INFINITE);
+      m_parent.resize (size, INFINITE);
+      m_firstHop.resize (size, INFINITE);
+      m_children.resize (size);
+    }
+}
+
+void
+LsrSpf::Touch (uint32_t node)
+{
+  if (m_touched.find (node) == m_touched.end ())
+    {
+      m_touched[node] = std::make_pair (m_distance[node], m_firstHop[node]);
+    }
+}
+
+void
+LsrSpf::SetPath (uint32_t node, uint32_t distance, uint32_t parent)
+{
+  Touch (node);
+  if (m_parent[node] != INFINITE)
+    {
+      m_children[m_parent[node]].erase (node);
+    }
+  m_parent[node] = parent;
+  m_children[parent].insert (node);
+  m_distance[node] = distance;
+  m_firstHop[node] = (parent == m_root) ? node : m_firstHop[parent];
+}
+
+void
+LsrSpf::Detach (uint32_t node)
+{
+  Touch (node);
+  if (m_parent[node] != INFINITE)
+    {
+      m_children[m_parent[node]].erase (node);
+    }
+  m_parent[node] = INFINITE;
+  m_distance[node] = INFINITE;
+  m_firstHop[node] = INFINITE;
+}
+
+void
+LsrSpf::SetEdge (uint32_t from, uint32_t to, uint32_t cost)
+{
+  NS_ASSERT_MSG (cost > 0, "Edge cost must be positive");
+  NS_ASSERT_MSG (from != to, "Edge must not be a loop");
+  EnsureNode (from);
+  EnsureNode (to);
+
+  uint32_t oldCost;
+  bool found = FindEdge (from, to, oldCost);
+  if (found && oldCost == cost)
+    {
+      return;
+    }
+
+  m_out[from][to] = cost;
+  m_in[to][from] = cost;
+
+  if (!found || cost < oldCost)
+    {
+      EdgeImproved (from, to);
+    }
+  else
+    {
+      EdgeWorsened (from, to);
+    }
+  FinishUpdate ();
+}
+
+void
+LsrSpf::RemoveEdge (uint32_t from, uint32_t to)
+{
+  uint32_t cost;
+  if (!FindEdge (from, to, cost))
+    {
+      return;
+    }
+
+  m_out[from].erase (to);
+  m_in[to].erase (from);
+  EdgeWorsened (from, to);
+  FinishUpdate ();
+}
+
+bool
+LsrSpf::FindEdge (uint32_t from, uint32_t to, uint32_t &cost) const
+{
+  if (from >= m_out.size ())
+    {
+      return false;
+    }
+
+  EdgeMapType::const_iterator i = m_out[from].find (to);
+  if (i == m_out[from].end ())
+    {
+      return false;
+    }
+  cost = i->second;
+  return true;
+}
+
+void
+LsrSpf::EdgeImproved (uint32_t from, uint32_t to)
+{
+  if (m_distance[from] == INFINITE)
+    {
+      return;
+    }
+
+  uint32_t distance = m_distance[from] + m_out[from][to];
+  if (distance < m_distance[to])
+    {
+      SetPath (to, distance, from);
+      HeapType heap;
+      heap.push (HeapEntryType (distance, to));
+      RunDijkstra (heap);
+    }
+}
+
+void
+LsrSpf::EdgeWorsened (uint32_t from, uint32_t to)
+{
+  // If the edge is not in the tree, no shortest path used it
+  if (m_parent[to] != from)
+    {
+      return;
+    }
+
+  // Detach the subtree below the edge
+  std::vector<uint32_t> subtree;
+  subtree.push_back (to);
+  for (size_t i = 0; i < subtree.size (); i++)
+    {
+      const std::set<uint32_t> &children = m_children[subtree[i]];
+      subtree.insert (subtree.end (), children.begin (), children.end ());
+    }
+
+  std::set<uint32_t> detached (subtree.begin (), subtree.end ());
+  for (size_t i = 0; i < subtree.size (); i++)
+    {
+      Detach (subtree[i]);
+    }
+
+  // Seed each detached node from its best neighbor outside the subtree
+  HeapType heap;
+  for (size_t i = 0; i < subtree.size (); i++)
+    {
+      uint32_t node = subtree[i];
+      for (EdgeMapType::const_iterator j = m_in[node].begin (); j != m_in[node].end (); ++j)
+        {
+          uint32_t neighbor = j->first;
+          if (detached.find (neighbor) == detached.end () && m_distance[neighbor] != INFINITE
+              && m_distance[neighbor] + j->second < m_distance[node])
+            {
+              SetPath (node, m_distance[neighbor] + j->second, neighbor);
+            }
+        }
+
+      if (m_distance[node] != INFINITE)
+        {
+          heap.push (HeapEntryType (m_distance[node], node));
+        }
+    }
+
+  RunDijkstra (heap);
+}
+
+void
+LsrSpf::RunDijkstra (HeapType &heap)
+{
+  while (!heap.empty ())
+    {
+      HeapEntryType top = heap.top ();
+      heap.pop ();
+
+      uint32_t node = top.second;
+      if (top.first != m_distance[node])
+        {
+          // stale entry, the node was relaxed again
+          continue;
+        }
+
+      m_visitCount++;
+      for (EdgeMapType::const_iterator i = m_out[node].begin (); i != m_out[node].end (); ++i)
+        {
+          uint32_t distance = top.first + i->second;
+          if (distance < m_distance[i->first])
+            {
+              SetPath (i->first, distance, node);
+              heap.push (HeapEntryType (distance, i->first));
+            }
+        }
+    }
+}
+
+void
+LsrSpf::FinishUpdate (void)
+{
+  for (std::map<uint32_t, std::pair<uint32_t, uint32_t> >::const_iterator i = m_touched.begin (); i != m_touched.end (); ++i)
+    {
+      uint32_t node = i->first;
+      if (i->second.first != m_distance[node] || i->second.second != m_firstHop[node])
+        {
+          m_changed.insert (node);
+        }
+    }
+  m_touched.clear ();
+}
+
+void
+LsrSpf::Recompute (void)
+{
+  for (uint32_t node = 0; node < m_distance.size (); node++)
+    {
+      if (node != m_root)
+        {
+          Detach (node);
+        }
+      m_children[node].clear ();
+    }
+
+  HeapType heap;
+  heap.push (HeapEntryType (0, m_root));
+  RunDijkstra (heap);
+  FinishUpdate ();
+}
+
+bool
+LsrSpf::IsReachable (uint32_t node) const
+{
+  return GetDistance (node) != INFINITE;
+}
+
+uint32_t
+LsrSpf::GetDistance (uint32_t node) const
+{
+  return node < m_distance.size () ? m_distance[node] : INFINITE;
+}
+
+uint32_t
+LsrSpf::GetParent (uint32_t node) const
+{
+  return node < m_parent.size () ? m_parent[node] : INFINITE;
+}
+
+uint32_t
+LsrSpf::GetFirstHop (uint32_t node) const
+{
+  return node < m_firstHop.size () ? m_firstHop[node] : INFINITE;
+}
+
+uint32_t
+LsrSpf::GetNodeCount (void) const
+{
+  return m_distance.size ();
+}
+
+std::vector<uint32_t>
+LsrSpf::TakeChanged (void)
+{
+  std::vector<uint32_t> changed (m_changed.begin (), m_changed.end ());
+  m_changed.clear ();
+  return changed;
+}
+
+uint64_t
+LsrSpf::GetVisitCount (void) const
+{
+  return m_visitCount;
+}
@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_LSR_LSR_SPF_H_
+#define CCNS3SIM_MODEL_ROUTING_LSR_LSR_SPF_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include <map>
+#include <set>
+#include <vector>
+#include <queue>
+#include <functional>
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * \ingroup lsr-routing
+ *
+ * A shortest path tree from a root node that is updated incrementally as edges change.
+ *
+ * Nodes are small integers (LsrLsdb assigns one per router).  Edges are directed with a
+ * positive cost.  Each node has one parent in the tree, and its first hop is the child of
+ * the root on the path to the node.
+ *
+ * - When an edge is added or its cost goes down, only the nodes whose distance improves are
+ *   visited (a Dijkstra started at the head of the edge).
+ * - When an edge is removed or its cost goes up, and the edge is in the tree, the subtree
+ *   below it is detached.  Each detached node is seeded from its best neighbor outside the
+ *   subtree and a Dijkstra runs over the subtree only.
+ * - Otherwise nothing is recomputed.
+ *
+ * After each change, TakeChanged() returns the nodes whose distance or first hop changed,
+ * so the routing protocol only updates routes to those nodes.
+ *
+ * Example:
+ * @code
+ * {
+ *    LsrSpf spf (0);
+ *    spf.SetEdge (0, 1, 1);
+ *    spf.SetEdge (1, 2, 1);
+ *    spf.GetDistance (2);    // 2
+ *    spf.GetFirstHop (2);    // 1
+ * }
+ * @endcode
+ */
+class LsrSpf
+{
+public:
+  /**
+   * The distance of an unreachable node, and the parent or first hop of the root
+   * and of unreachable nodes.
+   */
+  static const uint32_t INFINITE = 0xFFFFFFFF;
+
+  /**
+   * @param root The node at the root of the tree
+   */
+  LsrSpf (uint32_t root);
+
+  virtual ~LsrSpf ();
+
+  uint32_t GetRoot (void) const;
+
+  /**
+   * Adds the edge (from, to) or changes its cost, and updates the tree.
+   *
+   * @param cost A positive cost
+   */
+  void SetEdge (uint32_t from, uint32_t to, uint32_t cost);
+
+  /**
+   * Removes the edge (from, to), if it exists, and updates the tree.
+   */
+  void RemoveEdge (uint32_t from, uint32_t to);
+
+  /**
+   * Looks up the edge (from, to)
+   *
+   * @param [out] cost The cost of the edge, if found
+   * @return true if the edge exists
+   */
+  bool FindEdge (uint32_t from, uint32_t to, uint32_t &cost) const;
+
+  /**
+   * Recomputes the whole tree (a full Dijkstra).  The result is the same as the incremental
+   * updates, up to the choice among equal cost parents.
+   */
+  void Recompute (void);
+
+  bool IsReachable (uint32_t node) const;
+
+  /**
+   * @return The distance from the root, or INFINITE
+   */
+  uint32_t GetDistance (uint32_t node) const;
+
+  /**
+   * @return The parent in the tree, or INFINITE
+   */
+  uint32_t GetParent (uint32_t node) const;
+
+  /**
+   * @return The child of the root on the path to `node`, or INFINITE
+   */
+  uint32_t GetFirstHop (uint32_t node) const;
+
+  /**
+   * One more than the largest node used in an edge (or the root)
+   */
+  uint32_t GetNodeCount (void) const;
+
+  /**
+   * Returns the nodes whose distance or first hop changed since the last call, in increasing order.
+   */
+  std::vector<uint32_t> TakeChanged (void);
+
+  /**
+   * The number of nodes settled by Dijkstra so far, a measure of the SPF work
+   */
+  uint64_t GetVisitCount (void) const;
+
+private:
+  typedef std::map<uint32_t, uint32_t> EdgeMapType;
+  typedef std::pair<uint32_t, uint32_t> HeapEntryType;
+  typedef std::priority_queue< HeapEntryType, std::vector<HeapEntryType>, std::greater<HeapEntryType> > HeapType;
+
+  void EnsureNode (uint32_t node);
+
+  /**
+   * Saves the distance and first hop of `node` before its first change in this update
+   */
+  void Touch (uint32_t node);
+
+  /**
+   * Moves `node` under `parent` in the tree at `distance`
+   */
+  void SetPath (uint32_t node, uint32_t distance, uint32_t parent);
+
+  /**
+   * Removes `node` from the tree
+   */
+  void Detach (uint32_t node);
+
+  /**
+   * The cost of the edge (from, to) went down or the edge is new
+   */
+  void EdgeImproved (uint32_t from, uint32_t to);
+
+  /**
+   * The cost of the edge (from, to) went up or the edge was removed
+   */
+  void EdgeWorsened (uint32_t from, uint32_t to);
+
+  void RunDijkstra (HeapType &heap);
+
+  /**
+   * Moves the touched nodes that changed to m_changed
+   */
+  void FinishUpdate (void);
+
+  uint32_t m_root;
+
+  std::vector<EdgeMapType> m_out;
+  std::vector<EdgeMapType> m_in;
+
+  std::vector<uint32_t> m_distance;
+  std::vector<uint32_t> m_parent;
+  std::vector<uint32_t> m_firstHop;
+  std::vector< std::set<uint32_t> > m_children;
+
+  /**
+   * (distance, first hop) before the current update, by node
+   */
+  std::map<uint32_t, std::pair<uint32_t, uint32_t> > m_touched;
+
+  std::set<uint32_t> m_changed;
+  uint64_t m_visitCount;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_LSR_LSR_SPF_H_ */
@@ -68,6 +68,7 @@ NfpAdvertise::NfpAdvertise ()
 {
   m_anchorSeqnum = 0;
   m_distance = 0;
+  m_serializedSize = 0;
 }
 
 NfpAdvertise::NfpAdvertise (Ptr<const CCNxName> anchorName, Ptr<const CCNxName> prefix, uint32_t anchorSeqnum, uint16_t distance)
@@ -78,6 +79,7 @@ NfpAdvertise::NfpAdvertise (Ptr<const CCNxName> anchorName, Ptr<const CCNxName>
   m_prefixCodec.SetHeader (prefix);
   m_anchorSeqnum = anchorSeqnum;
   m_distance = distance;
+  m_serializedSize = 0;
 }
 
 NfpAdvertise::NfpAdvertise (NfpAdvertise const &copy, uint16_t linkcost)
@@ -90,6 +92,9 @@ NfpAdvertise::NfpAdvertise (NfpAdvertise const &copy, uint16_t linkcost)
   uint32_t newDistance = (uint32_t) copy.GetDistance () + linkcost;
   NS_ASSERT_MSG (newDistance <= std::numeric_limits<uint16_t>::max (), "distance + linkcost exceed 16-bits");
   m_distance = (uint16_t) newDistance;
+
+  // same names, so same encoded size
+  m_serializedSize = copy.m_serializedSize;
 }
 
 NfpAdvertise::~NfpAdvertise ()
@@ -124,13 +129,19 @@ NfpAdvertise::GetDistance (void) const
 uint32_t
 NfpAdvertise::GetSerializedSize (void) const
 {
-  uint32_t size = CCNxTlv::GetTLSize ();
+  // The names are immutable, so compute the size once.  It is asked for several
+  // times per message when packing a payload.
+  if (m_serializedSize == 0)
+    {
+      uint32_t size = CCNxTlv::GetTLSize ();
 
-  size += m_anchorNameCodec.GetSerializedSize ();
-  size += m_prefixCodec.GetSerializedSize ();
-  size += CCNxTlv::GetTLSize ();
-  size += sizeof(uint32_t) + sizeof(uint16_t);
-  return size;
+      size += m_anchorNameCodec.GetSerializedSize ();
+      size += m_prefixCodec.GetSerializedSize ();
+      size += CCNxTlv::GetTLSize ();
+      size += sizeof(uint32_t) + sizeof(uint16_t);
+      m_serializedSize = size;
+    }
+  return m_serializedSize;
 }
 
 void
@@ -168,6 +179,7 @@ NfpAdvertise::Deserialize (Buffer::Iterator start)
   uint16_t outerLength = CCNxTlv::ReadLength (start);
 
   NS_ASSERT_MSG (outerType == NfpSchema::T_ADV, "Outer type must be T_ADV");
+  m_serializedSize = 0;
 
   uint32_t anchorSize = m_anchorNameCodec.Deserialize (start);
   bytesRead += anchorSize;
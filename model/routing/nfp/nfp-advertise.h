@@ -135,6 +135,11 @@ protected:
 
   uint32_t m_anchorSeqnum;
   uint16_t m_distance;
+
+  /**
+   * Cached result of GetSerializedSize(), 0 if not yet computed.
+   */
+  mutable uint32_t m_serializedSize;
 };
 
 std::ostream & operator << (std::ostream & os, NfpAdvertise const & header);
@@ -67,6 +67,7 @@ NfpAnchorAdvertisement::NfpAnchorAdvertisement (Ptr<NfpAdvertise> advertise, Ptr
 {
   NS_LOG_FUNCTION (this << advertise << ingressConnection->GetConnectionId ());
 
+  m_readvertisementLinkcost = 0;
   m_anchorName = advertise->GetAnchorName ();
   m_prefix = advertise->GetPrefix ();
   m_equalCostPaths = Create<CCNxRoute> (advertise->GetPrefix ());
@@ -165,6 +166,7 @@ NfpAnchorAdvertisement::Replace (Ptr<NfpAdvertise> advertise, Ptr<CCNxConnection
 {
   NS_LOG_FUNCTION (this << advertise << ingressConnection->GetConnectionId ());
   m_bestAdvertisement = advertise;
+  m_readvertisement = 0;
   ClearEqualCostPaths ();
 
   m_equalCostPaths->AddNexthop (Create<CCNxRouteEntry> (advertise->GetPrefix (), advertise->GetDistance (), ingressConnection));
@@ -218,6 +220,31 @@ NfpAnchorAdvertisement::GetBestAdvertisement (void) const
   return m_bestAdvertisement;
 }
 
+Ptr<NfpAdvertise>
+NfpAnchorAdvertisement::GetReadvertisement (uint16_t linkcost)
+{
+  if (!m_readvertisement || m_readvertisementLinkcost != linkcost)
+    {
+      m_readvertisement = Create<NfpAdvertise> (*m_bestAdvertisement, linkcost);
+      m_readvertisementLinkcost = linkcost;
+    }
+  return m_readvertisement;
+}
+
+Time
+NfpAnchorAdvertisement::GetEarliestExpiryTime (void) const
+{
+  Time earliest = Time::Max ();
+  for (ExpiryTimeMap::const_iterator i = m_expiryTimes.begin (); i != m_expiryTimes.end (); ++i)
+    {
+      if (i->second < earliest)
+        {
+          earliest = i->second;
+        }
+    }
+  return earliest;
+}
+
 void
 NfpAnchorAdvertisement::LogState (void) const
 {
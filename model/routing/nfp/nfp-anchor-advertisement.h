@@ -143,6 +143,26 @@ public:
    */
   Ptr<const NfpAdvertise> GetBestAdvertisement (void) const;
 
+  /**
+   * Returns the advertisement we send to our neighbors for this anchor: the best advertisement
+   * with the distance increased by `linkcost`.
+   *
+   * The result is cached until the best advertisement changes, so the periodic re-advertisement
+   * of a stable route re-uses the same message.  The caller must not modify it.
+   *
+   * @param linkcost The amount by which to increase the distance
+   * @return The advertisement to send
+   */
+  Ptr<NfpAdvertise> GetReadvertisement (uint16_t linkcost);
+
+  /**
+   * Returns the earliest time at which one of the nexthops expires.  Until then,
+   * GetNexthopCount() can only change due to a call to one of our update methods.
+   *
+   * @return The earliest nexthop expiry time, or Time::Max() if there are no nexthops.
+   */
+  Time GetEarliestExpiryTime (void) const;
+
   /**
    * Remove the Connection from the nexthop list.
    *
@@ -190,6 +210,12 @@ protected:
   Ptr<const CCNxName> m_prefix;
   Ptr<NfpAdvertise> m_bestAdvertisement;
 
+  /**
+   * The cached result of GetReadvertisement(), cleared when m_bestAdvertisement changes.
+   */
+  Ptr<NfpAdvertise> m_readvertisement;
+  uint16_t m_readvertisementLinkcost;
+
   Time m_lastChangeTime;
 
   /**
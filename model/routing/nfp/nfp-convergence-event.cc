@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <cmath>
+#include "nfp-convergence-event.h"
+#include "ns3/assert.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NfpConvergenceEvent::NfpConvergenceEvent (EventType type, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName,
+                                          Time start, uint32_t nodeCount, uint64_t bytesAtStart)
+  : m_type (type), m_prefix (prefix), m_anchorName (anchorName), m_start (start), m_nodeCount (nodeCount),
+    m_bytesAtStart (bytesAtStart), m_bytesAtLastUpdate (bytesAtStart)
+{
+}
+
+NfpConvergenceEvent::EventType
+NfpConvergenceEvent::GetType (void) const
+{
+  return m_type;
+}
+
+Ptr<const CCNxName>
+NfpConvergenceEvent::GetPrefix (void) const
+{
+  return m_prefix;
+}
+
+Ptr<const CCNxName>
+NfpConvergenceEvent::GetAnchorName (void) const
+{
+  return m_anchorName;
+}
+
+Time
+NfpConvergenceEvent::GetStartTime (void) const
+{
+  return m_start;
+}
+
+uint32_t
+NfpConvergenceEvent::GetNodeCount (void) const
+{
+  return m_nodeCount;
+}
+
+bool
+NfpConvergenceEvent::NodeUpdated (uint32_t nodeId, Time now, uint64_t bytesNow)
+{
+  NS_ASSERT_MSG (now >= m_start, "FIB update before the start of the event");
+
+  if (!m_updatedNodes.insert (nodeId).second)
+    {
+      return false;
+    }
+
+  m_delays.push_back (now - m_start);
+  m_bytesAtLastUpdate = bytesNow;
+  return true;
+}
+
+uint32_t
+NfpConvergenceEvent::GetUpdatedCount (void) const
+{
+  return m_updatedNodes.size ();
+}
+
+bool
+NfpConvergenceEvent::IsConverged (void) const
+{
+  return m_updatedNodes.size () >= m_nodeCount;
+}
+
+Time
+NfpConvergenceEvent::GetConvergenceTime (void) const
+{
+  if (m_delays.empty ())
+    {
+      return Time (0);
+    }
+  return m_delays.back ();
+}
+
+Time
+NfpConvergenceEvent::GetDelayPercentile (double percentile) const
+{
+  NS_ASSERT_MSG (percentile >= 0.0 && percentile <= 100.0, "Percentile must be in [0, 100]");
+  if (m_delays.empty ())
+    {
+      return Time (0);
+    }
+
+  // m_delays is already sorted because updates arrive in time order
+  size_t rank = (size_t) std::ceil (percentile / 100.0 * m_delays.size ());
+  if (rank > 0)
+    {
+      rank--;
+    }
+  return m_delays[rank];
+}
+
+uint64_t
+NfpConvergenceEvent::GetControlBytes (void) const
+{
+  return m_bytesAtLastUpdate - m_bytesAtStart;
+}
+
+std::ostream &
+ns3::ccnx::operator<< (std::ostream &os, const NfpConvergenceEvent &event)
+{
+  os << (event.m_type == NfpConvergenceEvent::ADD ? "add" : "withdraw")
+     << " prefix " << *event.m_prefix
+     << " start " << event.m_start.GetSeconds ()
+     << " nodes " << event.GetUpdatedCount () << "/" << event.m_nodeCount
+     << " converged " << (event.IsConverged () ? "yes" : "no")
+     << " min " << event.GetDelayPercentile (0).GetSeconds ()
+     << " median " << event.GetDelayPercentile (50).GetSeconds ()
+     << " p90 " << event.GetDelayPercentile (90).GetSeconds ()
+     << " max " << event.GetConvergenceTime ().GetSeconds ()
+     << " bytes " << event.GetControlBytes ();
+  return os;
+}
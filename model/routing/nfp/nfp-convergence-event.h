@@ -0,0 +1,172 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_EVENT_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_EVENT_H_
+
+#include <ostream>
+#include <set>
+#include <vector>
+#include <stdint.h>
+
+#include "ns3/ccnx-name.h"
+#include "ns3/simple-ref-count.h"
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * One routing change tracked by NfpConvergenceObserver: an anchor added or withdrew a
+ * (prefix, anchorName) pair at GetStartTime().  Each node reports when its FIB reflects the
+ * change, and the event is converged once every node has reported.
+ *
+ * The per-node delays (FIB update time minus start time) form the convergence-time
+ * distribution of the event.
+ */
+class NfpConvergenceEvent : public SimpleRefCount<NfpConvergenceEvent>
+{
+public:
+  typedef enum
+  {
+    ADD,
+    WITHDRAW
+  } EventType;
+
+  /**
+   * @param type ADD or WITHDRAW
+   * @param prefix The anchor prefix
+   * @param anchorName The router name of the anchor
+   * @param start The simulation time of the change at the anchor
+   * @param nodeCount The number of nodes that must update their FIB
+   * @param bytesAtStart The observer's control byte count at the start
+   */
+  NfpConvergenceEvent (EventType type, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName,
+                       Time start, uint32_t nodeCount, uint64_t bytesAtStart);
+
+  EventType GetType (void) const;
+  Ptr<const CCNxName> GetPrefix (void) const;
+  Ptr<const CCNxName> GetAnchorName (void) const;
+  Time GetStartTime (void) const;
+  uint32_t GetNodeCount (void) const;
+
+  /**
+   * Records that `nodeId` updated its FIB for this event.  Only the first update from
+   * each node counts.
+   *
+   * @param nodeId The node that updated its FIB
+   * @param now The time of the update
+   * @param bytesNow The observer's control byte count at the update
+   * @return true if this was the first update from the node
+   */
+  bool NodeUpdated (uint32_t nodeId, Time now, uint64_t bytesNow);
+
+  /**
+   * The number of nodes that have updated their FIB
+   */
+  uint32_t GetUpdatedCount (void) const;
+
+  /**
+   * True when every node has updated its FIB
+   */
+  bool IsConverged (void) const;
+
+  /**
+   * The delay of the last node to update its FIB so far.  Once converged, this is the
+   * convergence time of the event.
+   */
+  Time GetConvergenceTime (void) const;
+
+  /**
+   * The per-node delay at the given percentile (nearest rank) of the nodes that have updated.
+   *
+   * @param percentile In the range [0, 100]
+   * @return The delay, or 0 if no node has updated
+   */
+  Time GetDelayPercentile (double percentile) const;
+
+  /**
+   * The control bytes sent (by all observed nodes) between the start and the last FIB update.
+   * Concurrent events and Hello messages share the same bytes, so this is an upper bound.
+   */
+  uint64_t GetControlBytes (void) const;
+
+  friend std::ostream &operator<< (std::ostream &os, const NfpConvergenceEvent &event);
+
+private:
+  EventType m_type;
+  Ptr<const CCNxName> m_prefix;
+  Ptr<const CCNxName> m_anchorName;
+  Time m_start;
+  uint32_t m_nodeCount;
+  uint64_t m_bytesAtStart;
+  uint64_t m_bytesAtLastUpdate;
+
+  std::set<uint32_t> m_updatedNodes;
+
+  /**
+   * The per-node delays, in order of update (so non-decreasing)
+   */
+  std::vector<Time> m_delays;
+};
+
+std::ostream &operator<< (std::ostream &os, const NfpConvergenceEvent &event);
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_EVENT_H_ */
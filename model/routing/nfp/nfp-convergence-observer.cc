@@ -0,0 +1,252 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "nfp-convergence-observer.h"
+#include "ns3/log.h"
+#include "ns3/assert.h"
+#include "ns3/simulator.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpConvergenceObserver");
+NS_OBJECT_ENSURE_REGISTERED (NfpConvergenceObserver);
+
+TypeId
+NfpConvergenceObserver::GetTypeId ()
+{
+  static TypeId tid = TypeId ("ns3::ccnx::NfpConvergenceObserver")
+    .SetParent<Object> ()
+    .SetGroupName ("CCNx")
+    .AddConstructor<NfpConvergenceObserver> ();
+  return tid;
+}
+
+NfpConvergenceObserver::NfpConvergenceObserver ()
+  : m_controlBytes (0)
+{
+}
+
+NfpConvergenceObserver::~NfpConvergenceObserver ()
+{
+}
+
+void
+NfpConvergenceObserver::RegisterNode (uint32_t nodeId)
+{
+  NS_LOG_FUNCTION (this << nodeId);
+  m_nodes.insert (nodeId);
+}
+
+uint32_t
+NfpConvergenceObserver::GetNodeCount (void) const
+{
+  return m_nodes.size ();
+}
+
+void
+NfpConvergenceObserver::AnchorPrefixAdded (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  OpenEvent (NfpConvergenceEvent::ADD, prefix, anchorName);
+}
+
+void
+NfpConvergenceObserver::AnchorPrefixRemoved (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  OpenEvent (NfpConvergenceEvent::WITHDRAW, prefix, anchorName);
+}
+
+void
+NfpConvergenceObserver::FibRouteAdded (uint32_t nodeId, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  UpdateEvent (NfpConvergenceEvent::ADD, nodeId, prefix, anchorName);
+}
+
+void
+NfpConvergenceObserver::FibRouteRemoved (uint32_t nodeId, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  UpdateEvent (NfpConvergenceEvent::WITHDRAW, nodeId, prefix, anchorName);
+}
+
+void
+NfpConvergenceObserver::ControlBytesSent (uint64_t bytes)
+{
+  m_controlBytes += bytes;
+}
+
+uint64_t
+NfpConvergenceObserver::GetControlBytes (void) const
+{
+  return m_controlBytes;
+}
+
+size_t
+NfpConvergenceObserver::GetEventCount (void) const
+{
+  return m_events.size ();
+}
+
+size_t
+NfpConvergenceObserver::GetOpenEventCount (void) const
+{
+  return m_openEvents.size ();
+}
+
+Ptr<const NfpConvergenceEvent>
+NfpConvergenceObserver::GetEvent (size_t index) const
+{
+  NS_ASSERT_MSG (index < m_events.size (), "Event index out of range " << index);
+  return m_events[index];
+}
+
+void
+NfpConvergenceObserver::OpenEvent (NfpConvergenceEvent::EventType type, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  NS_LOG_FUNCTION (this << *prefix << *anchorName);
+
+  Ptr<NfpConvergenceEvent> event = Create<NfpConvergenceEvent> (type, prefix, anchorName, Simulator::Now (),
+                                                                m_nodes.size (), m_controlBytes);
+  m_events.push_back (event);
+
+  // A newer event supersedes an unconverged one for the same pair
+  m_openEvents[KeyType (prefix, anchorName)] = event;
+}
+
+void
+NfpConvergenceObserver::UpdateEvent (NfpConvergenceEvent::EventType type, uint32_t nodeId,
+                                     Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  OpenEventMapType::iterator i = m_openEvents.find (KeyType (prefix, anchorName));
+  if (i == m_openEvents.end () || i->second->GetType () != type)
+    {
+      // A FIB change not caused by an anchor change, e.g. a neighbor going down
+      return;
+    }
+
+  Ptr<NfpConvergenceEvent> event = i->second;
+  if (event->NodeUpdated (nodeId, Simulator::Now (), m_controlBytes) && event->IsConverged ())
+    {
+      NS_LOG_INFO ("Converged " << *event);
+      m_openEvents.erase (i);
+    }
+}
+
+void
+NfpConvergenceObserver::PrintDistribution (std::ostream &os, NfpConvergenceEvent::EventType type) const
+{
+  std::vector<Time> times;
+  uint64_t bytes = 0;
+  size_t total = 0;
+  for (size_t i = 0; i < m_events.size (); i++)
+    {
+      if (m_events[i]->GetType () != type)
+        {
+          continue;
+        }
+      total++;
+      if (m_events[i]->IsConverged ())
+        {
+          times.push_back (m_events[i]->GetConvergenceTime ());
+          bytes += m_events[i]->GetControlBytes ();
+        }
+    }
+
+  os << (type == NfpConvergenceEvent::ADD ? "add" : "withdraw")
+     << " events " << total << " converged " << times.size ();
+
+  if (!times.empty ())
+    {
+      std::sort (times.begin (), times.end ());
+      Time sum (0);
+      for (size_t i = 0; i < times.size (); i++)
+        {
+          sum += times[i];
+        }
+
+      // nearest rank
+      size_t median = (size_t) std::ceil (0.50 * times.size ()) - 1;
+      size_t p90 = (size_t) std::ceil (0.90 * times.size ()) - 1;
+      size_t p99 = (size_t) std::ceil (0.99 * times.size ()) - 1;
+
+      os << " min " << times.front ().GetSeconds ()
+         << " mean " << sum.GetSeconds () / times.size ()
+         << " median " << times[median].GetSeconds ()
+         << " p90 " << times[p90].GetSeconds ()
+         << " p99 " << times[p99].GetSeconds ()
+         << " max " << times.back ().GetSeconds ()
+         << " bytes/event " << bytes / times.size ();
+    }
+  os << std::endl;
+}
+
+void
+NfpConvergenceObserver::Print (std::ostream &os) const
+{
+  os << "NFP convergence nodes " << m_nodes.size () << " control bytes " << m_controlBytes << std::endl;
+  PrintDistribution (os, NfpConvergenceEvent::ADD);
+  PrintDistribution (os, NfpConvergenceEvent::WITHDRAW);
+}
+
+void
+NfpConvergenceObserver::PrintEvents (std::ostream &os) const
+{
+  for (size_t i = 0; i < m_events.size (); i++)
+    {
+      os << *m_events[i] << std::endl;
+    }
+}
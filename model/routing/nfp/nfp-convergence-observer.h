@@ -0,0 +1,218 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_OBSERVER_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_OBSERVER_H_
+
+#include <map>
+#include <ostream>
+#include <set>
+#include <utility>
+#include <vector>
+
+#include "ns3/object.h"
+#include "ns3/nstime.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/nfp-convergence-event.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * Measures NFP routing convergence across all nodes of a simulation.  One observer is shared by
+ * every NfpRoutingProtocol through the `ConvergenceObserver` attribute.
+ *
+ * When an anchor adds or withdraws a prefix (AddAnchorPrefix() / RemoveAnchorPrefix()), the
+ * observer opens an NfpConvergenceEvent for the (prefix, anchorName) pair.  Each node reports
+ * when its FIB reflects the change (AddAnchorToFib() / RemoveAnchorFromFib()), and the event is
+ * closed once every registered node has reported.  The observer also counts the control bytes
+ * sent by all nodes, so each event carries the bytes spent until its last FIB update.
+ *
+ * Example:
+ * @code
+ * {
+ *    Ptr<NfpConvergenceObserver> observer = CreateObject<NfpConvergenceObserver> ();
+ *    NfpRoutingHelper nfpHelper;
+ *    nfpHelper.Set ("ConvergenceObserver", PointerValue (observer));
+ *    ...
+ *    Simulator::Run ();
+ *    observer->Print (std::cout);
+ * }
+ * @endcode
+ */
+class NfpConvergenceObserver : public Object
+{
+public:
+  static TypeId GetTypeId ();
+
+  NfpConvergenceObserver ();
+  virtual ~NfpConvergenceObserver ();
+
+  /**
+   * Adds a node that must update its FIB for an event to converge.  Called by
+   * NfpRoutingProtocol::SetNode().
+   */
+  void RegisterNode (uint32_t nodeId);
+
+  /**
+   * The number of registered nodes
+   */
+  uint32_t GetNodeCount (void) const;
+
+  /**
+   * An anchor started advertising `prefix`.  Opens an ADD event.  An open event for the
+   * same (prefix, anchorName) is left unconverged.
+   */
+  void AnchorPrefixAdded (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * An anchor withdrew `prefix`.  Opens a WITHDRAW event.
+   */
+  void AnchorPrefixRemoved (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * `nodeId` installed a route to (prefix, anchorName) in its FIB.
+   */
+  void FibRouteAdded (uint32_t nodeId, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * `nodeId` removed the route to (prefix, anchorName) from its FIB.
+   */
+  void FibRouteRemoved (uint32_t nodeId, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * A node sent `bytes` of NFP payload
+   */
+  void ControlBytesSent (uint64_t bytes);
+
+  /**
+   * The total control bytes sent by all nodes
+   */
+  uint64_t GetControlBytes (void) const;
+
+  /**
+   * The number of events, converged or not
+   */
+  size_t GetEventCount (void) const;
+
+  /**
+   * The number of events not yet converged
+   */
+  size_t GetOpenEventCount (void) const;
+
+  /**
+   * @param index In the range [0, GetEventCount())
+   * @return The events in the order they started
+   */
+  Ptr<const NfpConvergenceEvent> GetEvent (size_t index) const;
+
+  /**
+   * Prints the convergence-time distribution over all converged events, one line
+   * per event type.
+   */
+  void Print (std::ostream &os) const;
+
+  /**
+   * Prints one line per event
+   */
+  void PrintEvents (std::ostream &os) const;
+
+private:
+  typedef std::pair< Ptr<const CCNxName>, Ptr<const CCNxName> > KeyType;
+
+  struct KeyLess
+  {
+    bool operator() (const KeyType &a, const KeyType &b) const
+    {
+      if (*a.first < *b.first)
+        {
+          return true;
+        }
+      if (*b.first < *a.first)
+        {
+          return false;
+        }
+      return *a.second < *b.second;
+    }
+  };
+
+  typedef std::map< KeyType, Ptr<NfpConvergenceEvent>, KeyLess > OpenEventMapType;
+
+  void OpenEvent (NfpConvergenceEvent::EventType type, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  void UpdateEvent (NfpConvergenceEvent::EventType type, uint32_t nodeId, Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  void PrintDistribution (std::ostream &os, NfpConvergenceEvent::EventType type) const;
+
+  std::set<uint32_t> m_nodes;
+  uint64_t m_controlBytes;
+
+  /**
+   * All events in the order they started
+   */
+  std::vector< Ptr<NfpConvergenceEvent> > m_events;
+
+  /**
+   * The unconverged events, by (prefix, anchorName)
+   */
+  OpenEventMapType m_openEvents;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_CONVERGENCE_OBSERVER_H_ */
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "nfp-flap-damping.h"
+#include "ns3/assert.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NfpFlapDamping::NfpFlapDamping ()
+{
+  SetParameters (Seconds (15), 1000.0, 2000.0, 750.0, 12000.0);
+}
+
+NfpFlapDamping::NfpFlapDamping (Time halfLife, double penalty, double suppress, double reuse, double maxPenalty)
+{
+  SetParameters (halfLife, penalty, suppress, reuse, maxPenalty);
+}
+
+NfpFlapDamping::~NfpFlapDamping ()
+{
+}
+
+void
+NfpFlapDamping::SetParameters (Time halfLife, double penalty, double suppress, double reuse, double maxPenalty)
+{
+  NS_ASSERT_MSG (halfLife.IsStrictlyPositive (), "Half-life must be positive");
+  NS_ASSERT_MSG (reuse > 0 && reuse < suppress, "Must have 0 < reuse < suppress");
+  NS_ASSERT_MSG (suppress <= maxPenalty, "Must have suppress <= maxPenalty");
+
+  m_halfLife = halfLife;
+  m_penalty = penalty;
+  m_suppress = suppress;
+  m_reuse = reuse;
+  m_maxPenalty = maxPenalty;
+}
+
+NfpFlapDamping::Entry *
+NfpFlapDamping::Update (const KeyType &key, Time now)
+{
+  Entry *entry = m_entries.Find (key);
+  if (!entry)
+    {
+      return 0;
+    }
+
+  if (now > entry->updated)
+    {
+      double halfLives = (now - entry->updated).GetSeconds () / m_halfLife.GetSeconds ();
+      entry->penalty *= std::pow (0.5, halfLives);
+      entry->updated = now;
+    }
+
+  if (entry->suppressed && entry->penalty < m_reuse)
+    {
+      entry->suppressed = false;
+    }
+
+  // forget pairs that have not flapped for a long time
+  if (!entry->suppressed && entry->penalty < m_reuse / 100.0)
+    {
+      m_entries.Erase (key);
+      return 0;
+    }
+
+  return entry;
+}
+
+bool
+NfpFlapDamping::RecordFlap (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now)
+{
+  KeyType key (prefix, anchorName);
+  Entry *entry = Update (key, now);
+  if (!entry)
+    {
+      Entry empty;
+      empty.penalty = 0;
+      empty.updated = now;
+      empty.suppressed = false;
+      m_entries.Insert (key, empty);
+      entry = m_entries.Find (key);
+    }
+
+  entry->penalty = std::min (entry->penalty + m_penalty, m_maxPenalty);
+  if (!entry->suppressed && entry->penalty > m_suppress)
+    {
+      entry->suppressed = true;
+      return true;
+    }
+  return false;
+}
+
+bool
+NfpFlapDamping::IsSuppressed (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now)
+{
+  Entry *entry = Update (KeyType (prefix, anchorName), now);
+  return entry && entry->suppressed;
+}
+
+double
+NfpFlapDamping::GetPenalty (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now)
+{
+  Entry *entry = Update (KeyType (prefix, anchorName), now);
+  return entry ? entry->penalty : 0.0;
+}
+
+Time
+NfpFlapDamping::GetReuseDelay (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now)
+{
+  Entry *entry = Update (KeyType (prefix, anchorName), now);
+  if (!entry || !entry->suppressed)
+    {
+      return Time (0);
+    }
+
+  // penalty * 0.5^(t / halfLife) = reuse
+  double halfLives = std::log (entry->penalty / m_reuse) / std::log (2.0);
+  return Seconds (halfLives * m_halfLife.GetSeconds ());
+}
+
+size_t
+NfpFlapDamping::GetSize (void) const
+{
+  return m_entries.Size ();
+}
@@ -0,0 +1,176 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_FLAP_DAMPING_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_FLAP_DAMPING_H_
+
+#include <utility>
+
+#include "ns3/ccnx-name.h"
+#include "ns3/nstime.h"
+#include "ns3/ccnx-flat-hash-map.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * Route-flap damping for (prefix, anchorName) pairs, after BGP route-flap damping (RFC 2439).
+ *
+ * Every flap of a pair (NfpRoutingProtocol counts a loss of reachability) adds `penalty` to its figure of merit, which decays
+ * exponentially with `halfLife`.  When the figure of merit goes above `suppress`, the pair is
+ * suppressed until it decays below `reuse`.  The figure of merit never exceeds `maxPenalty`,
+ * which bounds the suppression time to halfLife * log2(maxPenalty / reuse).
+ *
+ * Pairs that have decayed to a negligible figure of merit are removed when looked up.
+ */
+class NfpFlapDamping
+{
+public:
+  /**
+   * Creates a table with the default RFC 2439 ratios (penalty 1000, suppress 2000, reuse 750,
+   * maximum 12000) and a 15 second half-life.
+   */
+  NfpFlapDamping ();
+
+  NfpFlapDamping (Time halfLife, double penalty, double suppress, double reuse, double maxPenalty);
+
+  virtual ~NfpFlapDamping ();
+
+  void SetParameters (Time halfLife, double penalty, double suppress, double reuse, double maxPenalty);
+
+  /**
+   * Adds one flap of the pair at time `now`.
+   *
+   * @return true if the pair was not suppressed and now is
+   */
+  bool RecordFlap (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now);
+
+  /**
+   * Determines if the pair is suppressed at time `now`.  A suppressed pair whose figure
+   * of merit has decayed below the reuse threshold is no longer suppressed.
+   */
+  bool IsSuppressed (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now);
+
+  /**
+   * The figure of merit of the pair at time `now`, 0 if unknown
+   */
+  double GetPenalty (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now);
+
+  /**
+   * The time from `now` until a suppressed pair may be reused, 0 if not suppressed
+   */
+  Time GetReuseDelay (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time now);
+
+  /**
+   * The number of pairs with a non-negligible figure of merit
+   */
+  size_t GetSize (void) const;
+
+private:
+  struct Entry
+  {
+    double penalty;             //!< Figure of merit at `updated`
+    Time updated;               //!< The time penalty was computed
+    bool suppressed;
+  };
+
+  typedef std::pair< Ptr<const CCNxName>, Ptr<const CCNxName> > KeyType;
+
+  /**
+   * Hash of a (prefix, anchorName) key by name
+   */
+  struct KeyHash
+  {
+    size_t operator() (const KeyType &key) const
+    {
+      return key.first->GetHash () * 31 + key.second->GetHash ();
+    }
+  };
+
+  /**
+   * Equality of a (prefix, anchorName) key by name
+   */
+  struct KeyEqual
+  {
+    bool operator() (const KeyType &a, const KeyType &b) const
+    {
+      return a.first->Equals (*b.first) && a.second->Equals (*b.second);
+    }
+  };
+
+  /**
+   * Looks up the entry of the pair and decays its figure of merit to `now`.  Updates the
+   * suppressed state and erases the entry if it is negligible.
+   *
+   * @return The entry, or 0 if the pair is not in the table
+   */
+  Entry * Update (const KeyType &key, Time now);
+
+  Time m_halfLife;
+  double m_penalty;
+  double m_suppress;
+  double m_reuse;
+  double m_maxPenalty;
+
+  typedef CCNxFlatHashMap< KeyType, Entry, KeyHash, KeyEqual > EntryMapType;
+  EntryMapType m_entries;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_FLAP_DAMPING_H_ */
@@ -73,8 +73,8 @@ NfpNeighbor::GetUniqueNeighborId (void)
 }
 
 NfpNeighbor::NfpNeighbor (Ptr<const CCNxName> name, Ptr<CCNxConnection> connection, uint16_t messageSeqnum, Time neighborTimeout,
-                          Callback< void, Ptr<NfpNeighborKey> > stateChangeCallback)
-  : m_neighborId (GetUniqueNeighborId ()), m_name (name), m_connection (connection)
+                          Callback< void, Ptr<NfpNeighborKey> > stateChangeCallback, Ptr<NfpTimerScheduler> timers)
+  : m_neighborId (GetUniqueNeighborId ()), m_name (name), m_timers (timers), m_connection (connection)
 {
   NS_LOG_FUNCTION (this << name << messageSeqnum << connection->GetConnectionId ());
 
@@ -84,8 +84,11 @@ NfpNeighbor::NfpNeighbor (Ptr<const CCNxName> name, Ptr<CCNxConnection> connecti
   m_stateChangeCallback = stateChangeCallback;
   m_expiry = ComputeExpiry ();
   m_state = StateUp;
-  m_timer = Timer (Timer::REMOVE_ON_DESTROY);
-  m_timer.SetFunction (&NfpNeighbor::TimeoutExpired, this);
+  if (!m_timers)
+    {
+      m_timers = Create<NfpTimerScheduler> ();
+    }
+  m_timerId = m_timers->Allocate (MakeCallback (&NfpNeighbor::TimeoutExpired, this));
   SetTimer ();
 
   LogState ();
@@ -93,7 +96,7 @@ NfpNeighbor::NfpNeighbor (Ptr<const CCNxName> name, Ptr<CCNxConnection> connecti
 
 NfpNeighbor::~NfpNeighbor ()
 {
-  // empty
+  m_timers->Release (m_timerId);
 }
 
 const NfpNeighbor::NeighborIdType
@@ -121,6 +124,7 @@ NfpNeighbor::ReceiveHello (uint16_t messageSeqnum)
       m_messageSeqnum = messageSeqnum;
       m_expiry = ComputeExpiry ();
       m_state = StateUp;
+      SetTimer ();
       LogState ();
 
       result = true;
@@ -270,12 +274,9 @@ NfpNeighbor::SetTimer (void)
 
   NS_ASSERT_MSG (m_expiry >= Simulator::Now (), "Trying to schedule a neighbor timer in the past");
 
-  Time delta = m_expiry - Simulator::Now ();
-
-  m_timer.SetDelay (delta);
-  m_timer.Schedule ();
+  m_timers->Schedule (m_timerId, m_expiry);
 
-  NS_LOG_DEBUG ("Set timer " << &m_timer << " delay " << delta);
+  NS_LOG_DEBUG ("Set timer " << m_timerId << " expiry " << m_expiry);
 }
 
 void
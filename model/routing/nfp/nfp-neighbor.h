@@ -58,7 +58,7 @@
 
 #include <stdint.h>
 #include "ns3/nstime.h"
-#include "ns3/timer.h"
+#include "ns3/nfp-timer-scheduler.h"
 #include "ns3/simple-ref-count.h"
 #include "ns3/ccnx-name.h"
 #include "ns3/nfp-neighbor-key.h"
@@ -78,11 +78,10 @@ namespace ccnx {
  * Hello messages are only valid if they are in-order to prior messages, as per normal
  * sequece numbers (see NfpSeqnum).
  *
- * A neighbor keeps its own timer for when it expires.  If it expires, it will call
- * a user-provided callback with the name of the neighbor.  The timer is updated lazily.  That is,
- * we set it once, then receive updates, then the timer expires.  Assuming we've received updates, we'll
- * set the timer to the next timeout based on the last update.  If we've not received any updates,
- * then the timeout was for real.
+ * A neighbor has a timer for when it expires.  If it expires, it will call
+ * a user-provided callback with the name of the neighbor.  The timer lives in an NfpTimerScheduler,
+ * which the routing protocol shares between all its neighbors.  Each in-order hello moves the timer
+ * in place to the new expiry time.
  *
  * A neighbor can be either Up or Down.  When a hello is first received, the neighbor becomes Up.
  * It stays Up until its timeout expires, at which time it is Down.  In Down, we run another timer.
@@ -126,9 +125,11 @@ public:
    * @param messageSeqnum The initial sequence number for the neighbor
    * @param neighorTimeout The timeout used to compute if the neighbor is expired
    * @param stateChangeCallback Called whenever the state of the neighbor changes with name of neighbor
+   * @param timers The scheduler that runs our expiry timer.  If null, the neighbor creates its own.
    */
   NfpNeighbor (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection, uint16_t messageSeqnum,
-               Time neighborTimeout, StateChangeCallback stateChangeCallback);
+               Time neighborTimeout, StateChangeCallback stateChangeCallback,
+               Ptr<NfpTimerScheduler> timers = Ptr<NfpTimerScheduler> ());
 
   virtual ~NfpNeighbor ();
 
@@ -291,13 +292,18 @@ protected:
   NeighborState m_state;
 
   /**
-   * Set for our expiry time, at which point we will call the timeout callback assuming
-   * we've not been updated.
+   * Runs our expiry timer, usually shared with the other neighbors
    */
-  Timer m_timer;
+  Ptr<NfpTimerScheduler> m_timers;
 
   /**
-   * Called by m_timer when it expires
+   * Our timer in m_timers.  It is set for our expiry time, at which point we will
+   * call the timeout callback.
+   */
+  NfpTimerScheduler::TimerId m_timerId;
+
+  /**
+   * Called by m_timers when our timer expires
    */
   void TimeoutExpired (void);
 
@@ -0,0 +1,140 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_PREFIX_INDEX_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_PREFIX_INDEX_H_
+
+#include <map>
+#include <set>
+#include <vector>
+
+#include "ns3/ccnx-name.h"
+#include "ns3/ccnx-flat-hash-map.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * A set of name prefixes that can answer hierarchy questions: which members are
+ * ancestors (proper prefixes) of a name, and which members are descendants of a name.
+ * NfpRoutingProtocol uses it for route summarization, on both its anchor names and its
+ * RIB prefixes.
+ *
+ * Ancestor lookups walk up the segments of the name and probe a hash set, so they cost
+ * one lookup per segment.  For descendant lookups, every ancestor name of every member
+ * (member or not) keeps the set of its member descendants, so the index uses memory
+ * proportional to the number of members times the name depth.
+ */
+class NfpPrefixIndex
+{
+public:
+  typedef std::set< Ptr<const CCNxName>, CCNxName::isLessPtrCCNxName > NameSetType;
+
+  NfpPrefixIndex ();
+  virtual ~NfpPrefixIndex ();
+
+  /**
+   * @return true if `name` was added, false if it was already a member
+   */
+  bool Insert (Ptr<const CCNxName> name);
+
+  /**
+   * @return true if `name` was removed, false if it was not a member
+   */
+  bool Erase (Ptr<const CCNxName> name);
+
+  bool Contains (Ptr<const CCNxName> name) const;
+
+  size_t GetSize (void) const;
+
+  /**
+   * The members that are proper prefixes of `name`, nearest (longest) first.  `name`
+   * does not need to be a member.
+   */
+  std::vector< Ptr<const CCNxName> > GetAncestors (Ptr<const CCNxName> name) const;
+
+  /**
+   * The nearest member that is a proper prefix of `name`, or null
+   */
+  Ptr<const CCNxName> GetNearestAncestor (Ptr<const CCNxName> name) const;
+
+  /**
+   * The members that `name` is a proper prefix of.  `name` does not need to be a member.
+   */
+  NameSetType GetDescendants (Ptr<const CCNxName> name) const;
+
+private:
+  /**
+   * Returns the name made of the first `count` segments of `name`
+   */
+  static Ptr<const CCNxName> GetPrefix (Ptr<const CCNxName> name, size_t count);
+
+  typedef CCNxFlatHashMap< Ptr<const CCNxName>, bool, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > MemberMapType;
+  typedef std::map< Ptr<const CCNxName>, NameSetType, CCNxName::isLessPtrCCNxName > DescendantMapType;
+
+  MemberMapType m_members;
+
+  /**
+   * ancestor name -> members below it
+   */
+  DescendantMapType m_descendants;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_PREFIX_INDEX_H_ */
@@ -82,6 +82,12 @@ NfpPrefixTimerEntry::GetTime (void) const
   return m_expiry;
 }
 
+void
+NfpPrefixTimerEntry::SetTime (Time expiry)
+{
+  m_expiry = expiry;
+}
+
 void
 NfpPrefixTimerEntry::Invalidate (void)
 {
@@ -75,6 +75,13 @@ public:
   Ptr<const CCNxName> GetAnchorName (void) const;
   Time GetTime (void) const;
 
+  /**
+   * Changes the expiry time.  Used by NfpPrefixTimerHeap when it moves the entry in place.
+   *
+   * @param expiry The new expiry time
+   */
+  void SetTime (Time expiry);
+
   /**
    * Marks the entry as invalid.  The timer heap might invalidate an entry in the heap
    * so it does not need to do a search to remove it.  It will be removed when it gets to the top.
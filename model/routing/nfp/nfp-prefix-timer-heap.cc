@@ -71,42 +71,36 @@ NfpPrefixTimerHeap::~NfpPrefixTimerHeap ()
 void
 NfpPrefixTimerHeap::Insert (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName, Time expiry)
 {
-  Ptr<NfpPrefixTimerEntry> key = Create<NfpPrefixTimerEntry> (prefix, anchorName, expiry);
-  KeyMapType::iterator i = m_keys.find (key);
-  if ( i != m_keys.end () )
+  KeyType key (prefix, anchorName);
+  NfpTimerHeap::TimerId *found = m_keys.Find (key);
+  NfpTimerHeap::TimerId id;
+  if (found)
     {
-      // If it is already in the map, invaildate it, then overwrite it in the map.
-      // it will stay in the heap and be discarded when it reaches the top.
-      m_keys[key]->Invalidate ();
+      // Already known, move it to the new time in place
+      id = *found;
+      m_entries[id]->SetTime (expiry);
+    }
+  else
+    {
+      id = m_heap.Allocate ();
+      if (id >= m_entries.size ())
+        {
+          m_entries.resize (id + 1);
+        }
+      m_entries[id] = Create<NfpPrefixTimerEntry> (prefix, anchorName, expiry);
+      m_keys.Insert (key, id);
     }
 
-  m_keys[key] = key;
-  m_heap.push (key);
+  m_heap.Schedule (id, expiry);
 }
 
 Ptr<const NfpPrefixTimerEntry>
 NfpPrefixTimerHeap::Peek (void)
 {
   Ptr<const NfpPrefixTimerEntry> result;
-  bool match = false;
-  while (!m_heap.empty ())
-    {
-      result = m_heap.top ();
-      if (result->IsValid ())
-        {
-          match = true;
-          break;
-        }
-      else
-        {
-          // result is invalid, so throw it away and try again
-          m_heap.pop ();
-        }
-    }
-
-  if (!match)
+  if (!m_heap.IsEmpty ())
     {
-      result = Ptr<const NfpPrefixTimerEntry> (0);
+      result = m_entries[m_heap.Peek ()];
     }
   return result;
 }
@@ -115,5 +109,11 @@ NfpPrefixTimerHeap::Peek (void)
 void
 NfpPrefixTimerHeap::Pop (void)
 {
-  m_heap.pop ();
+  m_heap.Pop ();
+}
+
+size_t
+NfpPrefixTimerHeap::GetSize (void) const
+{
+  return m_heap.GetSize ();
 }
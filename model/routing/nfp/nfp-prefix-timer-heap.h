@@ -56,11 +56,13 @@
 #ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_PREFIX_TIMER_HEAP_H_
 #define CCNS3SIM_MODEL_ROUTING_NFP_NFP_PREFIX_TIMER_HEAP_H_
 
-#include <queue>
-#include <map>
+#include <vector>
+#include <utility>
 
 #include "ns3/ccnx-name.h"
 #include "ns3/nfp-prefix-timer-entry.h"
+#include "ns3/nfp-timer-heap.h"
+#include "ns3/ccnx-flat-hash-map.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -77,10 +79,15 @@ namespace ccnx {
  * NfpPrefixTimerHeap will only keep one entry for (prefix, anchorName).  If NfpRoutingProtocol sets a new
  * timer for that pair and one is already in the heap, it will be updated as appropriate.
  *
- * In our actual implementation, we do not do live updates because that would require a linear search of the
- * priority queue to find the old update.  Instead, we have a map by (prefix, anchorName) that stores a reference
- * to the prioirty queue entry and we invalidate it then insert a new entry.  This leaves some crud in the tree
- * that we prune off when it pops to the top.  It is only O(logN), not O(N logN).
+ * The times are kept in an indexed NfpTimerHeap, so a new time for a (prefix, anchorName) moves its
+ * entry in place in O(log N).  There are no stale entries, so the heap never holds more than one
+ * entry per pair.  An entry keeps its heap handle after Pop(), so the next Insert() of the pair
+ * (which is how NfpRoutingProtocol refreshes an advertisement) does not allocate.
+ *
+ * A pair is never forgotten: its handle and entry live as long as the heap.  This matches
+ * NfpRoutingProtocol, which never deletes an NfpPrefix and re-inserts the timer of every
+ * popped pair (for an advertisement or a withdraw), so the heap holds one handle per pair
+ * the node has ever known and does not grow beyond that.
  */
 class NfpPrefixTimerHeap
 {
@@ -143,11 +150,44 @@ public:
    */
   void Pop (void);
 
+  /**
+   * @return The number of timers in the heap
+   */
+  size_t GetSize (void) const;
+
 private:
-  typedef std::priority_queue< Ptr<NfpPrefixTimerEntry>, std::vector< Ptr<NfpPrefixTimerEntry> >, NfpPrefixTimerEntry::IsTimeGreater > HeapType;
-  HeapType m_heap;
+  typedef std::pair< Ptr<const CCNxName>, Ptr<const CCNxName> > KeyType;
+
+  /**
+   * Hash of a (prefix, anchorName) key by name
+   */
+  struct KeyHash
+  {
+    size_t operator() (const KeyType &key) const
+    {
+      return key.first->GetHash () * 31 + key.second->GetHash ();
+    }
+  };
+
+  /**
+   * Equality of a (prefix, anchorName) key by name
+   */
+  struct KeyEqual
+  {
+    bool operator() (const KeyType &a, const KeyType &b) const
+    {
+      return a.first->Equals (*b.first) && a.second->Equals (*b.second);
+    }
+  };
+
+  NfpTimerHeap m_heap;
+
+  /**
+   * The entry of each heap handle
+   */
+  std::vector< Ptr<NfpPrefixTimerEntry> > m_entries;
 
-  typedef std::map< Ptr<NfpPrefixTimerEntry>, Ptr<NfpPrefixTimerEntry>, NfpPrefixTimerEntry::IsNameLess > KeyMapType;
+  typedef CCNxFlatHashMap< KeyType, NfpTimerHeap::TimerId, KeyHash, KeyEqual > KeyMapType;
   KeyMapType m_keys;
 
 };
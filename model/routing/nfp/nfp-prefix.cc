@@ -54,9 +54,11 @@
  */
 
 #include <iostream>
+#include <algorithm>
 
 #include "ns3/assert.h"
 #include "ns3/log.h"
+#include "ns3/simulator.h"
 #include "nfp-prefix.h"
 
 using namespace ns3;
@@ -65,7 +67,8 @@ using namespace ns3::ccnx;
 NS_LOG_COMPONENT_DEFINE ("NfpPrefix");
 
 NfpPrefix::NfpPrefix (Ptr<const CCNxName> prefix, Time advertisementTimeout, PrefixStateChangeCallback callback)
-  : m_prefix (prefix), m_advertisementTimeout (advertisementTimeout), m_stateChangeCallback (callback)
+  : m_prefix (prefix), m_advertisementTimeout (advertisementTimeout), m_stateChangeCallback (callback),
+  m_reachable (false), m_reachableValid (true), m_reachableUntil (Time::Max ())
 {
   NS_LOG_FUNCTION (this << prefix << advertisementTimeout);
 }
@@ -103,6 +106,7 @@ NfpPrefix::ReceiveAdvertisement (Ptr<NfpAdvertise> advertisement, Ptr<CCNxConnec
 
       m_computationCost.IncrementEvents();
       m_anchors[anchorName] = aa;
+      NexthopAdded (expiryTime);
       result = Advertisement_ImprovedRoute;
       notify = true;
     }
@@ -116,6 +120,7 @@ NfpPrefix::ReceiveAdvertisement (Ptr<NfpAdvertise> advertisement, Ptr<CCNxConnec
           bool wasReachable = aa->GetNexthopCount () > 0;
           NfpAnchorAdvertisement::CompareResult compareResult = aa->UpdateAdvertisement (advertisement, ingressConnection, expiryTime);
           bool isReachable = aa->GetNexthopCount () > 0;
+          NexthopAdded (expiryTime);
 
           switch (compareResult) {
             case NfpAnchorAdvertisement::REPLACE:
@@ -156,6 +161,10 @@ NfpPrefix::ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnection> ingre
       Ptr<NfpAnchorAdvertisement> aa = i->second;
       bool wasReachable = aa->GetNexthopCount () > 0;
       result = aa->RemoveNexthop (ingressConnection);
+      if (result)
+        {
+          m_reachableValid = false;
+        }
       if (wasReachable && aa->GetNexthopCount () == 0)
         {
           NS_LOG_DEBUG ("Prefix " << *m_prefix << " anchor " << *anchorName << " no longer reachable");
@@ -177,7 +186,10 @@ NfpPrefix::RemoveConnection (Ptr<CCNxConnection> connection)
       m_computationCost.IncrementLoopIterations();
       Ptr<NfpAnchorAdvertisement> aa = i->second;
       bool wasReachable = aa->GetNexthopCount () > 0;
-      aa->RemoveNexthop (connection);
+      if (aa->RemoveNexthop (connection))
+        {
+          m_reachableValid = false;
+        }
       bool isReachable = aa->GetNexthopCount () > 0;
       if (wasReachable != isReachable)
         {
@@ -187,20 +199,38 @@ NfpPrefix::RemoveConnection (Ptr<CCNxConnection> connection)
 }
 
 
+void
+NfpPrefix::NexthopAdded (Time expiryTime)
+{
+  // Adding a nexthop makes us reachable.  Keeping the earlier of the two times is
+  // conservative: at worst we re-scan the anchors earlier than needed.
+  if (m_reachableValid)
+    {
+      m_reachable = true;
+      m_reachableUntil = std::min (m_reachableUntil, expiryTime);
+    }
+}
+
 bool
 NfpPrefix::IsReachable (void)
 {
-  bool result = false;
-  for (AnchorMapType::const_iterator i = m_anchors.cbegin (); i != m_anchors.cend (); ++i)
+  Time now = Simulator::Now ();
+  if (!m_reachableValid || m_reachableUntil <= now)
     {
-      m_computationCost.IncrementLoopIterations();
-      if (i->second->GetNexthopCount () > 0)
+      m_reachable = false;
+      m_reachableUntil = Time::Max ();
+      for (AnchorMapType::const_iterator i = m_anchors.cbegin (); i != m_anchors.cend (); ++i)
         {
-          result = true;
-          break;
+          m_computationCost.IncrementLoopIterations();
+          if (i->second->GetNexthopCount () > 0)
+            {
+              m_reachable = true;
+              m_reachableUntil = std::min (m_reachableUntil, i->second->GetEarliestExpiryTime ());
+            }
         }
+      m_reachableValid = true;
     }
-  return result;
+  return m_reachable;
 }
 
 bool
@@ -242,6 +272,15 @@ NfpPrefix::GetAdvertisement (Ptr<const CCNxName> anchorName) const
   return i->second->GetBestAdvertisement ();
 }
 
+Ptr<NfpAdvertise>
+NfpPrefix::GetReadvertisement (Ptr<const CCNxName> anchorName, uint16_t linkcost)
+{
+  AnchorMapType::const_iterator i = m_anchors.find (anchorName);
+  NS_ASSERT_MSG ((i != m_anchors.cend ()), "Could not find anchor " << *anchorName);
+
+  return i->second->GetReadvertisement (linkcost);
+}
+
 std::ostream &
 ns3::ccnx::operator << (std::ostream &os, const NfpPrefix &prefix)
 {
@@ -169,6 +169,9 @@ public:
    *
    * To be reachable, we must know of at least one anchor with at least one nexthop
    *
+   * The answer is cached.  It is only re-computed (a scan of the anchors) after a nexthop
+   * was removed or once the earliest nexthop expiry time seen by the last scan has passed.
+   *
    * @return True if reachable, false if not reachable
    */
   bool IsReachable (void);
@@ -192,6 +195,19 @@ public:
    */
   Ptr<const NfpAdvertise> GetAdvertisement (Ptr<const CCNxName> anchorName) const;
 
+  /**
+   * Returns the advertisement to send to our neighbors for the named anchor, which is
+   * the best advertisement with `linkcost` added to the distance.  See
+   * NfpAnchorAdvertisement::GetReadvertisement().
+   *
+   * PRECONDITION: The anchor IsReachable() for the prefix.
+   *
+   * @param anchorName
+   * @param linkcost The amount by which to increase the distance
+   * @return The advertisement to send, which the caller must not modify.
+   */
+  Ptr<NfpAdvertise> GetReadvertisement (Ptr<const CCNxName> anchorName, uint16_t linkcost);
+
   typedef std::set< uint32_t > EgressListType;
 
   /**
@@ -233,6 +249,19 @@ protected:
   AnchorMapType m_anchors;
 
   NfpComputationCost m_computationCost;
+
+  /**
+   * The cached result of IsReachable().  It is valid while `m_reachableValid` is true and
+   * the current time is before `m_reachableUntil`.
+   */
+  bool m_reachable;
+  bool m_reachableValid;
+  Time m_reachableUntil;
+
+  /**
+   * A nexthop with expiry time `expiryTime` was added to one of the anchors
+   */
+  void NexthopAdded (Time expiryTime);
 };
 }   /* namespace ccnx */
 } /* namespace ns3 */
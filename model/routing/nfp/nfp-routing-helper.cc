@@ -184,3 +184,20 @@ NfpRoutingHelper::GetStats( Ptr<Node> node )
     }
 }
 
+
+NfpWallClockProfile
+NfpRoutingHelper::GetWallClockProfile( Ptr<Node> node )
+{
+  Ptr<NfpRoutingProtocol> nfp = node->GetObject<NfpRoutingProtocol> ();
+  if (nfp)
+    {
+      return nfp->GetWallClockProfile();
+    }
+  else
+    {
+      NS_ASSERT_MSG(false, "Could not retrieve object NfpRoutingProtocol from node " << node->GetId ());
+
+      // return a "0" if asserts not working.
+      return NfpWallClockProfile();
+    }
+}
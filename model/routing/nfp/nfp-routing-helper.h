@@ -61,6 +61,7 @@
 #include "ns3/node-container.h"
 #include "ns3/nfp-computation-cost.h"
 #include "ns3/nfp-stats.h"
+#include "ns3/nfp-wall-clock-profile.h"
 
 namespace ns3 {
 namespace ccnx {
@@ -152,6 +153,14 @@ public:
    */
   static NfpStats GetStats( Ptr<Node> node );
 
+  /**
+   * Returns the wall-clock time spent in the NFP handlers from time 0 to now.
+   * It is all zeros unless the attribute EnableProfiling is true.
+   *
+   * @param node [in] The node to lookup
+   */
+  static NfpWallClockProfile GetWallClockProfile( Ptr<Node> node );
+
 private:
   /**
    * The factory we use to create protocol instances
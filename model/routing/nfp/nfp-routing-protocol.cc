@@ -57,8 +57,10 @@
 
 #include <iostream>
 #include <iomanip>
+#include <set>
 
 #include "ns3/assert.h"
+#include "ns3/fatal-error.h"
 #include "ns3/log.h"
 #include "nfp-routing-protocol.h"
 #include "ns3/nstime.h"
@@ -68,6 +70,11 @@
 #include "ns3/nfp-payload.h"
 #include "ns3/buffer.h"
 #include "ns3/ccnx-name-builder.h"
+#include "ns3/pointer.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -102,7 +109,65 @@ NfpRoutingProtocol::GetTypeId ()
     .AddAttribute ("NeighborTimeout", "Timeout a neighbor if not heard in this period.",
                    TimeValue (Seconds (6)),
                    MakeTimeAccessor (&NfpRoutingProtocol::m_neighborTimeout),
-                   MakeTimeChecker ());
+                   MakeTimeChecker ())
+    .AddAttribute ("ConvergenceObserver", "An NfpConvergenceObserver shared by all nodes to measure convergence time.",
+                   PointerValue (),
+                   MakePointerAccessor (&NfpRoutingProtocol::m_convergenceObserver),
+                   MakePointerChecker<NfpConvergenceObserver> ())
+    .AddAttribute ("TriggeredUpdateInterval", "Delay from a routing change to sending the triggered update.",
+                   TimeValue (MilliSeconds (10)),
+                   MakeTimeAccessor (&NfpRoutingProtocol::m_triggeredUpdateInterval),
+                   MakeTimeChecker ())
+    .AddAttribute ("TriggeredUpdateJitter", "Subtractive jitter to the triggered update interval.",
+                   TimeValue (MilliSeconds (5)),
+                   MakeTimeAccessor (&NfpRoutingProtocol::m_triggeredUpdateJitter),
+                   MakeTimeChecker ())
+    .AddAttribute ("EnableDamping", "Suppress the advertisement of (prefix, anchor) pairs that flap.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NfpRoutingProtocol::m_enableDamping),
+                   MakeBooleanChecker ())
+    .AddAttribute ("DampingHalfLife", "Half-life of the flap damping penalty.",
+                   TimeValue (Seconds (15)),
+                   MakeTimeAccessor (&NfpRoutingProtocol::m_dampingHalfLife),
+                   MakeTimeChecker ())
+    .AddAttribute ("DampingPenalty", "Penalty added each time a (prefix, anchor) pair becomes unreachable.",
+                   DoubleValue (1000.0),
+                   MakeDoubleAccessor (&NfpRoutingProtocol::m_dampingPenalty),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("DampingSuppress", "Suppress a pair when its penalty goes above this.",
+                   DoubleValue (2000.0),
+                   MakeDoubleAccessor (&NfpRoutingProtocol::m_dampingSuppress),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("DampingReuse", "Advertise a suppressed pair again when its penalty decays below this.",
+                   DoubleValue (750.0),
+                   MakeDoubleAccessor (&NfpRoutingProtocol::m_dampingReuse),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("DampingMaxPenalty", "The maximum penalty, which bounds the suppression time.",
+                   DoubleValue (12000.0),
+                   MakeDoubleAccessor (&NfpRoutingProtocol::m_dampingMaxPenalty),
+                   MakeDoubleChecker<double> (0.0))
+    .AddAttribute ("InterfaceRateLimit", "Maximum rate of NFP payload bytes sent per interface.  0 is unlimited.",
+                   DataRateValue (DataRate (0)),
+                   MakeDataRateAccessor (&NfpRoutingProtocol::m_interfaceRateLimit),
+                   MakeDataRateChecker ())
+    .AddAttribute ("InterfaceBurst", "Token bucket size (bytes) of the per-interface rate limit.",
+                   UintegerValue (3000),
+                   MakeUintegerAccessor (&NfpRoutingProtocol::m_interfaceBurst),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("InterfaceQueueLimit", "Maximum payloads waiting for the per-interface rate limit.  "
+                   "When full, the oldest payload is dropped.",
+                   UintegerValue (100),
+                   MakeUintegerAccessor (&NfpRoutingProtocol::m_interfaceQueueLimit),
+                   MakeUintegerChecker<uint32_t> (1))
+    .AddAttribute ("Summarize", "Advertise only the covering prefix of our anchor names, and do not install a "
+                   "route in the FIB if its nearest parent route has the same nexthops.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NfpRoutingProtocol::m_summarize),
+                   MakeBooleanChecker ())
+    .AddAttribute ("EnableProfiling", "Measure the wall-clock time of the NFP handlers.",
+                   BooleanValue (false),
+                   MakeBooleanAccessor (&NfpRoutingProtocol::m_enableProfiling),
+                   MakeBooleanChecker ());
   return tid;
 }
 
@@ -111,6 +176,9 @@ NfpRoutingProtocol::GetTypeId ()
 
 NfpRoutingProtocol::NfpRoutingProtocol ()
 {
+  m_enableProfiling = false;
+  m_summarize = false;
+  m_enableDamping = false;
   m_anchorSeqnum = 0;
   m_messageSeqnum = 1;
   m_helloTimer = Timer (Timer::REMOVE_ON_DESTROY);
@@ -119,6 +187,7 @@ NfpRoutingProtocol::NfpRoutingProtocol ()
   m_processWorkQueueTimer  = Timer (Timer::REMOVE_ON_DESTROY);
 
   m_uniformRandomVariable = CreateObject<UniformRandomVariable> ();
+  m_neighborTimers = Create<NfpTimerScheduler> ();
   m_nfpPrefix = Create<CCNxName> ("ccnx:/name=nfp");
   m_minimumMtu = GetMinimumMtu ();
 
@@ -167,6 +236,25 @@ NfpRoutingProtocol::DoInitialize (void)
   m_anchorRouteTimer.SetFunction (&NfpRoutingProtocol::AnchorRouteTimerExpired, this);
   m_processWorkQueueTimer.SetFunction (&NfpRoutingProtocol::ProcessWorkQueueTimerExpired, this);
 
+  if (m_enableDamping)
+    {
+      if (!m_dampingHalfLife.IsStrictlyPositive ())
+        {
+          NS_FATAL_ERROR ("DampingHalfLife must be positive, got " << m_dampingHalfLife);
+        }
+      if (m_dampingReuse <= 0 || m_dampingReuse >= m_dampingSuppress)
+        {
+          NS_FATAL_ERROR ("DampingReuse (" << m_dampingReuse << ") must be above 0 and below DampingSuppress ("
+                          << m_dampingSuppress << ")");
+        }
+      if (m_dampingSuppress > m_dampingMaxPenalty)
+        {
+          NS_FATAL_ERROR ("DampingSuppress (" << m_dampingSuppress << ") must not be above DampingMaxPenalty ("
+                          << m_dampingMaxPenalty << ")");
+        }
+      m_damping.SetParameters (m_dampingHalfLife, m_dampingPenalty, m_dampingSuppress, m_dampingReuse, m_dampingMaxPenalty);
+    }
+
   // Set the hello timer to start in 1 jitter interval with 25% jitter
   SetTimer (m_helloTimer, m_jitter, m_jitter / 4);
 
@@ -185,6 +273,12 @@ NfpRoutingProtocol::DoDispose (void)
 {
   // Kill hello timer
   // kill advertisement timer
+
+  for (InterfacePacerMapType::iterator i = m_pacers.begin (); i != m_pacers.end (); ++i)
+    {
+      Simulator::Cancel (i->second.drainEvent);
+    }
+  m_pacers.clear ();
 }
 
 // ========================================
@@ -210,7 +304,37 @@ NfpRoutingProtocol::AddAnchorPrefix (Ptr<const CCNxName> prefix)
     {
       NS_LOG_WARN("Add anchor prefix " << *prefix);
       m_anchorNames[prefix] = 1;
+      if (m_summarize)
+        {
+          m_anchorIndex.Insert (prefix);
+        }
+
+      if (IsAnchorSummarized (prefix))
+        {
+          NS_LOG_INFO ("Anchor prefix " << *prefix << " is covered by " << *m_anchorIndex.GetNearestAncestor (prefix));
+          return;
+        }
+
+      if (m_convergenceObserver)
+        {
+          m_convergenceObserver->AnchorPrefixAdded (prefix, m_routerName);
+        }
       InjectAnchorRoute (prefix, m_anchorSeqnum++);
+
+      if (m_summarize)
+        {
+          // Withdraw the anchor names this prefix now covers, unless already covered by something below it.
+          NfpPrefixIndex::NameSetType descendants = m_anchorIndex.GetDescendants (prefix);
+          for (NfpPrefixIndex::NameSetType::const_iterator j = descendants.begin (); j != descendants.end (); ++j)
+            {
+              m_computationCost.IncrementLoopIterations();
+              if (m_anchorIndex.GetNearestAncestor (*j)->Equals (*prefix))
+                {
+                  NS_LOG_INFO ("Summarize anchor prefix " << **j << " under " << *prefix);
+                  InjectAnchorWithdraw (*j);
+                }
+            }
+        }
     }
 }
 
@@ -228,8 +352,34 @@ NfpRoutingProtocol::RemoveAnchorPrefix (Ptr<const CCNxName> prefix)
       if (i->second == 0)
         {
           NS_LOG_INFO ("Removing Anchor name " << *(i->first));
-          InjectAnchorWithdraw (prefix);
+          bool summarized = IsAnchorSummarized (prefix);
           m_anchorNames.erase (i);
+          m_anchorIndex.Erase (prefix);
+
+          // A summarized prefix was never advertised, so there is nothing to withdraw
+          if (!summarized)
+            {
+              if (m_convergenceObserver)
+                {
+                  m_convergenceObserver->AnchorPrefixRemoved (prefix, m_routerName);
+                }
+              InjectAnchorWithdraw (prefix);
+
+              if (m_summarize)
+                {
+                  // Advertise the anchor names this prefix covered that are no longer covered
+                  NfpPrefixIndex::NameSetType descendants = m_anchorIndex.GetDescendants (prefix);
+                  for (NfpPrefixIndex::NameSetType::const_iterator j = descendants.begin (); j != descendants.end (); ++j)
+                    {
+                      m_computationCost.IncrementLoopIterations();
+                      if (!IsAnchorSummarized (*j))
+                        {
+                          NS_LOG_INFO ("Unsummarize anchor prefix " << **j);
+                          InjectAnchorRoute (*j, m_anchorSeqnum++);
+                        }
+                    }
+                }
+            }
         }
       else
         {
@@ -308,11 +458,8 @@ NfpRoutingProtocol::ProcessWorkQueueTimerExpired()
 void
 NfpRoutingProtocol::SetProcessWorkQueueTimer()
 {
-  static Time interval = MilliSeconds(10);
-  static Time jitter = MilliSeconds(5);
-
   if (!m_processWorkQueueTimer.IsRunning()) {
-      SetTimer(m_processWorkQueueTimer, interval, jitter);
+      SetTimer(m_processWorkQueueTimer, m_triggeredUpdateInterval, m_triggeredUpdateJitter);
   }
 }
 
@@ -351,13 +498,12 @@ NfpRoutingProtocol::HelloTimerExpired ()
       m_stats.IncrementHellosSent();
 
       Ptr<NfpPayload> payload = CreatePayload ();
-      Ptr<CCNxPacket> packet = CreatePacket (payload);
 
       NS_LOG_DEBUG ("HelloTimerExpired sending payload " << *payload << ", serialized = " << payload->GetSerializedSize ());
       // that's all we need to do, as a Hello message doesn't advertise anything
 
       // this will update m_lastBroadcast
-      Broadcast (packet);
+      BroadcastHello (payload);
 
       NS_LOG_DEBUG ("HelloTimerExpired resetting timer delta = " << m_helloInterval);
       SetTimer (m_helloTimer, m_helloInterval, m_jitter);
@@ -425,7 +571,10 @@ NfpRoutingProtocol::AnchorRouteTimerExpired ()
       // Create an advertise for each anchor name and inject it into our RIB.
       for (AnchorNameMapType::const_iterator i = m_anchorNames.cbegin (); i != m_anchorNames.cend (); ++i)
         {
-          InjectAnchorRoute (i->first, anchorSeqnum);
+          if (!IsAnchorSummarized (i->first))
+            {
+              InjectAnchorRoute (i->first, anchorSeqnum);
+            }
         }
      }
 
@@ -439,6 +588,8 @@ NfpRoutingProtocol::AdvertiseTimerExpired ()
 
   NS_LOG_DEBUG ("AdvertiseTimerExpired, processing work queue");
 
+  NfpWallClockProfile::ScopedTimer profileTimer (GetProfile (), NfpWallClockProfile::ADVERTISE_TIMER);
+
   m_computationCost.IncrementEvents();
 
   /*
@@ -555,6 +706,8 @@ NfpRoutingProtocol::ReceivePayload (Ptr<NfpPayload> payload, Ptr<CCNxConnection>
 
   NS_LOG_DEBUG ("ReceivePayload from " << *payload->GetRouterName () << ", msgSeqnum " << payload->GetMessageSeqnum ());
 
+  NfpWallClockProfile::ScopedTimer profileTimer (GetProfile (), NfpWallClockProfile::RECEIVE_PAYLOAD);
+
   if (!m_routerName->Equals (*payload->GetRouterName ()))
     {
       m_stats.IncrementPayloadsReceived();
@@ -620,7 +773,11 @@ NfpRoutingProtocol::AddAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConnectio
   // must do this before calling ReceiveAdvertisement because if that triggers the PrefixStateChagned callback,
   // we need to have it in our map first.
   m_computationCost.IncrementEvents();
-  m_prefixes[prefixName] = prefixEntry;
+  m_prefixes.Insert (prefixName, prefixEntry);
+  if (m_summarize)
+    {
+      m_prefixIndex.Insert (prefixName);
+    }
   m_prefixTimerHeap.Insert (prefixName, advertise->GetAnchorName (),
                             GetCurrentTime () + CalculateJitteredTime (m_routeTimeout, m_jitter));
 
@@ -637,8 +794,8 @@ NfpRoutingProtocol::ReceiveAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConne
   m_stats.IncrementAdvertiseReceived();
   m_computationCost.IncrementEvents();
   Ptr<const CCNxName> prefixName = advertise->GetPrefix ();
-  PrefixMapType::iterator i = m_prefixes.find (prefixName);
-  if (i == m_prefixes.end ())
+  Ptr<NfpPrefix> *found = m_prefixes.Find (prefixName);
+  if (!found)
     {
       NS_LOG_INFO ("Adding advertisement " << *advertise << " ingress " << ingressConnection->GetConnectionId());
       m_stats.IncrementAdvertiseReceivedFeasible();
@@ -646,7 +803,7 @@ NfpRoutingProtocol::ReceiveAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConne
     }
   else
     {
-      Ptr<NfpPrefix> prefixEntry = i->second;
+      Ptr<NfpPrefix> prefixEntry = *found;
       NfpPrefix::AdvertisementResult result = prefixEntry->ReceiveAdvertisement (advertise, ingressConnection, GetCurrentTime ());
 
       // only re-advertise it if it improved our route
@@ -657,6 +814,14 @@ NfpRoutingProtocol::ReceiveAdvertise (Ptr<NfpAdvertise> advertise, Ptr<CCNxConne
 	  m_stats.IncrementAdvertiseReceivedFeasible();
           AddWorkQueueEntry (advertise->GetAnchorName (), prefixName);
         }
+
+      // A replaced or equal cost nexthop changes the route without a reachability change, so
+      // PrefixStateChanged() is not called; update the FIB (and what it summarizes) here
+      if (result != NfpPrefix::Advertisement_NotFeasible && prefixEntry->IsReachable ())
+        {
+          UpdateFibRoute (prefixEntry);
+          UpdateDescendantFibRoutes (prefixName);
+        }
     }
 }
 
@@ -669,14 +834,21 @@ NfpRoutingProtocol::ReceiveWithdraw (Ptr<NfpWithdraw> withdraw, Ptr<CCNxConnecti
 
   m_computationCost.IncrementEvents();
   Ptr<const CCNxName> prefixName = withdraw->GetPrefix ();
-  PrefixMapType::iterator i = m_prefixes.find (prefixName);
-  if (i != m_prefixes.end ())
+  Ptr<NfpPrefix> *found = m_prefixes.Find (prefixName);
+  if (found)
     {
-      Ptr<NfpPrefix> prefixEntry = i->second;
+      Ptr<NfpPrefix> prefixEntry = *found;
       bool wasReachable = prefixEntry->IsReachable ();
-      prefixEntry->ReceiveWithdraw (withdraw, ingressConnection, GetCurrentTime ());
+      bool removed = prefixEntry->ReceiveWithdraw (withdraw, ingressConnection, GetCurrentTime ());
       bool isReachable = prefixEntry->IsReachable ();
 
+      if (removed && isReachable)
+        {
+          // One of several nexthops went away; the FIB route still changes
+          UpdateFibRoute (prefixEntry);
+          UpdateDescendantFibRoutes (prefixName);
+        }
+
       // if we transitioned the edge from reachable -> not reachable, add it to work queue
       if (wasReachable && !isReachable)
 	{
@@ -693,6 +865,8 @@ NfpRoutingProtocol::ReceiveHello (Ptr<const CCNxName> neighborName, uint16_t msg
 {
   NS_LOG_FUNCTION (this << neighborName << msgSeqnum << ingressConnection->GetConnectionId ());
 
+  NfpWallClockProfile::ScopedTimer profileTimer (GetProfile (), NfpWallClockProfile::NEIGHBOR);
+
   bool result = false;
   // table event
   m_computationCost.IncrementEvents();
@@ -719,7 +893,8 @@ NfpRoutingProtocol::ReceiveHello (Ptr<const CCNxName> neighborName, uint16_t msg
       // not in map
       m_computationCost.IncrementEvents();
       Ptr<NfpNeighbor> neighbor = Create<NfpNeighbor> (neighborName, ingressConnection, msgSeqnum, m_neighborTimeout,
-                                                       MakeCallback (&NfpRoutingProtocol::NeighborStateChanged, this));
+                                                       MakeCallback (&NfpRoutingProtocol::NeighborStateChanged, this),
+                                                       m_neighborTimers);
       m_neighbors[key] = neighbor;
       NS_LOG_DEBUG ("ReceiveHello from " << *neighborName << " ConnId " << ingressConnection->GetConnectionId () << " msgSeqnum " << msgSeqnum << " add new neighbor");
       result = true;
@@ -732,6 +907,9 @@ void
 NfpRoutingProtocol::NeighborStateChanged (Ptr<NfpNeighborKey> neighborKey)
 {
   NS_LOG_FUNCTION (this << *neighborKey);
+
+  NfpWallClockProfile::ScopedTimer profileTimer (GetProfile (), NfpWallClockProfile::NEIGHBOR);
+
   NeighborMapType::iterator i = m_neighbors.find (neighborKey);
   NS_ASSERT_MSG (i != m_neighbors.end (), "Got a state change callback but cannot find neighbor in map: " << *neighborKey);
 
@@ -755,15 +933,15 @@ NfpRoutingProtocol::GetModelFibRoute (Ptr<const CCNxName> prefix)
 {
   m_computationCost.IncrementEvents();
   Ptr<CCNxRoute> route;
-  ModelFibType::iterator i = m_modelFib.find (prefix);
-  if (i == m_modelFib.end ())
+  Ptr<CCNxRoute> *found = m_modelFib.Find (prefix);
+  if (!found)
     {
       route = Create<CCNxRoute> (prefix);
-      m_modelFib[prefix] = route;
+      m_modelFib.Insert (prefix, route);
     }
   else
     {
-      route = i->second;
+      route = *found;
     }
   return route;
 }
@@ -774,18 +952,13 @@ NfpRoutingProtocol::AddAnchorToFib (Ptr<NfpPrefix> prefixEntry, Ptr<const CCNxNa
   NS_LOG_FUNCTION (this << *prefixEntry << *anchorName);
   NS_LOG_DEBUG ("AddAnchorToFib: prefix " << *prefixEntry->GetPrefix ());
 
-  Ptr<CCNxL3Protocol> ccnx = m_node->GetObject<CCNxL3Protocol> ();
-  Ptr<CCNxForwarder> forwarder = m_node->GetObject<CCNxForwarder> ();
-
-  Ptr<CCNxRoute> currentRoute = prefixEntry->GetRoute ();
-  Ptr<CCNxRoute> modelRoute   = GetModelFibRoute (prefixEntry->GetPrefix ());
-
-  // For now, we simply remove everything from modelRoute then add everything from currentRoute.
-  forwarder->RemoveRoute (modelRoute);
-  forwarder->AddRoute (currentRoute);
+  UpdateFibRoute (prefixEntry);
+  UpdateDescendantFibRoutes (prefixEntry->GetPrefix ());
 
-  m_computationCost.IncrementEvents();
-  m_modelFib[prefixEntry->GetPrefix ()] = currentRoute;
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->FibRouteAdded (m_node->GetId (), prefixEntry->GetPrefix (), anchorName);
+    }
 }
 
 void
@@ -794,18 +967,106 @@ NfpRoutingProtocol::RemoveAnchorFromFib (Ptr<NfpPrefix> prefixEntry, Ptr<const C
   NS_LOG_FUNCTION (this << *prefixEntry << *anchorName);
   NS_LOG_DEBUG ("RemoveAnchorFromFib: prefix " << *prefixEntry->GetPrefix ());
 
-  Ptr<CCNxL3Protocol> ccnx = m_node->GetObject<CCNxL3Protocol> ();
+  UpdateFibRoute (prefixEntry);
+  UpdateDescendantFibRoutes (prefixEntry->GetPrefix ());
+
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->FibRouteRemoved (m_node->GetId (), prefixEntry->GetPrefix (), anchorName);
+    }
+}
+
+void
+NfpRoutingProtocol::UpdateFibRoute (Ptr<NfpPrefix> prefixEntry)
+{
   Ptr<CCNxForwarder> forwarder = m_node->GetObject<CCNxForwarder> ();
 
   Ptr<CCNxRoute> currentRoute = prefixEntry->GetRoute ();
-  Ptr<CCNxRoute> modelRoute   = GetModelFibRoute (prefixEntry->GetPrefix ());
+  if (IsRouteSummarized (prefixEntry->GetPrefix (), currentRoute))
+    {
+      // The parent route forwards the same way, so the FIB does not need this one
+      NS_LOG_DEBUG ("Summarize route " << *prefixEntry->GetPrefix ());
+      currentRoute = Create<CCNxRoute> (prefixEntry->GetPrefix ());
+    }
+
+  Ptr<CCNxRoute> modelRoute = GetModelFibRoute (prefixEntry->GetPrefix ());
+  if (modelRoute->Equals (*currentRoute))
+    {
+      return;
+    }
 
   // For now, we simply remove everything from modelRoute then add everything from currentRoute.
   forwarder->RemoveRoute (modelRoute);
   forwarder->AddRoute (currentRoute);
 
   m_computationCost.IncrementEvents();
-  m_modelFib[prefixEntry->GetPrefix ()] = currentRoute;
+  m_modelFib.Insert (prefixEntry->GetPrefix (), currentRoute);
+}
+
+void
+NfpRoutingProtocol::UpdateDescendantFibRoutes (Ptr<const CCNxName> prefix)
+{
+  if (!m_summarize)
+    {
+      return;
+    }
+
+  // The route of `prefix` changed, so whether a descendant is summarized may have changed
+  NfpPrefixIndex::NameSetType descendants = m_prefixIndex.GetDescendants (prefix);
+  for (NfpPrefixIndex::NameSetType::const_iterator i = descendants.begin (); i != descendants.end (); ++i)
+    {
+      m_computationCost.IncrementLoopIterations();
+      Ptr<NfpPrefix> *found = m_prefixes.Find (*i);
+      NS_ASSERT_MSG (found, "Prefix index entry not in m_prefixes " << **i);
+      UpdateFibRoute (*found);
+    }
+}
+
+bool
+NfpRoutingProtocol::IsRouteSummarized (Ptr<const CCNxName> prefix, Ptr<const CCNxRoute> route)
+{
+  if (!m_summarize || route->empty ())
+    {
+      return false;
+    }
+
+  // The FIB will match the nearest reachable parent, so compare against that one
+  std::vector< Ptr<const CCNxName> > ancestors = m_prefixIndex.GetAncestors (prefix);
+  for (size_t i = 0; i < ancestors.size (); i++)
+    {
+      m_computationCost.IncrementLoopIterations();
+      Ptr<NfpPrefix> *found = m_prefixes.Find (ancestors[i]);
+      NS_ASSERT_MSG (found, "Prefix index entry not in m_prefixes " << *ancestors[i]);
+      if ((*found)->IsReachable ())
+        {
+          return HasSameNexthops (route, (*found)->GetRoute ());
+        }
+    }
+  return false;
+}
+
+bool
+NfpRoutingProtocol::HasSameNexthops (Ptr<const CCNxRoute> a, Ptr<const CCNxRoute> b)
+{
+  std::set<CCNxConnection::ConnIdType> aConnections;
+  for (CCNxRoute::const_iterator i = a->begin (); i != a->end (); ++i)
+    {
+      aConnections.insert ((*i)->GetConnection ()->GetConnectionId ());
+    }
+
+  std::set<CCNxConnection::ConnIdType> bConnections;
+  for (CCNxRoute::const_iterator i = b->begin (); i != b->end (); ++i)
+    {
+      bConnections.insert ((*i)->GetConnection ()->GetConnectionId ());
+    }
+
+  return aConnections == bConnections;
+}
+
+bool
+NfpRoutingProtocol::IsAnchorSummarized (Ptr<const CCNxName> prefix) const
+{
+  return m_summarize && m_anchorIndex.GetNearestAncestor (prefix);
 }
 
 void
@@ -820,9 +1081,10 @@ NfpRoutingProtocol::PrefixStateChanged (Ptr<const CCNxName> prefix, Ptr<const CC
   // Add or remove entries from the FIB
 
   m_computationCost.IncrementEvents();
-  Ptr<NfpPrefix> prefixEntry = m_prefixes[prefix];
-  if (prefixEntry)
+  Ptr<NfpPrefix> *found = m_prefixes.Find (prefix);
+  if (found)
     {
+      Ptr<NfpPrefix> prefixEntry = *found;
       if (prefixEntry->IsReachable (anchorName))
         {
           AddAnchorToFib (prefixEntry, anchorName);
@@ -830,6 +1092,14 @@ NfpRoutingProtocol::PrefixStateChanged (Ptr<const CCNxName> prefix, Ptr<const CC
       else
         {
           RemoveAnchorFromFib (prefixEntry, anchorName);
+
+          // A flap is the loss of reachability
+          if (m_enableDamping && m_damping.RecordFlap (prefix, anchorName, GetCurrentTime ()))
+            {
+              NS_LOG_INFO ("Damping suppressed prefix " << *prefix << " anchor " << *anchorName);
+              m_stats.IncrementDampingSuppressed ();
+              ScheduleDampingReuse (prefix, anchorName);
+            }
         }
 
       if (prefixEntry->IsReachable()) {
@@ -844,15 +1114,50 @@ NfpRoutingProtocol::PrefixStateChanged (Ptr<const CCNxName> prefix, Ptr<const CC
     }
 }
 
+bool
+NfpRoutingProtocol::IsDampened (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  return m_enableDamping && m_damping.IsSuppressed (prefix, anchorName, GetCurrentTime ());
+}
+
+void
+NfpRoutingProtocol::ScheduleDampingReuse (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  // at least 1 msec so rounding at the reuse threshold cannot spin
+  Time delay = std::max (m_damping.GetReuseDelay (prefix, anchorName, GetCurrentTime ()), MilliSeconds (1));
+  Simulator::Schedule (delay, &NfpRoutingProtocol::DampingReuseExpired, this, prefix, anchorName);
+}
+
+void
+NfpRoutingProtocol::DampingReuseExpired (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  m_computationCost.IncrementEvents();
+  if (IsDampened (prefix, anchorName))
+    {
+      // it flapped again while suppressed
+      ScheduleDampingReuse (prefix, anchorName);
+    }
+  else
+    {
+      NS_LOG_INFO ("Damping reuse prefix " << *prefix << " anchor " << *anchorName);
+      AddWorkQueueEntry (anchorName, prefix);
+    }
+}
+
 void
 NfpRoutingProtocol::RemoveNeighborRoutes (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection)
 {
   NS_LOG_FUNCTION (this << *neighborName << connection->GetConnectionId ());
 
-  for (PrefixMapType::iterator i = m_prefixes.begin (); i != m_prefixes.end (); ++i)
+  for (size_t slot = 0; slot < m_prefixes.Capacity (); ++slot)
     {
+      if (!m_prefixes.IsOccupied (slot))
+        {
+          continue;
+        }
+
       m_computationCost.IncrementLoopIterations();
-      Ptr<NfpPrefix> prefix = i->second;
+      Ptr<NfpPrefix> prefix = m_prefixes.ValueAt (slot);
 
       // this may induce a callback to PrefixStateChanged()
       prefix->RemoveConnection (connection);
@@ -881,13 +1186,14 @@ NfpRoutingProtocol::GetMinimumMtu (void) const
 void
 NfpRoutingProtocol::SendFromWorkQueue (Ptr<NfpPayload> payload)
 {
-  Ptr<CCNxPacket> packet = CreatePacket (payload);
-  Broadcast (packet);
+  Broadcast (payload);
 }
 
 void
 NfpRoutingProtocol::ProcessWorkQueue (void)
 {
+  NfpWallClockProfile::ScopedTimer profileTimer (GetProfile (), NfpWallClockProfile::PROCESS_WORK_QUEUE);
+
   if (!m_workQueue.empty()) {
       NS_LOG_DEBUG("Node " << m_node->GetId() << " Process work queue");
 
@@ -900,20 +1206,22 @@ NfpRoutingProtocol::ProcessWorkQueue (void)
           NS_LOG_DEBUG ("ProcessWorkQueue workEntry " << *workEntry);
 
           m_computationCost.IncrementEvents();
-          PrefixMapType::const_iterator i = m_prefixes.find (workEntry->GetPrefix ());
-          if (i != m_prefixes.end ())
+          Ptr<NfpPrefix> *found = m_prefixes.Find (workEntry->GetPrefix ());
+          if (found)
             {
-              Ptr<NfpPrefix> prefixEntry = i->second;
-              if (prefixEntry->IsReachable (workEntry->GetAnchorName ()))
+              Ptr<NfpPrefix> prefixEntry = *found;
+              if (prefixEntry->IsReachable (workEntry->GetAnchorName ())
+                  && !IsDampened (workEntry->GetPrefix (), workEntry->GetAnchorName ()))
                 {
                   // send an advertisement
 
-                  Ptr<const NfpAdvertise> bestInRib = prefixEntry->GetAdvertisement (workEntry->GetAnchorName ());
-                  NS_ASSERT_MSG (bestInRib, "Failed to retrieve stored advertisement for someting in workqueue");
-
                   // TODO: Implement link cost table
                   uint16_t linkcost = 1;
-                  Ptr<NfpAdvertise> advertise = Create<NfpAdvertise> (*bestInRib, linkcost);
+
+                  // The prefix entry keeps the re-advertisement until the best route changes, so
+                  // the periodic refresh of a stable route does not copy the advertisement.
+                  Ptr<NfpAdvertise> advertise = prefixEntry->GetReadvertisement (workEntry->GetAnchorName (), linkcost);
+                  NS_ASSERT_MSG (advertise, "Failed to retrieve stored advertisement for someting in workqueue");
 
                   if (advertise->GetSerializedSize () > payload->GetRemaining ())
                     {
@@ -928,7 +1236,7 @@ NfpRoutingProtocol::ProcessWorkQueue (void)
                 }
               else
                 {
-                  // send a withdraw
+                  // send a withdraw (also for a reachable pair that is suppressed by flap damping)
 
                   Ptr<NfpWithdraw> withdraw = Create<NfpWithdraw> (workEntry->GetAnchorName (), prefixEntry->GetPrefix ());
                   if (withdraw->GetSerializedSize () > payload->GetRemaining ())
@@ -961,23 +1269,182 @@ NfpRoutingProtocol::ProcessWorkQueue (void)
 }
 
 void
-NfpRoutingProtocol::Broadcast (Ptr<CCNxPacket> packet)
+NfpRoutingProtocol::Broadcast (Ptr<NfpPayload> payload)
+{
+  NS_ASSERT_MSG (m_portal, "CCNxPortal not created");
+
+  Ptr<CCNxPacket> packet = CreatePacket (payload);
+  for (InterfaceMapType::const_iterator i = m_interfaces.begin (); i != m_interfaces.end (); ++i)
+    {
+      m_computationCost.IncrementLoopIterations();
+      SendOnInterface (i->first, payload, packet);
+    }
+}
+
+void
+NfpRoutingProtocol::BroadcastHello (Ptr<NfpPayload> payload)
 {
   NS_ASSERT_MSG (m_portal, "CCNxPortal not created");
 
+  Ptr<CCNxPacket> packet = CreatePacket (payload);
   for (InterfaceMapType::const_iterator i = m_interfaces.begin (); i != m_interfaces.end (); ++i)
     {
       m_computationCost.IncrementLoopIterations();
-      m_stats.IncrementPayloadsSent();
-      m_stats.IncrementBytesSent (packet->GetMessage ()->GetPayload ()->GetSize ());
+      TransmitOnInterface (i->first, packet);
+    }
+}
 
-      Ptr<CCNxL3Interface> l3interface = i->second;
-      Ptr<CCNxConnection> broadcastConnection = l3interface->GetBroadcastConnection ();
+void
+NfpRoutingProtocol::SendOnInterface (uint32_t interface, Ptr<NfpPayload> payload, Ptr<CCNxPacket> packet)
+{
+  InterfacePacerMapType::iterator i = m_pacers.find (interface);
+  if (i == m_pacers.end ())
+    {
+      InterfacePacer pacer;
+      pacer.bucket = NfpTokenBucket (m_interfaceRateLimit, m_interfaceBurst);
+      i = m_pacers.insert (std::make_pair (interface, pacer)).first;
+    }
 
-      NS_LOG_DEBUG ("SendTo(" << *packet << ", " << broadcastConnection->GetConnectionId () << ")");
-      m_portal->SendTo (packet, broadcastConnection->GetConnectionId ());
+  InterfacePacer &pacer = i->second;
+  uint32_t bytes = packet->GetMessage ()->GetPayload ()->GetSize ();
+  if (pacer.queue.empty () && pacer.bucket.Consume (bytes, GetCurrentTime ()))
+    {
+      TransmitOnInterface (interface, packet);
     }
+  else
+    {
+      NS_LOG_DEBUG ("Rate limit interface " << interface << " queue " << pacer.queue.size ());
+      if (pacer.queue.size () >= m_interfaceQueueLimit)
+        {
+          if (EvictAdvertisement (pacer, payload))
+            {
+              NS_LOG_INFO ("Rate limit interface " << interface << " queue full, dropped an advertisement");
+              m_stats.IncrementPacerDropped ();
+            }
+          else
+            {
+              NS_LOG_INFO ("Rate limit interface " << interface << " queue full of withdraws, over limit " << pacer.queue.size ());
+            }
+        }
 
+      PacedPayload entry;
+      entry.payload = payload;
+      entry.packet = packet;
+      pacer.queue.push_back (entry);
+      if (!pacer.drainEvent.IsRunning ())
+        {
+          Time delay = pacer.bucket.GetDelay (bytes, GetCurrentTime ());
+          pacer.drainEvent = Simulator::Schedule (delay, &NfpRoutingProtocol::DrainInterface, this, interface);
+        }
+    }
+}
+
+bool
+NfpRoutingProtocol::EvictAdvertisement (InterfacePacer &pacer, Ptr<NfpPayload> newer)
+{
+  PacedQueueType::iterator victim = pacer.queue.end ();
+  for (PacedQueueType::iterator i = pacer.queue.begin (); i != pacer.queue.end (); ++i)
+    {
+      m_computationCost.IncrementLoopIterations();
+
+      bool hasWithdraw = false;
+      bool samePrefix = false;
+      for (size_t m = 0; m < i->payload->GetMessageCount () && !hasWithdraw; ++m)
+        {
+          Ptr<NfpMessage> message = i->payload->GetMessage (m);
+          if (message->IsWithdraw ())
+            {
+              hasWithdraw = true;
+            }
+          else if (!samePrefix)
+            {
+              Ptr<const CCNxName> prefix = DynamicCast<NfpAdvertise, NfpMessage> (message)->GetPrefix ();
+              for (size_t n = 0; n < newer->GetMessageCount () && !samePrefix; ++n)
+                {
+                  Ptr<NfpMessage> other = newer->GetMessage (n);
+                  samePrefix = other->IsAdvertise ()
+                    && DynamicCast<NfpAdvertise, NfpMessage> (other)->GetPrefix ()->Equals (*prefix);
+                }
+            }
+        }
+
+      // NFP is soft state for advertisements: every route is advertised again within
+      // RouteTimeout.  A withdraw is only sent once, so it must stay in the queue.
+      if (hasWithdraw)
+        {
+          continue;
+        }
+
+      if (victim == pacer.queue.end ())
+        {
+          victim = i;
+        }
+
+      if (samePrefix)
+        {
+          // the newer payload supersedes what this one said about the prefix
+          victim = i;
+          break;
+        }
+    }
+
+  if (victim == pacer.queue.end ())
+    {
+      return false;
+    }
+
+  pacer.queue.erase (victim);
+  return true;
+}
+
+void
+NfpRoutingProtocol::DrainInterface (uint32_t interface)
+{
+  m_computationCost.IncrementEvents();
+
+  InterfacePacerMapType::iterator i = m_pacers.find (interface);
+  NS_ASSERT_MSG (i != m_pacers.end (), "Drain event for an interface without a pacer " << interface);
+  InterfacePacer &pacer = i->second;
+
+  if (m_interfaces.find (interface) == m_interfaces.end ())
+    {
+      // the interface went down while we were waiting
+      pacer.queue.clear ();
+      return;
+    }
+
+  while (!pacer.queue.empty ())
+    {
+      m_computationCost.IncrementLoopIterations();
+      Ptr<CCNxPacket> packet = pacer.queue.front ().packet;
+      uint32_t bytes = packet->GetMessage ()->GetPayload ()->GetSize ();
+      if (!pacer.bucket.Consume (bytes, GetCurrentTime ()))
+        {
+          Time delay = pacer.bucket.GetDelay (bytes, GetCurrentTime ());
+          pacer.drainEvent = Simulator::Schedule (delay, &NfpRoutingProtocol::DrainInterface, this, interface);
+          break;
+        }
+
+      pacer.queue.pop_front ();
+      TransmitOnInterface (interface, packet);
+    }
+}
+
+void
+NfpRoutingProtocol::TransmitOnInterface (uint32_t interface, Ptr<CCNxPacket> packet)
+{
+  m_stats.IncrementPayloadsSent();
+  m_stats.IncrementBytesSent (packet->GetMessage ()->GetPayload ()->GetSize ());
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->ControlBytesSent (packet->GetMessage ()->GetPayload ()->GetSize ());
+    }
+
+  Ptr<CCNxL3Interface> l3interface = m_interfaces[interface];
+  Ptr<CCNxConnection> broadcastConnection = l3interface->GetBroadcastConnection ();
+
+  NS_LOG_DEBUG ("SendTo(" << *packet << ", " << broadcastConnection->GetConnectionId () << ")");
+  m_portal->SendTo (packet, broadcastConnection->GetConnectionId ());
   m_lastBroadcast = GetCurrentTime ();
 }
 
@@ -1024,6 +1491,10 @@ NfpRoutingProtocol::SetNode (Ptr<Node> node)
   NS_ASSERT_MSG (m_ccnx, "Failed to lookup the CCNxL3Protocol on this node");
 
   m_stats.SetNodeId(node->GetId());
+  if (m_convergenceObserver)
+    {
+      m_convergenceObserver->RegisterNode (node->GetId ());
+    }
 
   SetRouterName ();
 }
@@ -1077,8 +1548,18 @@ NfpRoutingProtocol::PrintRoutingTable (Ptr<OutputStreamWrapper> streamWrapper) c
   (*timePrinter)(*stream);
   *stream << std::setw (5) << m_node->GetId ();
   *stream << " Routing table for " << *m_routerName << std::endl;
+  // The prefix table is a hash table, so sort by name for a stable listing
+  std::map< Ptr<const CCNxName>, Ptr<const NfpPrefix>, CCNxName::isLessPtrCCNxName > sorted;
+  for (size_t slot = 0; slot < m_prefixes.Capacity (); ++slot)
+    {
+      if (m_prefixes.IsOccupied (slot))
+        {
+          sorted[m_prefixes.KeyAt (slot)] = m_prefixes.ValueAt (slot);
+        }
+    }
+
   size_t count = 0;
-  for (PrefixMapType::const_iterator i = m_prefixes.cbegin (); i != m_prefixes.cend (); i++)
+  for (std::map< Ptr<const CCNxName>, Ptr<const NfpPrefix>, CCNxName::isLessPtrCCNxName >::const_iterator i = sorted.begin (); i != sorted.end (); i++)
     {
       Ptr<const NfpPrefix> prefix = i->second;
       *stream << "      " << *prefix << std::endl;
@@ -1120,8 +1601,10 @@ NfpComputationCost
 NfpRoutingProtocol::GetComputationCost() const
 {
   NfpComputationCost total(m_computationCost);
-  for (PrefixMapType::const_iterator i = m_prefixes.begin(); i != m_prefixes.end(); ++i) {
-      total += i->second->GetComputationCost();
+  for (size_t slot = 0; slot < m_prefixes.Capacity (); ++slot) {
+      if (m_prefixes.IsOccupied (slot)) {
+          total += m_prefixes.ValueAt (slot)->GetComputationCost();
+      }
   }
 
   for (NeighborMapType::const_iterator i = m_neighbors.begin(); i != m_neighbors.end(); ++i) {
@@ -1147,4 +1630,23 @@ NfpRoutingProtocol::PrintComputationCost (Ptr<OutputStreamWrapper> streamWrapper
   (*timePrinter)(*stream);
   *stream << std::setw (5) << m_node->GetId ();
   *stream << " " << GetComputationCost() << std::endl;
+
+  if (m_enableProfiling)
+    {
+      (*timePrinter)(*stream);
+      *stream << std::setw (5) << m_node->GetId ();
+      *stream << " " << m_profile << std::endl;
+    }
+}
+
+NfpWallClockProfile
+NfpRoutingProtocol::GetWallClockProfile () const
+{
+  return m_profile;
+}
+
+NfpWallClockProfile *
+NfpRoutingProtocol::GetProfile ()
+{
+  return m_enableProfiling ? &m_profile : 0;
 }
@@ -58,6 +58,7 @@
 
 #include <list>
 #include <map>
+#include <deque>
 
 #include "ns3/ccnx-l3-protocol.h"
 #include "ns3/ccnx-routing-protocol.h"
@@ -76,6 +77,13 @@
 
 #include "ns3/nfp-computation-cost.h"
 #include "ns3/nfp-stats.h"
+#include "ns3/nfp-convergence-observer.h"
+#include "ns3/nfp-wall-clock-profile.h"
+#include "ns3/nfp-prefix-index.h"
+#include "ns3/nfp-flap-damping.h"
+#include "ns3/nfp-token-bucket.h"
+#include "ns3/event-id.h"
+#include "ns3/ccnx-flat-hash-map.h"
 
 // For unit tests
 class NfpRoutingProtocolFriend;
@@ -157,6 +165,8 @@ namespace ccnx {
  *
  *      m_neighbors   : CCNxName -> NfpNeighbor  (routerName -> neighbor entry)
  *
+ *      The neighbor expiry timers all live in m_neighborTimers, an indexed heap driven by one simulator event.
+ *
  * @subsection prefix-table Prefix Table
  *      The prefix table stores the individual best advertisements we have seen for each (prefix, anchorName) pair.
  *      It has a callback to PrefixStateChanged() when a (prefix, anchorName) becomes reachable or unreachable.  There currently is
@@ -166,11 +176,16 @@ namespace ccnx {
  *
  *      m_prefixes    : CCNxName -> NfpPrefix    (prefixName -> prefix entry)
  *
+ *      The table is a hash map on the prefix name (not on the Ptr) so it scales to a large number
+ *      of advertised prefixes.  Each NfpPrefix caches whether it is reachable, and caches the
+ *      message it re-advertises for each anchor, so a periodic re-advertisement does not copy it.
+ *
  * @subsection model-fib Model FIB
  *      The model FIB keeps track of all the state we have injected into the FIB, organized by prefix.  When we need
  *      to make an update, we can get the current route out of the RIB and compare it to the model FIB.  We then
  *      add the updates from the RIB to the FIB and remove any stale routes from the FIB not in the RIB.  We do it
- *      in that order so there's always a route in the FIB, if possible.
+ *      in that order so there's always a route in the FIB, if possible.  A prefix's FIB entry is updated when
+ *      an anchor becomes reachable or unreachable, and when an advertisement or withdraw changes its nexthops.
  *
  *      m_modelFib    : CCNxName -> CCNxRoute    (prefixName -> CCNxRoute)
  *
@@ -191,8 +206,9 @@ namespace ccnx {
  *
  * @subsection prefix-timer-heap Prefix Timer Heap
  *      The heap tracks the expiry time of each (prefix, anchorName) pair.  We insert a record into the heap
- *      every time we advertise a (prefix, anchorName) with the new expiry time of the record.  We can then
- *      Peek() and Pop() from the top of the heap, which is the next timer that will expire.
+ *      every time we advertise a (prefix, anchorName) with the new expiry time of the record, which moves
+ *      an existing record in place.  We can then Peek() and Pop() from the top of the heap, which is the
+ *      next timer that will expire.
  *
  *      m_prefixTimerHeap : NfpPrefixTimerHeap
  *
@@ -221,6 +237,37 @@ namespace ccnx {
  *
  * @subsection adv-timer Advertise Timer
  *
+ * @subsection triggered-timer Triggered Update Timer
+ *      Changes queued in the work queue are sent after TriggeredUpdateInterval (jittered by TriggeredUpdateJitter).
+ *
+ * @section damping Flap Damping and Rate Limiting
+ *      If the attribute EnableDamping is true, each time a (prefix, anchorName) pair becomes unreachable it
+ *      gets a penalty (m_damping, NfpFlapDamping) that decays exponentially with DampingHalfLife.  Above
+ *      DampingSuppress the pair is advertised as withdrawn, even if reachable, until the penalty decays
+ *      below DampingReuse.  The FIB is not affected.
+ *
+ *      If the attribute InterfaceRateLimit is not 0, payloads sent on each interface are paced by a
+ *      token bucket (NfpTokenBucket) of InterfaceBurst bytes.  Payloads over the limit wait in a
+ *      per-interface queue (m_pacers) of up to InterfaceQueueLimit payloads.  When the queue is full
+ *      we drop a queued advertisement, preferring an older one for a prefix the new payload also
+ *      advertises; its routes are advertised again within RouteTimeout.  Payloads carrying a
+ *      withdraw are never dropped, so the queue may exceed the limit if it holds only withdraws.
+ *      Hellos bypass the rate limit so a busy interface does not look dead to its neighbors.
+ *
+ * @section summarization Summarization
+ *      If the attribute Summarize is true, NFP aggregates routes under a covering prefix.
+ *      - An anchor name covered by another of our anchor names (a proper prefix of it) is not advertised.
+ *        Adding the covering prefix withdraws the names it covers, and removing it advertises them again.
+ *      - A RIB route is not installed in the FIB if the nearest reachable parent prefix in the RIB has the
+ *        same set of nexthop connections, as the FIB's longest match on the parent forwards the same way.
+ *        When a prefix's route changes, we re-evaluate all its descendants.
+ *
+ *      m_anchorIndex and m_prefixIndex (NfpPrefixIndex) answer the ancestor and descendant queries.
+ *
+ * @section convergence Convergence Observer
+ *      If the attribute ConvergenceObserver is set to an NfpConvergenceObserver shared by all nodes, we report
+ *      anchor prefix changes, FIB updates per (prefix, anchorName), and the bytes we broadcast.  The observer
+ *      measures how long each change takes to reach every FIB.
  *
  * Notes:
  * - If a neighbor goes down, we need to scan m_prefixes to find any entries that use the
@@ -300,8 +347,18 @@ public:
 
   NfpComputationCost GetComputationCost() const;
 
+  /**
+   * Prints the routing stats and computation cost.  If the attribute EnableProfiling is true,
+   * also prints the wall-clock profile of the handlers.
+   */
   void PrintComputationCost (Ptr<OutputStreamWrapper> streamWrapper) const;
 
+  /**
+   * The wall-clock time spent in the NFP handlers.  All zeros unless the attribute
+   * EnableProfiling is true.
+   */
+  NfpWallClockProfile GetWallClockProfile () const;
+
   NfpStats GetStats() const;
 
 protected:
@@ -533,7 +590,8 @@ protected:
   Timer m_helloTimer;
 
   /**
-   * The time we sent our last broadcast packet.  This is used to determine if we need to send
+   * The time our last payload left on an interface (set in TransmitOnInterface(), not when a payload
+   * is queued by the rate limit).  This is used to determine if we need to send
    * a Hello message when the hello timer expires.  If m_lastBroadcast + m_helloInterval <= GetCurrentTime(),
    * then we need to send a hello packet.
    */
@@ -560,6 +618,11 @@ protected:
    */
   NeighborMapType m_neighbors;
 
+  /**
+   * Runs the expiry timers of all of m_neighbors with one simulator event
+   */
+  Ptr<NfpTimerScheduler> m_neighborTimers;
+
   /**
    * Passed as the callback to NfpNeighbor for when its state changes.
    * UP: We can use the neighbor as a successor
@@ -577,9 +640,10 @@ protected:
   void RemoveNeighborRoutes (Ptr<const CCNxName> neighborName, Ptr<CCNxConnection> connection);
 
   /**
-   * Prefix routes are indexed by the prefix name, which then holds state for each anchor
+   * Prefix routes are indexed by the prefix name, which then holds state for each anchor.
+   * It is a hash table on the name, so lookups do not depend on the number of prefixes.
    */
-  typedef std::map< Ptr<const CCNxName>, Ptr<NfpPrefix>, CCNxName::isLessPtrCCNxName > PrefixMapType;
+  typedef CCNxFlatHashMap< Ptr<const CCNxName>, Ptr<NfpPrefix>, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > PrefixMapType;
 
   /**
    * Our routing state.  This is also known as the Route Information Base (RIB).
@@ -595,7 +659,7 @@ protected:
    * The type we use to store the model FIB.  The model FIB stores our image of what is in
    * the actual FIB so we know what our diffs look like.
    */
-  typedef std::map< Ptr<const CCNxName>, Ptr<CCNxRoute> > ModelFibType;
+  typedef CCNxFlatHashMap< Ptr<const CCNxName>, Ptr<CCNxRoute>, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName > ModelFibType;
 
   /**
    * Stores the model FIB.
@@ -627,6 +691,34 @@ protected:
    */
   void AddAnchorToFib (Ptr<NfpPrefix> prefixEntry, Ptr<const CCNxName> anchorName);
 
+  /**
+   * Makes the FIB entry of a prefix match its RIB route (m_prefixes), or removes it if the route
+   * is summarized.  Uses m_modelFib to know what is in the FIB.
+   */
+  void UpdateFibRoute (Ptr<NfpPrefix> prefixEntry);
+
+  /**
+   * If summarizing, calls UpdateFibRoute() on every RIB prefix below `prefix`, because the
+   * route of `prefix` changed.
+   */
+  void UpdateDescendantFibRoutes (Ptr<const CCNxName> prefix);
+
+  /**
+   * True if we are summarizing and the nearest reachable parent of `prefix` in the RIB has the
+   * same nexthops as `route`.  An empty route is never summarized.
+   */
+  bool IsRouteSummarized (Ptr<const CCNxName> prefix, Ptr<const CCNxRoute> route);
+
+  /**
+   * True if both routes use the same set of nexthop connections (costs are ignored)
+   */
+  static bool HasSameNexthops (Ptr<const CCNxRoute> a, Ptr<const CCNxRoute> b);
+
+  /**
+   * True if we are summarizing and another of our anchor names covers `prefix`, so we do not advertise it
+   */
+  bool IsAnchorSummarized (Ptr<const CCNxName> prefix) const;
+
   /**
    * Called by PrefixStateChanged, will remove all the next hops for an anchor to the FIB.
    *
@@ -664,6 +756,12 @@ protected:
    */
   NfpStats m_stats;
 
+  /**
+   * If set (attribute ConvergenceObserver), we report anchor changes, FIB updates, and
+   * control bytes sent to it.
+   */
+  Ptr<NfpConvergenceObserver> m_convergenceObserver;
+
   /**
    * Callback of Timer when m_helloTimer expires
    */
@@ -723,14 +821,102 @@ protected:
   Ptr<CCNxPacket> CreatePacket (Ptr<NfpPayload> payload);
 
   /**
-   * Broad cast a packet out all our interfaces.
+   * Broad cast a payload out all our interfaces, subject to each interface's rate limit.
    *
-   * @param packet The Interest to broadcast.
+   * @param payload The NFP payload to broadcast.
    */
-  void Broadcast (Ptr<CCNxPacket> packet);
+  void Broadcast (Ptr<NfpPayload> payload);
 
   /**
-   * Send a payload generated from ProcessWorkQueue.  Creates a packet and calls Broadcast().
+   * Send a Hello out all our interfaces now.  Hellos are not paced: they prove we are alive,
+   * so they must not wait behind queued advertisements past a neighbor's timeout.
+   *
+   * @param payload The (empty) NFP payload of the Hello
+   */
+  void BroadcastHello (Ptr<NfpPayload> payload);
+
+  /**
+   * Send a packet on one interface, subject to the interface's rate limit.  If there
+   * are no tokens, the packet is queued until DrainInterface().
+   *
+   * @param interface The interface index
+   * @param payload The NFP payload in the packet
+   * @param packet The Interest to send
+   */
+  void SendOnInterface (uint32_t interface, Ptr<NfpPayload> payload, Ptr<CCNxPacket> packet);
+
+  /**
+   * Send as many queued packets of an interface as its token bucket allows.
+   *
+   * @param interface The interface index
+   */
+  void DrainInterface (uint32_t interface);
+
+  /**
+   * Send a packet on an interface's broadcast connection now.
+   *
+   * @param interface The interface index
+   * @param packet The Interest to send
+   */
+  void TransmitOnInterface (uint32_t interface, Ptr<CCNxPacket> packet);
+
+  /**
+   * A payload waiting for tokens.  We keep the payload next to its packet so the queue
+   * can tell advertisements from withdraws without parsing the packet.
+   */
+  struct PacedPayload
+  {
+    Ptr<NfpPayload> payload;
+    Ptr<CCNxPacket> packet;
+  };
+
+  typedef std::deque< PacedPayload > PacedQueueType;
+
+  /**
+   * The rate limit state of one interface.
+   */
+  struct InterfacePacer
+  {
+    NfpTokenBucket bucket;
+    PacedQueueType queue;
+    EventId drainEvent;
+  };
+
+  /**
+   * Make room in a full pacer queue for `newer`.  A queued withdraw is never dropped, as
+   * nothing would send it again.  We drop the oldest advertisement-only payload that advertises
+   * a prefix also in `newer`, else the oldest advertisement-only payload.
+   *
+   * @param pacer The interface's pacer
+   * @param newer The payload we are about to queue
+   * @return true if a payload was dropped, false if the queue only holds withdraws
+   */
+  bool EvictAdvertisement (InterfacePacer &pacer, Ptr<NfpPayload> newer);
+
+  typedef std::map< uint32_t, InterfacePacer > InterfacePacerMapType;
+
+  /**
+   * Per-interface rate limit, created on first use
+   */
+  InterfacePacerMapType m_pacers;
+
+  /**
+   * Set by the attribute InterfaceRateLimit (0 is unlimited)
+   */
+  DataRate m_interfaceRateLimit;
+
+  /**
+   * Set by the attribute InterfaceBurst
+   */
+  uint32_t m_interfaceBurst;
+
+  /**
+   * Set by the attribute InterfaceQueueLimit
+   */
+  uint32_t m_interfaceQueueLimit;
+
+  /**
+   * Send a payload generated from ProcessWorkQueue via Broadcast().
    */
   void SendFromWorkQueue (Ptr<NfpPayload> payload);
 
@@ -758,6 +944,37 @@ protected:
 
   NfpComputationCost m_computationCost;
 
+  /**
+   * Set by the attribute Summarize
+   */
+  bool m_summarize;
+
+  /**
+   * Our anchor names, by name, for summarization
+   */
+  NfpPrefixIndex m_anchorIndex;
+
+  /**
+   * The prefixes of m_prefixes, for summarization.  Only filled if m_summarize.
+   */
+  NfpPrefixIndex m_prefixIndex;
+
+  /**
+   * Set by the attribute EnableProfiling
+   */
+  bool m_enableProfiling;
+
+  /**
+   * Wall-clock time of ReceivePayload, ProcessWorkQueue, AdvertiseTimerExpired, and
+   * the neighbor handlers (ReceiveHello and NeighborStateChanged).
+   */
+  NfpWallClockProfile m_profile;
+
+  /**
+   * The profile to pass to a NfpWallClockProfile::ScopedTimer, or null if profiling is disabled.
+   */
+  NfpWallClockProfile * GetProfile ();
+
   /**
    * Whenever there is a change that requires a message to be sent, we queue it and start
    * (if not running) this timer so we send the messages a short delay later.
@@ -775,6 +992,50 @@ protected:
    */
   void SetProcessWorkQueueTimer();
 
+  /**
+   * Set by the attribute TriggeredUpdateInterval
+   */
+  Time m_triggeredUpdateInterval;
+
+  /**
+   * Set by the attribute TriggeredUpdateJitter
+   */
+  Time m_triggeredUpdateJitter;
+
+  /**
+   * Set by the attribute EnableDamping
+   */
+  bool m_enableDamping;
+
+  /**
+   * Set by the Damping* attributes, passed to m_damping in DoInitialize
+   */
+  Time m_dampingHalfLife;
+  double m_dampingPenalty;
+  double m_dampingSuppress;
+  double m_dampingReuse;
+  double m_dampingMaxPenalty;
+
+  /**
+   * Flap penalties of (prefix, anchorName) pairs.  Only used if m_enableDamping.
+   */
+  NfpFlapDamping m_damping;
+
+  /**
+   * @return true if damping is enabled and the pair is suppressed
+   */
+  bool IsDampened (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * Schedule DampingReuseExpired() for when the pair's penalty decays below the reuse threshold.
+   */
+  void ScheduleDampingReuse (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
+  /**
+   * If the pair is no longer suppressed, put it in the work queue to advertise its current state.
+   */
+  void DampingReuseExpired (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName);
+
 };
 }
 }
@@ -65,7 +65,8 @@ NfpStats::NfpStats ()
   : m_nodeId(0),
     m_payloadsSent (0), m_bytesSent (0), m_payloadsReceived (0), m_bytesReceived (0), m_hellosSent(0),
     m_advertiseOriginated (0), m_advertiseSent (0), m_advertiseReceived (0), m_advertiseReceivedFeasible (0),
-    m_withdrawOriginated(0), m_withdrawSent (0), m_withdrawReceived (0)
+    m_withdrawOriginated(0), m_withdrawSent (0), m_withdrawReceived (0),
+    m_dampingSuppressed (0), m_pacerDropped (0)
 {
 }
 
@@ -75,7 +76,8 @@ NfpStats::NfpStats(const NfpStats &copy)
     m_bytesReceived (copy.m_bytesReceived), m_hellosSent (copy.m_hellosSent),
     m_advertiseOriginated (copy.m_advertiseOriginated), m_advertiseSent (copy.m_advertiseSent), m_advertiseReceived (copy.m_advertiseReceived),
     m_advertiseReceivedFeasible (copy.m_advertiseReceivedFeasible),
-    m_withdrawOriginated(copy.m_withdrawOriginated), m_withdrawSent (copy.m_withdrawSent), m_withdrawReceived (copy.m_withdrawReceived)
+    m_withdrawOriginated(copy.m_withdrawOriginated), m_withdrawSent (copy.m_withdrawSent), m_withdrawReceived (copy.m_withdrawReceived),
+    m_dampingSuppressed (copy.m_dampingSuppressed), m_pacerDropped (copy.m_pacerDropped)
 {
 
 }
@@ -103,6 +105,9 @@ NfpStats::operator += (const NfpStats &other)
   m_withdrawOriginated+= other.m_withdrawOriginated;
   m_withdrawSent += other.m_withdrawSent;
   m_withdrawReceived += other.m_withdrawReceived;
+
+  m_dampingSuppressed += other.m_dampingSuppressed;
+  m_pacerDropped += other.m_pacerDropped;
   return *this;
 }
 
@@ -221,6 +226,26 @@ uint64_t NfpStats::GetWithdrawReceived() const
   return m_withdrawReceived;
 }
 
+void NfpStats::IncrementDampingSuppressed()
+{
+  m_dampingSuppressed++;
+}
+
+uint64_t NfpStats::GetDampingSuppressed() const
+{
+  return m_dampingSuppressed;
+}
+
+void NfpStats::IncrementPacerDropped()
+{
+  m_pacerDropped++;
+}
+
+uint64_t NfpStats::GetPacerDropped() const
+{
+  return m_pacerDropped;
+}
+
 void NfpStats::IncrementHellosSent()
 {
   m_hellosSent++;
@@ -256,7 +281,9 @@ ns3::ccnx::operator << (std::ostream &os, const NfpStats &stats)
   os << " Routing stats";
   os << " withdraw orig " << stats.m_withdrawOriginated;
   os << " recv " << stats.m_withdrawReceived;
-  os << " sent " << stats.m_withdrawSent << std::endl;
+  os << " sent " << stats.m_withdrawSent;
+  os << " damped " << stats.m_dampingSuppressed;
+  os << " paced drops " << stats.m_pacerDropped << std::endl;
 
   return os;
 }
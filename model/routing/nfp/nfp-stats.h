@@ -92,6 +92,9 @@ namespace ns3
       void IncrementWithdrawSent();
       void IncrementWithdrawReceived();
 
+      void IncrementDampingSuppressed();
+      void IncrementPacerDropped();
+
       uint64_t GetPayloadsSent() const;
       uint64_t GetBytesSent() const;
       uint64_t GetPayloadsReceived() const;
@@ -106,6 +109,9 @@ namespace ns3
       uint64_t GetWithdrawSent() const;
       uint64_t GetWithdrawReceived() const;
 
+      uint64_t GetDampingSuppressed() const;
+      uint64_t GetPacerDropped() const;
+
       friend std::ostream & operator << (std::ostream &os, const NfpStats &stats);
 
     protected:
@@ -125,6 +131,9 @@ namespace ns3
       uint64_t    m_withdrawOriginated;            //<! Withdraws we originated
       uint64_t    m_withdrawSent;
       uint64_t    m_withdrawReceived;
+
+      uint64_t    m_dampingSuppressed;              //<! Times a (prefix, anchor) pair was suppressed by flap damping
+      uint64_t    m_pacerDropped;                   //<! Payloads dropped from a full rate limit queue
       };
 
 
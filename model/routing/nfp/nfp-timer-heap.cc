@@ -0,0 +1,298 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+
+#include "ns3/assert.h"
+#include "ns3/log.h"
+#include "nfp-timer-heap.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpTimerHeap");
+
+/**
+ * The number of children of each heap node.  A 4-ary heap is shallower than a binary
+ * heap and the children of a node share a cache line.
+ */
+static const size_t ARITY = 4;
+
+/**
+ * m_position value of an allocated handle that is not in the heap
+ */
+static const uint32_t NOT_SCHEDULED = 0xFFFFFFFE;
+
+/**
+ * m_position value of a released handle
+ */
+static const uint32_t NOT_ALLOCATED = 0xFFFFFFFF;
+
+NfpTimerHeap::NfpTimerHeap ()
+{
+  // empty
+}
+
+NfpTimerHeap::~NfpTimerHeap ()
+{
+  // empty
+}
+
+NfpTimerHeap::TimerId
+NfpTimerHeap::Allocate (void)
+{
+  TimerId id;
+  if (!m_freeIds.empty ())
+    {
+      id = m_freeIds.back ();
+      m_freeIds.pop_back ();
+      m_position[id] = NOT_SCHEDULED;
+    }
+  else
+    {
+      id = (TimerId) m_position.size ();
+      m_position.push_back (NOT_SCHEDULED);
+    }
+  return id;
+}
+
+void
+NfpTimerHeap::Release (TimerId id)
+{
+  NS_ASSERT_MSG (id < m_position.size () && m_position[id] != NOT_ALLOCATED, "Releasing a handle that is not allocated: " << id);
+  Cancel (id);
+  m_position[id] = NOT_ALLOCATED;
+  m_freeIds.push_back (id);
+}
+
+void
+NfpTimerHeap::Schedule (TimerId id, Time expiry)
+{
+  NS_ASSERT_MSG (id < m_position.size () && m_position[id] != NOT_ALLOCATED, "Scheduling a handle that is not allocated: " << id);
+
+  if (m_position[id] == NOT_SCHEDULED)
+    {
+      HeapNode node;
+      node.expiry = expiry;
+      node.id = id;
+      m_heap.push_back (node);
+      m_position[id] = (uint32_t) (m_heap.size () - 1);
+      SiftUp (m_heap.size () - 1);
+    }
+  else
+    {
+      size_t index = m_position[id];
+      Time old = m_heap[index].expiry;
+      m_heap[index].expiry = expiry;
+      if (expiry < old)
+        {
+          SiftUp (index);
+        }
+      else if (old < expiry)
+        {
+          SiftDown (index);
+        }
+    }
+}
+
+void
+NfpTimerHeap::Cancel (TimerId id)
+{
+  NS_ASSERT_MSG (id < m_position.size () && m_position[id] != NOT_ALLOCATED, "Cancelling a handle that is not allocated: " << id);
+  if (m_position[id] != NOT_SCHEDULED)
+    {
+      RemoveAt (m_position[id]);
+    }
+}
+
+bool
+NfpTimerHeap::IsScheduled (TimerId id) const
+{
+  return id < m_position.size () && m_position[id] < NOT_SCHEDULED;
+}
+
+Time
+NfpTimerHeap::GetExpiry (TimerId id) const
+{
+  NS_ASSERT_MSG (IsScheduled (id), "Timer is not scheduled: " << id);
+  return m_heap[m_position[id]].expiry;
+}
+
+bool
+NfpTimerHeap::IsEmpty (void) const
+{
+  return m_heap.empty ();
+}
+
+size_t
+NfpTimerHeap::GetSize (void) const
+{
+  return m_heap.size ();
+}
+
+size_t
+NfpTimerHeap::GetAllocatedCount (void) const
+{
+  return m_position.size () - m_freeIds.size ();
+}
+
+NfpTimerHeap::TimerId
+NfpTimerHeap::Peek (void) const
+{
+  NS_ASSERT_MSG (!m_heap.empty (), "Peek on an empty heap");
+  return m_heap[0].id;
+}
+
+Time
+NfpTimerHeap::PeekTime (void) const
+{
+  NS_ASSERT_MSG (!m_heap.empty (), "PeekTime on an empty heap");
+  return m_heap[0].expiry;
+}
+
+NfpTimerHeap::TimerId
+NfpTimerHeap::Pop (void)
+{
+  NS_ASSERT_MSG (!m_heap.empty (), "Pop on an empty heap");
+  TimerId id = m_heap[0].id;
+  RemoveAt (0);
+  return id;
+}
+
+void
+NfpTimerHeap::Place (size_t index, const HeapNode &node)
+{
+  m_heap[index] = node;
+  m_position[node.id] = (uint32_t) index;
+}
+
+void
+NfpTimerHeap::SiftUp (size_t index)
+{
+  HeapNode node = m_heap[index];
+  while (index > 0)
+    {
+      size_t parent = (index - 1) / ARITY;
+      if (!(node.expiry < m_heap[parent].expiry))
+        {
+          break;
+        }
+      Place (index, m_heap[parent]);
+      index = parent;
+    }
+  Place (index, node);
+}
+
+void
+NfpTimerHeap::SiftDown (size_t index)
+{
+  HeapNode node = m_heap[index];
+  size_t size = m_heap.size ();
+  for (;;)
+    {
+      size_t first = index * ARITY + 1;
+      if (first >= size)
+        {
+          break;
+        }
+
+      size_t last = std::min (first + ARITY, size);
+      size_t smallest = first;
+      for (size_t child = first + 1; child < last; child++)
+        {
+          if (m_heap[child].expiry < m_heap[smallest].expiry)
+            {
+              smallest = child;
+            }
+        }
+
+      if (!(m_heap[smallest].expiry < node.expiry))
+        {
+          break;
+        }
+      Place (index, m_heap[smallest]);
+      index = smallest;
+    }
+  Place (index, node);
+}
+
+void
+NfpTimerHeap::RemoveAt (size_t index)
+{
+  TimerId id = m_heap[index].id;
+  m_position[id] = NOT_SCHEDULED;
+
+  size_t last = m_heap.size () - 1;
+  if (index != last)
+    {
+      HeapNode moved = m_heap[last];
+      m_heap.pop_back ();
+      Place (index, moved);
+
+      // The moved node came from a leaf, so it may need to go either way
+      if (index > 0 && moved.expiry < m_heap[(index - 1) / ARITY].expiry)
+        {
+          SiftUp (index);
+        }
+      else
+        {
+          SiftDown (index);
+        }
+    }
+  else
+    {
+      m_heap.pop_back ();
+    }
+}
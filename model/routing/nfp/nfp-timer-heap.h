@@ -0,0 +1,235 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_HEAP_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_HEAP_H_
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+
+#include "ns3/nstime.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * An indexed 4-ary min-heap of expiry times.  Each timer is identified by a TimerId handle
+ * that the owner allocates once and then re-schedules in place for as long as it needs
+ * the timer.  Because the heap knows the position of every handle, re-scheduling
+ * (increase or decrease key) and cancelling are O(log N) and never leave stale entries
+ * behind, so the heap size is the number of scheduled timers.  Re-scheduling does not
+ * allocate memory.
+ *
+ * The heap only orders times, it does not run anything.  NfpPrefixTimerHeap polls it
+ * for prefix expiry and NfpTimerScheduler drives neighbor expiry from it with one
+ * simulator event.
+ *
+ * Example:
+ * @code
+ * {
+ *   NfpTimerHeap heap;
+ *   NfpTimerHeap::TimerId id = heap.Allocate ();
+ *   heap.Schedule (id, Seconds (5));
+ *   heap.Schedule (id, Seconds (7));  // in-place reschedule
+ *   while (!heap.IsEmpty () && heap.PeekTime () <= Simulator::Now ())
+ *     {
+ *       id = heap.Pop ();
+ *       // process id
+ *     }
+ * }
+ * @endcode
+ */
+class NfpTimerHeap
+{
+public:
+  /**
+   * The handle of a timer.  Handles are re-used after Release().
+   */
+  typedef uint32_t TimerId;
+
+  NfpTimerHeap ();
+  virtual ~NfpTimerHeap ();
+
+  /**
+   * Allocates a new timer handle.  The timer is not scheduled.
+   *
+   * @return The new handle
+   */
+  TimerId Allocate (void);
+
+  /**
+   * Cancels the timer (if scheduled) and frees the handle for re-use.
+   *
+   * @param id An allocated handle
+   */
+  void Release (TimerId id);
+
+  /**
+   * Schedules the timer to expire at `expiry`.  If it is already scheduled, it is
+   * moved in place to the new time.
+   *
+   * @param id An allocated handle
+   * @param expiry The absolute expiry time
+   */
+  void Schedule (TimerId id, Time expiry);
+
+  /**
+   * Removes the timer from the heap.  The handle stays allocated.  It is ok to cancel
+   * a timer that is not scheduled.
+   *
+   * @param id An allocated handle
+   */
+  void Cancel (TimerId id);
+
+  /**
+   * @param id An allocated handle
+   * @return true if the timer is in the heap
+   */
+  bool IsScheduled (TimerId id) const;
+
+  /**
+   * PRECONDITION: IsScheduled(id)
+   *
+   * @param id An allocated handle
+   * @return The expiry time of the timer
+   */
+  Time GetExpiry (TimerId id) const;
+
+  /**
+   * @return true if no timer is scheduled
+   */
+  bool IsEmpty (void) const;
+
+  /**
+   * @return The number of scheduled timers
+   */
+  size_t GetSize (void) const;
+
+  /**
+   * @return The number of allocated handles (scheduled or not)
+   */
+  size_t GetAllocatedCount (void) const;
+
+  /**
+   * PRECONDITION: !IsEmpty()
+   *
+   * @return The handle of the earliest timer
+   */
+  TimerId Peek (void) const;
+
+  /**
+   * PRECONDITION: !IsEmpty()
+   *
+   * @return The expiry time of the earliest timer
+   */
+  Time PeekTime (void) const;
+
+  /**
+   * Removes the earliest timer from the heap.  The handle stays allocated, so the
+   * owner can Schedule() it again.
+   *
+   * PRECONDITION: !IsEmpty()
+   *
+   * @return The handle of the removed timer
+   */
+  TimerId Pop (void);
+
+private:
+  struct HeapNode
+  {
+    Time expiry;
+    TimerId id;
+  };
+
+  /**
+   * Move the node at `index` up towards the root until the heap property holds
+   */
+  void SiftUp (size_t index);
+
+  /**
+   * Move the node at `index` down towards the leaves until the heap property holds
+   */
+  void SiftDown (size_t index);
+
+  /**
+   * Removes the node at `index` from the heap
+   */
+  void RemoveAt (size_t index);
+
+  /**
+   * Put `node` at `index` and update its position
+   */
+  void Place (size_t index, const HeapNode &node);
+
+  std::vector<HeapNode> m_heap;
+
+  /**
+   * The heap index of each handle, or NOT_SCHEDULED
+   */
+  std::vector<uint32_t> m_position;
+
+  /**
+   * Released handles available for re-use
+   */
+  std::vector<TimerId> m_freeIds;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_HEAP_H_ */
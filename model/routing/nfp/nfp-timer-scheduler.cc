@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/log.h"
+#include "ns3/simulator.h"
+#include "nfp-timer-scheduler.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NS_LOG_COMPONENT_DEFINE ("NfpTimerScheduler");
+
+NfpTimerScheduler::NfpTimerScheduler ()
+{
+  // empty
+}
+
+NfpTimerScheduler::~NfpTimerScheduler ()
+{
+  Simulator::Cancel (m_event);
+}
+
+NfpTimerScheduler::TimerId
+NfpTimerScheduler::Allocate (Callback<void> callback)
+{
+  TimerId id = m_heap.Allocate ();
+  if (id >= m_callbacks.size ())
+    {
+      m_callbacks.resize (id + 1);
+    }
+  m_callbacks[id] = callback;
+  return id;
+}
+
+void
+NfpTimerScheduler::Release (TimerId id)
+{
+  m_heap.Release (id);
+  m_callbacks[id] = Callback<void> ();
+}
+
+void
+NfpTimerScheduler::Schedule (TimerId id, Time expiry)
+{
+  NS_LOG_FUNCTION (this << id << expiry);
+  NS_ASSERT_MSG (expiry >= Simulator::Now (), "Trying to schedule a timer in the past");
+  m_heap.Schedule (id, expiry);
+  UpdateEvent ();
+}
+
+void
+NfpTimerScheduler::Cancel (TimerId id)
+{
+  // The event stays set.  If it fires early, Expire() finds nothing to do and moves it.
+  m_heap.Cancel (id);
+}
+
+bool
+NfpTimerScheduler::IsScheduled (TimerId id) const
+{
+  return m_heap.IsScheduled (id);
+}
+
+size_t
+NfpTimerScheduler::GetSize (void) const
+{
+  return m_heap.GetSize ();
+}
+
+void
+NfpTimerScheduler::UpdateEvent (void)
+{
+  if (m_heap.IsEmpty ())
+    {
+      return;
+    }
+
+  // An event at or before the earliest timer is good enough.  A later timer only needs
+  // the event to be re-armed when it fires, so a refresh does not touch the simulator.
+  Time earliest = m_heap.PeekTime ();
+  if (m_event.IsRunning () && m_eventTime <= earliest)
+    {
+      return;
+    }
+
+  Simulator::Cancel (m_event);
+  m_eventTime = earliest;
+  m_event = Simulator::Schedule (earliest - Simulator::Now (), &NfpTimerScheduler::Expire, this);
+}
+
+void
+NfpTimerScheduler::Expire (void)
+{
+  NS_LOG_FUNCTION (this);
+  Time now = Simulator::Now ();
+  while (!m_heap.IsEmpty () && m_heap.PeekTime () <= now)
+    {
+      TimerId id = m_heap.Pop ();
+
+      // copy, as the callback may release the handle
+      Callback<void> callback = m_callbacks[id];
+      if (!callback.IsNull ())
+        {
+          callback ();
+        }
+    }
+  UpdateEvent ();
+}
@@ -0,0 +1,159 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_SCHEDULER_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_SCHEDULER_H_
+
+#include <vector>
+
+#include "ns3/simple-ref-count.h"
+#include "ns3/callback.h"
+#include "ns3/event-id.h"
+#include "ns3/nfp-timer-heap.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * Runs many timers from one NfpTimerHeap with a single simulator event, which is set
+ * for the earliest timer.  Each timer has a callback that is called when it expires.
+ *
+ * NfpRoutingProtocol shares one scheduler between all its NfpNeighbor records, so a
+ * neighbor refresh is an in-place reschedule in the heap instead of a simulator event
+ * per neighbor.
+ *
+ * A callback may Schedule(), Cancel() or Release() any timer, including its own.
+ */
+class NfpTimerScheduler : public SimpleRefCount<NfpTimerScheduler>
+{
+public:
+  typedef NfpTimerHeap::TimerId TimerId;
+
+  NfpTimerScheduler ();
+
+  /**
+   * Cancels the simulator event.  Callbacks are not called.
+   */
+  virtual ~NfpTimerScheduler ();
+
+  /**
+   * Allocates a timer that calls `callback` when it expires.  The timer is not scheduled.
+   *
+   * @param callback The function to call on expiry
+   * @return The timer handle
+   */
+  TimerId Allocate (Callback<void> callback);
+
+  /**
+   * Cancels the timer and frees its handle.
+   *
+   * @param id The timer handle
+   */
+  void Release (TimerId id);
+
+  /**
+   * Schedules (or re-schedules in place) the timer for the absolute time `expiry`.
+   *
+   * @param id The timer handle
+   * @param expiry The absolute expiry time, not in the past
+   */
+  void Schedule (TimerId id, Time expiry);
+
+  /**
+   * Stops the timer.  The handle stays allocated.
+   *
+   * @param id The timer handle
+   */
+  void Cancel (TimerId id);
+
+  /**
+   * @param id The timer handle
+   * @return true if the timer is scheduled
+   */
+  bool IsScheduled (TimerId id) const;
+
+  /**
+   * @return The number of scheduled timers
+   */
+  size_t GetSize (void) const;
+
+private:
+  /**
+   * The simulator event: run the callbacks of all expired timers
+   */
+  void Expire (void);
+
+  /**
+   * Makes sure the simulator event is set no later than the earliest timer
+   */
+  void UpdateEvent (void);
+
+  NfpTimerHeap m_heap;
+
+  /**
+   * The callback of each handle
+   */
+  std::vector< Callback<void> > m_callbacks;
+
+  EventId m_event;
+  Time m_eventTime;
+};
+
+}   /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_TIMER_SCHEDULER_H_ */
@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <algorithm>
+#include <cmath>
+
+#include "nfp-token-bucket.h"
+#include "ns3/assert.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NfpTokenBucket::NfpTokenBucket ()
+  : m_bytesPerSecond (0), m_burst (0), m_tokens (0), m_updated (0)
+{
+}
+
+NfpTokenBucket::NfpTokenBucket (DataRate rate, uint32_t burst)
+  : m_bytesPerSecond (rate.GetBitRate () / 8.0), m_burst (burst), m_tokens (burst), m_updated (0)
+{
+  NS_ASSERT_MSG (burst > 0 || m_bytesPerSecond == 0, "A rate limited bucket needs a positive burst");
+}
+
+NfpTokenBucket::~NfpTokenBucket ()
+{
+}
+
+bool
+NfpTokenBucket::IsUnlimited (void) const
+{
+  return m_bytesPerSecond == 0;
+}
+
+void
+NfpTokenBucket::Refill (Time now)
+{
+  if (now > m_updated)
+    {
+      m_tokens = std::min (m_burst, m_tokens + (now - m_updated).GetSeconds () * m_bytesPerSecond);
+      m_updated = now;
+    }
+}
+
+double
+NfpTokenBucket::GetNeeded (uint32_t bytes) const
+{
+  // an oversized payload only needs a full bucket
+  return std::min ((double) bytes, m_burst);
+}
+
+bool
+NfpTokenBucket::Consume (uint32_t bytes, Time now)
+{
+  if (IsUnlimited ())
+    {
+      return true;
+    }
+
+  Refill (now);
+  if (m_tokens >= GetNeeded (bytes))
+    {
+      m_tokens -= bytes;
+      return true;
+    }
+  return false;
+}
+
+Time
+NfpTokenBucket::GetDelay (uint32_t bytes, Time now)
+{
+  if (IsUnlimited ())
+    {
+      return Time (0);
+    }
+
+  Refill (now);
+  double missing = GetNeeded (bytes) - m_tokens;
+  if (missing <= 0)
+    {
+      return Time (0);
+    }
+
+  // round up to the next nanosecond so Consume() succeeds at now + delay
+  return NanoSeconds ((int64_t) std::ceil (missing / m_bytesPerSecond * 1e9));
+}
+
+double
+NfpTokenBucket::GetTokens (Time now)
+{
+  Refill (now);
+  return m_tokens;
+}
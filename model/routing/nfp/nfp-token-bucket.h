@@ -0,0 +1,127 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_TOKEN_BUCKET_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_TOKEN_BUCKET_H_
+
+#include <stdint.h>
+
+#include "ns3/nstime.h"
+#include "ns3/data-rate.h"
+
+namespace ns3 {
+namespace ccnx {
+
+/**
+ * @ingroup nfp-routing
+ *
+ * A byte token bucket.  Tokens accumulate at `rate` up to `burst` bytes.  NfpRoutingProtocol
+ * keeps one per interface to bound the NFP payload bytes it sends.
+ *
+ * The bucket starts full.  A rate of 0 means unlimited.
+ */
+class NfpTokenBucket
+{
+public:
+  NfpTokenBucket ();
+
+  /**
+   * @param rate The rate tokens accumulate, 0 for unlimited
+   * @param burst The bucket size in bytes
+   */
+  NfpTokenBucket (DataRate rate, uint32_t burst);
+
+  virtual ~NfpTokenBucket ();
+
+  bool IsUnlimited (void) const;
+
+  /**
+   * Takes `bytes` tokens if there are enough at time `now`.
+   *
+   * A payload bigger than the burst size may be sent when the bucket is full, leaving
+   * the bucket in debt, so an oversized payload is delayed but not blocked forever.
+   *
+   * @return true if the tokens were taken
+   */
+  bool Consume (uint32_t bytes, Time now);
+
+  /**
+   * The time from `now` until Consume(bytes) will succeed
+   */
+  Time GetDelay (uint32_t bytes, Time now);
+
+  /**
+   * The tokens in the bucket at time `now` (negative if in debt)
+   */
+  double GetTokens (Time now);
+
+private:
+  void Refill (Time now);
+
+  /**
+   * The tokens needed for Consume(bytes) to succeed
+   */
+  double GetNeeded (uint32_t bytes) const;
+
+  double m_bytesPerSecond;
+  double m_burst;
+  double m_tokens;
+  Time m_updated;
+};
+
+} /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_TOKEN_BUCKET_H_ */
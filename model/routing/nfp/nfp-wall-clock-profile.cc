@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <chrono>
+#include "nfp-wall-clock-profile.h"
+#include "ns3/assert.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+NfpWallClockProfile::ScopedTimer::ScopedTimer (NfpWallClockProfile *profile, Handler handler)
+  : m_profile (profile), m_handler (handler), m_start (0)
+{
+  if (m_profile)
+    {
+      m_start = NfpWallClockProfile::Now ();
+    }
+}
+
+NfpWallClockProfile::ScopedTimer::~ScopedTimer ()
+{
+  if (m_profile)
+    {
+      m_profile->Add (m_handler, NfpWallClockProfile::Now () - m_start);
+    }
+}
+
+NfpWallClockProfile::NfpWallClockProfile ()
+{
+  for (int i = 0; i < HANDLER_COUNT; i++)
+    {
+      m_calls[i] = 0;
+      m_nanoseconds[i] = 0;
+    }
+}
+
+NfpWallClockProfile::NfpWallClockProfile (const NfpWallClockProfile &copy)
+{
+  for (int i = 0; i < HANDLER_COUNT; i++)
+    {
+      m_calls[i] = copy.m_calls[i];
+      m_nanoseconds[i] = copy.m_nanoseconds[i];
+    }
+}
+
+NfpWallClockProfile::~NfpWallClockProfile ()
+{
+}
+
+void
+NfpWallClockProfile::Add (Handler handler, uint64_t nanoseconds)
+{
+  NS_ASSERT_MSG (handler < HANDLER_COUNT, "Invalid handler " << handler);
+  m_calls[handler]++;
+  m_nanoseconds[handler] += nanoseconds;
+}
+
+uint64_t
+NfpWallClockProfile::GetCalls (Handler handler) const
+{
+  NS_ASSERT_MSG (handler < HANDLER_COUNT, "Invalid handler " << handler);
+  return m_calls[handler];
+}
+
+uint64_t
+NfpWallClockProfile::GetNanoSeconds (Handler handler) const
+{
+  NS_ASSERT_MSG (handler < HANDLER_COUNT, "Invalid handler " << handler);
+  return m_nanoseconds[handler];
+}
+
+const char *
+NfpWallClockProfile::GetHandlerName (Handler handler)
+{
+  switch (handler)
+    {
+    case RECEIVE_PAYLOAD:
+      return "receive";
+    case PROCESS_WORK_QUEUE:
+      return "workqueue";
+    case ADVERTISE_TIMER:
+      return "advertise";
+    case NEIGHBOR:
+      return "neighbor";
+    default:
+      return "unknown";
+    }
+}
+
+uint64_t
+NfpWallClockProfile::Now (void)
+{
+  return std::chrono::duration_cast<std::chrono::nanoseconds> (std::chrono::steady_clock::now ().time_since_epoch ()).count ();
+}
+
+NfpWallClockProfile &
+NfpWallClockProfile::operator += (const NfpWallClockProfile &other)
+{
+  for (int i = 0; i < HANDLER_COUNT; i++)
+    {
+      m_calls[i] += other.m_calls[i];
+      m_nanoseconds[i] += other.m_nanoseconds[i];
+    }
+  return *this;
+}
+
+std::ostream &
+ns3::ccnx::operator << (std::ostream &os, const NfpWallClockProfile &profile)
+{
+  os << "WallClockProfile { ";
+  for (int i = 0; i < NfpWallClockProfile::HANDLER_COUNT; i++)
+    {
+      if (i > 0)
+        {
+          os << ", ";
+        }
+      os << NfpWallClockProfile::GetHandlerName ((NfpWallClockProfile::Handler) i)
+         << " calls " << profile.m_calls[i]
+         << " usec " << profile.m_nanoseconds[i] / 1000;
+    }
+  os << " }";
+  return os;
+}
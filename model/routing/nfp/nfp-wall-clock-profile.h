@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#ifndef CCNS3SIM_MODEL_ROUTING_NFP_NFP_WALL_CLOCK_PROFILE_H_
+#define CCNS3SIM_MODEL_ROUTING_NFP_NFP_WALL_CLOCK_PROFILE_H_
+
+#include <ostream>
+#include <stdint.h>
+
+namespace ns3
+{
+  namespace ccnx
+  {
+
+    /**
+     * @ingroup nfp-routing
+     *
+     * Host CPU (wall-clock) time spent in the NFP handlers, to put next to NfpComputationCost.
+     * The computation cost counts what the modeled protocol does; this measures what the
+     * simulator code costs to run it.
+     *
+     * Each handler accumulates the number of calls and the total nanoseconds measured with
+     * std::chrono::steady_clock.  Times are inclusive: ReceiveHello() runs inside
+     * ReceivePayload(), so its time is counted in both.
+     *
+     * Use a ScopedTimer at the top of a handler.  A ScopedTimer with a null profile does
+     * nothing, so profiling costs one branch when it is disabled.
+     */
+    class NfpWallClockProfile
+    {
+    public:
+      typedef enum
+      {
+        RECEIVE_PAYLOAD,
+        PROCESS_WORK_QUEUE,
+        ADVERTISE_TIMER,
+        NEIGHBOR,
+        HANDLER_COUNT
+      } Handler;
+
+      /**
+       * Adds the elapsed wall-clock time from its construction to its destruction to
+       * a handler of the profile.
+       */
+      class ScopedTimer
+      {
+      public:
+        /**
+         * @param profile The profile to update, or null to not measure
+         * @param handler The handler to charge
+         */
+        ScopedTimer (NfpWallClockProfile *profile, Handler handler);
+        ~ScopedTimer ();
+
+      private:
+        NfpWallClockProfile *m_profile;
+        Handler m_handler;
+        uint64_t m_start;
+      };
+
+      NfpWallClockProfile ();
+      NfpWallClockProfile (const NfpWallClockProfile &copy);
+      virtual ~NfpWallClockProfile ();
+
+      /**
+       * Adds one call of `handler` that took `nanoseconds`
+       */
+      void Add (Handler handler, uint64_t nanoseconds);
+
+      uint64_t GetCalls (Handler handler) const;
+      uint64_t GetNanoSeconds (Handler handler) const;
+
+      /**
+       * The short name of the handler used by operator<<
+       */
+      static const char * GetHandlerName (Handler handler);
+
+      /**
+       * The current steady_clock time in nanoseconds
+       */
+      static uint64_t Now (void);
+
+      NfpWallClockProfile & operator += (const NfpWallClockProfile &other);
+
+      friend std::ostream & operator << (std::ostream &os, const NfpWallClockProfile &profile);
+
+    private:
+      uint64_t m_calls[HANDLER_COUNT];		/*< The number of calls of each handler */
+      uint64_t m_nanoseconds[HANDLER_COUNT];	/*< The total wall-clock time of each handler */
+    };
+
+    std::ostream & operator << (std::ostream &os, const NfpWallClockProfile &profile);
+
+  } /* namespace ccnx */
+} /* namespace ns3 */
+
+#endif /* CCNS3SIM_MODEL_ROUTING_NFP_NFP_WALL_CLOCK_PROFILE_H_ */
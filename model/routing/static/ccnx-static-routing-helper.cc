@@ -53,6 +53,15 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <cstdlib>
+#include <fstream>
+#include <map>
+#include <vector>
+
+#include "ns3/log.h"
+#include "ns3/node-list.h"
+#include "ns3/ccnx-l3-protocol.h"
+#include "ns3/ccnx-route-entry.h"
 #include "ccnx-static-routing-helper.h"
 #include "ccnx-static-routing-protocol.h"
 #include "ns3/node-container.h"
@@ -60,6 +69,8 @@
 using namespace ns3;
 using namespace ns3::ccnx;
 
+NS_LOG_COMPONENT_DEFINE ("CCNxStaticRoutingHelper");
+
 CCNxStaticRoutingHelper::CCNxStaticRoutingHelper ()
 {
   m_routerFactory.SetTypeId ("ns3::ccnx::staticRoutingProtocol");
@@ -116,3 +127,167 @@ CCNxStaticRoutingHelper::SetSteams (NodeContainer &c, int64_t stream)
     }
   return (currentStream - stream);
 }
+
+/**
+ * Parses a whole token as an unsigned decimal number
+ */
+static bool
+ParseUnsigned (const std::string &token, uint32_t &value)
+{
+  char *end;
+  unsigned long parsed = std::strtoul (token.c_str (), &end, 10);
+  if (token.empty () || *end != '\0' || token[0] == '-')
+    {
+      return false;
+    }
+  value = static_cast<uint32_t> (parsed);
+  return true;
+}
+
+/**
+ * Checks that `uri` is a name CCNxName can parse ("ccnx:/" and then "label=value" segments),
+ * because CCNxName asserts on anything else
+ */
+static bool
+IsNameUri (const std::string &uri)
+{
+  const std::string schema ("ccnx:/");
+  if (uri.compare (0, schema.length (), schema) != 0)
+    {
+      return false;
+    }
+
+  size_t start = schema.length ();
+  while (start <= uri.length ())
+    {
+      size_t end = uri.find ('/', start);
+      if (end == std::string::npos)
+        {
+          end = uri.length ();
+        }
+      size_t equals = uri.find ('=', start);
+      if (equals == start || equals >= end)
+        {
+          return false;
+        }
+      start = end + 1;
+    }
+  return true;
+}
+
+size_t
+CCNxStaticRoutingHelper::LoadRoutes (std::istream &input)
+{
+  NS_LOG_FUNCTION_NOARGS ();
+
+  // Prefixes repeat across nodes, so parse each URI once and share the name
+  typedef std::map<std::string, Ptr<const CCNxName> > NameCacheType;
+  NameCacheType names;
+
+  // Saves scanning the devices again for every route to the same neighbor.  The connection
+  // itself is the one the node keeps for the neighbor, see ConnectNeighbor().  A pair that
+  // has no CCNx link is cached as null.
+  typedef std::map< std::pair<uint32_t, uint32_t>, Ptr<CCNxConnection> > ConnectionCacheType;
+  ConnectionCacheType connections;
+
+  typedef std::map<uint32_t, CCNxForwarder::RouteEntryListType> NodeRoutesType;
+  NodeRoutesType nodeRoutes;
+
+  std::string line;
+  std::vector<std::string> tokens;
+  size_t lineNumber = 0;
+  while (std::getline (input, line))
+    {
+      lineNumber++;
+
+      tokens.clear ();
+      size_t start = line.find_first_not_of (" \t\r");
+      while (start != std::string::npos)
+        {
+          size_t end = line.find_first_of (" \t\r", start);
+          tokens.push_back (line.substr (start, end - start));
+          start = line.find_first_not_of (" \t\r", end);
+        }
+
+      if (tokens.empty () || tokens[0][0] == '#')
+        {
+          continue;
+        }
+
+      uint32_t nodeId, nexthopId;
+      uint32_t cost = 0;
+      if ((tokens.size () != 3 && tokens.size () != 4)
+          || !ParseUnsigned (tokens[0], nodeId)
+          || !ParseUnsigned (tokens[2], nexthopId)
+          || (tokens.size () == 4 && !ParseUnsigned (tokens[3], cost)))
+        {
+          NS_LOG_WARN ("Skipping unparseable route line " << lineNumber << " '" << line << "'");
+          continue;
+        }
+
+      if (nodeId >= NodeList::GetNNodes () || nexthopId >= NodeList::GetNNodes ())
+        {
+          NS_LOG_WARN ("Skipping route line " << lineNumber << ", no such node");
+          continue;
+        }
+
+      if (!IsNameUri (tokens[1]))
+        {
+          NS_LOG_WARN ("Skipping route line " << lineNumber << ", bad prefix '" << tokens[1] << "'");
+          continue;
+        }
+
+      std::pair<uint32_t, uint32_t> link = std::make_pair (nodeId, nexthopId);
+      ConnectionCacheType::iterator cached = connections.find (link);
+      if (cached == connections.end ())
+        {
+          Ptr<CCNxConnection> found;
+          Ptr<Node> node = NodeList::GetNode (nodeId);
+          if (node->GetObject<CCNxL3Protocol> ())
+            {
+              found = ConnectNeighbor (node, nexthopId);
+            }
+          cached = connections.insert (std::make_pair (link, found)).first;
+        }
+
+      Ptr<CCNxConnection> connection = cached->second;
+      if (!connection)
+        {
+          NS_LOG_WARN ("Skipping route line " << lineNumber << ", node " << nodeId << " has no CCNx link to " << nexthopId);
+          continue;
+        }
+
+      Ptr<const CCNxName> &prefix = names[tokens[1]];
+      if (!prefix)
+        {
+          prefix = Create<CCNxName> (tokens[1]);
+        }
+
+      nodeRoutes[nodeId].push_back (Create<CCNxRouteEntry> (prefix, cost, connection));
+    }
+
+  size_t routeCount = 0;
+  for (NodeRoutesType::const_iterator i = nodeRoutes.begin (); i != nodeRoutes.end (); ++i)
+    {
+      Ptr<CCNxForwarder> forwarder = NodeList::GetNode (i->first)->GetObject<CCNxL3Protocol> ()->GetForwarder ();
+      NS_ASSERT_MSG (forwarder, "Node " << i->first << " has no CCNxForwarder");
+      forwarder->AddRoutes (i->second);
+      routeCount += i->second.size ();
+    }
+
+  NS_LOG_INFO ("Loaded " << routeCount << " routes on " << nodeRoutes.size () << " nodes, "
+                         << names.size () << " prefixes");
+  return routeCount;
+}
+
+size_t
+CCNxStaticRoutingHelper::LoadRouteFile (std::string filename)
+{
+  std::ifstream input (filename.c_str ());
+  if (!input.is_open ())
+    {
+      NS_LOG_ERROR ("Could not open route file '" << filename << "'");
+      return 0;
+    }
+  return LoadRoutes (input);
+}
@@ -56,6 +56,9 @@
 #ifndef CCNS3SIM_STATIC_ROUTING_HELPER_H_H
 #define CCNS3SIM_STATIC_ROUTING_HELPER_H_H
 
+#include <istream>
+#include <string>
+
 #include "ns3/object-factory.h"
 #include "ns3/ccnx-routing-helper.h"
 #include "ns3/node-container.h"
@@ -87,6 +90,37 @@ public:
 
   virtual int64_t SetSteams (NodeContainer &c, int64_t stream);
 
+  /**
+   * Load static routes into the forwarders of the nodes in the NodeList.
+   *
+   * Each line is `nodeId prefix nexthopNodeId [cost]`, for example
+   * `3 ccnx:/name=foo/name=bar 4 2`.  The nexthop must share a channel with the node
+   * and both must have CCNx interfaces up on it.  The cost defaults to 0.
+   * Blank lines and lines starting with '#' are skipped, as are lines that do not parse,
+   * including a prefix that is not a `ccnx:/` name (with a warning).
+   *
+   * Each prefix is parsed once no matter how many lines use it, and the routes of
+   * each node are given to its forwarder in one `CCNxForwarder::AddRoutes()` batch,
+   * so large tables load in seconds.  This does not require the static routing
+   * protocol to be installed.
+   *
+   * The routes use the connection each node already has to the nexthop, see
+   * CCNxL3Protocol::GetNeighbor(), so loading several tables, or loading after traffic,
+   * does not add connections.
+   *
+   * @param [in] input The route table
+   * @return The number of routes loaded
+   */
+  static size_t LoadRoutes (std::istream &input);
+
+  /**
+   * Load static routes from a file, see `LoadRoutes()`.
+   *
+   * @param [in] filename The route file
+   * @return The number of routes loaded (0 if the file cannot be opened)
+   */
+  static size_t LoadRouteFile (std::string filename);
+
 private:
   /**
    * The factory we use to create protocol instances
@@ -0,0 +1,185 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+
+#include <sstream>
+#include <fstream>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/boolean.h"
+#include "ns3/double.h"
+#include "ns3/pointer.h"
+#include "ns3/string.h"
+#include "ns3/object-factory.h"
+#include "ns3/error-model.h"
+#include "ns3/node-container.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccnx-stack-helper.h"
+#include "ns3/ccnx-static-routing-helper.h"
+#include "ns3/ccnx-consumer.h"
+#include "ns3/ccnx-consumer-helper.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxConsumer {
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxConsumer> consumer = CreateObject<CCNxConsumer> ();
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetRto (), Seconds (1), "Wrong initial RTO");
+}
+EndTest ()
+
+BeginTest (WindowTimeoutBacksOffOnce)
+{
+  // 0 - 1, node 0 routes the repository prefix to node 1, which drops everything it receives
+  NodeContainer nodes;
+  nodes.Create (2);
+  PointToPointHelper p2p;
+  NetDeviceContainer devices = p2p.Install (nodes.Get (0), nodes.Get (1));
+
+  Ptr<RateErrorModel> blackhole = CreateObject<RateErrorModel> ();
+  blackhole->SetAttribute ("ErrorRate", DoubleValue (1.0));
+  blackhole->SetAttribute ("ErrorUnit", StringValue ("ERROR_UNIT_PACKET"));
+  devices.Get (1)->SetAttribute ("ReceiveErrorModel", PointerValue (blackhole));
+
+  CCNxStaticRoutingHelper staticRouting;
+  CCNxStackHelper stack;
+  stack.SetRoutingHelper (staticRouting);
+  stack.Install (nodes);
+  stack.AddInterfaces (devices);
+
+  std::istringstream routes ("0 ccnx:/name=consumer 1\n");
+  NS_TEST_EXPECT_MSG_EQ (CCNxStaticRoutingHelper::LoadRoutes (routes), 1, "Route not loaded");
+
+  // A window of 4 Interests goes out at once, so all of them expire at the same time
+  Ptr<CCNxContentRepository> repository = Create<CCNxContentRepository> (Create<CCNxName> ("ccnx:/name=consumer"), 100, 16);
+  CCNxConsumerHelper consumerHelper (repository);
+  consumerHelper.SetAttribute ("WindowMode", BooleanValue (true));
+  consumerHelper.SetAttribute ("InitialWindow", DoubleValue (4.0));
+  consumerHelper.SetAttribute ("InitialRto", TimeValue (Seconds (1)));
+  ApplicationContainer apps = consumerHelper.Install (nodes.Get (0));
+  apps.Start (Seconds (0));
+  apps.Stop (Seconds (10));
+  Ptr<CCNxConsumer> consumer = DynamicCast<CCNxConsumer, Application> (apps.Get (0));
+
+  Simulator::Stop (MilliSeconds (1500));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetRto (), Seconds (2), "The RTO should double once for the whole window");
+
+  // The retransmissions went out together with the backed off RTO, so they expire together too
+  Simulator::Stop (Seconds (2));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetRto (), Seconds (4), "The RTO should double once per timer expiry");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (TraceEndIsNotAnError)
+{
+  std::string path = CreateTempDirFilename ("ccnx-consumer-trace.txt");
+  std::ofstream trace (path.c_str ());
+  trace << "0\n1\n2\n";
+  trace.close ();
+
+  // A single node with no routes; every Interest comes back as a NoRoute InterestReturn
+  NodeContainer nodes;
+  nodes.Create (1);
+  CCNxStaticRoutingHelper staticRouting;
+  CCNxStackHelper stack;
+  stack.SetRoutingHelper (staticRouting);
+  stack.Install (nodes);
+
+  ObjectFactory popularity;
+  popularity.SetTypeId ("ns3::ccnx::CCNxTracePopularity");
+  popularity.Set ("TraceFile", StringValue (path));
+  popularity.Set ("Loop", BooleanValue (false));
+
+  Ptr<CCNxContentRepository> repository = Create<CCNxContentRepository> (Create<CCNxName> ("ccnx:/name=consumer"), 100, 16);
+  CCNxConsumerHelper consumerHelper (repository);
+  consumerHelper.SetAttribute ("RequestInterval", TimeValue (MilliSeconds (100)));
+  consumerHelper.SetAttribute ("PopularityModel", ObjectFactoryValue (popularity));
+  ApplicationContainer apps = consumerHelper.Install (nodes.Get (0));
+  apps.Start (Seconds (0));
+  apps.Stop (Seconds (2));
+  Ptr<CCNxConsumer> consumer = DynamicCast<CCNxConsumer, Application> (apps.Get (0));
+
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetRequestCount (), 3, "The consumer should replay the whole trace");
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetErrorCount (), 0, "The end of the trace is not an error");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxConsumer
+ */
+static class TestSuiteCCNxConsumer : public TestSuite
+{
+public:
+  TestSuiteCCNxConsumer () : TestSuite ("ccnx-consumer", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new WindowTimeoutBacksOffOnce (), TestCase::QUICK);
+    AddTestCase (new TraceEndIsNotAnError (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxConsumer;
+
+} // namespace TestSuiteCCNxConsumer
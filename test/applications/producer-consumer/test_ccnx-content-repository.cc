@@ -188,6 +188,104 @@ BeginTest (Test_GetContentObject)
 }
 EndTest ()
 
+BeginTest (Test_GetName)
+{
+  printf ("TestSuiteCCNxContentRepository Test_GetName DoRun\n");
+  /*
+   * Names by index are sequential chunks under the repository prefix and resolve to content.
+   */
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  uint32_t size = 10;
+  uint32_t count = 10;
+  Ptr <CCNxContentRepository> globalContentRepository = Create <CCNxContentRepository> (prefix,size,count);
+
+  Ptr <const CCNxName> truth = Create <CCNxName> ("ccnx:/name=test/name=producer/chunk=3");
+  Ptr <const CCNxName> name = globalContentRepository->GetName (3);
+  NS_TEST_EXPECT_MSG_EQ (name->Equals (*truth), true, "Wrong name for index 3");
+
+  bool found = (globalContentRepository->GetContentObject (name));
+  NS_TEST_EXPECT_MSG_EQ (found, true, "Indexed name did not resolve to a content object");
+}
+EndTest ()
+
+BeginTest (Test_GetContentObjectNotInRepository)
+{
+  printf ("TestSuiteCCNxContentRepository Test_GetContentObjectNotInRepository DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  Ptr <CCNxContentRepository> globalContentRepository = Create <CCNxContentRepository> (prefix,10,10);
+
+  const char *misses[] = {
+    "ccnx:/name=test/name=producer/chunk=10",
+    "ccnx:/name=test/name=producer/chunk=03",
+    "ccnx:/name=test/name=producer/chunk=x",
+    "ccnx:/name=test/name=producer/name=3",
+    "ccnx:/name=test/name=producer/chunk=3/chunk=3",
+    "ccnx:/name=test/name=consumer/chunk=3",
+  };
+  for (size_t i = 0; i < sizeof(misses) / sizeof(misses[0]); ++i)
+    {
+      Ptr <const CCNxName> name = Create <CCNxName> (misses[i]);
+      bool found = (globalContentRepository->GetContentObject (name));
+      NS_TEST_EXPECT_MSG_EQ (found, false, "Should not have found " << misses[i]);
+    }
+}
+EndTest ()
+
+BeginTest (Test_LazyRepository)
+{
+  printf ("TestSuiteCCNxContentRepository Test_LazyRepository DoRun\n");
+  /*
+   * A lazy repository with a huge catalog answers without creating every object.
+   */
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  uint32_t count = 10000000;
+  Ptr <CCNxContentRepository> globalContentRepository = Create <CCNxContentRepository> (prefix,1200,count,true,0);
+  NS_TEST_EXPECT_MSG_EQ (globalContentRepository->IsLazy (), true, "Repository should be lazy");
+  NS_TEST_EXPECT_MSG_EQ (globalContentRepository->GetContentObjectCount (), count, "Wrong count");
+
+  Ptr <const CCNxName> truth = Create <CCNxName> ("ccnx:/name=test/name=producer/chunk=9999999");
+  Ptr <const CCNxName> name = globalContentRepository->GetName (count - 1);
+  NS_TEST_EXPECT_MSG_EQ (name->Equals (*truth), true, "Wrong name for the last index");
+
+  Ptr <CCNxContentObject> contentObject = globalContentRepository->GetContentObject (truth);
+  bool found = (contentObject);
+  NS_TEST_EXPECT_MSG_EQ (found, true, "Lazy repository did not synthesize the object");
+  NS_TEST_EXPECT_MSG_EQ (contentObject->GetName ()->Equals (*truth), true, "Synthesized object has the wrong name");
+
+  Ptr <const CCNxName> beyond = Create <CCNxName> ("ccnx:/name=test/name=producer/chunk=10000000");
+  found = (globalContentRepository->GetContentObject (beyond));
+  NS_TEST_EXPECT_MSG_EQ (found, false, "Chunk beyond the catalog should not exist");
+
+  Ptr <const CCNxName> randName = globalContentRepository->GetRandomName ();
+  found = (globalContentRepository->GetContentObject (randName));
+  NS_TEST_EXPECT_MSG_EQ (found, true, "Random name should be in the repository");
+}
+EndTest ()
+
+BeginTest (Test_LazyHotCache)
+{
+  printf ("TestSuiteCCNxContentRepository Test_LazyHotCache DoRun\n");
+  /*
+   * The hot cache keeps the most recently requested objects and evicts the least recent.
+   */
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=producer");
+  Ptr <CCNxContentRepository> globalContentRepository = Create <CCNxContentRepository> (prefix,10,1000,true,2);
+
+  Ptr <CCNxContentObject> first = globalContentRepository->GetContentObject (globalContentRepository->GetName (1));
+  Ptr <CCNxContentObject> again = globalContentRepository->GetContentObject (globalContentRepository->GetName (1));
+  NS_TEST_EXPECT_MSG_EQ (first == again, true, "Hot object should be served from the cache");
+
+  globalContentRepository->GetContentObject (globalContentRepository->GetName (2));
+  globalContentRepository->GetContentObject (globalContentRepository->GetName (1));
+  globalContentRepository->GetContentObject (globalContentRepository->GetName (3));
+  NS_TEST_EXPECT_MSG_EQ (globalContentRepository->GetHotCacheCount (), 2, "Hot cache exceeded its bound");
+
+  // chunk 2 was least recently used, so chunk 1 survived
+  again = globalContentRepository->GetContentObject (globalContentRepository->GetName (1));
+  NS_TEST_EXPECT_MSG_EQ (first == again, true, "Recently used object was evicted");
+}
+EndTest ()
+
 
 
 /*
@@ -211,6 +309,10 @@ public:
     AddTestCase (new Test_GetRandomName (), TestCase::QUICK);
     AddTestCase (new Test_GetRepositoryPrefix, TestCase::QUICK);
     AddTestCase (new Test_GetContentObject, TestCase::QUICK);
+    AddTestCase (new Test_GetName, TestCase::QUICK);
+    AddTestCase (new Test_GetContentObjectNotInRepository, TestCase::QUICK);
+    AddTestCase (new Test_LazyRepository, TestCase::QUICK);
+    AddTestCase (new Test_LazyHotCache, TestCase::QUICK);
   }
 } g_TestSuiteCCNxContentRepository;
 
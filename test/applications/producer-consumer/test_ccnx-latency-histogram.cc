@@ -0,0 +1,169 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/ccnx-latency-histogram.h"
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxLatencyHistogram {
+
+BeginTest (Constructor)
+{
+  printf ("TestSuiteCCNxLatencyHistogram Constructor DoRun\n");
+  Ptr<CCNxLatencyHistogram> histogram = Create<CCNxLatencyHistogram> ();
+  NS_TEST_EXPECT_MSG_EQ (histogram->GetCount (), 0, "New histogram should be empty");
+  NS_TEST_EXPECT_MSG_EQ (histogram->GetPercentile (99.0), Time (0), "Empty histogram percentile should be 0");
+  NS_TEST_EXPECT_MSG_EQ (histogram->GetMax (), Time (0), "Empty histogram max should be 0");
+}
+EndTest ()
+
+BeginTest (SmallValuesExact)
+{
+  printf ("TestSuiteCCNxLatencyHistogram SmallValuesExact DoRun\n");
+  CCNxLatencyHistogram histogram;
+  for (int i = 1; i <= 10; ++i)
+    {
+      histogram.Record (NanoSeconds (i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetCount (), 10, "Wrong count");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetPercentile (50.0), NanoSeconds (5), "Wrong p50");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetPercentile (90.0), NanoSeconds (9), "Wrong p90");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetPercentile (100.0), NanoSeconds (10), "Wrong p100");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetMin (), NanoSeconds (1), "Wrong min");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetMax (), NanoSeconds (10), "Wrong max");
+}
+EndTest ()
+
+BeginTest (RelativeError)
+{
+  printf ("TestSuiteCCNxLatencyHistogram RelativeError DoRun\n");
+  /*
+   * 1000 samples of 1us .. 1000us.  Each percentile should be within the 1/32 bucket error.
+   */
+  CCNxLatencyHistogram histogram;
+  for (int i = 1; i <= 1000; ++i)
+    {
+      histogram.Record (MicroSeconds (i));
+    }
+
+  double truth[] = { 500e3, 900e3, 990e3, 999e3 };
+  double percentiles[] = { 50.0, 90.0, 99.0, 99.9 };
+  for (int i = 0; i < 4; ++i)
+    {
+      double value = histogram.GetPercentile (percentiles[i]).GetNanoSeconds ();
+      bool close = value >= truth[i] && value <= truth[i] * (1.0 + 1.0 / 32);
+      NS_TEST_EXPECT_MSG_EQ (close, true, "p" << percentiles[i] << " is " << value << " expected about " << truth[i]);
+    }
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetMax (), MicroSeconds (1000), "Max should be exact");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetMean (), NanoSeconds (500500), "Mean should be exact");
+}
+EndTest ()
+
+BeginTest (Merge)
+{
+  printf ("TestSuiteCCNxLatencyHistogram Merge DoRun\n");
+  CCNxLatencyHistogram fast;
+  CCNxLatencyHistogram slow;
+  for (int i = 0; i < 99; ++i)
+    {
+      fast.Record (MicroSeconds (100));
+    }
+  slow.Record (Seconds (2));
+
+  fast.Merge (slow);
+  NS_TEST_EXPECT_MSG_EQ (fast.GetCount (), 100, "Wrong merged count");
+  NS_TEST_EXPECT_MSG_EQ (fast.GetMax (), Seconds (2), "Wrong merged max");
+  NS_TEST_EXPECT_MSG_EQ (fast.GetMin (), MicroSeconds (100), "Wrong merged min");
+
+  bool p99Fast = fast.GetPercentile (99.0) < MicroSeconds (104);
+  NS_TEST_EXPECT_MSG_EQ (p99Fast, true, "p99 should come from the fast samples");
+  bool p100Slow = fast.GetPercentile (100.0) == Seconds (2);
+  NS_TEST_EXPECT_MSG_EQ (p100Slow, true, "p100 should be the slow sample");
+}
+EndTest ()
+
+BeginTest (Reset)
+{
+  printf ("TestSuiteCCNxLatencyHistogram Reset DoRun\n");
+  CCNxLatencyHistogram histogram;
+  histogram.Record (MilliSeconds (3));
+  histogram.Reset ();
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetCount (), 0, "Reset should empty the histogram");
+  NS_TEST_EXPECT_MSG_EQ (histogram.GetMax (), Time (0), "Reset should clear max");
+}
+EndTest ()
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for CCNxLatencyHistogram
+ */
+static class TestCCNxLatencyHistogram : public TestSuite
+{
+public:
+  TestCCNxLatencyHistogram () : TestSuite ("ccnx-latency-histogram", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new SmallValuesExact (), TestCase::QUICK);
+    AddTestCase (new RelativeError (), TestCase::QUICK);
+    AddTestCase (new Merge (), TestCase::QUICK);
+    AddTestCase (new Reset (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxLatencyHistogram;
+
+}
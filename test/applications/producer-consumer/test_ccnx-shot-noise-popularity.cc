@@ -0,0 +1,189 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <set>
+#include <sstream>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/double.h"
+#include "ns3/uinteger.h"
+#include "ns3/ccnx-shot-noise-popularity.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxShotNoisePopularity {
+
+BeginTest (Constructor)
+{
+  printf ("TestSuiteCCNxShotNoisePopularity Constructor DoRun\n");
+  Ptr<CCNxShotNoisePopularity> model = CreateObject<CCNxShotNoisePopularity> ();
+  NS_TEST_EXPECT_MSG_EQ (model->GetAliveCount (), 0, "Nothing is alive before the first request");
+}
+EndTest ()
+
+/*
+ * Request 200 names from the model, storing them and the number of contents alive.
+ */
+static void
+SampleAt (Ptr<CCNxShotNoisePopularity> model, Ptr<CCNxContentRepository> repository,
+          std::set<std::string> *names, uint32_t *alive)
+{
+  for (int i = 0; i < 200; ++i)
+    {
+      Ptr<const CCNxName> name = model->GetNextName (repository);
+      std::ostringstream os;
+      os << *name;
+      names->insert (os.str ());
+    }
+  *alive = model->GetAliveCount ();
+}
+
+BeginTest (Churn)
+{
+  printf ("TestSuiteCCNxShotNoisePopularity Churn DoRun\n");
+  /*
+   * With a 1 second mean lifetime, the contents requested at t=0 and at t=100s should
+   * be disjoint, and the number alive should stay near ArrivalRate * MeanLifetime.
+   */
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=shot");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,1000000,true,0);
+  Ptr<CCNxShotNoisePopularity> model = CreateObject<CCNxShotNoisePopularity> ();
+  model->SetAttribute ("ArrivalRate", DoubleValue (50.0));
+  model->SetAttribute ("MeanLifetime", TimeValue (Seconds (1)));
+  model->SetAttribute ("InitialContents", UintegerValue (50));
+
+  std::set<std::string> early;
+  std::set<std::string> late;
+  uint32_t earlyAlive = 0;
+  uint32_t lateAlive = 0;
+  Simulator::Schedule (Seconds (0), &SampleAt, model, repository, &early, &earlyAlive);
+  Simulator::Schedule (Seconds (100), &SampleAt, model, repository, &late, &lateAlive);
+  Simulator::Run ();
+  Simulator::Destroy ();
+
+  NS_TEST_EXPECT_MSG_EQ (earlyAlive, 50, "Initial contents should all be alive at t=0");
+  bool steady = lateAlive > 20 && lateAlive < 100;
+  NS_TEST_EXPECT_MSG_EQ (steady, true, "Alive count " << lateAlive << " is far from 50");
+
+  bool disjoint = true;
+  for (std::set<std::string>::iterator i = late.begin (); i != late.end (); ++i)
+    {
+      disjoint = disjoint && early.find (*i) == early.end ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (disjoint, true, "Contents from t=0 should be dead by t=100s");
+
+  // Requests concentrate on a subset of what is alive, not on the whole catalog
+  bool concentrated = late.size () <= lateAlive;
+  NS_TEST_EXPECT_MSG_EQ (concentrated, true, "Requested contents should all be alive");
+}
+EndTest ()
+
+static void
+RequestOne (Ptr<CCNxShotNoisePopularity> model, Ptr<CCNxContentRepository> repository, uint32_t *answered)
+{
+  if (model->GetNextName (repository))
+    {
+      (*answered)++;
+    }
+}
+
+BeginTest (Degenerate)
+{
+  printf ("TestSuiteCCNxShotNoisePopularity Degenerate DoRun\n");
+  Ptr<CCNxShotNoisePopularity> model = CreateObject<CCNxShotNoisePopularity> ();
+  NS_TEST_EXPECT_MSG_EQ (model->SetAttributeFailSafe ("MeanLifetime", TimeValue (Seconds (0))), false,
+                         "A zero MeanLifetime should be rejected");
+  NS_TEST_EXPECT_MSG_EQ (model->SetAttributeFailSafe ("VolumeShape", DoubleValue (0.0)), false,
+                         "A zero VolumeShape should be rejected");
+
+  // No arrivals and the shortest lifetime: every request still gets a name, and none of them hang
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=shot");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,1000);
+  model->SetAttribute ("ArrivalRate", DoubleValue (0.0));
+  model->SetAttribute ("MeanLifetime", TimeValue (TimeStep (1)));
+  model->SetAttribute ("InitialContents", UintegerValue (0));
+
+  uint32_t answered = 0;
+  for (int i = 0; i < 10; ++i)
+    {
+      Simulator::Schedule (Seconds (i), &RequestOne, model, repository, &answered);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+  NS_TEST_EXPECT_MSG_EQ (answered, 10, "Every request should get a name");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxShotNoisePopularity
+ */
+static class TestSuiteCCNxShotNoisePopularity : public TestSuite
+{
+public:
+  TestSuiteCCNxShotNoisePopularity () : TestSuite ("ccnx-shot-noise-popularity", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Churn (), TestCase::QUICK);
+    AddTestCase (new Degenerate (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxShotNoisePopularity;
+
+} // namespace TestSuiteCCNxShotNoisePopularity
@@ -0,0 +1,175 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <fstream>
+
+#include "ns3/test.h"
+#include "ns3/string.h"
+#include "ns3/boolean.h"
+#include "ns3/ccnx-trace-popularity.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxTracePopularity {
+
+BeginTest (Constructor)
+{
+  printf ("TestSuiteCCNxTracePopularity Constructor DoRun\n");
+  Ptr<CCNxTracePopularity> model = CreateObject<CCNxTracePopularity> ();
+  NS_TEST_EXPECT_MSG_EQ (model->GetRequestCount (), 0, "No requests replayed yet");
+}
+EndTest ()
+
+BeginTest (Replay)
+{
+  printf ("TestSuiteCCNxTracePopularity Replay DoRun\n");
+  std::string path = CreateTempDirFilename ("ccnx-trace-popularity.txt");
+  std::ofstream trace (path.c_str ());
+  trace << "# a comment\n";
+  trace << "3\n";
+  trace << "\n";
+  trace << "  ccnx:/name=elsewhere/chunk=1 \n";
+  trace << "not-a-request\n";
+  trace << "12\n";
+  trace.close ();
+
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=trace");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,10);
+
+  Ptr<CCNxTracePopularity> model = CreateObject<CCNxTracePopularity> ();
+  model->SetAttribute ("TraceFile", StringValue (path));
+  model->SetAttribute ("Loop", BooleanValue (false));
+
+  Ptr <const CCNxName> expected[] = {
+    repository->GetName (3),
+    Create <CCNxName> ("ccnx:/name=elsewhere/chunk=1"),
+    repository->GetName (2),
+  };
+  for (int i = 0; i < 3; ++i)
+    {
+      Ptr<const CCNxName> name = model->GetNextName (repository);
+      bool exists = (name);
+      NS_TEST_EXPECT_MSG_EQ (exists, true, "Trace ended early at request " << i);
+      if (exists)
+        {
+          NS_TEST_EXPECT_MSG_EQ (name->Equals (*expected[i]), true, "Wrong name for request " << i);
+        }
+    }
+
+  bool ended = !model->GetNextName (repository);
+  NS_TEST_EXPECT_MSG_EQ (ended, true, "A non-looping trace should end");
+  NS_TEST_EXPECT_MSG_EQ (model->GetRequestCount (), 3, "Wrong request count");
+  model->Dispose ();
+}
+EndTest ()
+
+BeginTest (Loop)
+{
+  printf ("TestSuiteCCNxTracePopularity Loop DoRun\n");
+  std::string path = CreateTempDirFilename ("ccnx-trace-popularity-loop.txt");
+  std::ofstream trace (path.c_str ());
+  trace << "0\n1\n";
+  trace.close ();
+
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=trace");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,10);
+
+  Ptr<CCNxTracePopularity> model = CreateObject<CCNxTracePopularity> ();
+  model->SetAttribute ("TraceFile", StringValue (path));
+
+  for (int i = 0; i < 5; ++i)
+    {
+      Ptr<const CCNxName> name = model->GetNextName (repository);
+      bool correct = name && name->Equals (*repository->GetName (i % 2));
+      NS_TEST_EXPECT_MSG_EQ (correct, true, "Looping trace gave the wrong name at request " << i);
+    }
+  model->Dispose ();
+}
+EndTest ()
+
+BeginTest (MissingFile)
+{
+  printf ("TestSuiteCCNxTracePopularity MissingFile DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=trace");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,10);
+
+  Ptr<CCNxTracePopularity> model = CreateObject<CCNxTracePopularity> ();
+  model->SetAttribute ("TraceFile", StringValue (CreateTempDirFilename ("does-not-exist.txt")));
+  bool ended = !model->GetNextName (repository);
+  NS_TEST_EXPECT_MSG_EQ (ended, true, "A missing trace has no requests");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxTracePopularity
+ */
+static class TestSuiteCCNxTracePopularity : public TestSuite
+{
+public:
+  TestSuiteCCNxTracePopularity () : TestSuite ("ccnx-trace-popularity", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Replay (), TestCase::QUICK);
+    AddTestCase (new Loop (), TestCase::QUICK);
+    AddTestCase (new MissingFile (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxTracePopularity;
+
+} // namespace TestSuiteCCNxTracePopularity
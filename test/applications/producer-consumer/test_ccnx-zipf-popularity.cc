@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <vector>
+#include <cmath>
+
+#include "ns3/test.h"
+#include "ns3/double.h"
+#include "ns3/ccnx-zipf-popularity.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxZipfPopularity {
+
+/*
+ * Draw `samples` ranks over `count` items and check the frequency of the first few ranks
+ * against the exact Zipf probabilities.
+ */
+static bool
+CheckDistribution (double alpha, uint64_t count, int samples)
+{
+  Ptr<CCNxZipfPopularity> model = CreateObject<CCNxZipfPopularity> ();
+  model->SetAttribute ("Alpha", DoubleValue (alpha));
+
+  double normalization = 0.0;
+  for (uint64_t k = 1; k <= count; ++k)
+    {
+      normalization += std::pow ((double) k, -alpha);
+    }
+
+  std::vector<int> hits (4, 0);
+  for (int i = 0; i < samples; ++i)
+    {
+      uint64_t rank = model->SampleRank (count);
+      if (rank < 1 || rank > count)
+        {
+          return false;
+        }
+      if (rank <= hits.size ())
+        {
+          hits[rank - 1]++;
+        }
+    }
+
+  for (uint64_t k = 1; k <= hits.size (); ++k)
+    {
+      double expected = std::pow ((double) k, -alpha) / normalization;
+      double observed = (double) hits[k - 1] / samples;
+      if (std::fabs (observed - expected) > 0.1 * expected + 0.005)
+        {
+          printf ("alpha %f rank %lu observed %f expected %f\n", alpha, (unsigned long) k, observed, expected);
+          return false;
+        }
+    }
+  return true;
+}
+
+BeginTest (Constructor)
+{
+  printf ("TestSuiteCCNxZipfPopularity Constructor DoRun\n");
+  Ptr<CCNxZipfPopularity> model = CreateObject<CCNxZipfPopularity> ();
+  DoubleValue alpha;
+  model->GetAttribute ("Alpha", alpha);
+  NS_TEST_EXPECT_MSG_EQ (alpha.Get (), 0.8, "Wrong default Alpha");
+}
+EndTest ()
+
+BeginTest (SampleRank)
+{
+  printf ("TestSuiteCCNxZipfPopularity SampleRank DoRun\n");
+  NS_TEST_EXPECT_MSG_EQ (CheckDistribution (0.8, 1000, 50000), true, "Alpha 0.8 distribution is off");
+  NS_TEST_EXPECT_MSG_EQ (CheckDistribution (1.0, 100, 50000), true, "Alpha 1.0 distribution is off");
+  NS_TEST_EXPECT_MSG_EQ (CheckDistribution (1.5, 10000000, 50000), true, "Alpha 1.5 distribution is off");
+}
+EndTest ()
+
+BeginTest (GetNextName)
+{
+  printf ("TestSuiteCCNxZipfPopularity GetNextName DoRun\n");
+  Ptr <const CCNxName> prefix = Create <CCNxName> ("ccnx:/name=test/name=zipf");
+  Ptr <CCNxContentRepository> repository = Create <CCNxContentRepository> (prefix,10,10000000,true,0);
+  Ptr<CCNxZipfPopularity> model = CreateObject<CCNxZipfPopularity> ();
+  Ptr <const CCNxName> first = repository->GetName (0);
+  int firstCount = 0;
+  for (int i = 0; i < 1000; ++i)
+    {
+      Ptr<const CCNxName> name = model->GetNextName (repository);
+      bool found = (repository->GetContentObject (name));
+      NS_TEST_EXPECT_MSG_EQ (found, true, "Name should come from the repository");
+      if (name->Equals (*first))
+        {
+          firstCount++;
+        }
+    }
+  bool popular = firstCount > 0;
+  NS_TEST_EXPECT_MSG_EQ (popular, true, "Chunk 0 is the most popular and should have been requested");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxZipfPopularity
+ */
+static class TestSuiteCCNxZipfPopularity : public TestSuite
+{
+public:
+  TestSuiteCCNxZipfPopularity () : TestSuite ("ccnx-zipf-popularity", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new SampleRank (), TestCase::QUICK);
+    AddTestCase (new GetNextName (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxZipfPopularity;
+
+} // namespace TestSuiteCCNxZipfPopularity
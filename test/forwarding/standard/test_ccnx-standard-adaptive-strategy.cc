@@ -0,0 +1,274 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-standard-adaptive-strategy.h"
+#include "ns3/ccnx-interest.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardAdaptiveStrategy {
+
+static const char *_prefixUri = "ccnx:/name=adaptive";
+static const char *_nameUri = "ccnx:/name=adaptive/name=chunk";
+
+static Ptr<CCNxForwarderMessage>
+MessageFromName (Ptr<const CCNxName> name)
+{
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (CreateObject<CCNxInterest> (name));
+  return Create<CCNxForwarderMessage> (packet, Create<CCNxVirtualConnection> ());
+}
+
+static CCNxForwardingStrategy::Nexthop
+CreateNexthop (Ptr<CCNxConnection> connection, uint32_t cost)
+{
+  CCNxForwardingStrategy::Nexthop nexthop;
+  nexthop.connection = connection;
+  nexthop.cost = cost;
+  return nexthop;
+}
+
+static Ptr<CCNxConnectionList>
+Select (Ptr<CCNxStandardAdaptiveStrategy> strategy, const CCNxForwardingStrategy::NexthopVecType & nexthops,
+        const char *nameUri = _nameUri)
+{
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  strategy->SelectEgress (MessageFromName (Create<CCNxName> (nameUri)), Create<CCNxName> (_prefixUri), nexthops, egress);
+  return egress;
+}
+
+static void
+AdvanceTime (Time delay)
+{
+  Simulator::Stop (delay);
+  Simulator::Run ();
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+  bool ok = (strategy);
+  NS_TEST_EXPECT_MSG_EQ (ok, true, "Could not create a CCNxStandardAdaptiveStrategy");
+}
+EndTest ()
+
+BeginTest (MeasureAndSteer)
+{
+  Ptr<const CCNxName> prefix = Create<CCNxName> (_prefixUri);
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+
+  Ptr<CCNxConnection> slow = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> fast = Create<CCNxVirtualConnection> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (slow, 1));
+  nexthops.push_back (CreateNexthop (fast, 2));
+
+  // nothing measured: lowest cost plus a probe of the other
+  Ptr<CCNxConnectionList> egress = Select (strategy, nexthops);
+  NS_TEST_EXPECT_MSG_EQ (egress->size (), 2, "Unmeasured nexthop should be probed");
+  NS_TEST_EXPECT_MSG_EQ (egress->front (), slow, "Should start on the lowest cost nexthop");
+
+  strategy->InterestSatisfied (prefix, slow, MilliSeconds (50));
+  strategy->InterestSatisfied (prefix, fast, MilliSeconds (5));
+
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSmoothedRtt (prefix, slow), MilliSeconds (50), "Wrong first srtt");
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSmoothedRtt (prefix, fast), MilliSeconds (5), "Wrong first srtt");
+
+  egress = Select (strategy, nexthops);
+  NS_TEST_EXPECT_MSG_EQ (egress->size (), 1, "Should not probe before the probe interval");
+  NS_TEST_EXPECT_MSG_EQ (egress->front (), fast, "Should use the fastest nexthop");
+  strategy->InterestSatisfied (prefix, fast, MilliSeconds (13));
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSmoothedRtt (prefix, fast), MilliSeconds (6), "srtt should move 1/8 of the way");
+
+  // after the probe interval the other nexthop gets a copy
+  AdvanceTime (MilliSeconds (600));
+  egress = Select (strategy, nexthops);
+  NS_TEST_EXPECT_MSG_EQ (egress->size (), 2, "Should probe after the probe interval");
+  NS_TEST_EXPECT_MSG_EQ (egress->front (), fast, "Should still use the fastest nexthop");
+  NS_TEST_EXPECT_MSG_EQ (egress->back (), slow, "Should probe the other nexthop");
+
+  // the slow path got faster
+  for (unsigned i = 0; i < 40; ++i)
+    {
+      strategy->InterestSatisfied (prefix, slow, MilliSeconds (1));
+    }
+  egress = Select (strategy, nexthops);
+  NS_TEST_EXPECT_MSG_EQ (egress->front (), slow, "Should move to the nexthop that got faster");
+
+  strategy->PrintStatistics (std::cout);
+}
+EndTest ()
+
+BeginTest (UnsatisfiedInterests)
+{
+  Ptr<const CCNxName> prefix = Create<CCNxName> (_prefixUri);
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+  strategy->SetAttribute ("ProbeInterval", TimeValue (Seconds (100)));
+
+  Ptr<CCNxConnection> lossy = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> steady = Create<CCNxVirtualConnection> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (lossy, 1));
+  nexthops.push_back (CreateNexthop (steady, 1));
+
+  Select (strategy, nexthops);
+  strategy->InterestSatisfied (prefix, lossy, MilliSeconds (2));
+  strategy->InterestSatisfied (prefix, steady, MilliSeconds (4));
+
+  // the lossy one is faster, but stops answering, as reported by the PIT
+  for (unsigned i = 0; i < 30; ++i)
+    {
+      Ptr<CCNxConnectionList> egress = Select (strategy, nexthops);
+      if (egress->front () == steady)
+        {
+          strategy->InterestSatisfied (prefix, steady, MilliSeconds (4));
+        }
+      else
+        {
+          strategy->InterestTimedOut (prefix, lossy);
+        }
+    }
+
+  bool lossyDropped = strategy->GetSatisfaction (prefix, lossy) < 0.5;
+  NS_TEST_EXPECT_MSG_EQ (lossyDropped, true, "Satisfaction of the lossy nexthop should drop: " << strategy->GetSatisfaction (prefix, lossy));
+  NS_TEST_EXPECT_MSG_EQ (Select (strategy, nexthops)->front (), steady, "Should move away from the lossy nexthop");
+}
+EndTest ()
+
+BeginTest (ReturnedInterests)
+{
+  Ptr<const CCNxName> prefix = Create<CCNxName> (_prefixUri);
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+
+  Ptr<CCNxConnection> connection = Create<CCNxVirtualConnection> ();
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (connection, 1));
+  Select (strategy, nexthops);
+
+  strategy->InterestReturned (prefix, connection);
+  double returned = strategy->GetSatisfaction (prefix, connection);
+  NS_TEST_EXPECT_MSG_EQ (returned < 1.0, true, "A returned Interest should count as unsatisfied");
+
+  strategy->InterestTimedOut (prefix, connection);
+  double timedOut = strategy->GetSatisfaction (prefix, connection);
+  NS_TEST_EXPECT_MSG_EQ (timedOut < returned, true, "A timed out Interest should count as unsatisfied");
+
+  strategy->InterestSatisfied (prefix, connection, MilliSeconds (2));
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSatisfaction (prefix, connection) > timedOut, true, "A satisfied Interest should count as satisfied");
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSmoothedRtt (prefix, connection), MilliSeconds (2), "Wrong first srtt");
+}
+EndTest ()
+
+BeginTest (ProbeUnmeasured)
+{
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+  strategy->SetAttribute ("ProbeInterval", TimeValue (MilliSeconds (100)));
+
+  Ptr<CCNxConnection> first = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> silent = Create<CCNxVirtualConnection> ();
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (first, 1));
+  nexthops.push_back (CreateNexthop (silent, 2));
+
+  // a nexthop that never answers is probed once per ProbeInterval, not with every Interest
+  NS_TEST_EXPECT_MSG_EQ (Select (strategy, nexthops)->size (), 2, "Unmeasured nexthop should be probed");
+  NS_TEST_EXPECT_MSG_EQ (Select (strategy, nexthops)->size (), 1, "Unmeasured nexthop was just probed");
+
+  AdvanceTime (MilliSeconds (150));
+  NS_TEST_EXPECT_MSG_EQ (Select (strategy, nexthops)->size (), 2, "Unmeasured nexthop should be probed again");
+}
+EndTest ()
+
+BeginTest (UnknownPrefix)
+{
+  Ptr<const CCNxName> prefix = Create<CCNxName> (_prefixUri);
+  Ptr<CCNxStandardAdaptiveStrategy> strategy = CreateObject<CCNxStandardAdaptiveStrategy> ();
+  Ptr<CCNxConnection> connection = Create<CCNxVirtualConnection> ();
+
+  // feedback for a prefix the strategy never forwarded is ignored
+  strategy->InterestSatisfied (Create<CCNxName> ("ccnx:/name=other"), connection, MilliSeconds (1));
+  strategy->InterestTimedOut (Create<CCNxName> ("ccnx:/name=other"), connection);
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSmoothedRtt (prefix, connection).IsStrictlyNegative (), true, "Should not have a measurement");
+  NS_TEST_EXPECT_MSG_EQ (strategy->GetSatisfaction (prefix, connection), 1.0, "Should not have a satisfaction");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardAdaptiveStrategy
+ */
+static class TestSuiteCCNxStandardAdaptiveStrategy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardAdaptiveStrategy () : TestSuite ("ccnx-standard-adaptive-strategy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new MeasureAndSteer (), TestCase::QUICK);
+    AddTestCase (new UnsatisfiedInterests (), TestCase::QUICK);
+    AddTestCase (new ReturnedInterests (), TestCase::QUICK);
+    AddTestCase (new ProbeUnmeasured (), TestCase::QUICK);
+    AddTestCase (new UnknownPrefix (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardAdaptiveStrategy;
+
+} // namespace TestSuiteCCNxStandardAdaptiveStrategy
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-broadcast-strategy.h"
+#include "ns3/ccnx-interest.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardBroadcastStrategy {
+
+static Ptr<CCNxForwarderMessage>
+MessageFromName (Ptr<const CCNxName> name)
+{
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (CreateObject<CCNxInterest> (name));
+  return Create<CCNxForwarderMessage> (packet, Create<CCNxVirtualConnection> ());
+}
+
+static CCNxForwardingStrategy::Nexthop
+CreateNexthop (Ptr<CCNxConnection> connection, uint32_t cost)
+{
+  CCNxForwardingStrategy::Nexthop nexthop;
+  nexthop.connection = connection;
+  nexthop.cost = cost;
+  return nexthop;
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxStandardBroadcastStrategy> strategy = CreateObject<CCNxStandardBroadcastStrategy> ();
+  bool ok = (strategy);
+  NS_TEST_EXPECT_MSG_EQ (ok, true, "Could not create a CCNxStandardBroadcastStrategy");
+}
+EndTest ()
+
+BeginTest (SelectEgress)
+{
+  Ptr<CCNxStandardBroadcastStrategy> strategy = CreateObject<CCNxStandardBroadcastStrategy> ();
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=a/name=b");
+
+  Ptr<CCNxConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection2 = Create<CCNxVirtualConnection> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (connection1, 10));
+  nexthops.push_back (CreateNexthop (connection2, 1));
+
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  strategy->SelectEgress (MessageFromName (name), name, nexthops, egress);
+
+  NS_TEST_EXPECT_MSG_EQ (egress->size (), 2, "Wrong egress count");
+  NS_TEST_EXPECT_MSG_EQ (egress->front (), connection1, "Wrong first egress");
+  NS_TEST_EXPECT_MSG_EQ (egress->back (), connection2, "Wrong second egress");
+}
+EndTest ()
+
+BeginTest (SelectEgressEmpty)
+{
+  Ptr<CCNxStandardBroadcastStrategy> strategy = CreateObject<CCNxStandardBroadcastStrategy> ();
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=a/name=b");
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  strategy->SelectEgress (MessageFromName (name), name, nexthops, egress);
+
+  NS_TEST_EXPECT_MSG_EQ (egress->size (), 0, "Wrong egress count");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardBroadcastStrategy
+ */
+static class TestSuiteCCNxStandardBroadcastStrategy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardBroadcastStrategy () : TestSuite ("ccnx-standard-broadcast-strategy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new SelectEgress (), TestCase::QUICK);
+    AddTestCase (new SelectEgressEmpty (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardBroadcastStrategy;
+
+} // namespace TestSuiteCCNxStandardBroadcastStrategy
@@ -450,6 +450,55 @@ BeginTest (AddContentObject_ObjectCapacity)
 }
 EndTest ()
 
+static Ptr<CCNxStandardForwarderWorkItem>
+CreateVirtualContentWorkItem (std::string uri, size_t payloadLength, uint32_t hash, Ptr<CCNxConnection> ingress)
+{
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (Create<CCNxName> (uri), payloadLength);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (content);
+  packet->SetContentObjectHash (Create<CCNxHashValue> (hash));
+  return CreateWorkItem (packet, ingress);
+}
+
+BeginTest (AddContentObject_ByteCapacity)
+{
+  printf ("TestCCNxStandardContentStore_AddContentObject_ByteCapacity DoRun\n");
+  //ByteCapacity fits two 1000 byte virtual payloads, the third evicts the oldest
+  TestData data = CreateTestData ();
+
+  Ptr<CCNxStandardContentStoreWithTestMethods> a = CreateContentStore ();
+  a->SetAttribute ("ByteCapacity", IntegerValue (2500));
+  a->Initialize ();
+  NS_TEST_EXPECT_MSG_EQ (a->GetByteCapacity (), 2500, "wrong byte capacity");
+
+  Ptr<CCNxStandardForwarderWorkItem> item1 = CreateVirtualContentWorkItem ("ccnx:/name=big/chunk=1", 1000, 11, data.ingress1);
+  Ptr<CCNxStandardForwarderWorkItem> item2 = CreateVirtualContentWorkItem ("ccnx:/name=big/chunk=2", 1000, 12, data.ingress1);
+  Ptr<CCNxStandardForwarderWorkItem> item3 = CreateVirtualContentWorkItem ("ccnx:/name=big/chunk=3", 1000, 13, data.ingress1);
+  Ptr<CCNxStandardForwarderWorkItem> huge = CreateVirtualContentWorkItem ("ccnx:/name=big/chunk=4", 5000, 14, data.ingress1);
+
+  uint64_t packetBytes = item1->GetPacket ()->GetFixedHeader ()->GetPacketLength ();
+  bool charged = packetBytes > 1000;
+  NS_TEST_EXPECT_MSG_EQ (charged, true, "packet length should include the virtual payload");
+
+  a->AddContentObject (item1, data.eConnList1); StepSimulatorAddContentObject ();
+  a->AddContentObject (item2, data.eConnList1); StepSimulatorAddContentObject ();
+  NS_TEST_EXPECT_MSG_EQ (a->GetObjectCount (), 2, "Lru list length wrong");
+  NS_TEST_EXPECT_MSG_EQ (a->GetByteCount (), 2 * packetBytes, "wrong byte count");
+
+  a->AddContentObject (item3, data.eConnList1); StepSimulatorAddContentObject ();
+  NS_TEST_EXPECT_MSG_EQ (a->GetObjectCount (), 2, "Lru list length wrong after eviction");
+  NS_TEST_EXPECT_MSG_EQ (a->GetByteCount (), 2 * packetBytes, "wrong byte count after eviction");
+  NS_TEST_EXPECT_MSG_EQ (a->FindEntryInHashMap (item1->GetPacket ()), Ptr<CCNxStandardContentStoreEntry> (0), "oldest object should be evicted");
+
+  // An object larger than the whole store is not added and evicts nothing
+  a->AddContentObject (huge, data.eConnList1); StepSimulatorAddContentObject ();
+  NS_TEST_EXPECT_MSG_EQ (huge->GetContentAddedFlag (), false, "oversize object should not be added");
+  NS_TEST_EXPECT_MSG_EQ (a->GetObjectCount (), 2, "oversize object should not evict");
+
+  a->DeleteContentObject (item2->GetPacket ());
+  NS_TEST_EXPECT_MSG_EQ (a->GetByteCount (), packetBytes, "wrong byte count after delete");
+}
+EndTest ()
+
 
 BeginTest (FindEntryInHashMap)
 {
@@ -608,6 +657,7 @@ public:
 
     AddTestCase (new AddContentObject (), TestCase::QUICK);
     AddTestCase (new AddContentObject_ObjectCapacity (), TestCase::QUICK);
+    AddTestCase (new AddContentObject_ByteCapacity (), TestCase::QUICK);
     AddTestCase (new GetMapCounts (), TestCase::QUICK);
     AddTestCase (new MatchInterestTwoObjects (), TestCase::QUICK);
     AddTestCase (new AddContentObject2x (), TestCase::QUICK);
@@ -0,0 +1,236 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <sstream>
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
+#include "ns3/test.h"
+#include "ns3/ccnx-standard-ecmp-strategy.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/integer.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxStandardEcmpStrategy {
+
+static Ptr<CCNxForwarderMessage>
+MessageFromName (Ptr<const CCNxName> name)
+{
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (CreateObject<CCNxInterest> (name));
+  return Create<CCNxForwarderMessage> (packet, Create<CCNxVirtualConnection> ());
+}
+
+static CCNxForwardingStrategy::Nexthop
+CreateNexthop (Ptr<CCNxConnection> connection, uint32_t cost)
+{
+  CCNxForwardingStrategy::Nexthop nexthop;
+  nexthop.connection = connection;
+  nexthop.cost = cost;
+  return nexthop;
+}
+
+static Ptr<const CCNxName>
+NameFromIndex (const char *prefix, unsigned index)
+{
+  std::ostringstream uri;
+  uri << prefix << "/name=" << index;
+  return Create<CCNxName> (uri.str ());
+}
+
+static Ptr<CCNxConnection>
+Select (Ptr<CCNxStandardEcmpStrategy> strategy, Ptr<const CCNxName> name, const CCNxForwardingStrategy::NexthopVecType & nexthops)
+{
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  strategy->SelectEgress (MessageFromName (name), name, nexthops, egress);
+  NS_ASSERT_MSG (egress->size () == 1, "ECMP must select exactly one egress");
+  return egress->front ();
+}
+
+BeginTest (Constructor)
+{
+  Ptr<CCNxStandardEcmpStrategy> strategy = CreateObject<CCNxStandardEcmpStrategy> ();
+  bool ok = (strategy);
+  NS_TEST_EXPECT_MSG_EQ (ok, true, "Could not create a CCNxStandardEcmpStrategy");
+}
+EndTest ()
+
+BeginTest (HashName)
+{
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=a/name=b/name=c");
+  Ptr<const CCNxName> b = Create<CCNxName> ("ccnx:/name=a/name=b/name=c");
+  Ptr<const CCNxName> c = Create<CCNxName> ("ccnx:/name=a/name=b/name=d");
+
+  NS_TEST_EXPECT_MSG_EQ (CCNxStandardEcmpStrategy::HashName (a, 0), CCNxStandardEcmpStrategy::HashName (b, 0), "Equal names should hash the same");
+  NS_TEST_EXPECT_MSG_NE (CCNxStandardEcmpStrategy::HashName (a, 0), CCNxStandardEcmpStrategy::HashName (c, 0), "Different names should hash differently");
+  NS_TEST_EXPECT_MSG_EQ (CCNxStandardEcmpStrategy::HashName (a, 2), CCNxStandardEcmpStrategy::HashName (c, 2), "Common 2-segment prefix should hash the same");
+}
+EndTest ()
+
+BeginTest (OnlyLowestCost)
+{
+  Ptr<CCNxStandardEcmpStrategy> strategy = CreateObject<CCNxStandardEcmpStrategy> ();
+
+  Ptr<CCNxConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection3 = Create<CCNxVirtualConnection> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  nexthops.push_back (CreateNexthop (connection1, 10));
+  nexthops.push_back (CreateNexthop (connection2, 2));
+  nexthops.push_back (CreateNexthop (connection3, 2));
+
+  unsigned counts[3] = { 0, 0, 0 };
+  for (unsigned i = 0; i < 200; ++i)
+    {
+      Ptr<CCNxConnection> chosen = Select (strategy, NameFromIndex ("ccnx:/name=ecmp", i), nexthops);
+      counts[0] += (chosen == connection1);
+      counts[1] += (chosen == connection2);
+      counts[2] += (chosen == connection3);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (counts[0], 0, "Chose a higher cost nexthop");
+  NS_TEST_EXPECT_MSG_GT (counts[1], 50, "Equal cost nexthop 2 underused");
+  NS_TEST_EXPECT_MSG_GT (counts[2], 50, "Equal cost nexthop 3 underused");
+}
+EndTest ()
+
+BeginTest (Deterministic)
+{
+  Ptr<CCNxStandardEcmpStrategy> strategy1 = CreateObject<CCNxStandardEcmpStrategy> ();
+  Ptr<CCNxStandardEcmpStrategy> strategy2 = CreateObject<CCNxStandardEcmpStrategy> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  for (unsigned i = 0; i < 4; ++i)
+    {
+      nexthops.push_back (CreateNexthop (Create<CCNxVirtualConnection> (), 1));
+    }
+
+  // a different order of the same nexthops must not change the choice
+  CCNxForwardingStrategy::NexthopVecType reversed (nexthops.rbegin (), nexthops.rend ());
+
+  for (unsigned i = 0; i < 50; ++i)
+    {
+      Ptr<const CCNxName> name = NameFromIndex ("ccnx:/name=ecmp", i);
+      NS_TEST_EXPECT_MSG_EQ (Select (strategy1, name, nexthops), Select (strategy2, name, reversed), "Choice is not deterministic");
+    }
+}
+EndTest ()
+
+BeginTest (Consistent)
+{
+  Ptr<CCNxStandardEcmpStrategy> strategy = CreateObject<CCNxStandardEcmpStrategy> ();
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  for (unsigned i = 0; i < 4; ++i)
+    {
+      nexthops.push_back (CreateNexthop (Create<CCNxVirtualConnection> (), 1));
+    }
+
+  CCNxForwardingStrategy::NexthopVecType fewer (nexthops.begin (), nexthops.end () - 1);
+  Ptr<CCNxConnection> removed = nexthops.back ().connection;
+
+  for (unsigned i = 0; i < 100; ++i)
+    {
+      Ptr<const CCNxName> name = NameFromIndex ("ccnx:/name=ecmp", i);
+      Ptr<CCNxConnection> before = Select (strategy, name, nexthops);
+      if (before != removed)
+        {
+          NS_TEST_EXPECT_MSG_EQ (Select (strategy, name, fewer), before, "Name moved when an unrelated nexthop was removed");
+        }
+    }
+}
+EndTest ()
+
+BeginTest (HashSegmentCount)
+{
+  Ptr<CCNxStandardEcmpStrategy> strategy = CreateObject<CCNxStandardEcmpStrategy> ();
+  strategy->SetAttribute ("HashSegmentCount", IntegerValue (2));
+
+  CCNxForwardingStrategy::NexthopVecType nexthops;
+  for (unsigned i = 0; i < 4; ++i)
+    {
+      nexthops.push_back (CreateNexthop (Create<CCNxVirtualConnection> (), 1));
+    }
+
+  Ptr<CCNxConnection> first = Select (strategy, NameFromIndex ("ccnx:/name=ecmp/name=object", 0), nexthops);
+  for (unsigned i = 1; i < 20; ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (Select (strategy, NameFromIndex ("ccnx:/name=ecmp/name=object", i), nexthops), first, "Chunks of one object took different paths");
+    }
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxStandardEcmpStrategy
+ */
+static class TestSuiteCCNxStandardEcmpStrategy : public TestSuite
+{
+public:
+  TestSuiteCCNxStandardEcmpStrategy () : TestSuite ("ccnx-standard-ecmp-strategy", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new HashName (), TestCase::QUICK);
+    AddTestCase (new OnlyLowestCost (), TestCase::QUICK);
+    AddTestCase (new Deterministic (), TestCase::QUICK);
+    AddTestCase (new Consistent (), TestCase::QUICK);
+    AddTestCase (new HashSegmentCount (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxStandardEcmpStrategy;
+
+} // namespace TestSuiteCCNxStandardEcmpStrategy
@@ -57,9 +57,13 @@
 #include "ns3/test.h"
 #include "ns3/ccnx-standard-fib.h"
 #include "ns3/ccnx-standard-fibEntry.h"
+#include "ns3/ccnx-route-entry.h"
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/ccnx-forwarder-message.h"
+#include "ns3/ccnx-standard-fib-factory.h"
+#include "ns3/ccnx-standard-broadcast-strategy.h"
+#include "ns3/ccnx-standard-best-route-strategy.h"
 
 #include "../../TestMacros.h"
 
@@ -309,6 +313,40 @@ BeginTest (AddRoutes)
 EndTest ()
 
 
+BeginTest (BatchAddRoutes)
+{
+  CCNxStandardFib a;
+
+  Ptr<CCNxVirtualConnection> nextHop0 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> nextHop1 = Create<CCNxVirtualConnection> ();
+
+  Ptr<const CCNxName>  name0 = Create<CCNxName> ("ccnx:/name=aaaa");
+  Ptr<const CCNxName>  name1 = Create<CCNxName> ("ccnx:/name=aaaa/name=bbbb");
+  Ptr<const CCNxName>  name2 = Create<CCNxName> ("ccnx:/name=cccc");
+
+  // an existing entry is merged with the batch
+  a.AddRoute (name1, nextHop0);
+
+  // out of order, with repeated prefixes
+  CCNxFib::RouteEntryListType entries;
+  entries.push_back (Create<CCNxRouteEntry> (name2, 1, nextHop0));
+  entries.push_back (Create<CCNxRouteEntry> (name0, 1, nextHop1));
+  entries.push_back (Create<CCNxRouteEntry> (name1, 2, nextHop1));
+  entries.push_back (Create<CCNxRouteEntry> (name0, 3, nextHop0));
+
+  NS_TEST_EXPECT_MSG_EQ (a.AddRoutes (entries), true, "AddRoutes should succeed");
+  NS_TEST_EXPECT_MSG_EQ (a.CountEntries (), 3, "wrong number of fib entries !");
+
+  NS_TEST_EXPECT_MSG_EQ (a.DeleteRoute (name0, nextHop0), true, "missing route name0 nextHop0");
+  NS_TEST_EXPECT_MSG_EQ (a.DeleteRoute (name0, nextHop1), true, "missing route name0 nextHop1");
+  NS_TEST_EXPECT_MSG_EQ (a.DeleteRoute (name1, nextHop0), true, "missing route name1 nextHop0");
+  NS_TEST_EXPECT_MSG_EQ (a.DeleteRoute (name1, nextHop1), true, "missing route name1 nextHop1");
+  NS_TEST_EXPECT_MSG_EQ (a.CountEntries (), 1, "wrong number of fib entries !");
+
+  NS_TEST_EXPECT_MSG_EQ (a.AddRoutes (CCNxFib::RouteEntryListType ()), false, "empty batch should add nothing");
+}
+EndTest ()
+
 BeginTest (DeleteNonExistentRoute)
 {
   /* add several routes. delete nonexistent ones.
@@ -485,6 +523,118 @@ BeginTest (RemoveConnection)
 }
 EndTest ()
 
+BeginTest (LookupDefaultStrategy)
+{
+  /* the default strategy forwards on every nexthop except the ingress
+   */
+  Ptr<CCNxStandardFib> fib = CreateFib ();
+
+  Ptr<const CCNxName> name1 = Create<CCNxName> ("ccnx:/name=multi");
+  Ptr<CCNxVirtualConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection3 = Create<CCNxVirtualConnection> ();
+
+  fib->AddRoute (name1, connection1, 5);
+  fib->AddRoute (name1, connection2, 1);
+  fib->AddRoute (name1, connection3, 3);
+
+  bool isBroadcast = DynamicCast<CCNxStandardBroadcastStrategy> (fib->GetStrategy (name1));
+  NS_TEST_EXPECT_MSG_EQ (isBroadcast, true, "Default strategy should be broadcast");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name1), connection3));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 2, "Default strategy should use all nexthops but the ingress");
+}
+EndTest ()
+
+BeginTest (LookupPerPrefixStrategy)
+{
+  /* best-route on one prefix only, using the route costs
+   */
+  Ptr<CCNxStandardFib> fib = CreateFib ();
+
+  Ptr<const CCNxName> name1 = Create<CCNxName> ("ccnx:/name=best");
+  Ptr<const CCNxName> name1l = Create<CCNxName> ("ccnx:/name=best/name=route/name=chunk");
+  Ptr<const CCNxName> name2 = Create<CCNxName> ("ccnx:/name=flood");
+  Ptr<CCNxVirtualConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection3 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> ingress = Create<CCNxVirtualConnection> ();
+
+  fib->AddRoute (name1, connection1, 5);
+  fib->AddRoute (name1, connection2, 1);
+  fib->AddRoute (name1, connection3, 3);
+  fib->AddRoute (name2, connection1, 5);
+  fib->AddRoute (name2, connection2, 1);
+
+  fib->SetStrategy (name1, CreateObject<CCNxStandardBestRouteStrategy> ());
+  fib->PrintRoutes (std::cout);
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name1l), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 1, "Best route should use one nexthop");
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), connection2, "Best route did not choose the lowest cost");
+
+  // the best nexthop is the ingress, so the next best is used
+  fib->Lookup (CreateWorkItem (PacketFromName (name1l), connection2));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 1, "Best route should use one nexthop");
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), connection3, "Best route did not skip the ingress");
+
+  // a route cost update changes the choice
+  fib->AddRoute (name1, connection1, 0);
+  fib->Lookup (CreateWorkItem (PacketFromName (name1l), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->front (), connection1, "Best route did not follow the cost update");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name2), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 2, "Other prefixes should keep the default strategy");
+
+  NS_TEST_EXPECT_MSG_EQ (fib->ClearStrategy (name1), true, "ClearStrategy did not find the prefix");
+  NS_TEST_EXPECT_MSG_EQ (fib->ClearStrategy (name1), false, "ClearStrategy found a removed prefix");
+
+  fib->Lookup (CreateWorkItem (PacketFromName (name1l), ingress));
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_lookupCallbackConnections->size (), 3, "Cleared prefix should use the default strategy");
+}
+EndTest ()
+
+BeginTest (GetStrategyLongestMatch)
+{
+  Ptr<CCNxStandardFib> fib = CreateFib ();
+
+  Ptr<CCNxForwardingStrategy> strategyShort = CreateObject<CCNxStandardBestRouteStrategy> ();
+  Ptr<CCNxForwardingStrategy> strategyLong = CreateObject<CCNxStandardBestRouteStrategy> ();
+
+  fib->SetStrategy (Create<CCNxName> ("ccnx:/name=a"), strategyShort);
+  fib->SetStrategy (Create<CCNxName> ("ccnx:/name=a/name=b/name=c"), strategyLong);
+
+  NS_TEST_EXPECT_MSG_EQ (fib->GetStrategy (Create<CCNxName> ("ccnx:/name=a/name=x")), strategyShort, "Wrong strategy");
+  NS_TEST_EXPECT_MSG_EQ (fib->GetStrategy (Create<CCNxName> ("ccnx:/name=a/name=b")), strategyShort, "Wrong strategy");
+  NS_TEST_EXPECT_MSG_EQ (fib->GetStrategy (Create<CCNxName> ("ccnx:/name=a/name=b/name=c/name=d")), strategyLong, "Wrong strategy");
+
+  bool isBroadcast = DynamicCast<CCNxStandardBroadcastStrategy> (fib->GetStrategy (Create<CCNxName> ("ccnx:/name=z")));
+  NS_TEST_EXPECT_MSG_EQ (isBroadcast, true, "Unmatched name should use the default strategy");
+}
+EndTest ()
+
+BeginTest (DefaultStrategyAttribute)
+{
+  CCNxStandardFibFactory factory;
+  ObjectFactory strategyFactory;
+  strategyFactory.SetTypeId (CCNxStandardBestRouteStrategy::GetTypeId ());
+  factory.SetDefaultStrategy (strategyFactory);
+
+  Ptr<CCNxFib> fib = factory.Create<CCNxFib> ();
+  fib->SetLookupCallback (MakeCallback (&MockupReceiveInterestCallback));
+  fib->Initialize ();
+
+  bool isBestRoute = DynamicCast<CCNxStandardBestRouteStrategy> (fib->GetStrategy (Create<CCNxName> ("ccnx:/name=z")));
+  NS_TEST_EXPECT_MSG_EQ (isBestRoute, true, "Default strategy attribute not used");
+}
+EndTest ()
+
 
 
 
@@ -500,12 +650,17 @@ public:
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
     AddTestCase (new AddRoutes (), TestCase::QUICK);
+    AddTestCase (new BatchAddRoutes (), TestCase::QUICK);
     AddTestCase (new Lookup (), TestCase::QUICK);
     AddTestCase (new DeleteRoute (), TestCase::QUICK);
     AddTestCase (new RemoveConnection (), TestCase::QUICK);
     AddTestCase (new DeleteNonExistentRoute (), TestCase::QUICK );
     AddTestCase (new DeleteAllRoutes (), TestCase::QUICK );
     AddTestCase (new LookupBestMatch (), TestCase::QUICK );
+    AddTestCase (new LookupDefaultStrategy (), TestCase::QUICK );
+    AddTestCase (new LookupPerPrefixStrategy (), TestCase::QUICK );
+    AddTestCase (new GetStrategyLongestMatch (), TestCase::QUICK );
+    AddTestCase (new DefaultStrategyAttribute (), TestCase::QUICK );
   }
 } g_TestSuiteCCNxStandardFib;
 
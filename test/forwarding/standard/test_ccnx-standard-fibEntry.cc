@@ -53,6 +53,7 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
 #include "ns3/test.h"
 #include "ns3/ccnx-standard-fibEntry.h"
 #include "ns3/ccnx-connection.h"
@@ -60,6 +61,7 @@
 #include "ns3/log.h"
 #include "ns3/assert.h"
 #include "ns3/object.h"
+#include <limits>
 
 #include "../../TestMacros.h"
 
@@ -78,6 +80,49 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+BeginTest (AddConnectionWithCost)
+{
+  Ptr<CCNxStandardFibEntry> entry = Create<CCNxStandardFibEntry> ();
+  Ptr<CCNxConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection3 = Create<CCNxVirtualConnection> ();
+
+  NS_TEST_EXPECT_MSG_EQ (entry->AddConnection (connection1, 10), 1, "Wrong connection count");
+  NS_TEST_EXPECT_MSG_EQ (entry->AddConnection (connection2), 2, "Wrong connection count");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection1), 10, "Wrong cost");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection2), 0, "Connection without a cost should have cost 0");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection3), std::numeric_limits<uint32_t>::max (), "Missing connection should have max cost");
+
+  // update the cost, a plain add must not reset it
+  NS_TEST_EXPECT_MSG_EQ (entry->AddConnection (connection1, 4), 2, "Wrong connection count after cost update");
+  entry->AddConnection (connection1);
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection1), 4, "Cost not updated");
+}
+EndTest ()
+
+BeginTest (RemoveConnectionKeepsCosts)
+{
+  Ptr<CCNxStandardFibEntry> entry = Create<CCNxStandardFibEntry> ();
+  Ptr<CCNxConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxConnection> connection3 = Create<CCNxVirtualConnection> ();
+
+  entry->AddConnection (connection1, 1);
+  entry->AddConnection (connection2, 2);
+  entry->AddConnection (connection3, 3);
+
+  std::pair<bool,int> result = entry->RemoveConnection (connection2);
+  NS_TEST_EXPECT_MSG_EQ (result.first, true, "Connection not removed");
+  NS_TEST_EXPECT_MSG_EQ (result.second, 2, "Wrong connection count");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection1), 1, "Wrong cost after remove");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetCost (connection3), 3, "Wrong cost after remove");
+
+  result = entry->RemoveConnection (connection2);
+  NS_TEST_EXPECT_MSG_EQ (result.first, false, "Removed a missing connection");
+  NS_TEST_EXPECT_MSG_EQ (result.second, 2, "Wrong connection count");
+}
+EndTest ()
+
 
 
 
@@ -95,6 +140,8 @@ public:
   TestSuiteCCNxStandardFibEntry () : TestSuite ("ccnx-standard-fibEntry", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new AddConnectionWithCost (), TestCase::QUICK);
+    AddTestCase (new RemoveConnectionKeepsCosts (), TestCase::QUICK);
 //   AddTestCase (new b1 (), TestCase::QUICK);
 //   AddTestCase (new b1a (), TestCase::QUICK);
 //   AddTestCase (new b2 (), TestCase::QUICK);
@@ -62,6 +62,8 @@
 #include "ns3/integer.h"
 #include "ns3/object-factory.h"
 #include "ns3/ccnx-standard-content-store-factory.h"
+#include "ns3/ccnx-standard-fib-factory.h"
+#include "ns3/ccnx-standard-best-route-strategy.h"
 
 #include "../../TestMacros.h"
 
@@ -78,6 +80,9 @@ static CCNxRoutingError::RoutingErrno _routeCallbackErrno;
 static Ptr<CCNxConnectionList> _routeCallbackConnections;
 static bool _routeCallbackFired;
 
+static Ptr<CCNxPacket> _interestReturnPacket;
+static Ptr<CCNxConnectionList> _interestReturnConnections;
+
 static Time _layerDelay = MicroSeconds (1);
 
 /*
@@ -93,6 +98,12 @@ MockupRouteCallback (Ptr<CCNxPacket> packet, Ptr<CCNxConnection> ingress, enum C
   _routeCallbackErrno = routingErrno;
   _routeCallbackConnections = connectionList;
   _routeCallbackFired = true;
+
+  if (packet->GetFixedHeader ()->GetPacketType () == CCNxFixedHeaderType_InterestReturn)
+    {
+      _interestReturnPacket = packet;
+      _interestReturnConnections = connectionList;
+    }
 }
 
 Ptr<CCNxStandardForwarder> CreateForwarder (bool WithContentStore=true)
@@ -429,12 +440,17 @@ BeginTest (DuplicateRoutes)
   forwarder->RemoveRoute (data.nextHop3,data.prefix3);
   NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::FibTable),2,"wrong number of fib entries");
 
-  //route an interest for prefix3 - not forwarded - but is retained in pit
+  //route an interest for prefix3 - not forwarded - an InterestReturn goes back and removes the pit entry
   forwarder->RouteInput (data.iPacket3,data.ingress1);
   StepSimulator ();
   NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (),0,"wrong number of connections");
 //  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno,CCNxRoutingError::CCNxRoutingError_NoRoute,"wrong errorno");
   NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable),2,"wrong number of pit entries");
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackPacket->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_InterestReturn, "expected an InterestReturn");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (),1,"wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (),"InterestReturn not sent to interest source");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable),1,"wrong number of pit entries");
 
   forwarder->AddRoute (data.route3);
   NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::FibTable),3,"wrong number of fib entries");
@@ -450,7 +466,7 @@ BeginTest (DuplicateRoutes)
   NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (),1,"wrong number of connections");
   NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (),"interest not forwarded to correct nextHop");
   _routeCallbackConnections->pop_front ();
-  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable),1,"wrong number of pit entries");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable),0,"wrong number of pit entries");
 
 
   printf ("TestCCNxStandardForwarder b6 End\n");
@@ -459,6 +475,51 @@ BeginTest (DuplicateRoutes)
 EndTest ()
 
 
+/*
+ * AddRoute without a cost must not change the cost of an existing nexthop
+ */
+BeginTest (AddRouteKeepsCost)
+{
+  CCNxStandardFibFactory fibFactory;
+  ObjectFactory strategyFactory;
+  strategyFactory.SetTypeId (CCNxStandardBestRouteStrategy::GetTypeId ());
+  fibFactory.SetDefaultStrategy (strategyFactory);
+
+  Ptr<CCNxStandardForwarder> forwarder = CreateObject<CCNxStandardForwarder> ();
+  forwarder->SetAttribute ("FibFactory", ObjectFactoryValue (fibFactory));
+  forwarder->SetAttribute ("LayerDelayConstant", TimeValue (_layerDelay));
+  forwarder->SetAttribute ("LayerDelaySlope", TimeValue (Seconds (0)));
+  forwarder->SetAttribute ("LayerDelayServers", IntegerValue (1));
+  forwarder->SetRouteCallback (MakeCallback (&MockupRouteCallback));
+  forwarder->Initialize ();
+
+  TestData data = CreateTestData ();
+  Ptr<CCNxRoute> route = Create<CCNxRoute> (data.prefix1);
+  route->AddNexthop (Create<CCNxRouteEntry> (data.prefix1, 10, data.nextHop1));
+  route->AddNexthop (Create<CCNxRouteEntry> (data.prefix1, 5, data.nextHop2));
+  forwarder->AddRoute (route);
+
+  // nextHop1 keeps cost 10, so the best route is still nextHop2
+  forwarder->AddRoute (data.nextHop1, data.prefix1);
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.nextHop2->GetConnectionId (), "existing nexthop cost was reset");
+  _routeCallbackConnections->pop_front ();
+
+  // a new nexthop without a cost costs 0
+  forwarder->AddRoute (data.nextHop3, data.prefix1);
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (Create<CCNxName> ("ccnx:/name=trump/name=is/name=forwarder/name=other"));
+  forwarder->RouteInput (CCNxPacket::CreateFromMessage (interest), data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.nextHop3->GetConnectionId (), "new nexthop should cost 0");
+  _routeCallbackConnections->pop_front ();
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
 /*
  * RouteOutput test of one interest to one content object
  */
@@ -620,6 +681,174 @@ BeginTest (NoContentStore)
 EndTest ()
 
 
+BeginTest (HopLimitExceeded)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  // An Interest from Layer 2 with a HopLimit of 0 whose only routes are remote is not forwarded
+  data.iPacket1->GetFixedHeader ()->SetHopLimit (0);
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno, CCNxRoutingError::CCNxRoutingError_HopLimitExceeded, "wrong errorno");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 0, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) data.iPacket1->GetFixedHeader ()->GetHopLimit (), 0, "HopLimit should stay at 0");
+
+  // and an InterestReturn goes back to the ingress out of the PIT
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackPacket->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_InterestReturn, "expected an InterestReturn");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) _routeCallbackPacket->GetFixedHeader ()->GetReturnCode (), CCNxInterestReturnCode_HopLimitExceeded, "wrong return code");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (), "InterestReturn not sent to ingress");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 0, "wrong number of pit entries");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (HopLimitZeroFromContentStore)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  // fill the content store
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  forwarder->RouteInput (data.cPacket1, data.nextHop1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 0, "wrong number of pit entries");
+
+  // An Interest with a HopLimit of 0 may still be answered locally
+  data.iPacket1->GetFixedHeader ()->SetHopLimit (0);
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno, CCNxRoutingError::CCNxRoutingError_NoError, "wrong errorno");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackPacket, data.cPacket1, "wrong packet returned");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (), "content from CS not sent to ingress");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (HopLimitDecrement)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  // serialize the packet first so the forwarder must patch the cached ns3::Packet
+  data.iPacket1->GetFixedHeader ()->SetHopLimit (2);
+  Ptr<const Packet> before = data.iPacket1->GetNs3Packet ();
+
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) data.iPacket1->GetFixedHeader ()->GetHopLimit (), 1, "HopLimit not decremented");
+
+  Ptr<CCNxPacket> decoded = CCNxPacket::CreateFromNs3Packet (data.iPacket1->GetNs3Packet ());
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) decoded->GetFixedHeader ()->GetHopLimit (), 1, "HopLimit not patched in ns3 packet");
+  NS_TEST_EXPECT_MSG_EQ (data.iPacket1->GetNs3Packet ()->GetSize (), before->GetSize (), "Packet size changed");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (HopLimitZeroNotForwardedRemote)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  // Arrives with 1, leaves with 0, so it may only go to a local application
+  data.iPacket1->GetFixedHeader ()->SetHopLimit (1);
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 0, "Interest with HopLimit 0 should not go to a remote node");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (NoRouteInterestReturn)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+
+  // no routes, so the Interest is dropped after the FIB lookup
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 0, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 1, "wrong number of pit entries");
+
+  // then the InterestReturn comes back out of the PIT
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno, CCNxRoutingError::CCNxRoutingError_NoError, "wrong errorno");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackPacket->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_InterestReturn, "expected an InterestReturn");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) _routeCallbackPacket->GetFixedHeader ()->GetReturnCode (), CCNxInterestReturnCode_NoRoute, "wrong return code");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (), "InterestReturn not sent to interest source");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 0, "wrong number of pit entries");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (InterestReturnFromUpstream)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.nextHop1->GetConnectionId (), "interest not forwarded to correct nextHop");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 1, "wrong number of pit entries");
+
+  // the upstream returns the Interest, it goes back to the source and the pit entry is removed
+  Ptr<CCNxPacket> nack = CCNxPacket::CreateInterestReturn (data.iPacket1, CCNxInterestReturnCode_NoResources);
+  forwarder->RouteInput (nack, data.nextHop1);
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno, CCNxRoutingError::CCNxRoutingError_NoError, "wrong errorno");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackPacket, nack, "wrong packet returned");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 1, "wrong number of connections");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.ingress1->GetConnectionId (), "InterestReturn not sent to interest source");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 0, "wrong number of pit entries");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (CongestionInterestReturn)
+{
+  Ptr<CCNxStandardForwarder> forwarder = CreateForwarder ();
+  forwarder->SetAttribute ("InputQueueLimit", IntegerValue (1));
+  TestData data = CreateTestData ();
+  SetupRoutes (forwarder, data);
+
+  // the first Interest fills the input queue, the second is refused right away
+  forwarder->RouteInput (data.iPacket1, data.ingress1);
+  _routeCallbackFired = false;
+  _interestReturnPacket = 0;
+  forwarder->RouteInput (data.iPacket2, data.ingress2);
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackFired, true, "Route callback should fire synchronously");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackErrno, CCNxRoutingError::CCNxRoutingError_Congestion, "wrong errorno");
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->size (), 0, "wrong number of connections");
+
+  NS_TEST_ASSERT_MSG_NE (_interestReturnPacket, Ptr<CCNxPacket> (0), "Expected an InterestReturn");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) _interestReturnPacket->GetFixedHeader ()->GetReturnCode (), CCNxInterestReturnCode_Congestion, "wrong return code");
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnConnections->front ()->GetConnectionId (), data.ingress2->GetConnectionId (), "InterestReturn not sent to ingress");
+
+  // the first Interest is still forwarded
+  StepSimulator ();
+  NS_TEST_EXPECT_MSG_EQ (_routeCallbackConnections->front ()->GetConnectionId (), data.nextHop1->GetConnectionId (), "interest not forwarded to correct nextHop");
+  NS_TEST_EXPECT_MSG_EQ (forwarder->CountEntries (CCNxStandardForwarder::PitTable), 1, "wrong number of pit entries");
+
+  Simulator::Destroy ();
+}
+EndTest ()
 
 //#TODO CCN test forwarder stats
 //#TODO CCN test no content store option set by attribute
@@ -642,13 +871,20 @@ public:
     AddTestCase (new OneInterestToOneContent (), TestCase::QUICK);
     AddTestCase (new OneInterestNonMatchingContent (), TestCase::QUICK);
     AddTestCase (new TwoInterestOneContent (), TestCase::QUICK);
-//   AddTestCase (new InterestReturnPacket, TestCase::QUICK); TODO CCN write this case
+    AddTestCase (new NoRouteInterestReturn (), TestCase::QUICK);
+    AddTestCase (new InterestReturnFromUpstream (), TestCase::QUICK);
+    AddTestCase (new CongestionInterestReturn (), TestCase::QUICK);
     AddTestCase (new InterestToTwo (), TestCase::QUICK);
     AddTestCase (new DuplicateRoutes (), TestCase::QUICK);
+    AddTestCase (new AddRouteKeepsCost (), TestCase::QUICK);
     AddTestCase (new RouteOutputOneInterestOneContent (), TestCase::QUICK);
     AddTestCase (new RouteExactName (), TestCase::QUICK);
     AddTestCase (new ContentStore (), TestCase::QUICK);
     AddTestCase (new NoContentStore (), TestCase::QUICK);
+    AddTestCase (new HopLimitExceeded (), TestCase::QUICK);
+    AddTestCase (new HopLimitZeroFromContentStore (), TestCase::QUICK);
+    AddTestCase (new HopLimitDecrement (), TestCase::QUICK);
+    AddTestCase (new HopLimitZeroNotForwardedRemote (), TestCase::QUICK);
 
   }
 } g_TestSuiteCCNxStandardForwarder;
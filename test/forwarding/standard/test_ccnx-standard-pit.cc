@@ -185,12 +185,83 @@ MockupSatisfyInterestCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnec
   _satisfyInterestCallbackFired = true;
 }
 
+static Ptr<CCNxConnectionList> _interestReturnCallbackConnections;
+static bool _interestReturnCallbackFired;
+
+/*
+ * used by the PIT as the callback function for ReceiveInterestReturn.
+ */
+static void
+MockupReceiveInterestReturnCallback (Ptr<CCNxForwarderMessage> message, Ptr<CCNxConnectionList> egress)
+{
+  _interestReturnCallbackConnections = egress;
+  _interestReturnCallbackFired = true;
+}
+
+/*
+ * The FIB prefix the tests forward Interests under
+ */
+static Ptr<const CCNxName> _fibPrefix = Create<CCNxName> ("ccnx:/name=fib");
+
+static Ptr<const CCNxName> _interestSatisfiedName;
+static Ptr<const CCNxName> _interestSatisfiedPrefix;
+static Ptr<CCNxConnection> _interestSatisfiedUpstream;
+static Time _interestSatisfiedRtt;
+static bool _interestSatisfiedCallbackFired;
+
+/*
+ * used by the PIT as the callback function for satisfaction events.
+ */
+static void
+MockupInterestSatisfiedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream, Time rtt)
+{
+  _interestSatisfiedName = name;
+  _interestSatisfiedPrefix = prefix;
+  _interestSatisfiedUpstream = upstream;
+  _interestSatisfiedRtt = rtt;
+  _interestSatisfiedCallbackFired = true;
+}
+
+static Ptr<CCNxConnection> _interestReturnedUpstream;
+static unsigned _interestReturnedCount = 0;
+
+/*
+ * used by the PIT as the callback function for InterestReturns from an upstream.
+ */
+static void
+MockupInterestReturnedCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  NS_ASSERT_MSG (prefix->Equals (*_fibPrefix), "Wrong prefix " << *prefix);
+  _interestReturnedUpstream = upstream;
+  _interestReturnedCount++;
+}
+
+static Ptr<const CCNxName> _interestTimedOutName;
+static Ptr<CCNxConnection> _interestTimedOutUpstream;
+static unsigned _interestTimedOutCount = 0;
+
+/*
+ * used by the PIT as the callback function for upstreams that time out.
+ */
+static void
+MockupInterestTimedOutCallback (Ptr<const CCNxName> name, Ptr<const CCNxName> prefix, Ptr<CCNxConnection> upstream)
+{
+  NS_ASSERT_MSG (prefix->Equals (*_fibPrefix), "Wrong prefix " << *prefix);
+  _interestTimedOutName = name;
+  _interestTimedOutUpstream = upstream;
+  _interestTimedOutCount++;
+}
+
 Ptr<CCNxStandardPit>
 CreatePit ()
 {
   Ptr<CCNxStandardPit> pit = CreateObject<CCNxStandardPit> ();
   pit->SetReceiveInterestCallback (MakeCallback (&MockupReceiveInterestCallback));
   pit->SetSatisfyInterestCallback (MakeCallback (&MockupSatisfyInterestCallback));
+  pit->SetReceiveInterestReturnCallback (MakeCallback (&MockupReceiveInterestReturnCallback));
+  pit->SetInterestSatisfiedCallback (MakeCallback (&MockupInterestSatisfiedCallback));
+  pit->SetInterestReturnedCallback (MakeCallback (&MockupInterestReturnedCallback));
+  pit->SetInterestTimedOutCallback (MakeCallback (&MockupInterestTimedOutCallback));
   pit->Initialize ();
   return pit;
 }
@@ -225,6 +296,20 @@ StepSimulatorSatisfyInterest ()
   NS_ASSERT_MSG (_receiveInterestCallbackFired, "Did not get a call to SatisfyInterestCallback");
 }
 
+static void
+StepSimulatorReceiveInterestReturn ()
+{
+  unsigned tries = 0;
+  _interestReturnCallbackFired = false;
+  while (!_interestReturnCallbackFired && tries < 4)
+    {
+      Simulator::Stop (_layerDelay);
+      Simulator::Run ();
+      tries++;
+    }
+
+  NS_ASSERT_MSG (_interestReturnCallbackFired, "Did not get a call to ReceiveInterestReturnCallback");
+}
 
 BeginTest (Constructor)
 {
@@ -674,6 +759,292 @@ BeginTest (b6)
 }
 EndTest ()
 
+BeginTest (InterestReturn)
+{
+  //two interests different ports, aggregated, one InterestReturn from upstream
+  //receiveInterestReturn - should return both ports and remove the entry
+
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=trump/name=is");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxPacket> nPacket1 = CCNxPacket::CreateInterestReturn (iPacket1, CCNxInterestReturnCode_NoRoute);
+  Ptr<CCNxVirtualConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection2 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection3 = Create<CCNxVirtualConnection> ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, connection1));
+  StepSimulatorReceiveInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_receiveInterestCallbackVerdict, CCNxPit::Forward, "verdict should be forward !");
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, connection2));
+  StepSimulatorReceiveInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_receiveInterestCallbackVerdict, CCNxPit::Aggregate, "verdict should be aggregate !");
+
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (connection3);
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+
+  // an InterestReturn from a connection the Interest was not sent on is ignored
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, connection2));
+  StepSimulatorReceiveInterestReturn ();
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnCallbackConnections->size (), 0, "InterestReturn from a non-upstream should be ignored!");
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 1, "pit entry should still be there!");
+
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, connection3));
+  StepSimulatorReceiveInterestReturn ();
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnCallbackConnections->size (), 2, "wrong number of connections!");
+  NS_TEST_EXPECT_MSG_EQ (listContains (_interestReturnCallbackConnections, connection1), true, "missing connection1");
+  NS_TEST_EXPECT_MSG_EQ (listContains (_interestReturnCallbackConnections, connection2), true, "missing connection2");
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 0, "pit entry should be removed!");
+
+  // a second InterestReturn does not match anything
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, connection3));
+  StepSimulatorReceiveInterestReturn ();
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnCallbackConnections->size (), 0, "should not have gotten back any connections!");
+}
+EndTest ()
+
+BeginTest (InterestReturnOtherUpstreamPending)
+{
+  //one interest forwarded on two upstreams, one returns an InterestReturn and the other Content
+  //the InterestReturn is absorbed and the Content still goes downstream
+
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=multipath");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxContentObject> content1 = Create<CCNxContentObject> (name1);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxPacket> nPacket1 = CCNxPacket::CreateInterestReturn (iPacket1, CCNxInterestReturnCode_Congestion);
+  Ptr<CCNxPacket> cPacket1 = CCNxPacket::CreateFromMessage (content1);
+  Ptr<CCNxVirtualConnection> downstream = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> nacking = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> answering = Create<CCNxVirtualConnection> ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, downstream));
+  StepSimulatorReceiveInterest ();
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (nacking);
+  egress->push_back (answering);
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+
+  _interestReturnedCount = 0;
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, nacking));
+  StepSimulatorReceiveInterestReturn ();
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnCallbackConnections->size (), 0, "InterestReturn should wait for the other upstream");
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnedCount, 1, "InterestReturn should be reported");
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnedUpstream, nacking, "Wrong returning upstream");
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 1, "pit entry should be kept");
+
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, answering));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_satisfyInterestCallbackConnections->size (), 1, "Content should go downstream");
+  NS_TEST_EXPECT_MSG_EQ (listContains (_satisfyInterestCallbackConnections, downstream), true, "missing downstream");
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 0, "pit entry should be removed");
+
+  // both upstreams returning the Interest does send it downstream
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, downstream));
+  StepSimulatorReceiveInterest ();
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, nacking));
+  StepSimulatorReceiveInterestReturn ();
+  pit->ReceiveInterestReturn (Create<CCNxForwarderMessage> (nPacket1, answering));
+  StepSimulatorReceiveInterestReturn ();
+  NS_TEST_EXPECT_MSG_EQ (_interestReturnCallbackConnections->size (), 1, "InterestReturn should go downstream");
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 0, "pit entry should be removed");
+}
+EndTest ()
+
+BeginTest (RemoveEntry)
+{
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=trump/name=is");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxVirtualConnection> connection1 = Create<CCNxVirtualConnection> ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, connection1));
+  StepSimulatorReceiveInterest ();
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 1, "wrong number of table entries!");
+
+  pit->RemoveEntry (interest1);
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 0, "wrong number of table entries!");
+}
+EndTest ()
+
+BeginTest (InterestSatisfied)
+{
+  //one interest, content 10 msec later from upstream
+  //the satisfaction callback gets the name, upstream and round trip time
+
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=trump/name=is");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxContentObject> content1 = Create<CCNxContentObject> (name1);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxPacket> cPacket1 = CCNxPacket::CreateFromMessage (content1);
+  Ptr<CCNxVirtualConnection> connection1 = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> connection2 = Create<CCNxVirtualConnection> ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, connection1));
+  StepSimulatorReceiveInterest ();
+  Time forwardTime = Simulator::Now ();
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (connection2);
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+
+  Simulator::Stop (MilliSeconds (10));
+  Simulator::Run ();
+
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, connection2));
+  StepSimulatorSatisfyInterest ();
+
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, true, "Satisfaction callback not called");
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedName->Equals (*name1), true, "Wrong name");
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedPrefix, _fibPrefix, "Wrong FIB prefix");
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedUpstream, connection2, "Wrong upstream connection");
+  bool rttTooShort = _interestSatisfiedRtt < MilliSeconds (10);
+  bool rttTooLong = _interestSatisfiedRtt > Simulator::Now () - forwardTime + MicroSeconds (10);
+  NS_TEST_EXPECT_MSG_EQ (rttTooShort, false, "Rtt too short: " << _interestSatisfiedRtt);
+  NS_TEST_EXPECT_MSG_EQ (rttTooLong, false, "Rtt too long: " << _interestSatisfiedRtt);
+
+  // a duplicate content object does not match a PIT entry, so there is no measurement
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, connection2));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, false, "Satisfaction callback called without a PIT entry");
+}
+EndTest ()
+
+BeginTest (InterestSatisfiedPerUpstream)
+{
+  //one interest forwarded on two upstreams, the fast one answers after 10 msec and the slow one after 30 msec
+  //each upstream is measured from its own send time, and the slow one after the PIT entry is gone
+
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=straggler");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxContentObject> content1 = Create<CCNxContentObject> (name1);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxPacket> cPacket1 = CCNxPacket::CreateFromMessage (content1);
+  Ptr<CCNxVirtualConnection> downstream = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> fast = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> slow = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> other = Create<CCNxVirtualConnection> ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, downstream));
+  StepSimulatorReceiveInterest ();
+
+  // the slow upstream is sent to first, so a single entry send time would credit it wrongly
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (slow);
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+
+  Simulator::Stop (MilliSeconds (5));
+  Simulator::Run ();
+  Time fastSend = Simulator::Now ();
+  egress = Create<CCNxConnectionList> ();
+  egress->push_back (fast);
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+
+  Simulator::Stop (MilliSeconds (10));
+  Simulator::Run ();
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, fast));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, true, "Satisfaction callback not called");
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedUpstream, fast, "Wrong upstream connection");
+  bool fastRttOk = _interestSatisfiedRtt >= MilliSeconds (10) && _interestSatisfiedRtt <= Simulator::Now () - fastSend;
+  NS_TEST_EXPECT_MSG_EQ (fastRttOk, true, "Wrong fast rtt: " << _interestSatisfiedRtt);
+  NS_TEST_EXPECT_MSG_EQ (pit->CountEntries (), 0, "PIT entry should be removed");
+
+  // an upstream the Interest was not sent on is not measured
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, other));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, false, "Satisfaction callback for an unused upstream");
+
+  Simulator::Stop (MilliSeconds (15));
+  Simulator::Run ();
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, slow));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, true, "Straggler not measured");
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedUpstream, slow, "Wrong upstream connection");
+  bool slowRttOk = _interestSatisfiedRtt >= MilliSeconds (30);
+  NS_TEST_EXPECT_MSG_EQ (slowRttOk, true, "Wrong slow rtt: " << _interestSatisfiedRtt);
+  NS_TEST_EXPECT_MSG_EQ (_satisfyInterestCallbackConnections->size (), 0, "Straggler should not be forwarded");
+
+  // and only once
+  _interestSatisfiedCallbackFired = false;
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, slow));
+  StepSimulatorSatisfyInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestSatisfiedCallbackFired, false, "Straggler measured twice");
+}
+EndTest ()
+
+BeginTest (InterestTimedOut)
+{
+  //one interest forwarded on two upstreams, one answers and the other never does
+  //the silent one times out StragglerTimeout later, and an unanswered entry DefaultLifetime after the send
+
+  Ptr<CCNxStandardPit> pit = CreatePit ();
+  pit->SetAttribute ("StragglerTimeout", TimeValue (MilliSeconds (50)));
+  pit->SetAttribute ("DefaultLifetime", TimeValue (MilliSeconds (100)));
+
+  Ptr<CCNxName> name1 = Create<CCNxName> ("ccnx:/name=fib/name=answered");
+  Ptr<CCNxName> name2 = Create<CCNxName> ("ccnx:/name=fib/name=unanswered");
+  Ptr<CCNxName> name3 = Create<CCNxName> ("ccnx:/name=fib/name=later");
+  Ptr<CCNxInterest> interest1 = Create<CCNxInterest> (name1);
+  Ptr<CCNxInterest> interest2 = Create<CCNxInterest> (name2);
+  Ptr<CCNxPacket> iPacket1 = CCNxPacket::CreateFromMessage (interest1);
+  Ptr<CCNxPacket> iPacket2 = CCNxPacket::CreateFromMessage (interest2);
+  Ptr<CCNxPacket> iPacket3 = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name3));
+  Ptr<CCNxPacket> cPacket1 = CCNxPacket::CreateFromMessage (Create<CCNxContentObject> (name1));
+  Ptr<CCNxVirtualConnection> downstream = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> answering = Create<CCNxVirtualConnection> ();
+  Ptr<CCNxVirtualConnection> silent = Create<CCNxVirtualConnection> ();
+
+  Ptr<CCNxConnectionList> egress = Create<CCNxConnectionList> ();
+  egress->push_back (answering);
+  egress->push_back (silent);
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket1, downstream));
+  StepSimulatorReceiveInterest ();
+  pit->InterestForwarded (interest1, _fibPrefix, egress);
+  pit->SatisfyInterest (Create<CCNxForwarderMessage> (cPacket1, answering));
+  StepSimulatorSatisfyInterest ();
+
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket2, downstream));
+  StepSimulatorReceiveInterest ();
+  pit->InterestForwarded (interest2, _fibPrefix, egress);
+
+  // timeouts are found when the PIT services a packet
+  _interestTimedOutCount = 0;
+  Simulator::Stop (MilliSeconds (60));
+  Simulator::Run ();
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket3, downstream));
+  StepSimulatorReceiveInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestTimedOutCount, 1, "The straggler should time out");
+  NS_TEST_EXPECT_MSG_EQ (_interestTimedOutName->Equals (*name1), true, "Wrong name");
+  NS_TEST_EXPECT_MSG_EQ (_interestTimedOutUpstream, silent, "Only the silent upstream should time out");
+
+  _interestTimedOutCount = 0;
+  Simulator::Stop (MilliSeconds (50));
+  Simulator::Run ();
+  pit->ReceiveInterest (Create<CCNxForwarderMessage> (iPacket3, downstream));
+  StepSimulatorReceiveInterest ();
+  NS_TEST_EXPECT_MSG_EQ (_interestTimedOutCount, 2, "Both upstreams of the unanswered Interest should time out");
+  NS_TEST_EXPECT_MSG_EQ (_interestTimedOutName->Equals (*name2), true, "Wrong name");
+}
+EndTest ()
+
 /**
  * \ingroup ccnx-test
  *
@@ -693,6 +1064,12 @@ public:
     AddTestCase (new b4 (), TestCase::QUICK);
     AddTestCase (new b5 (), TestCase::QUICK);
     AddTestCase (new b6 (), TestCase::QUICK);
+    AddTestCase (new InterestReturn (), TestCase::QUICK);
+    AddTestCase (new InterestReturnOtherUpstreamPending (), TestCase::QUICK);
+    AddTestCase (new RemoveEntry (), TestCase::QUICK);
+    AddTestCase (new InterestSatisfied (), TestCase::QUICK);
+    AddTestCase (new InterestSatisfiedPerUpstream (), TestCase::QUICK);
+    AddTestCase (new InterestTimedOut (), TestCase::QUICK);
 
   }
 } g_TestSuiteCCNxStandardPit;
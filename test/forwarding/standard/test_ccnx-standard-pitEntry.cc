@@ -233,6 +233,59 @@ BeginTest (ReceiveInterest_SecondSameConnection)
 }
 EndTest ()
 
+/*
+ * The send time is kept per upstream connection
+ */
+BeginTest (OutRecords)
+{
+  Ptr<CCNxStandardPitEntry> entry = Create<CCNxStandardPitEntry>();
+  TestData data = CreateTestData();
+  Ptr<CCNxConnection> upstream1 = Create<CCNxVirtualConnection>();
+  Ptr<CCNxConnection> upstream2 = Create<CCNxVirtualConnection>();
+
+  entry->ReceiveInterest(data.interest_Ingress1_Expiry1.interest,
+			  data.interest_Ingress1_Expiry1.ingress,
+			  Simulator::Now() + Seconds(10));
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecordTime(upstream1).IsStrictlyNegative(), true, "Not sent on upstream1 yet");
+
+  Ptr<const CCNxName> prefix = Create<CCNxName>("ccnx:/name=prefix");
+  Time firstSend = Simulator::Now();
+  entry->AddOutRecord(upstream1, prefix);
+
+  Simulator::Stop(MilliSeconds(5));
+  Simulator::Run();
+  entry->AddOutRecord(upstream2, prefix);
+
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecordTime(upstream1), firstSend, "Wrong send time on upstream1");
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecordTime(upstream2), Simulator::Now(), "Wrong send time on upstream2");
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecords().size(), 2, "Wrong number of out records");
+
+  // a retransmission restarts the clock of that upstream only
+  Simulator::Stop(MilliSeconds(5));
+  Simulator::Run();
+  entry->AddOutRecord(upstream1, prefix);
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecordTime(upstream1), Simulator::Now(), "Retransmission should restart the send time");
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecordTime(upstream2), Simulator::Now() - MilliSeconds(5), "Other upstream should keep its send time");
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecords().begin()->second.prefix, prefix, "Out record should keep the FIB prefix");
+
+  entry->ClearOutRecords();
+  NS_TEST_EXPECT_MSG_EQ(entry->GetOutRecords().size(), 0, "Cleared entry should have no out records");
+
+  // an expired entry forgets them when it is reused
+  Ptr<CCNxStandardPitEntry> expiring = Create<CCNxStandardPitEntry>();
+  expiring->ReceiveInterest(data.interest_Ingress1_Expiry1.interest,
+			     data.interest_Ingress1_Expiry1.ingress,
+			     Simulator::Now() + MilliSeconds(1));
+  expiring->AddOutRecord(upstream1, prefix);
+  Simulator::Stop(MilliSeconds(2));
+  Simulator::Run();
+  expiring->ReceiveInterest(data.interest_Ingress1_Expiry1.interest,
+			     data.interest_Ingress1_Expiry1.ingress,
+			     Simulator::Now() + Seconds(10));
+  NS_TEST_EXPECT_MSG_EQ(expiring->GetOutRecords().size(), 0, "Expired entry should forget its out records");
+}
+EndTest ()
+
 /*
  * An expired PIT entry should return an empty set
  */
@@ -375,6 +428,7 @@ public:
     AddTestCase (new ReceiveInterest_FirstInterest (), TestCase::QUICK);
     AddTestCase (new ReceiveInterest_SecondDifferentConnection (), TestCase::QUICK);
     AddTestCase (new ReceiveInterest_SecondSameConnection (), TestCase::QUICK);
+    AddTestCase (new OutRecords (), TestCase::QUICK);
     AddTestCase (new SatisfyInterest_Expired (), TestCase::QUICK);
     AddTestCase (new SatisfyInterest_TwoPaths (), TestCase::QUICK);
     AddTestCase (new SatisfyInterest_OnePathOneIngress (), TestCase::QUICK);
@@ -194,6 +194,26 @@ BeginTest (Equals)
 }
 EndTest ()
 
+BeginTest (EqualsVirtualPayload)
+{
+  printf ("TestCCNxContentObjectEqualsVirtualPayload DoRun\n");
+
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo");
+  Ptr<CCNxContentObject> a = Create<CCNxContentObject> (name, (size_t) 1000);
+  Ptr<CCNxContentObject> b = Create<CCNxContentObject> (name, (size_t) 1000);
+  Ptr<CCNxContentObject> x = Create<CCNxContentObject> (name, (size_t) 1001);
+  Ptr<CCNxContentObject> y = Create<CCNxContentObject> (name, Create<CCNxBuffer> (5, "apple"));
+  Ptr<CCNxContentObject> z = Create<CCNxContentObject> (name, (size_t) 1000, CCNxContentObjectPayloadType_Data,
+                                                        Create<CCNxTime> (3600));
+
+  NS_TEST_EXPECT_MSG_EQ (a->Equals (b), true, "not equal");
+  NS_TEST_EXPECT_MSG_EQ (a->Equals (x), false, "different virtual lengths");
+  NS_TEST_EXPECT_MSG_EQ (a->Equals (y), false, "virtual and physical payloads");
+  NS_TEST_EXPECT_MSG_EQ (y->Equals (a), false, "physical and virtual payloads");
+  NS_TEST_EXPECT_MSG_EQ (a->Equals (z), false, "expiry time only on one side");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -213,6 +233,7 @@ public:
     AddTestCase (new GetExpiryTime (), TestCase::QUICK);
     AddTestCase (new GetMessageType (), TestCase::QUICK);
     AddTestCase (new Equals (), TestCase::QUICK);
+    AddTestCase (new EqualsVirtualPayload (), TestCase::QUICK);
   }
 } g_TestSuiteContentObject;
 
@@ -126,6 +126,25 @@ BeginTest (TestSetHopLimit)
 }
 EndTest ()
 
+BeginTest (TestSetPacketType)
+{
+  CCNxFixedHeader fh (g_header);
+  fh.SetPacketType (CCNxFixedHeaderType_InterestReturn);
+  CCNxFixedHeaderType test = fh.GetPacketType ();
+  NS_TEST_EXPECT_MSG_EQ (test, CCNxFixedHeaderType_InterestReturn, "Wrong value");
+}
+EndTest ()
+
+BeginTest (TestSetReturnCode)
+{
+  uint8_t returnCode = CCNxInterestReturnCode_Congestion;
+  CCNxFixedHeader fh (g_header);
+  fh.SetReturnCode (returnCode);
+  uint8_t test = fh.GetReturnCode ();
+  NS_TEST_EXPECT_MSG_EQ (returnCode, test, "Wrong value");
+}
+EndTest ()
+
 BeginTest (TestSetPacketLength)
 {
   uint16_t packetLength = g_packetLength + 3;
@@ -192,6 +211,8 @@ public:
     AddTestCase (new TestGetHeaderLength (), TestCase::QUICK);
 
     AddTestCase (new TestSetHopLimit (), TestCase::QUICK);
+    AddTestCase (new TestSetPacketType (), TestCase::QUICK);
+    AddTestCase (new TestSetReturnCode (), TestCase::QUICK);
     AddTestCase (new TestSetPacketLength (), TestCase::QUICK);
     AddTestCase (new TestSetHeaderLength (), TestCase::QUICK);
 
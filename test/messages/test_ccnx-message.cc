@@ -53,6 +53,8 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <sstream>
+
 #include "ns3/test.h"
 #include "ns3/ccnx-message.h"
 #include "ns3/ccnx-contentobject.h"
@@ -170,6 +172,30 @@ BeginTest (PrintMessage)
 }
 EndTest ()
 
+BeginTest (VirtualPayload)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo");
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, (size_t) 4000);
+  NS_TEST_EXPECT_MSG_EQ (content->GetPayloadSize (), 4000, "Got wrong virtual payload size");
+  NS_TEST_EXPECT_MSG_EQ (content->HasPayload (), true, "Virtual payload should count as a payload");
+  NS_TEST_EXPECT_MSG_EQ (content->HasVirtualPayload (), true, "Should have a virtual payload");
+  bool nullPayload = !content->GetPayload ();
+  NS_TEST_EXPECT_MSG_EQ (nullPayload, true, "Virtual payload should not have a buffer");
+
+  Ptr<CCNxBuffer> payload = Create<CCNxBuffer> (5, "apple");
+  Ptr<CCNxContentObject> physical = Create<CCNxContentObject> (name, payload);
+  NS_TEST_EXPECT_MSG_EQ (physical->HasVirtualPayload (), false, "Physical payload is not virtual");
+
+  Ptr<CCNxContentObject> none = Create<CCNxContentObject> (name);
+  NS_TEST_EXPECT_MSG_EQ (none->HasVirtualPayload (), false, "No payload is not virtual");
+
+  std::ostringstream printed;
+  printed << *content;
+  bool markedVirtual = printed.str ().find ("(virtual)") != std::string::npos;
+  NS_TEST_EXPECT_MSG_EQ (markedVirtual, true, "Printed content object should mark the payload virtual");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -187,6 +213,7 @@ public:
     AddTestCase (new GetPayload (), TestCase::QUICK);
     AddTestCase (new HasPayload (), TestCase::QUICK);
     AddTestCase (new PrintMessage (), TestCase::QUICK);
+    AddTestCase (new VirtualPayload (), TestCase::QUICK);
   }
 } g_TestCCNxMessage;
 
@@ -170,6 +170,31 @@ BeginTest (LessThan)
 }
 EndTest ()
 
+BeginTest (Hash)
+{
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/NAME=foo/VER=bar");
+  Ptr<const CCNxName> b = Create<CCNxName> ("ccnx:/NAME=foo/VER=bar");
+  Ptr<const CCNxName> c = Create<CCNxName> ("ccnx:/NAME=foo/NAME=bar");
+  Ptr<const CCNxName> d = Create<CCNxName> (*a);
+
+  bool equalHash = a->GetHash () == b->GetHash ();
+  NS_TEST_EXPECT_MSG_EQ (equalHash, true, "Equal names should have equal hashes");
+
+  bool copyHash = a->GetHash () == d->GetHash ();
+  NS_TEST_EXPECT_MSG_EQ (copyHash, true, "A copy should have the same hash");
+
+  bool typeHash = a->GetHash () == c->GetHash ();
+  NS_TEST_EXPECT_MSG_EQ (typeHash, false, "Segment types should be part of the hash");
+
+  CCNxName::hashPtrCCNxName hasher;
+  CCNxName::isEqualPtrCCNxName equals;
+  bool hashTest = hasher (a) == a->GetHash ();
+  NS_TEST_EXPECT_MSG_EQ (hashTest, true, "hashPtrCCNxName should use GetHash");
+  NS_TEST_EXPECT_MSG_EQ (equals (a, b), true, "isEqualPtrCCNxName should compare names");
+  NS_TEST_EXPECT_MSG_EQ (equals (a, c), false, "isEqualPtrCCNxName should compare names");
+}
+EndTest ()
+
 BeginTest (PrintName)
 {
   std::string s ("ccnx:/NAME=foor/VER=bar");
@@ -194,6 +219,7 @@ public:
     AddTestCase (new Parse_1 (), TestCase::QUICK);
     AddTestCase (new IsPrefixOf (), TestCase::QUICK);
     AddTestCase (new LessThan (), TestCase::QUICK);
+    AddTestCase (new Hash (), TestCase::QUICK);
     AddTestCase (new PrintName (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxName;
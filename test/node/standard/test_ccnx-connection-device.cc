@@ -56,6 +56,8 @@
 #include "ns3/test.h"
 #include "ns3/ccnx-connection-device.h"
 #include "ns3/virtual-net-device.h"
+#include "ns3/ccnx-droptail-queue.h"
+#include "ns3/simulator.h"
 
 #include "../../TestMacros.h"
 
@@ -157,6 +159,49 @@ BeginTest (Send)
 }
 EndTest ()
 
+BeginTest (SendQueued)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo/name=bar");
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
+
+  Ptr<CCNxConnectionDevice> conn = Create<CCNxConnectionDevice> ();
+
+  Ptr<VirtualNetDevice> tap = CreateObject<VirtualNetDevice> ();
+  tap->SetSendCallback (MakeCallback (&SendCallback));
+  conn->SetOutputDevice (tap);
+  conn->SetNexthop (Mac48Address::Allocate ());
+  conn->SetProtocolNumber (0x0801);
+
+  // 8 kbps, so each packet holds the link for several milliseconds
+  Ptr<CCNxDropTailQueue> queue = CreateObject<CCNxDropTailQueue> ();
+  queue->SetAttribute ("LinkRate", DataRateValue (DataRate ("8kbps")));
+  conn->SetOutputQueue (queue);
+  bool truth = (conn->GetOutputQueue () == queue);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Output queue should be the same");
+
+  sendCount = 0;
+  for (int i = 0; i < 3; i++)
+    {
+      conn->Send (CCNxPacket::CreateFromMessage (interest), conn);
+    }
+
+  // The first packet goes out now, the others wait for the link
+  truth = (sendCount == 1 && queue->GetNPackets () == 2);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Only the first packet should be sent, sendCount " << sendCount);
+
+  Simulator::Run ();
+
+  truth = (sendCount == 3 && queue->IsEmpty ());
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "All packets should be sent, sendCount " << sendCount);
+
+  CCNxOutputQueue::Stats stats = queue->GetStats ();
+  truth = (stats.dequeued == 3 && stats.maxSojourn > MilliSeconds (1));
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Packets should have waited in the queue");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -172,6 +217,7 @@ public:
     AddTestCase (new GetSetNextHop (), TestCase::QUICK);
     AddTestCase (new GetSetOutputDevice (), TestCase::QUICK);
     AddTestCase (new Send (), TestCase::QUICK);
+    AddTestCase (new SendQueued (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxConnectionDevice;
 
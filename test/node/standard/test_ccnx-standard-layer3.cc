@@ -356,6 +356,76 @@ BeginTest (ReceiveFromLayer2)
 }
 EndTest ()
 
+BeginTest (NeighborTable)
+{
+  Ptr<Node> node = Create<Node> ();
+
+  CCNxStackHelper stack;
+  stack.Install (node);
+
+  Ptr<VirtualNetDevice> device = SetupTapDevice (node, 0, MakeCallback (&SendCallback));
+
+  Ptr<CCNxStandardLayer3> ccnx = DynamicCast<CCNxStandardLayer3> (node->GetObject<CCNxL3Protocol> ());
+  bool exists = (ccnx);
+  NS_TEST_EXPECT_MSG_EQ (exists, true, "Not a CCNxStandardLayer3");
+  ccnx->AddInterface (device);
+
+  // The interface adds its broadcast neighbor
+  NS_TEST_EXPECT_MSG_EQ (ccnx->GetNNeighbors (), 1, "Wrong neighbor count after AddInterface");
+
+  Ptr<CCNxName> prefixName = Create<CCNxName> ("ccnx:/name=foo/name=sink");
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (prefixName);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+  uint16_t protocol = ccnx->GetProtocolNumber ();
+  Address to = Mac48Address ("ff:ff:ff:ff:ff:ff");
+
+  Address from1 = Mac48Address ("11:00:00:00:11:11");
+  Address from2 = Mac48Address ("11:00:00:00:11:12");
+  ccnx->ReceiveFromLayer2 (device, packet->CreateNs3Packet (), protocol, from1, to, NetDevice::PACKET_BROADCAST);
+  ccnx->ReceiveFromLayer2 (device, packet->CreateNs3Packet (), protocol, from2, to, NetDevice::PACKET_BROADCAST);
+  ccnx->ReceiveFromLayer2 (device, packet->CreateNs3Packet (), protocol, from1, to, NetDevice::PACKET_BROADCAST);
+
+  // from1 is only learned once
+  CCNxStandardLayer3::NeighborTableStats stats = ccnx->GetNeighborTableStats ();
+  NS_TEST_EXPECT_MSG_EQ (stats.neighbors, 3, "Wrong neighbor count");
+  bool truth = stats.capacity >= stats.neighbors;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Capacity smaller than neighbor count");
+  truth = stats.probes >= stats.lookups - 1 && stats.lookups >= 3;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Lookup statistics not counted");
+  truth = stats.maxProbeLength >= 1 && stats.maxProbeLength <= stats.neighbors;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong max probe length " << stats.maxProbeLength);
+}
+EndTest ()
+
+BeginTest (GetNeighbor)
+{
+  Ptr<Node> node = Create<Node> ();
+
+  CCNxStackHelper stack;
+  stack.Install (node);
+
+  Ptr<VirtualNetDevice> device = SetupTapDevice (node, 0, MakeCallback (&SendCallback));
+
+  Ptr<CCNxStandardLayer3> ccnx = DynamicCast<CCNxStandardLayer3> (node->GetObject<CCNxL3Protocol> ());
+  ccnx->AddInterface (device);
+
+  Address nexthop = Mac48Address ("11:00:00:00:11:11");
+  Ptr<CCNxConnectionDevice> first = ccnx->GetNeighbor (nexthop, device);
+  NS_TEST_EXPECT_MSG_EQ (ccnx->GetNNeighbors (), 2, "GetNeighbor should add a missing neighbor");
+
+  Ptr<CCNxConnectionDevice> second = ccnx->GetNeighbor (nexthop, device);
+  NS_TEST_EXPECT_MSG_EQ (second->GetConnectionId (), first->GetConnectionId (), "GetNeighbor should return the existing connection");
+  NS_TEST_EXPECT_MSG_EQ (ccnx->GetNNeighbors (), 2, "GetNeighbor should not add an existing neighbor");
+  NS_TEST_EXPECT_MSG_EQ ((bool) ccnx->GetConnection (first->GetConnectionId ()), true, "Connection not in the connection table");
+
+  // A frame from the neighbor arrives on the same connection
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (Create<CCNxName> ("ccnx:/name=foo")));
+  ccnx->ReceiveFromLayer2 (device, packet->CreateNs3Packet (), ccnx->GetProtocolNumber (), nexthop,
+                           Mac48Address ("ff:ff:ff:ff:ff:ff"), NetDevice::PACKET_BROADCAST);
+  NS_TEST_EXPECT_MSG_EQ (ccnx->GetNNeighbors (), 2, "A received frame should not add a known neighbor");
+}
+EndTest ()
+
 
 /**
  * @ingroup ccnx-test
@@ -379,6 +449,8 @@ public:
     AddTestCase (new GetInterfaceNonexistent (), TestCase::QUICK);
     AddTestCase (new GetNInterfaces (), TestCase::QUICK);
     AddTestCase (new ReceiveFromLayer2 (), TestCase::QUICK);
+    AddTestCase (new NeighborTable (), TestCase::QUICK);
+    AddTestCase (new GetNeighbor (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxStandardLayer3;
 
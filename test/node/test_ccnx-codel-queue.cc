@@ -0,0 +1,155 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-codel-queue.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxCoDelQueue {
+
+static Ptr<CCNxPacket>
+CreatePacket (std::string uri)
+{
+  return CCNxPacket::CreateFromMessage (Create<CCNxInterest> (Create<CCNxName> (uri)));
+}
+
+static void
+DequeueOne (Ptr<CCNxCoDelQueue> queue)
+{
+  queue->Dequeue ();
+}
+
+/**
+ * Fill the queue at time 0 and drain it one packet every `spacing`.
+ */
+static void
+RunDrain (Ptr<CCNxCoDelQueue> queue, unsigned packets, Time spacing)
+{
+  for (unsigned i = 0; i < packets; i++)
+    {
+      queue->Enqueue (CreatePacket ("ccnx:/name=flow/chunk=1"));
+    }
+  for (unsigned i = 0; i < packets; i++)
+    {
+      Simulator::Schedule (Time (spacing.GetTimeStep () * i), &DequeueOne, queue);
+    }
+  Simulator::Run ();
+  Simulator::Destroy ();
+}
+
+BeginTest (NoDropBelowTarget)
+{
+  // One packet every 1 ms: the standing queue drains faster than Interval
+  Ptr<CCNxCoDelQueue> queue = CreateObject<CCNxCoDelQueue> ();
+  queue->SetAttribute ("Mtu", UintegerValue (0));
+  RunDrain (queue, 4, MilliSeconds (1));
+
+  CCNxOutputQueue::Stats stats = queue->GetStats ();
+  bool truth = (stats.aqmDrops == 0 && stats.dequeued == 4);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Should not drop below target, drops " << stats.aqmDrops);
+}
+EndTest ()
+
+BeginTest (DropStandingQueue)
+{
+  // One packet every 10 ms: the sojourn time stays above 5 ms for more than 100 ms
+  Ptr<CCNxCoDelQueue> queue = CreateObject<CCNxCoDelQueue> ();
+  queue->SetAttribute ("Mtu", UintegerValue (0));
+  RunDrain (queue, 100, MilliSeconds (10));
+
+  CCNxOutputQueue::Stats stats = queue->GetStats ();
+  bool truth = (stats.aqmDrops > 0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "CoDel should drop from a standing queue");
+  truth = (stats.aqmDrops + stats.dequeued == 100 && queue->IsEmpty ());
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Every packet should be dropped or dequeued");
+  truth = (queue->GetControlLawCount () >= 1);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Should have entered the dropping state");
+}
+EndTest ()
+
+BeginTest (NoDropUnderMtu)
+{
+  // Same standing queue, but it never holds more than one Mtu of bytes
+  Ptr<CCNxCoDelQueue> queue = CreateObject<CCNxCoDelQueue> ();
+  queue->SetAttribute ("Mtu", UintegerValue (100000));
+  RunDrain (queue, 100, MilliSeconds (10));
+
+  NS_TEST_EXPECT_MSG_EQ (queue->GetStats ().aqmDrops, 0, "Should not drop a queue under one Mtu");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxCoDelQueue
+ */
+static class TestSuiteCCNxCoDelQueue : public TestSuite
+{
+public:
+  TestSuiteCCNxCoDelQueue () : TestSuite ("ccnx-codel-queue", UNIT)
+  {
+    AddTestCase (new NoDropBelowTarget (), TestCase::QUICK);
+    AddTestCase (new DropStandingQueue (), TestCase::QUICK);
+    AddTestCase (new NoDropUnderMtu (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxCoDelQueue;
+
+} // namespace TestSuiteCCNxCoDelQueue
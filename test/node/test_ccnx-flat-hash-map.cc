@@ -0,0 +1,247 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <map>
+
+#include "ns3/test.h"
+#include "../TestMacros.h"
+#include "ns3/ccnx-flat-hash-map.h"
+#include "ns3/ccnx-name.h"
+#include "ns3/random-variable-stream.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxFlatHashMap {
+
+/**
+ * A bad hash that puts every key in the same probe run, so Erase() has to shift entries.
+ */
+struct CollidingHash
+{
+  uint32_t operator() (const uint32_t &key) const
+  {
+    return key % 4;
+  }
+};
+
+BeginTest (InsertFind)
+{
+  CCNxFlatHashMap<uint32_t, int> table;
+  bool truth = table.Empty () && table.Capacity () == 0;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "New table should be empty with no slots");
+
+  bool inserted = table.Insert (7, 70);
+  NS_TEST_EXPECT_MSG_EQ (inserted, true, "First insert should be new");
+  inserted = table.Insert (7, 71);
+  NS_TEST_EXPECT_MSG_EQ (inserted, false, "Second insert should replace");
+  NS_TEST_EXPECT_MSG_EQ (table.Size (), 1, "Wrong size");
+
+  int *found = table.Find (7);
+  truth = found && *found == 71;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong value");
+
+  truth = (table.Find (8) == 0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Should not find missing key");
+}
+EndTest ()
+
+BeginTest (Grow)
+{
+  CCNxFlatHashMap<uint32_t, uint32_t> table;
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      table.Insert (i, i * 3);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (table.Size (), 1000, "Wrong size");
+  bool truth = table.Capacity () * 3 >= table.Size () * 4;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Load factor above 3/4, capacity " << table.Capacity ());
+
+  bool allFound = true;
+  for (uint32_t i = 0; i < 1000; i++)
+    {
+      uint32_t *found = table.Find (i);
+      allFound = allFound && found && *found == i * 3;
+    }
+  NS_TEST_EXPECT_MSG_EQ (allFound, true, "Lost entries when growing");
+
+  size_t walked = 0;
+  for (size_t slot = 0; slot < table.Capacity (); slot++)
+    {
+      if (table.IsOccupied (slot))
+        {
+          NS_TEST_EXPECT_MSG_EQ (table.ValueAt (slot), table.KeyAt (slot) * 3, "Wrong value in slot walk");
+          walked++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (walked, 1000, "Slot walk did not visit every entry");
+}
+EndTest ()
+
+BeginTest (EraseCollisions)
+{
+  CCNxFlatHashMap<uint32_t, uint32_t, CollidingHash> table;
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      table.Insert (i, i);
+    }
+
+  bool erased = table.Erase (4);
+  NS_TEST_EXPECT_MSG_EQ (erased, true, "Should erase key 4");
+  erased = table.Erase (4);
+  NS_TEST_EXPECT_MSG_EQ (erased, false, "Key 4 already erased");
+  erased = table.Erase (1);
+  NS_TEST_EXPECT_MSG_EQ (erased, true, "Should erase key 1");
+
+  bool correct = true;
+  for (uint32_t i = 0; i < 10; i++)
+    {
+      bool expected = (i != 4 && i != 1);
+      correct = correct && ((table.Find (i) != 0) == expected);
+    }
+  NS_TEST_EXPECT_MSG_EQ (correct, true, "Erase broke a probe run");
+  NS_TEST_EXPECT_MSG_EQ (table.Size (), 8, "Wrong size");
+
+  table.Clear ();
+  bool truth = table.Empty () && table.Find (2) == 0;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Clear should remove everything");
+}
+EndTest ()
+
+BeginTest (CompareWithMap)
+{
+  // Random operations against std::map as the reference
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+
+  CCNxFlatHashMap<uint32_t, uint32_t> table;
+  std::map<uint32_t, uint32_t> reference;
+  bool correct = true;
+
+  for (uint32_t n = 0; n < 20000 && correct; n++)
+    {
+      uint32_t key = random->GetInteger (0, 500);
+      switch (random->GetInteger (0, 2))
+        {
+        case 0:
+          correct = table.Insert (key, n) == (reference.find (key) == reference.end ());
+          reference[key] = n;
+          break;
+
+        case 1:
+          correct = table.Erase (key) == (reference.erase (key) == 1);
+          break;
+
+        default:
+          {
+            uint32_t *found = table.Find (key);
+            std::map<uint32_t, uint32_t>::const_iterator i = reference.find (key);
+            correct = (found != 0) == (i != reference.end ()) && (!found || *found == i->second);
+          }
+          break;
+        }
+      correct = correct && table.Size () == reference.size ();
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (correct, true, "Table differs from std::map");
+  bool truth = table.GetProbeCount () >= table.GetLookupCount () / 2;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Probe statistics not counted");
+}
+EndTest ()
+
+BeginTest (NameKeys)
+{
+  // Different Ptr to equal names must find the same entry
+  typedef CCNxFlatHashMap<Ptr<const CCNxName>, uint32_t, CCNxName::hashPtrCCNxName, CCNxName::isEqualPtrCCNxName> NameMapType;
+  NameMapType table;
+
+  bool truth = table.Insert (Create<CCNxName> ("ccnx:/name=a/name=b"), 1);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "First insert should be new");
+  truth = table.Insert (Create<CCNxName> ("ccnx:/name=a/name=c"), 2);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Second insert should be new");
+  truth = table.Insert (Create<CCNxName> ("ccnx:/name=a/name=b"), 3);
+  NS_TEST_EXPECT_MSG_EQ (truth, false, "Equal name should replace");
+
+  uint32_t *found = table.Find (Create<CCNxName> ("ccnx:/name=a/name=b"));
+  truth = found != 0 && *found == 3;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Lookup by an equal name failed");
+  NS_TEST_EXPECT_MSG_EQ (table.Size (), 2, "Wrong size");
+
+  truth = table.Erase (Create<CCNxName> ("ccnx:/name=a/name=c"));
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Erase by an equal name failed");
+  NS_TEST_EXPECT_MSG_EQ (table.Size (), 1, "Wrong size");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxFlatHashMap
+ */
+static class TestSuiteCCNxFlatHashMap : public TestSuite
+{
+public:
+  TestSuiteCCNxFlatHashMap () : TestSuite ("ccnx-flat-hash-map", UNIT)
+  {
+    AddTestCase (new InsertFind (), TestCase::QUICK);
+    AddTestCase (new Grow (), TestCase::QUICK);
+    AddTestCase (new EraseCollisions (), TestCase::QUICK);
+    AddTestCase (new CompareWithMap (), TestCase::QUICK);
+    AddTestCase (new NameKeys (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxFlatHashMap;
+
+} // namespace TestSuiteCCNxFlatHashMap
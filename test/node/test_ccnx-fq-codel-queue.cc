@@ -0,0 +1,173 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/ccnx-fq-codel-queue.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxFqCoDelQueue {
+
+static Ptr<CCNxPacket>
+CreatePacket (std::string uri)
+{
+  return CCNxPacket::CreateFromMessage (Create<CCNxInterest> (Create<CCNxName> (uri)));
+}
+
+static std::string
+FirstSegment (Ptr<CCNxPacket> packet)
+{
+  return packet->GetMessage ()->GetName ()->GetSegment (0)->GetValue ();
+}
+
+BeginTest (FlowIndex)
+{
+  Ptr<CCNxFqCoDelQueue> queue = CreateObject<CCNxFqCoDelQueue> ();
+  queue->SetAttribute ("FlowPrefixSegments", UintegerValue (1));
+
+  uint32_t a1 = queue->GetFlowIndex (CreatePacket ("ccnx:/name=video/chunk=1"));
+  uint32_t a2 = queue->GetFlowIndex (CreatePacket ("ccnx:/name=video/chunk=2"));
+  uint32_t b = queue->GetFlowIndex (CreatePacket ("ccnx:/name=audio/chunk=1"));
+
+  NS_TEST_EXPECT_MSG_EQ (a1, a2, "Same prefix should be the same flow");
+  bool truth = (a1 != b);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Different prefixes should be different flows");
+  truth = (a1 < 1024 && b < 1024);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Flow index out of range");
+}
+EndTest ()
+
+BeginTest (RoundRobin)
+{
+  // A quantum of 1 byte makes each flow send one packet per round
+  Ptr<CCNxFqCoDelQueue> queue = CreateObject<CCNxFqCoDelQueue> ();
+  queue->SetAttribute ("FlowPrefixSegments", UintegerValue (1));
+  queue->SetAttribute ("Quantum", UintegerValue (1));
+
+  for (int i = 0; i < 4; i++)
+    {
+      queue->Enqueue (CreatePacket ("ccnx:/name=bulk/chunk=x"));
+    }
+  queue->Enqueue (CreatePacket ("ccnx:/name=small/chunk=x"));
+  NS_TEST_EXPECT_MSG_EQ (queue->GetNActiveFlows (), 2, "Should have two flows");
+
+  // The small flow does not wait behind the whole bulk backlog
+  std::string first = FirstSegment (queue->Dequeue ());
+  std::string second = FirstSegment (queue->Dequeue ());
+  bool truth = (first == "bulk" && second == "small");
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Flows should alternate, got " << first << " " << second);
+
+  unsigned remaining = 0;
+  while (queue->Dequeue ())
+    {
+      remaining++;
+    }
+  NS_TEST_EXPECT_MSG_EQ (remaining, 3, "Wrong number of remaining packets");
+  NS_TEST_EXPECT_MSG_EQ (queue->GetNActiveFlows (), 0, "Empty queue should have no active flows");
+}
+EndTest ()
+
+BeginTest (DropFromLongestFlow)
+{
+  Ptr<CCNxFqCoDelQueue> queue = CreateObject<CCNxFqCoDelQueue> ();
+  queue->SetAttribute ("FlowPrefixSegments", UintegerValue (1));
+  queue->SetAttribute ("MaxPackets", UintegerValue (4));
+
+  for (int i = 0; i < 3; i++)
+    {
+      queue->Enqueue (CreatePacket ("ccnx:/name=bulk/chunk=x"));
+    }
+  queue->Enqueue (CreatePacket ("ccnx:/name=small/chunk=x"));
+
+  // Over the limit: the arriving small packet is kept and bulk loses its head
+  bool queued = queue->Enqueue (CreatePacket ("ccnx:/name=small/chunk=y"));
+  NS_TEST_EXPECT_MSG_EQ (queued, true, "Arriving packet should be queued");
+  bool truth = (queue->GetNPackets () == 4 && queue->GetStats ().overflowDrops == 1);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "One packet should have been dropped");
+
+  unsigned small = 0;
+  Ptr<CCNxPacket> packet;
+  while ((packet = queue->Dequeue ()))
+    {
+      if (FirstSegment (packet) == "small")
+        {
+          small++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (small, 2, "Both small packets should survive");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxFqCoDelQueue
+ */
+static class TestSuiteCCNxFqCoDelQueue : public TestSuite
+{
+public:
+  TestSuiteCCNxFqCoDelQueue () : TestSuite ("ccnx-fq-codel-queue", UNIT)
+  {
+    AddTestCase (new FlowIndex (), TestCase::QUICK);
+    AddTestCase (new RoundRobin (), TestCase::QUICK);
+    AddTestCase (new DropFromLongestFlow (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxFqCoDelQueue;
+
+} // namespace TestSuiteCCNxFqCoDelQueue
@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <vector>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/uinteger.h"
+#include "ns3/double.h"
+#include "ns3/ccnx-interest-shaper.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxInterestShaper {
+
+static std::vector<Time> _sendTimes;
+
+static bool
+SendCallback (Ptr<CCNxPacket> interest)
+{
+  _sendTimes.push_back (Simulator::Now ());
+  return true;
+}
+
+static Ptr<CCNxPacket>
+CreateInterest ()
+{
+  return CCNxPacket::CreateFromMessage (Create<CCNxInterest> (Create<CCNxName> ("ccnx:/name=foo/chunk=1")));
+}
+
+/**
+ * A shaper allowing 1 Interest per second: 1500 byte Content Objects on a 12 kbps link.
+ */
+static Ptr<CCNxInterestShaper>
+CreateShaper (uint32_t maxQueue)
+{
+  Ptr<CCNxInterestShaper> shaper = CreateObject<CCNxInterestShaper> ();
+  shaper->SetAttribute ("LinkRate", DataRateValue (DataRate ("12kbps")));
+  shaper->SetAttribute ("ExpectedDataSize", UintegerValue (1500));
+  shaper->SetAttribute ("BurstSize", DoubleValue (1.0));
+  shaper->SetAttribute ("MaxQueue", UintegerValue (maxQueue));
+  shaper->SetSendCallback (MakeCallback (&SendCallback));
+  return shaper;
+}
+
+BeginTest (NoRate)
+{
+  _sendTimes.clear ();
+  Ptr<CCNxInterestShaper> shaper = CreateObject<CCNxInterestShaper> ();
+  shaper->SetSendCallback (MakeCallback (&SendCallback));
+
+  // Without a link rate every Interest goes straight through
+  for (int i = 0; i < 10; i++)
+    {
+      shaper->Enqueue (CreateInterest ());
+    }
+  bool truth = (_sendTimes.size () == 10 && shaper->GetNQueued () == 0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Unshaped Interests should be sent");
+}
+EndTest ()
+
+BeginTest (RateLimit)
+{
+  _sendTimes.clear ();
+  Ptr<CCNxInterestShaper> shaper = CreateShaper (100);
+  bool truth = (shaper->GetInterestRate () == 1.0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Rate should be 1 Interest/s, got " << shaper->GetInterestRate ());
+
+  for (int i = 0; i < 4; i++)
+    {
+      shaper->Enqueue (CreateInterest ());
+    }
+  truth = (_sendTimes.size () == 1 && shaper->GetNQueued () == 3);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Only the burst should be sent at once");
+
+  Simulator::Run ();
+
+  truth = (_sendTimes.size () == 4);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "All Interests should be sent");
+  bool spaced = true;
+  for (size_t i = 0; i < _sendTimes.size (); i++)
+    {
+      Time error = _sendTimes[i] - Seconds (i);
+      spaced = spaced && error >= Time (0) && error < MicroSeconds (1);
+    }
+  NS_TEST_EXPECT_MSG_EQ (spaced, true, "Interests should be 1 second apart");
+
+  CCNxInterestShaper::Stats stats = shaper->GetStats ();
+  truth = (stats.sent == 4 && stats.delayed == 3 && stats.dropped == 0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong statistics");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (QueueFull)
+{
+  _sendTimes.clear ();
+  Ptr<CCNxInterestShaper> shaper = CreateShaper (2);
+
+  bool accepted = true;
+  for (int i = 0; i < 3; i++)
+    {
+      accepted = accepted && shaper->Enqueue (CreateInterest ());
+    }
+  NS_TEST_EXPECT_MSG_EQ (accepted, true, "Burst plus queue should be accepted");
+
+  accepted = shaper->Enqueue (CreateInterest ());
+  NS_TEST_EXPECT_MSG_EQ (accepted, false, "Full queue should refuse the Interest");
+  NS_TEST_EXPECT_MSG_EQ (shaper->GetStats ().dropped, 1, "Wrong drop count");
+
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (_sendTimes.size (), 3, "Queued Interests should be sent");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (ObserveData)
+{
+  Ptr<CCNxInterestShaper> shaper = CreateShaper (100);
+  shaper->SetAttribute ("DataSizeGain", DoubleValue (0.5));
+
+  // The first Content Object replaces the initial guess, then the average moves by half
+  shaper->ObserveData (500);
+  bool truth = (shaper->GetExpectedDataSize () == 500.0 && shaper->GetInterestRate () == 3.0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Expected size should be 500, got " << shaper->GetExpectedDataSize ());
+
+  shaper->ObserveData (1500);
+  truth = (shaper->GetExpectedDataSize () == 1000.0);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Expected size should be 1000, got " << shaper->GetExpectedDataSize ());
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxInterestShaper
+ */
+static class TestSuiteCCNxInterestShaper : public TestSuite
+{
+public:
+  TestSuiteCCNxInterestShaper () : TestSuite ("ccnx-interest-shaper", UNIT)
+  {
+    AddTestCase (new NoRate (), TestCase::QUICK);
+    AddTestCase (new RateLimit (), TestCase::QUICK);
+    AddTestCase (new QueueFull (), TestCase::QUICK);
+    AddTestCase (new ObserveData (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxInterestShaper;
+
+} // namespace TestSuiteCCNxInterestShaper
@@ -0,0 +1,226 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <vector>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "ns3/ccnx-output-queue.h"
+
+#include "../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxOutputQueue {
+
+/**
+ * A LIFO queue of at most 2 packets that drops every packet it dequeues with
+ * DROP_AQM when `m_dropNext` is set.  Enough to exercise the base class.
+ */
+class MockQueue : public CCNxOutputQueue
+{
+public:
+  MockQueue () : m_dropNext (false)
+  {
+  }
+
+  bool m_dropNext;
+
+protected:
+  virtual bool DoEnqueue (const ItemType &item)
+  {
+    if (m_items.size () >= 2)
+      {
+        return false;
+      }
+    m_items.push_back (item);
+    return true;
+  }
+
+  virtual bool DoDequeue (ItemType &item)
+  {
+    while (!m_items.empty ())
+      {
+        item = m_items.back ();
+        m_items.pop_back ();
+        if (!m_dropNext)
+          {
+            return true;
+          }
+        DropItem (item, DROP_AQM);
+      }
+    return false;
+  }
+
+private:
+  std::vector<ItemType> m_items;
+};
+
+static Ptr<CCNxPacket>
+CreatePacket (std::string uri)
+{
+  return CCNxPacket::CreateFromMessage (Create<CCNxInterest> (Create<CCNxName> (uri)));
+}
+
+static unsigned _overflowDrops;
+static unsigned _aqmDrops;
+static unsigned _dequeues;
+
+static void
+DropCallback (Ptr<const CCNxPacket> packet, CCNxOutputQueue::DropReason reason)
+{
+  if (reason == CCNxOutputQueue::DROP_AQM)
+    {
+      _aqmDrops++;
+    }
+  else
+    {
+      _overflowDrops++;
+    }
+}
+
+static void
+DequeueCallback (Ptr<const CCNxPacket> packet, Time sojourn)
+{
+  _dequeues++;
+}
+
+BeginTest (Counts)
+{
+  Ptr<MockQueue> queue = CreateObject<MockQueue> ();
+  bool truth = queue->IsEmpty () && queue->GetNPackets () == 0 && queue->GetNBytes () == 0;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "New queue should be empty");
+
+  Ptr<CCNxPacket> packet = CreatePacket ("ccnx:/name=a");
+  uint32_t bytes = packet->GetNs3Packet ()->GetSize ();
+  queue->Enqueue (packet);
+  queue->Enqueue (CreatePacket ("ccnx:/name=b"));
+
+  truth = queue->GetNPackets () == 2 && queue->GetNBytes () == 2 * bytes;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong counts after Enqueue");
+
+  bool queued = queue->Enqueue (CreatePacket ("ccnx:/name=c"));
+  NS_TEST_EXPECT_MSG_EQ (queued, false, "Full queue should drop");
+  truth = queue->GetNPackets () == 2 && queue->GetNBytes () == 2 * bytes;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Dropped packet should not be counted");
+
+  Ptr<CCNxPacket> out = queue->Dequeue ();
+  truth = out && queue->GetNPackets () == 1 && queue->GetNBytes () == bytes;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong counts after Dequeue");
+
+  CCNxOutputQueue::Stats stats = queue->GetStats ();
+  truth = stats.enqueued == 2 && stats.dequeued == 1 && stats.overflowDrops == 1 && stats.aqmDrops == 0;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong statistics");
+}
+EndTest ()
+
+BeginTest (Callbacks)
+{
+  _overflowDrops = 0;
+  _aqmDrops = 0;
+  _dequeues = 0;
+
+  Ptr<MockQueue> queue = CreateObject<MockQueue> ();
+  queue->SetDropCallback (MakeCallback (&DropCallback));
+  queue->SetDequeueCallback (MakeCallback (&DequeueCallback));
+
+  queue->Enqueue (CreatePacket ("ccnx:/name=a"));
+  queue->Enqueue (CreatePacket ("ccnx:/name=b"));
+  queue->Enqueue (CreatePacket ("ccnx:/name=c"));
+  queue->Dequeue ();
+
+  queue->m_dropNext = true;
+  Ptr<CCNxPacket> out = queue->Dequeue ();
+  bool truth = !out && queue->IsEmpty ();
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "AQM should have dropped the last packet");
+
+  truth = _overflowDrops == 1 && _aqmDrops == 1 && _dequeues == 1;
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong callbacks " << _overflowDrops << " " << _aqmDrops << " " << _dequeues);
+  NS_TEST_EXPECT_MSG_EQ (queue->GetStats ().aqmDrops, 1, "Wrong AQM drop count");
+}
+EndTest ()
+
+BeginTest (Sojourn)
+{
+  Ptr<MockQueue> queue = CreateObject<MockQueue> ();
+  queue->Enqueue (CreatePacket ("ccnx:/name=a"));
+  Simulator::Schedule (MilliSeconds (20), &CCNxOutputQueue::Dequeue, queue);
+  Simulator::Run ();
+
+  CCNxOutputQueue::Stats stats = queue->GetStats ();
+  bool truth = stats.maxSojourn == MilliSeconds (20) && stats.totalSojourn == MilliSeconds (20);
+  NS_TEST_EXPECT_MSG_EQ (truth, true, "Wrong sojourn time " << stats.maxSojourn);
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxOutputQueue
+ */
+static class TestSuiteCCNxOutputQueue : public TestSuite
+{
+public:
+  TestSuiteCCNxOutputQueue () : TestSuite ("ccnx-output-queue", UNIT)
+  {
+    AddTestCase (new Counts (), TestCase::QUICK);
+    AddTestCase (new Callbacks (), TestCase::QUICK);
+    AddTestCase (new Sojourn (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxOutputQueue;
+
+} // namespace TestSuiteCCNxOutputQueue
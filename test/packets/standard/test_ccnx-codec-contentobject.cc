@@ -288,6 +288,49 @@ BeginTest (TestDeserialize_PayloadType)
 
 }
 EndTest ()
+
+BeginTest (TestVirtualPayload)
+{
+  printf ("TestVirtualPayload DoRun\n");
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=apple/ver=pie/chunk=crust");
+  Ptr<CCNxTime> expiryTime  = Create<CCNxTime> (3600);
+  size_t virtualLength = 1200;
+
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, virtualLength, CCNxContentObjectPayloadType_Data, expiryTime);
+  CCNxCodecContentObject ci;
+  ci.SetHeader (content);
+
+  // The header ends with the payload TL, the virtual bytes follow it
+  size_t expectedSize = 4 + 29 + 4 + 8 + 4;
+  NS_TEST_EXPECT_MSG_EQ (ci.GetSerializedSize (), expectedSize, "wrong header size");
+  NS_TEST_EXPECT_MSG_EQ (ci.GetVirtualPayloadSize (), virtualLength, "wrong virtual size");
+
+  // A zero-filled buffer with the header in front, like CCNxPacket builds it
+  Buffer buffer (virtualLength);
+  buffer.AddAtStart (ci.GetSerializedSize ());
+  ci.Serialize (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (buffer.GetSize (), expectedSize + virtualLength, "wrong buffer size");
+
+  Buffer::Iterator i = buffer.Begin ();
+  NS_TEST_EXPECT_MSG_EQ (i.ReadNtohU16 (), CCNxSchemaV1::T_OBJECT, "wrong type");
+  NS_TEST_EXPECT_MSG_EQ (i.ReadNtohU16 (), expectedSize + virtualLength - 4, "T_OBJECT length should include the virtual bytes");
+
+  CCNxCodecContentObject citest;
+  citest.SetDeserializeVirtualPayload (true);
+  uint32_t bytes = citest.Deserialize (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (bytes, expectedSize, "virtual bytes should not be consumed");
+
+  Ptr<CCNxContentObject> test = citest.GetHeader ();
+  NS_TEST_EXPECT_MSG_EQ (test->HasVirtualPayload (), true, "should decode a virtual payload");
+  NS_TEST_EXPECT_MSG_EQ (content->Equals (test), true, "decoded object wrong");
+
+  // Without the virtual flag the zero bytes are read as a physical payload
+  CCNxCodecContentObject physical;
+  bytes = physical.Deserialize (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (bytes, expectedSize + virtualLength, "physical payload should be consumed");
+  NS_TEST_EXPECT_MSG_EQ (physical.GetHeader ()->GetPayloadSize (), virtualLength, "wrong physical payload size");
+}
+EndTest ()
 }
 
 // =================================
@@ -310,6 +353,7 @@ public:
     AddTestCase (new TestCCNxCodecContentObject::TestDeserializeWithNonDataPayloadType (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestSerialize_PayloadType (), TestCase::QUICK);
     AddTestCase (new TestCCNxCodecContentObject::TestDeserialize_PayloadType (), TestCase::QUICK);
+    AddTestCase (new TestCCNxCodecContentObject::TestVirtualPayload (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxCodecContentObject;
 
@@ -55,6 +55,9 @@
 
 #include "ns3/test.h"
 #include "ns3/ccnx-packet.h"
+#include "ns3/ccnx-interest.h"
+#include "ns3/ccnx-contentobject.h"
+#include "ns3/ccnx-virtual-payload-tag.h"
 
 #include "../TestMacros.h"
 
@@ -68,6 +71,93 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+BeginTest (GetNs3Packet)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo/name=bar");
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+
+  Ptr<const Packet> a = packet->GetNs3Packet ();
+  Ptr<const Packet> b = packet->GetNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (a, b, "GetNs3Packet should return the cached packet");
+
+  Ptr<Packet> c = packet->CreateNs3Packet ();
+  bool different = (PeekPointer (c) != PeekPointer (a));
+  NS_TEST_EXPECT_MSG_EQ (different, true, "CreateNs3Packet should return a copy");
+  NS_TEST_EXPECT_MSG_EQ (c->GetSize (), a->GetSize (), "Copy should be the same size");
+  NS_TEST_EXPECT_MSG_EQ (a->GetSize (), packet->GetFixedHeader ()->GetPacketLength (), "Wrong packet length");
+}
+EndTest ()
+
+BeginTest (CreateInterestReturn)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo/name=bar");
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (name);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (interest);
+  packet->GetFixedHeader ()->SetHopLimit (7);
+
+  Ptr<CCNxPacket> nack = CCNxPacket::CreateInterestReturn (packet, CCNxInterestReturnCode_NoRoute);
+  NS_TEST_EXPECT_MSG_EQ (nack->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_InterestReturn, "Wrong packet type");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) nack->GetFixedHeader ()->GetReturnCode (), CCNxInterestReturnCode_NoRoute, "Wrong return code");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) nack->GetFixedHeader ()->GetHopLimit (), 7, "Wrong hop limit");
+  NS_TEST_EXPECT_MSG_EQ (nack->GetMessage (), packet->GetMessage (), "Should carry the Interest message");
+  NS_TEST_EXPECT_MSG_EQ (packet->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_Interest, "Original packet changed");
+
+  // The type and return code must survive serialization
+  Ptr<CCNxPacket> decoded = CCNxPacket::CreateFromNs3Packet (nack->GetNs3Packet ());
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetFixedHeader ()->GetPacketType (), CCNxFixedHeaderType_InterestReturn, "Wrong decoded packet type");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) decoded->GetFixedHeader ()->GetReturnCode (), CCNxInterestReturnCode_NoRoute, "Wrong decoded return code");
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetMessage ()->GetMessageType (), CCNxMessage::Interest, "Wrong decoded message type");
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetMessage ()->GetName ()->Equals (*name), true, "Wrong decoded name");
+}
+EndTest ()
+
+BeginTest (DecrementHopLimit)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo/name=bar");
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (Create<CCNxInterest> (name));
+  packet->GetFixedHeader ()->SetHopLimit (2);
+
+  // Someone else (e.g. a trace sink) still holds the serialized packet
+  Ptr<const Packet> held = packet->GetNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (packet->DecrementHopLimit (), true, "Decrement should succeed");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) packet->GetFixedHeader ()->GetHopLimit (), 1, "Wrong hop limit");
+
+  Ptr<CCNxPacket> heldDecoded = CCNxPacket::CreateFromNs3Packet (held);
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) heldDecoded->GetFixedHeader ()->GetHopLimit (), 2, "Held packet should not change");
+
+  Ptr<CCNxPacket> patchedDecoded = CCNxPacket::CreateFromNs3Packet (packet->GetNs3Packet ());
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) patchedDecoded->GetFixedHeader ()->GetHopLimit (), 1, "Patched packet should have the new hop limit");
+  NS_TEST_EXPECT_MSG_EQ (patchedDecoded->GetMessage ()->GetName ()->Equals (*name), true, "Wrong decoded name");
+
+  NS_TEST_EXPECT_MSG_EQ (packet->DecrementHopLimit (), true, "Decrement should succeed");
+  NS_TEST_EXPECT_MSG_EQ (packet->DecrementHopLimit (), false, "Decrement of 0 should fail");
+  NS_TEST_EXPECT_MSG_EQ ((uint32_t) packet->GetFixedHeader ()->GetHopLimit (), 0, "Hop limit should stay at 0");
+}
+EndTest ()
+
+BeginTest (VirtualPayload)
+{
+  Ptr<CCNxName> name = Create<CCNxName> ("ccnx:/name=foo/chunk=1");
+  Ptr<CCNxContentObject> content = Create<CCNxContentObject> (name, (size_t) 1400);
+  Ptr<CCNxPacket> packet = CCNxPacket::CreateFromMessage (content);
+
+  Ptr<const Packet> ns3Packet = packet->GetNs3Packet ();
+  NS_TEST_EXPECT_MSG_EQ (ns3Packet->GetSize (), packet->GetFixedHeader ()->GetPacketLength (), "Wrong packet length");
+  bool includesPayload = ns3Packet->GetSize () > 1400;
+  NS_TEST_EXPECT_MSG_EQ (includesPayload, true, "Packet size should include the virtual payload");
+
+  CCNxVirtualPayloadTag tag;
+  NS_TEST_EXPECT_MSG_EQ (ns3Packet->PeekPacketTag (tag), true, "Missing virtual payload tag");
+
+  Ptr<CCNxPacket> decoded = CCNxPacket::CreateFromNs3Packet (ns3Packet);
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetMessage ()->HasVirtualPayload (), true, "Decoded payload should be virtual");
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetMessage ()->GetPayloadSize (), 1400, "Wrong decoded payload size");
+  NS_TEST_EXPECT_MSG_EQ (decoded->GetFixedHeader ()->GetPacketLength (), packet->GetFixedHeader ()->GetPacketLength (),
+                         "Wrong decoded packet length");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +169,10 @@ public:
   TestSuiteCCNxPacket () : TestSuite ("ccnx-packet", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new GetNs3Packet (), TestCase::QUICK);
+    AddTestCase (new CreateInterestReturn (), TestCase::QUICK);
+    AddTestCase (new DecrementHopLimit (), TestCase::QUICK);
+    AddTestCase (new VirtualPayload (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxPacket;
 
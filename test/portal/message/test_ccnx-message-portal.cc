@@ -53,9 +53,13 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <sstream>
+
 #include "ns3/test.h"
+#include "ns3/boolean.h"
 #include "ns3/ccnx-message-portal.h"
 #include "ns3/ccns3Sim-module.h"
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
 
 #include "../../TestMacros.h"
 
@@ -211,6 +215,140 @@ BeginTest (SendRecv)
 }
 EndTest ()
 
+static Ptr<CCNxPacket>
+CreateChunkInterest (uint32_t chunk)
+{
+  std::ostringstream uri;
+  uri << "ccnx:/name=foo/chunk=" << chunk;
+  Ptr<CCNxInterest> interest = Create<CCNxInterest> (Create<CCNxName> (uri.str ()));
+  return CCNxPacket::CreateFromMessage (interest);
+}
+
+BeginTest (InputQueueOrder)
+{
+  Ptr<CCNxMessagePortal> portal = CreateObject<CCNxMessagePortal> ();
+  portal->SetAttribute ("CoalesceNotifications", BooleanValue (false));
+  Ptr<CCNxConnection> incoming = Create<CCNxVirtualConnection> ();
+
+  // Interleave pushes and pops so the ring wraps and grows several times
+  std::vector< Ptr<CCNxPacket> > sent;
+  size_t next = 0;
+  for (uint32_t i = 0; i < 100; i++)
+    {
+      sent.push_back (CreateChunkInterest (i));
+      portal->ReceiveFromLayer3 (sent.back (), incoming);
+      if (i % 3 == 0)
+        {
+          Ptr<CCNxConnection> from;
+          Ptr<CCNxPacket> packet = portal->RecvFrom (from);
+          NS_TEST_EXPECT_MSG_EQ (packet, sent[next], "Packets out of order");
+          NS_TEST_EXPECT_MSG_EQ (from, incoming, "Wrong incoming connection");
+          next++;
+        }
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (portal->GetInputQueueSize (), sent.size () - next, "Wrong queue size");
+  while (Ptr<CCNxPacket> packet = portal->Recv ())
+    {
+      NS_TEST_EXPECT_MSG_EQ (packet, sent[next], "Packets out of order");
+      next++;
+    }
+  NS_TEST_EXPECT_MSG_EQ (next, sent.size (), "Did not read every packet");
+  NS_TEST_EXPECT_MSG_EQ (portal->GetInputQueueSize (), 0, "Queue should be empty");
+
+  portal->Dispose ();
+}
+EndTest ()
+
+static unsigned _notifications;
+static size_t _batchReads;
+static size_t _packetsRead;
+
+static void
+PortalReceiveBatch (Ptr<CCNxPortal> portal)
+{
+  _notifications++;
+  CCNxPortal::PacketBatchType batch;
+  while (portal->RecvBatch (batch, 2) > 0)
+    {
+      _batchReads++;
+      _packetsRead += batch.size ();
+      batch.clear ();
+    }
+}
+
+BeginTest (CoalescedRecvBatch)
+{
+  Ptr<CCNxMessagePortal> portal = CreateObject<CCNxMessagePortal> ();
+  portal->SetAttribute ("CoalesceNotifications", BooleanValue (true));
+  portal->SetRecvCallback (MakeCallback (&PortalReceiveBatch));
+  Ptr<CCNxConnection> incoming = Create<CCNxVirtualConnection> ();
+
+  _notifications = 0;
+  _batchReads = 0;
+  _packetsRead = 0;
+
+  // Five packets in the same instant, then one more a little later
+  for (uint32_t i = 0; i < 5; i++)
+    {
+      Simulator::Schedule (Seconds (1), &CCNxMessagePortal::ReceiveFromLayer3, portal, CreateChunkInterest (i), incoming);
+    }
+  Simulator::Schedule (Seconds (2), &CCNxMessagePortal::ReceiveFromLayer3, portal, CreateChunkInterest (5), incoming);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (_notifications, 2, "Expected one notification per instant");
+  NS_TEST_EXPECT_MSG_EQ (_batchReads, 4, "Expected batches of at most 2 packets");
+  NS_TEST_EXPECT_MSG_EQ (_packetsRead, 6, "Did not read every packet");
+
+  portal->Dispose ();
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * Runs the simulator with `count` packets arriving at the same instant, then one more later,
+ * and returns the number of receive notifications.
+ */
+static unsigned
+RunNotifications (bool coalesce, uint32_t count)
+{
+  Ptr<CCNxMessagePortal> portal = CreateObject<CCNxMessagePortal> ();
+  portal->SetAttribute ("CoalesceNotifications", BooleanValue (coalesce));
+  portal->SetRecvCallback (MakeCallback (&PortalReceiveBatch));
+  Ptr<CCNxConnection> incoming = Create<CCNxVirtualConnection> ();
+
+  _notifications = 0;
+  _batchReads = 0;
+  _packetsRead = 0;
+
+  for (uint32_t i = 0; i < count; i++)
+    {
+      Simulator::Schedule (Seconds (1), &CCNxMessagePortal::ReceiveFromLayer3, portal, CreateChunkInterest (i), incoming);
+    }
+  Simulator::Schedule (Seconds (2), &CCNxMessagePortal::ReceiveFromLayer3, portal, CreateChunkInterest (count), incoming);
+  Simulator::Run ();
+
+  portal->Dispose ();
+  Simulator::Destroy ();
+  return _notifications;
+}
+
+BeginTest (CoalesceOnOff)
+{
+  Ptr<CCNxMessagePortal> portal = CreateObject<CCNxMessagePortal> ();
+  BooleanValue coalesce;
+  portal->GetAttribute ("CoalesceNotifications", coalesce);
+  NS_TEST_EXPECT_MSG_EQ (coalesce.Get (), false, "Coalescing should be off by default");
+  portal->Dispose ();
+
+  NS_TEST_EXPECT_MSG_EQ (RunNotifications (false, 5), 6, "Without coalescing, one notification per packet");
+  NS_TEST_EXPECT_MSG_EQ (_packetsRead, 6, "Did not read every packet without coalescing");
+
+  NS_TEST_EXPECT_MSG_EQ (RunNotifications (true, 5), 2, "With coalescing, one notification per instant");
+  NS_TEST_EXPECT_MSG_EQ (_packetsRead, 6, "Did not read every packet with coalescing");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -225,6 +363,9 @@ public:
     AddTestCase (new GetCCNx (), TestCase::QUICK);
     AddTestCase (new SendRecv (), TestCase::QUICK);
     AddTestCase (new SendToRecvFrom (), TestCase::QUICK);
+    AddTestCase (new InputQueueOrder (), TestCase::QUICK);
+    AddTestCase (new CoalescedRecvBatch (), TestCase::QUICK);
+    AddTestCase (new CoalesceOnOff (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxMessagePortal;
 
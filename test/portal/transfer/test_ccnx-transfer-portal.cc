@@ -0,0 +1,237 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/uinteger.h"
+#include "ns3/nstime.h"
+#include "ns3/ccnx-transfer-portal.h"
+#include "ns3/ccns3Sim-module.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxTransferPortal {
+
+static Ptr<CCNxTransferPortal>
+CreateTransferPortal (Ptr<Node> node)
+{
+  TypeId tid = TypeId::LookupByName ("ns3::ccnx::CCNxTransferPortalFactory");
+  return DynamicCast<CCNxTransferPortal> (CCNxPortal::CreatePortal (node, tid));
+}
+
+static Ptr<CCNxBuffer> _completeObject;
+static uint64_t _completeBytes;
+static unsigned _completeCount;
+static unsigned _failedCount;
+static uint64_t _nextOffset;
+static unsigned _segmentCount;
+static bool _segmentsInOrder;
+
+static void
+ResetResults ()
+{
+  _completeObject = 0;
+  _completeBytes = 0;
+  _completeCount = 0;
+  _failedCount = 0;
+  _nextOffset = 0;
+  _segmentCount = 0;
+  _segmentsInOrder = true;
+}
+
+static void
+TransferComplete (Ptr<CCNxTransferPortal> portal, Ptr<const CCNxName> name, Ptr<CCNxBuffer> object, uint64_t bytes)
+{
+  _completeObject = object;
+  _completeBytes = bytes;
+  _completeCount++;
+}
+
+static void
+TransferFailed (Ptr<CCNxTransferPortal> portal, Ptr<const CCNxName> name)
+{
+  _failedCount++;
+}
+
+static void
+SegmentReceived (Ptr<CCNxTransferPortal> portal, Ptr<const CCNxName> name, uint64_t offset, Ptr<CCNxContentObject> segment)
+{
+  if (offset != _nextOffset)
+    {
+      _segmentsInOrder = false;
+    }
+  _nextOffset = offset + segment->GetPayloadSize ();
+  _segmentCount++;
+}
+
+BeginTest (FetchBuffer)
+{
+  ResetResults ();
+  Ptr<Node> node = CreateObject<Node> ();
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  Ptr<CCNxTransferPortal> producer = CreateTransferPortal (node);
+  producer->SetAttribute ("SegmentSize", UintegerValue (1000));
+
+  // 4500 bytes with a recognizable pattern, so 5 segments with a short last one
+  Ptr<CCNxBuffer> object = Create<CCNxBuffer> (4500, true);
+  Buffer::Iterator writer = object->Begin ();
+  for (uint32_t i = 0; i < 4500; i++)
+    {
+      writer.WriteU8 ((uint8_t) (i * 7));
+    }
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=file/name=pattern");
+  producer->Publish (name, object);
+
+  Ptr<CCNxTransferPortal> consumer = CreateTransferPortal (node);
+  consumer->SetAttribute ("WindowSize", UintegerValue (2));
+  consumer->SetTransferCompleteCallback (MakeCallback (&TransferComplete));
+  consumer->SetTransferFailedCallback (MakeCallback (&TransferFailed));
+  NS_TEST_EXPECT_MSG_EQ (consumer->Fetch (name), true, "Fetch should start");
+  NS_TEST_EXPECT_MSG_EQ (consumer->Fetch (name), false, "Second Fetch of the same name should fail");
+
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (_completeCount, 1, "Transfer did not complete");
+  NS_TEST_EXPECT_MSG_EQ (_failedCount, 0, "Transfer failed");
+  NS_TEST_EXPECT_MSG_EQ (_completeBytes, 4500, "Wrong byte count");
+  bool equal = _completeObject && _completeObject->Equals (object);
+  NS_TEST_EXPECT_MSG_EQ (equal, true, "Reassembled object is different");
+
+  consumer->Close ();
+  producer->Close ();
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (FetchVirtualStream)
+{
+  ResetResults ();
+  Ptr<Node> node = CreateObject<Node> ();
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  Ptr<CCNxTransferPortal> producer = CreateTransferPortal (node);
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=movie");
+  producer->PublishVirtual (name, 100000);
+
+  Ptr<CCNxTransferPortal> consumer = CreateTransferPortal (node);
+  consumer->SetTransferCompleteCallback (MakeCallback (&TransferComplete));
+  consumer->SetSegmentCallback (MakeCallback (&SegmentReceived));
+  consumer->Fetch (name);
+
+  Simulator::Run ();
+
+  // 100000 bytes in 1200 byte segments
+  NS_TEST_EXPECT_MSG_EQ (_completeCount, 1, "Transfer did not complete");
+  NS_TEST_EXPECT_MSG_EQ (_completeBytes, 100000, "Wrong byte count");
+  NS_TEST_EXPECT_MSG_EQ (_segmentCount, 84, "Wrong segment count");
+  NS_TEST_EXPECT_MSG_EQ (_nextOffset, 100000, "Segments do not cover the object");
+  NS_TEST_EXPECT_MSG_EQ (_segmentsInOrder, true, "Segments out of order");
+  bool nullObject = !_completeObject;
+  NS_TEST_EXPECT_MSG_EQ (nullObject, true, "Stream transfer should not reassemble");
+
+  consumer->Close ();
+  producer->Close ();
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (FetchUnpublished)
+{
+  ResetResults ();
+  Ptr<Node> node = CreateObject<Node> ();
+  CCNxStackHelper ccnx;
+  ccnx.Install (node);
+
+  // Nobody answers, so the metadata Interest times out MaxRetries times
+  Ptr<CCNxTransferPortal> consumer = CreateTransferPortal (node);
+  consumer->SetAttribute ("RetransmitTimeout", TimeValue (MilliSeconds (100)));
+  consumer->SetAttribute ("MaxRetries", UintegerValue (2));
+  consumer->SetTransferCompleteCallback (MakeCallback (&TransferComplete));
+  consumer->SetTransferFailedCallback (MakeCallback (&TransferFailed));
+  consumer->Fetch (Create<CCNxName> ("ccnx:/name=missing"));
+
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (_completeCount, 0, "Transfer should not complete");
+  NS_TEST_EXPECT_MSG_EQ (_failedCount, 1, "Transfer should fail");
+  NS_TEST_EXPECT_MSG_EQ (consumer->GetRetransmissionCount (), 2, "Wrong retransmission count");
+
+  consumer->Close ();
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxTransferPortal
+ */
+static class TestSuiteCCNxTransferPortal : public TestSuite
+{
+public:
+  TestSuiteCCNxTransferPortal () : TestSuite ("ccnx-transfer-portal", UNIT)
+  {
+    AddTestCase (new FetchBuffer (), TestCase::QUICK);
+    AddTestCase (new FetchVirtualStream (), TestCase::QUICK);
+    AddTestCase (new FetchUnpublished (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxTransferPortal;
+
+} // namespace TestSuiteCCNxTransferPortal
@@ -0,0 +1,171 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/ccnx-global-routing-graph.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxGlobalRoutingGraph {
+
+static void
+AddLink (CCNxGlobalRoutingGraph &graph, uint32_t a, uint32_t b)
+{
+  graph.AddEdge (a, b, 1);
+  graph.AddEdge (b, a, 1);
+}
+
+BeginTest (Line)
+{
+  // 0 - 1 - 2, and 3 is not connected
+  CCNxGlobalRoutingGraph graph (4);
+  AddLink (graph, 0, 1);
+  AddLink (graph, 1, 2);
+
+  std::vector<uint32_t> targets;
+  targets.push_back (2);
+  targets.push_back (3);
+  graph.Compute (targets, 1);
+
+  NS_TEST_EXPECT_MSG_EQ (graph.GetDistance (0, 0), 2, "Wrong distance 0 to 2");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetFirstHops (0, 0).size (), 1, "Wrong first hop count");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetEdgeTo (graph.GetFirstHops (0, 0)[0]), 1, "First hop should go to 1");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetDistance (2, 0), 0, "Distance to self should be 0");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetDistance (0, 1), CCNxGlobalRoutingGraph::INFINITE, "3 should be unreachable");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetFirstHops (0, 1).size (), 0, "No first hops to unreachable");
+}
+EndTest ()
+
+BeginTest (EqualCost)
+{
+  // 0 - 1 - 3 and 0 - 2 - 3
+  CCNxGlobalRoutingGraph graph (4);
+  AddLink (graph, 0, 1);
+  AddLink (graph, 0, 2);
+  AddLink (graph, 1, 3);
+  AddLink (graph, 2, 3);
+
+  std::vector<uint32_t> targets;
+  targets.push_back (3);
+  graph.Compute (targets, 1);
+
+  NS_TEST_EXPECT_MSG_EQ (graph.GetDistance (0, 0), 2, "Wrong distance 0 to 3");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetFirstHops (0, 0).size (), 2, "Should have both first hops");
+  NS_TEST_EXPECT_MSG_EQ (graph.GetFirstHops (1, 0).size (), 1, "1 should go direct");
+}
+EndTest ()
+
+BeginTest (Threads)
+{
+  // A 10 x 10 grid, computed on 1 and on 4 threads
+  const uint32_t side = 10;
+  CCNxGlobalRoutingGraph single (side * side);
+  CCNxGlobalRoutingGraph multi (side * side);
+  for (uint32_t row = 0; row < side; row++)
+    {
+      for (uint32_t col = 0; col < side; col++)
+        {
+          uint32_t node = row * side + col;
+          if (col + 1 < side)
+            {
+              AddLink (single, node, node + 1);
+              AddLink (multi, node, node + 1);
+            }
+          if (row + 1 < side)
+            {
+              AddLink (single, node, node + side);
+              AddLink (multi, node, node + side);
+            }
+        }
+    }
+
+  std::vector<uint32_t> targets;
+  targets.push_back (0);
+  targets.push_back (side * side - 1);
+  single.Compute (targets, 1);
+  multi.Compute (targets, 4);
+
+  NS_TEST_EXPECT_MSG_EQ (single.GetDistance (0, 1), 2 * (side - 1), "Wrong corner to corner distance");
+  for (uint32_t node = 0; node < side * side; node++)
+    {
+      for (size_t t = 0; t < targets.size (); t++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (multi.GetDistance (node, t), single.GetDistance (node, t), "Wrong distance from " << node);
+          NS_TEST_ASSERT_MSG_EQ ((multi.GetFirstHops (node, t) == single.GetFirstHops (node, t)), true, "Wrong first hops from " << node);
+        }
+    }
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxGlobalRoutingGraph
+ */
+static class TestSuiteCCNxGlobalRoutingGraph : public TestSuite
+{
+public:
+  TestSuiteCCNxGlobalRoutingGraph () : TestSuite ("ccnx-global-routing-graph", UNIT)
+  {
+    AddTestCase (new Line (), TestCase::QUICK);
+    AddTestCase (new EqualCost (), TestCase::QUICK);
+    AddTestCase (new Threads (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxGlobalRoutingGraph;
+
+} // namespace TestSuiteCCNxGlobalRoutingGraph
@@ -0,0 +1,170 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/node-container.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccnx-stack-helper.h"
+#include "ns3/ccnx-standard-layer3.h"
+#include "ns3/ccnx-global-routing-helper.h"
+#include "ns3/ccnx-global-routing-protocol.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteCCNxGlobalRoutingHelper {
+
+/**
+ * Installs CCNx with global routing on `nodes` and adds the devices of the given links
+ */
+static void
+Setup (NodeContainer &nodes, const uint32_t links[][2], size_t linkCount)
+{
+  PointToPointHelper p2p;
+  NetDeviceContainer devices;
+  for (size_t i = 0; i < linkCount; i++)
+    {
+      devices.Add (p2p.Install (nodes.Get (links[i][0]), nodes.Get (links[i][1])));
+    }
+
+  CCNxGlobalRoutingHelper global;
+  CCNxStackHelper stack;
+  stack.SetRoutingHelper (global);
+  stack.Install (nodes);
+  stack.AddInterfaces (devices);
+}
+
+BeginTest (TestCreate)
+{
+  NodeContainer nodes;
+  nodes.Create (1);
+  Setup (nodes, 0, 0);
+
+  NS_TEST_EXPECT_MSG_EQ ((bool) nodes.Get (0)->GetObject<CCNxGlobalRoutingProtocol> (), true, "Protocol not aggregated");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (TestLine)
+{
+  NodeContainer nodes;
+  nodes.Create (3);
+  const uint32_t links[][2] = { { 0, 1 }, { 1, 2 } };
+  Setup (nodes, links, 2);
+
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=foo/name=sink");
+  nodes.Get (2)->GetObject<CCNxGlobalRoutingProtocol> ()->AddAnchorPrefix (prefix);
+  CCNxGlobalRoutingHelper::PopulateRoutingTables ();
+
+  Ptr<const CCNxRoute> route = nodes.Get (0)->GetObject<CCNxGlobalRoutingProtocol> ()->GetRoute (prefix);
+  NS_TEST_ASSERT_MSG_EQ ((bool) route, true, "Missing route on n0");
+  NS_TEST_EXPECT_MSG_EQ (route->size (), 1, "Expected 1 nexthop");
+  NS_TEST_EXPECT_MSG_EQ ((*route->begin ())->GetCost (), 2, "Expected cost 2");
+
+  NS_TEST_EXPECT_MSG_EQ (nodes.Get (2)->GetObject<CCNxGlobalRoutingProtocol> ()->GetRouteCount (), 0,
+                         "The anchor should not route to itself");
+
+  Ptr<CCNxStandardLayer3> layer3 = DynamicCast<CCNxStandardLayer3> (nodes.Get (0)->GetObject<CCNxL3Protocol> ());
+  size_t neighbors = layer3->GetNeighborTableStats ().neighbors;
+  CCNxConnection::ConnIdType connId = (*route->begin ())->GetConnection ()->GetConnectionId ();
+
+  // Populating again gives the same routes over the same connection
+  CCNxGlobalRoutingHelper::PopulateRoutingTables ();
+  NS_TEST_EXPECT_MSG_EQ (nodes.Get (0)->GetObject<CCNxGlobalRoutingProtocol> ()->GetRouteCount (), 1, "Wrong route count");
+  route = nodes.Get (0)->GetObject<CCNxGlobalRoutingProtocol> ()->GetRoute (prefix);
+  NS_TEST_EXPECT_MSG_EQ ((*route->begin ())->GetConnection ()->GetConnectionId (), connId, "The neighbor connection should be reused");
+  NS_TEST_EXPECT_MSG_EQ (layer3->GetNeighborTableStats ().neighbors, neighbors, "No neighbor should be added");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (TestEqualCost)
+{
+  // 0 - 1 - 3 and 0 - 2 - 3
+  NodeContainer nodes;
+  nodes.Create (4);
+  const uint32_t links[][2] = { { 0, 1 }, { 0, 2 }, { 1, 3 }, { 2, 3 } };
+  Setup (nodes, links, 4);
+
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=foo");
+  nodes.Get (3)->GetObject<CCNxGlobalRoutingProtocol> ()->AddAnchorPrefix (prefix);
+  CCNxGlobalRoutingHelper::PopulateRoutingTables (2);
+
+  Ptr<const CCNxRoute> route = nodes.Get (0)->GetObject<CCNxGlobalRoutingProtocol> ()->GetRoute (prefix);
+  NS_TEST_ASSERT_MSG_EQ ((bool) route, true, "Missing route on n0");
+  NS_TEST_EXPECT_MSG_EQ (route->size (), 2, "Expected 2 equal cost nexthops");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for CCNxGlobalRoutingHelper
+ */
+static class TestSuiteCCNxGlobalRoutingHelper : public TestSuite
+{
+public:
+  TestSuiteCCNxGlobalRoutingHelper () : TestSuite ("ccnx-global-routing-helper", UNIT)
+  {
+    AddTestCase (new TestCreate (), TestCase::QUICK);
+    AddTestCase (new TestLine (), TestCase::QUICK);
+    AddTestCase (new TestEqualCost (), TestCase::QUICK);
+  }
+} g_TestSuiteCCNxGlobalRoutingHelper;
+
+} // namespace TestSuiteCCNxGlobalRoutingHelper
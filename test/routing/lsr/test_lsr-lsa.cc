@@ -0,0 +1,198 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <sstream>
+
+#include "ns3/test.h"
+#include "ns3/buffer.h"
+#include "../../TestMacros.h"
+
+#include "ns3/lsr-lsa.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteLsrLsa {
+
+static Ptr<LsrLsa>
+CreateLsa (uint32_t seqnum)
+{
+  Ptr<LsrLsa> lsa = Create<LsrLsa> (Create<CCNxName> ("ccnx:/name=router"), seqnum);
+  lsa->AddLink (Create<CCNxName> ("ccnx:/name=left"), 1);
+  lsa->AddLink (Create<CCNxName> ("ccnx:/name=right"), 7);
+  lsa->AddPrefix (Create<CCNxName> ("ccnx:/name=prefix/name=1"));
+  return lsa;
+}
+
+BeginTest (Constructor)
+{
+  Ptr<LsrLsa> lsa = CreateLsa (5);
+  NS_TEST_EXPECT_MSG_EQ (lsa->GetRouterName ()->Equals (CCNxName ("ccnx:/name=router")), true, "Wrong router name");
+  NS_TEST_EXPECT_MSG_EQ (lsa->GetSeqnum (), 5, "Wrong seqnum");
+  NS_TEST_EXPECT_MSG_EQ (lsa->GetLinkCount (), 2, "Wrong link count");
+  NS_TEST_EXPECT_MSG_EQ (lsa->GetLinkCost (1), 7, "Wrong link cost");
+  NS_TEST_EXPECT_MSG_EQ (lsa->GetPrefixCount (), 1, "Wrong prefix count");
+}
+EndTest ()
+
+BeginTest (FindLink)
+{
+  Ptr<LsrLsa> lsa = CreateLsa (5);
+  uint32_t cost = 0;
+  NS_TEST_EXPECT_MSG_EQ (lsa->FindLink (Create<CCNxName> ("ccnx:/name=right"), cost), true, "Should find right");
+  NS_TEST_EXPECT_MSG_EQ (cost, 7, "Wrong cost for right");
+  NS_TEST_EXPECT_MSG_EQ (lsa->FindLink (Create<CCNxName> ("ccnx:/name=other"), cost), false, "Should not find other");
+}
+EndTest ()
+
+BeginTest (IsNewerThan)
+{
+  Ptr<LsrLsa> a = CreateLsa (5);
+  Ptr<LsrLsa> b = CreateLsa (6);
+  NS_TEST_EXPECT_MSG_EQ (b->IsNewerThan (*a), true, "6 should be newer than 5");
+  NS_TEST_EXPECT_MSG_EQ (a->IsNewerThan (*b), false, "5 should not be newer than 6");
+  NS_TEST_EXPECT_MSG_EQ (a->IsNewerThan (*a), false, "Equal is not newer");
+
+  // sequence number wrap
+  Ptr<LsrLsa> c = CreateLsa (0xFFFFFFFF);
+  Ptr<LsrLsa> d = CreateLsa (1);
+  NS_TEST_EXPECT_MSG_EQ (d->IsNewerThan (*c), true, "1 should be newer than 0xFFFFFFFF");
+}
+EndTest ()
+
+BeginTest (SerializeDeserialize)
+{
+  Ptr<LsrLsa> lsa = CreateLsa (5);
+
+  Buffer buffer (0);
+  buffer.AddAtStart (lsa->GetSerializedSize ());
+  lsa->Serialize (buffer.Begin ());
+
+  Ptr<LsrLsa> test = Create<LsrLsa> ();
+  uint32_t bytesRead = test->Deserialize (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (bytesRead, lsa->GetSerializedSize (), "Wrong bytes read");
+  NS_TEST_EXPECT_MSG_EQ (test->Equals (*lsa), true, "Deserialized LSA does not match");
+}
+EndTest ()
+
+BeginTest (FragmentSmall)
+{
+  Ptr<LsrLsa> lsa = CreateLsa (5);
+  std::vector< Ptr<const LsrLsa> > fragments = lsa->Fragment (lsa->GetSerializedSize ());
+  NS_TEST_EXPECT_MSG_EQ (fragments.size (), 1, "An LSA that fits should not be split");
+  NS_TEST_EXPECT_MSG_EQ (fragments[0]->Equals (*lsa), true, "The only fragment should be the LSA");
+  NS_TEST_EXPECT_MSG_EQ (fragments[0]->GetFragmentCount (), 1, "A complete LSA has fragment count 1");
+}
+EndTest ()
+
+BeginTest (FragmentLargePrefixSet)
+{
+  Ptr<LsrLsa> lsa = CreateLsa (5);
+  for (int i = 0; i < 500; i++)
+    {
+      std::ostringstream uri;
+      uri << "ccnx:/name=large/name=prefix/name=" << i;
+      lsa->AddPrefix (Create<CCNxName> (uri.str ()));
+    }
+
+  const uint32_t maxSize = 1400;
+  NS_TEST_EXPECT_MSG_GT (lsa->GetSerializedSize (), 4 * maxSize, "The test LSA should need several fragments");
+
+  std::vector< Ptr<const LsrLsa> > fragments = lsa->Fragment (maxSize);
+  NS_TEST_EXPECT_MSG_GT (fragments.size (), 4, "Expected several fragments");
+
+  Ptr<LsrLsa> reassembled = Create<LsrLsa> (lsa->GetRouterName (), lsa->GetSeqnum ());
+  for (size_t i = 0; i < fragments.size (); i++)
+    {
+      NS_TEST_EXPECT_MSG_LT_OR_EQ (fragments[i]->GetSerializedSize (), maxSize, "Fragment " << i << " too large");
+      NS_TEST_EXPECT_MSG_EQ (fragments[i]->GetSeqnum (), 5, "Fragments keep the seqnum");
+      NS_TEST_EXPECT_MSG_EQ (fragments[i]->GetFragmentIndex (), i, "Wrong fragment index");
+      NS_TEST_EXPECT_MSG_EQ (fragments[i]->GetFragmentCount (), fragments.size (), "Wrong fragment count");
+
+      // The fragment number survives the wire
+      Buffer buffer (0);
+      buffer.AddAtStart (fragments[i]->GetSerializedSize ());
+      fragments[i]->Serialize (buffer.Begin ());
+      Ptr<LsrLsa> test = Create<LsrLsa> ();
+      NS_TEST_EXPECT_MSG_EQ (test->Deserialize (buffer.Begin ()), fragments[i]->GetSerializedSize (), "Wrong bytes read");
+      NS_TEST_EXPECT_MSG_EQ (test->Equals (*fragments[i]), true, "Deserialized fragment does not match");
+
+      reassembled->Merge (*test);
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (reassembled->Equals (*lsa), true, "Reassembled LSA does not match");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for LsrLsa
+ */
+static class TestSuiteLsrLsa : public TestSuite
+{
+public:
+  TestSuiteLsrLsa () : TestSuite ("lsr-lsa", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new FindLink (), TestCase::QUICK);
+    AddTestCase (new IsNewerThan (), TestCase::QUICK);
+    AddTestCase (new SerializeDeserialize (), TestCase::QUICK);
+    AddTestCase (new FragmentSmall (), TestCase::QUICK);
+    AddTestCase (new FragmentLargePrefixSet (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrLsa;
+
+} // namespace TestSuiteLsrLsa
@@ -0,0 +1,135 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/lsr-lsdb.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteLsrLsdb {
+
+BeginTest (GetIndex)
+{
+  LsrLsdb lsdb;
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName> b = Create<CCNxName> ("ccnx:/name=b");
+
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetIndex (a), 0, "First index should be 0");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetIndex (b), 1, "Second index should be 1");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetIndex (Create<CCNxName> ("ccnx:/name=a")), 0, "Same name should have the same index");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetIndexCount (), 2, "Wrong index count");
+
+  uint32_t index;
+  NS_TEST_EXPECT_MSG_EQ (lsdb.FindIndex (Create<CCNxName> ("ccnx:/name=c"), index), false, "Should not find c");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetRouterName (1)->Equals (*b), true, "Wrong name for index 1");
+}
+EndTest ()
+
+BeginTest (Install)
+{
+  LsrLsdb lsdb;
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<LsrLsa> lsa5 = Create<LsrLsa> (a, 5);
+  Ptr<LsrLsa> lsa6 = Create<LsrLsa> (a, 6);
+
+  NS_TEST_EXPECT_MSG_EQ (lsdb.Install (lsa5, Seconds (1)), LsrLsdb::INSTALLED, "Should install first");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.Install (lsa5, Seconds (2)), LsrLsdb::DUPLICATE, "Should be duplicate");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.Install (lsa6, Seconds (3)), LsrLsdb::INSTALLED, "Should install newer");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.Install (lsa5, Seconds (4)), LsrLsdb::OLDER, "Should be older");
+
+  uint32_t index = lsdb.GetIndex (a);
+  NS_TEST_EXPECT_MSG_EQ (lsdb.Get (index)->GetSeqnum (), 6, "Wrong stored LSA");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetInstallTime (index), Seconds (3), "Wrong install time");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetSize (), 1, "Wrong size");
+}
+EndTest ()
+
+BeginTest (Remove)
+{
+  LsrLsdb lsdb;
+  lsdb.Install (Create<LsrLsa> (Create<CCNxName> ("ccnx:/name=a"), 1), Seconds (1));
+  lsdb.Install (Create<LsrLsa> (Create<CCNxName> ("ccnx:/name=b"), 1), Seconds (5));
+
+  std::vector<uint32_t> old = lsdb.GetInstalledBefore (Seconds (3));
+  NS_TEST_EXPECT_MSG_EQ (old.size (), 1, "Wrong old count");
+  NS_TEST_EXPECT_MSG_EQ (old[0], 0, "Wrong old index");
+
+  lsdb.Remove (0);
+  NS_TEST_EXPECT_MSG_EQ ((bool) lsdb.Get (0), false, "Removed LSA should be null");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetSize (), 1, "Wrong size");
+  NS_TEST_EXPECT_MSG_EQ (lsdb.GetIndexCount (), 2, "Index is never re-used");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for LsrLsdb
+ */
+static class TestSuiteLsrLsdb : public TestSuite
+{
+public:
+  TestSuiteLsrLsdb () : TestSuite ("lsr-lsdb", UNIT)
+  {
+    AddTestCase (new GetIndex (), TestCase::QUICK);
+    AddTestCase (new Install (), TestCase::QUICK);
+    AddTestCase (new Remove (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrLsdb;
+
+} // namespace TestSuiteLsrLsdb
@@ -0,0 +1,130 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/buffer.h"
+#include "../../TestMacros.h"
+
+#include "ns3/lsr-payload.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteLsrPayload {
+
+static Ptr<LsrLsa>
+CreateLsa (const char *routerName, uint32_t seqnum)
+{
+  Ptr<LsrLsa> lsa = Create<LsrLsa> (Create<CCNxName> (routerName), seqnum);
+  lsa->AddLink (Create<CCNxName> ("ccnx:/name=neighbor"), 3);
+  lsa->AddPrefix (Create<CCNxName> ("ccnx:/name=prefix"));
+  return lsa;
+}
+
+BeginTest (Hello)
+{
+  Ptr<LsrPayload> payload = Create<LsrPayload> (1000, Create<CCNxName> ("ccnx:/name=router"));
+  NS_TEST_EXPECT_MSG_EQ (payload->GetLsaCount (), 0, "Hello should have no LSAs");
+  NS_TEST_EXPECT_MSG_EQ (payload->GetRemaining (), 1000 - payload->GetSerializedSize (), "Wrong remaining");
+}
+EndTest ()
+
+BeginTest (AppendLsa)
+{
+  Ptr<LsrPayload> payload = Create<LsrPayload> (1000, Create<CCNxName> ("ccnx:/name=router"));
+  size_t before = payload->GetRemaining ();
+  Ptr<LsrLsa> lsa = CreateLsa ("ccnx:/name=a", 1);
+  payload->AppendLsa (lsa);
+  NS_TEST_EXPECT_MSG_EQ (payload->GetLsaCount (), 1, "Wrong LSA count");
+  NS_TEST_EXPECT_MSG_EQ (payload->GetRemaining (), before - lsa->GetSerializedSize (), "Wrong remaining");
+  NS_TEST_EXPECT_MSG_EQ (payload->GetLsa (0)->Equals (*lsa), true, "Wrong LSA");
+}
+EndTest ()
+
+BeginTest (SerializeDeserialize)
+{
+  Ptr<LsrPayload> payload = Create<LsrPayload> (1000, Create<CCNxName> ("ccnx:/name=router"));
+  payload->AppendLsa (CreateLsa ("ccnx:/name=a", 1));
+  payload->AppendLsa (CreateLsa ("ccnx:/name=b", 2));
+
+  Buffer buffer (0);
+  buffer.AddAtStart (payload->GetSerializedSize ());
+  payload->Serialize (buffer.Begin ());
+
+  Ptr<LsrPayload> test = Create<LsrPayload> ();
+  uint32_t bytesRead = test->Deserialize (buffer.Begin ());
+  NS_TEST_EXPECT_MSG_EQ (bytesRead, payload->GetSerializedSize (), "Wrong bytes read");
+  NS_TEST_EXPECT_MSG_EQ (test->Equals (*payload), true, "Deserialized payload does not match");
+  NS_TEST_EXPECT_MSG_EQ (test->GetLsaCount (), 2, "Wrong LSA count");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for LsrPayload
+ */
+static class TestSuiteLsrPayload : public TestSuite
+{
+public:
+  TestSuiteLsrPayload () : TestSuite ("lsr-payload", UNIT)
+  {
+    AddTestCase (new Hello (), TestCase::QUICK);
+    AddTestCase (new AppendLsa (), TestCase::QUICK);
+    AddTestCase (new SerializeDeserialize (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrPayload;
+
+} // namespace TestSuiteLsrPayload
@@ -0,0 +1,149 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/node-container.h"
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/lsr-routing-helper.h"
+#include "ns3/lsr-routing-protocol.h"
+#include "ns3/ccnx-stack-helper.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+// =================================
+
+namespace TestSuiteLsrRoutingHelper {
+
+static void
+Setup (Ptr<Node> node)
+{
+  CCNxStackHelper stack;
+  stack.Install (node);
+}
+
+BeginTest (TestConstructor)
+{
+  // this could fail if, for instance, we cannot lookup LsrRoutingProtocol in the RTTI
+  LsrRoutingHelper *helper = new LsrRoutingHelper;
+
+  NS_TEST_EXPECT_MSG_NE (helper, NULL, "Got null from constructor");
+
+  delete helper;
+}
+EndTest ()
+
+BeginTest (TestCreate)
+{
+  NodeContainer nc;
+  nc.Create (1);
+  Setup (nc.Get (0));
+
+  LsrRoutingHelper helper;
+
+  Ptr<CCNxRoutingProtocol> protocol = helper.Create (nc.Get (0));
+
+  bool success = false;
+  if (protocol)
+    {
+      success = true;
+    }
+
+  NS_TEST_EXPECT_MSG_EQ ( success, true, "Got empty pointer from Create");
+}
+EndTest ()
+
+BeginTest (TestCreateWithAttribute)
+{
+  NodeContainer nc;
+  nc.Create (1);
+  Setup (nc.Get (0));
+
+  LsrRoutingHelper helper;
+  helper.Set ("HelloInterval", TimeValue (Seconds (99)));
+
+  Ptr<CCNxRoutingProtocol> protocol = helper.Create (nc.Get (0));
+
+  Ptr<LsrRoutingProtocol> lsr = DynamicCast<LsrRoutingProtocol, CCNxRoutingProtocol> (protocol);
+
+  Time test = lsr->GetHelloInterval ();
+
+  NS_TEST_EXPECT_MSG_EQ ( test, Seconds (99), "Wrong HelloInterval");
+}
+EndTest ()
+
+// =================================
+// Finally, define the TestSuite
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for LsrRoutingHelper
+ */
+static class TestSuiteLsrRoutingHelper : public TestSuite
+{
+public:
+  TestSuiteLsrRoutingHelper () : TestSuite ("lsr-routing-helper", UNIT)
+  {
+    AddTestCase (new TestConstructor (), TestCase::QUICK);
+    AddTestCase (new TestCreate (), TestCase::QUICK);
+    AddTestCase (new TestCreateWithAttribute (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrRoutingHelper;
+
+} // namespace
+
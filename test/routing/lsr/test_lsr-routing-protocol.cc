@@ -0,0 +1,212 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <sstream>
+
+#include "ns3/log.h"
+#include "ns3/test.h"
+#include "ns3/node-container.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccnx-stack-helper.h"
+#include "ns3/lsr-routing-helper.h"
+#include "ns3/lsr-routing-protocol.h"
+
+#include "../../TestMacros.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+// =================================
+
+namespace TestSuiteLsrRoutingProtocol {
+
+/**
+ * Build a line n0 -- n1 -- ... with LSR on every node
+ */
+static NodeContainer
+CreateLine (uint32_t count)
+{
+  NodeContainer nodes;
+  nodes.Create (count);
+
+  PointToPointHelper p2p;
+  NetDeviceContainer devices;
+  for (uint32_t i = 0; i + 1 < count; i++)
+    {
+      devices.Add (p2p.Install (nodes.Get (i), nodes.Get (i + 1)));
+    }
+
+  LsrRoutingHelper lsr;
+  lsr.Set ("HelloInterval", TimeValue (Seconds (1)));
+
+  CCNxStackHelper stack;
+  stack.SetRoutingHelper (lsr);
+  stack.Install (nodes);
+  stack.AddInterfaces (devices);
+  return nodes;
+}
+
+BeginTest (TestGetTypeId)
+{
+  TypeId id = LsrRoutingProtocol::GetTypeId ();
+  NS_TEST_EXPECT_MSG_EQ (id.GetName (), "ns3::ccnx::LsrRoutingProtocol", "Wrong TypeId name");
+}
+EndTest ()
+
+BeginTest (TestAnchorRefcount)
+{
+  NodeContainer nodes = CreateLine (2);
+  Ptr<LsrRoutingProtocol> lsr = nodes.Get (1)->GetObject<LsrRoutingProtocol> ();
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=apple");
+
+  lsr->AddAnchorPrefix (prefix);
+  lsr->AddAnchorPrefix (prefix);
+  lsr->RemoveAnchorPrefix (prefix);
+
+  Simulator::Stop (Seconds (5));
+  Simulator::Run ();
+
+  Ptr<LsrRoutingProtocol> other = nodes.Get (0)->GetObject<LsrRoutingProtocol> ();
+  NS_TEST_EXPECT_MSG_EQ ((bool) other->GetRoute (prefix), true, "Prefix should still be advertised");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (TestConverge)
+{
+  NodeContainer nodes = CreateLine (3);
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=foo/name=sink");
+  nodes.Get (2)->GetObject<LsrRoutingProtocol> ()->AddAnchorPrefix (prefix);
+
+  Simulator::Stop (Seconds (5));
+  Simulator::Run ();
+
+  Ptr<LsrRoutingProtocol> lsr = nodes.Get (0)->GetObject<LsrRoutingProtocol> ();
+  NS_TEST_EXPECT_MSG_EQ (lsr->GetLsdbSize (), 3, "Every router should be in the LSDB");
+
+  Ptr<const CCNxRoute> route = lsr->GetRoute (prefix);
+  NS_TEST_ASSERT_MSG_EQ ((bool) route, true, "Missing route on n0");
+  NS_TEST_EXPECT_MSG_EQ (route->size (), 1, "Expected 1 nexthop");
+  NS_TEST_EXPECT_MSG_EQ ((*route->begin ())->GetCost (), 2, "Expected cost 2 to n2");
+
+  NS_TEST_EXPECT_MSG_EQ ((bool) nodes.Get (2)->GetObject<LsrRoutingProtocol> ()->GetRoute (prefix), false,
+                         "The anchor should not route to itself");
+
+  // Withdraw it
+  nodes.Get (2)->GetObject<LsrRoutingProtocol> ()->RemoveAnchorPrefix (prefix);
+  Simulator::Stop (Seconds (1));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ ((bool) lsr->GetRoute (prefix), false, "Route should be withdrawn");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (TestLargePrefixSet)
+{
+  // Many more prefixes than fit in one packet, so n2 sends its LSA in fragments
+  NodeContainer nodes = CreateLine (3);
+  std::vector< Ptr<const CCNxName> > prefixes;
+  for (int i = 0; i < 400; i++)
+    {
+      std::ostringstream uri;
+      uri << "ccnx:/name=large/name=prefix/name=" << i;
+      prefixes.push_back (Create<CCNxName> (uri.str ()));
+      nodes.Get (2)->GetObject<LsrRoutingProtocol> ()->AddAnchorPrefix (prefixes.back ());
+    }
+
+  Simulator::Stop (Seconds (5));
+  Simulator::Run ();
+
+  Ptr<LsrRoutingProtocol> lsr = nodes.Get (0)->GetObject<LsrRoutingProtocol> ();
+  NS_TEST_EXPECT_MSG_EQ (lsr->GetLsdbSize (), 3, "Every router should be in the LSDB");
+
+  size_t routed = 0;
+  for (size_t i = 0; i < prefixes.size (); i++)
+    {
+      Ptr<const CCNxRoute> route = lsr->GetRoute (prefixes[i]);
+      if (route && route->size () == 1 && (*route->begin ())->GetCost () == 2)
+        {
+          routed++;
+        }
+    }
+  NS_TEST_EXPECT_MSG_EQ (routed, prefixes.size (), "n0 should route every prefix of n2");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+// =================================
+// Finally, define the TestSuite
+
+/**
+ * \ingroup ccnx-test
+ *
+ * \brief Test Suite for LsrRoutingProtocol
+ */
+static class TestSuiteLsrRoutingProtocol : public TestSuite
+{
+public:
+  TestSuiteLsrRoutingProtocol () : TestSuite ("lsr-routing-protocol", UNIT)
+  {
+    AddTestCase (new TestGetTypeId (), TestCase::QUICK);
+    AddTestCase (new TestAnchorRefcount (), TestCase::QUICK);
+    AddTestCase (new TestConverge (), TestCase::QUICK);
+    AddTestCase (new TestLargePrefixSet (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrRoutingProtocol;
+
+} // namespace
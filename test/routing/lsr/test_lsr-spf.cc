@@ -0,0 +1,205 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "ns3/random-variable-stream.h"
+#include "../../TestMacros.h"
+
+#include "ns3/lsr-spf.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteLsrSpf {
+
+/**
+ * A line 0 - 1 - 2 - 3 with unit costs in both directions
+ */
+static void
+CreateLine (LsrSpf &spf)
+{
+  for (uint32_t i = 0; i < 3; i++)
+    {
+      spf.SetEdge (i, i + 1, 1);
+      spf.SetEdge (i + 1, i, 1);
+    }
+}
+
+BeginTest (Line)
+{
+  LsrSpf spf (0);
+  CreateLine (spf);
+
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (3), 3, "Wrong distance to 3");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetParent (3), 2, "Wrong parent of 3");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetFirstHop (3), 1, "Wrong first hop to 3");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetFirstHop (0), LsrSpf::INFINITE, "Root has no first hop");
+
+  std::vector<uint32_t> changed = spf.TakeChanged ();
+  NS_TEST_EXPECT_MSG_EQ (changed.size (), 3, "Nodes 1, 2, 3 should have changed");
+  NS_TEST_EXPECT_MSG_EQ (spf.TakeChanged ().size (), 0, "TakeChanged should clear");
+}
+EndTest ()
+
+BeginTest (Shortcut)
+{
+  LsrSpf spf (0);
+  CreateLine (spf);
+  spf.TakeChanged ();
+
+  // A shortcut from 0 to 2 only changes 2 and 3
+  spf.SetEdge (0, 2, 1);
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (3), 2, "Wrong distance to 3");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetFirstHop (3), 2, "Wrong first hop to 3");
+
+  std::vector<uint32_t> changed = spf.TakeChanged ();
+  NS_TEST_EXPECT_MSG_EQ (changed.size (), 2, "Wrong changed count");
+  NS_TEST_EXPECT_MSG_EQ (changed[0], 2, "Node 2 should change");
+  NS_TEST_EXPECT_MSG_EQ (changed[1], 3, "Node 3 should change");
+
+  // Removing it goes back to the line
+  spf.RemoveEdge (0, 2);
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (3), 3, "Wrong distance to 3 after remove");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetFirstHop (3), 1, "Wrong first hop to 3 after remove");
+}
+EndTest ()
+
+BeginTest (Disconnect)
+{
+  LsrSpf spf (0);
+  CreateLine (spf);
+  spf.TakeChanged ();
+
+  spf.RemoveEdge (1, 2);
+  NS_TEST_EXPECT_MSG_EQ (spf.IsReachable (1), true, "1 should be reachable");
+  NS_TEST_EXPECT_MSG_EQ (spf.IsReachable (2), false, "2 should not be reachable");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (3), LsrSpf::INFINITE, "3 should be infinite");
+  NS_TEST_EXPECT_MSG_EQ (spf.TakeChanged ().size (), 2, "Nodes 2 and 3 should have changed");
+
+  // Increasing a cost on the tree moves the subtree
+  spf.SetEdge (1, 2, 1);
+  spf.SetEdge (0, 3, 10);
+  spf.SetEdge (1, 2, 20);
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (3), 10, "3 should be reached directly");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetDistance (2), 11, "2 should be reached through 3");
+  NS_TEST_EXPECT_MSG_EQ (spf.GetFirstHop (2), 3, "Wrong first hop to 2");
+}
+EndTest ()
+
+BeginTest (RandomIncremental)
+{
+  const uint32_t nodes = 20;
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+
+  LsrSpf spf (0);
+  for (int round = 0; round < 500; round++)
+    {
+      uint32_t from = random->GetInteger (0, nodes - 1);
+      uint32_t to = random->GetInteger (0, nodes - 1);
+      if (from == to)
+        {
+          continue;
+        }
+
+      if (random->GetInteger (0, 3) == 0)
+        {
+          spf.RemoveEdge (from, to);
+        }
+      else
+        {
+          spf.SetEdge (from, to, random->GetInteger (1, 10));
+        }
+
+      LsrSpf full (0);
+      for (uint32_t i = 0; i < nodes; i++)
+        {
+          for (uint32_t j = 0; j < nodes; j++)
+            {
+              uint32_t cost;
+              if (spf.FindEdge (i, j, cost))
+                {
+                  full.SetEdge (i, j, cost);
+                }
+            }
+        }
+      full.Recompute ();
+
+      for (uint32_t i = 0; i < nodes; i++)
+        {
+          NS_TEST_ASSERT_MSG_EQ (spf.GetDistance (i), full.GetDistance (i), "Wrong distance in round " << round);
+        }
+    }
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for LsrSpf
+ */
+static class TestSuiteLsrSpf : public TestSuite
+{
+public:
+  TestSuiteLsrSpf () : TestSuite ("lsr-spf", UNIT)
+  {
+    AddTestCase (new Line (), TestCase::QUICK);
+    AddTestCase (new Shortcut (), TestCase::QUICK);
+    AddTestCase (new Disconnect (), TestCase::QUICK);
+    AddTestCase (new RandomIncremental (), TestCase::QUICK);
+  }
+} g_TestSuiteLsrSpf;
+
+} // namespace TestSuiteLsrSpf
@@ -158,9 +158,15 @@ public:
   }
 
   void
-  Broadcast (ns3::Ptr<ns3::ccnx::CCNxPacket> packet)
+  Broadcast (ns3::Ptr<ns3::ccnx::NfpPayload> payload)
   {
-    m_nfp->Broadcast (packet);
+    m_nfp->Broadcast (payload);
+  }
+
+  void
+  BroadcastHello (ns3::Ptr<ns3::ccnx::NfpPayload> payload)
+  {
+    m_nfp->BroadcastHello (payload);
   }
 
   std::map< uint32_t, ns3::Ptr<ns3::ccnx::CCNxL3Interface> > *
@@ -189,6 +195,38 @@ public:
     return m_nfp->ReceiveHello (neighbor, msgSeqnum, ingressConnection);
   }
 
+  bool IsAnchorSummarized (ns3::Ptr<const ns3::ccnx::CCNxName> prefix) const
+  {
+    return m_nfp->IsAnchorSummarized (prefix);
+  }
+
+  static bool HasSameNexthops (ns3::Ptr<const ns3::ccnx::CCNxRoute> a, ns3::Ptr<const ns3::ccnx::CCNxRoute> b)
+  {
+    return ns3::ccnx::NfpRoutingProtocol::HasSameNexthops (a, b);
+  }
+
+  /**
+   * The number of nexthops NFP has installed in the FIB for `prefix`
+   */
+  size_t
+  GetFibNexthopCount (ns3::Ptr<const ns3::ccnx::CCNxName> prefix)
+  {
+    ns3::Ptr<ns3::ccnx::CCNxRoute> *route = m_nfp->m_modelFib.Find (prefix);
+    return route ? (*route)->size () : 0;
+  }
+
+  size_t
+  GetPacerQueueSize (uint32_t interface)
+  {
+    return m_nfp->m_pacers[interface].queue.size ();
+  }
+
+  ns3::Ptr<ns3::ccnx::NfpPayload>
+  GetPacerQueuePayload (uint32_t interface, size_t index)
+  {
+    return m_nfp->m_pacers[interface].queue[index].payload;
+  }
+
   typedef std::map< ns3::Ptr<ns3::ccnx::NfpNeighborKey>, ns3::Ptr<ns3::ccnx::NfpNeighbor>, ns3::ccnx::NfpNeighborKey::isLessPtrNfpNeighborKey > NeighborMapType;
   NeighborMapType &
   GetNeighbors (void)
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <sstream>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-convergence-observer.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpConvergenceObserver {
+
+BeginTest (AddConverges)
+{
+  Ptr<NfpConvergenceObserver> observer = CreateObject<NfpConvergenceObserver> ();
+  observer->RegisterNode (0);
+  observer->RegisterNode (1);
+  observer->RegisterNode (2);
+  NS_TEST_EXPECT_MSG_EQ (observer->GetNodeCount (), 3, "Wrong node count");
+
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=foo");
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+
+  // Use a copy of the name for the FIB updates, as each node has its own copy
+  Ptr<const CCNxName> prefixCopy = Create<CCNxName> ("ccnx:/name=foo");
+
+  Simulator::Schedule (Seconds (1), &NfpConvergenceObserver::AnchorPrefixAdded, observer, prefix, anchor);
+  Simulator::Schedule (Seconds (1), &NfpConvergenceObserver::FibRouteAdded, observer, 0, prefix, anchor);
+  Simulator::Schedule (Seconds (1.5), &NfpConvergenceObserver::ControlBytesSent, observer, 64);
+  Simulator::Schedule (Seconds (2), &NfpConvergenceObserver::FibRouteAdded, observer, 1, prefixCopy, anchor);
+
+  // a removal does not count for an add event
+  Simulator::Schedule (Seconds (2.5), &NfpConvergenceObserver::FibRouteRemoved, observer, 2, prefixCopy, anchor);
+  Simulator::Schedule (Seconds (3), &NfpConvergenceObserver::ControlBytesSent, observer, 32);
+  Simulator::Schedule (Seconds (4), &NfpConvergenceObserver::FibRouteAdded, observer, 2, prefixCopy, anchor);
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (observer->GetEventCount (), 1, "Wrong event count");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetOpenEventCount (), 0, "Event should be closed");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetControlBytes (), 96, "Wrong control bytes");
+
+  Ptr<const NfpConvergenceEvent> event = observer->GetEvent (0);
+  NS_TEST_EXPECT_MSG_EQ (event->IsConverged (), true, "Event should be converged");
+  NS_TEST_EXPECT_MSG_EQ (event->GetConvergenceTime (), Seconds (3), "Wrong convergence time");
+  NS_TEST_EXPECT_MSG_EQ (event->GetControlBytes (), 96, "Wrong event control bytes");
+
+  std::ostringstream os;
+  observer->Print (os);
+  NS_TEST_EXPECT_MSG_NE (os.str ().find ("add events 1 converged 1"), std::string::npos, "Wrong summary: " << os.str ());
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (WithdrawOpen)
+{
+  Ptr<NfpConvergenceObserver> observer = CreateObject<NfpConvergenceObserver> ();
+  observer->RegisterNode (0);
+  observer->RegisterNode (1);
+
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=foo");
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  Ptr<const CCNxName> other = Create<CCNxName> ("ccnx:/name=other");
+
+  observer->AnchorPrefixRemoved (prefix, anchor);
+  observer->FibRouteRemoved (0, prefix, anchor);
+
+  // a different anchor for the same prefix is a different event
+  observer->FibRouteRemoved (1, prefix, other);
+
+  NS_TEST_EXPECT_MSG_EQ (observer->GetEventCount (), 1, "Wrong event count");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetOpenEventCount (), 1, "Event should be open");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetEvent (0)->GetUpdatedCount (), 1, "Wrong updated count");
+
+  // A new event for the same pair supersedes the open one
+  observer->AnchorPrefixAdded (prefix, anchor);
+  NS_TEST_EXPECT_MSG_EQ (observer->GetEventCount (), 2, "Wrong event count");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetOpenEventCount (), 1, "Only the newest event should be open");
+  NS_TEST_EXPECT_MSG_EQ (observer->GetEvent (0)->IsConverged (), false, "Superseded event should not be converged");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpConvergenceObserver
+ */
+static class TestSuiteNfpConvergenceObserver : public TestSuite
+{
+public:
+  TestSuiteNfpConvergenceObserver () : TestSuite ("nfp-convergence-observer", UNIT)
+  {
+    AddTestCase (new AddConverges (), TestCase::QUICK);
+    AddTestCase (new WithdrawOpen (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpConvergenceObserver;
+
+} // namespace TestSuiteNfpConvergenceObserver
@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-flap-damping.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpFlapDamping {
+
+BeginTest (Suppress)
+{
+  NfpFlapDamping damping (Seconds (10), 1000.0, 2000.0, 750.0, 12000.0);
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (prefix, anchor, Seconds (0)), false, "Unknown pair should not be suppressed");
+  NS_TEST_EXPECT_MSG_EQ (damping.RecordFlap (prefix, anchor, Seconds (0)), false, "First flap should not suppress");
+  NS_TEST_EXPECT_MSG_EQ (damping.RecordFlap (prefix, anchor, Seconds (0)), false, "Penalty at suppress should not suppress");
+  NS_TEST_EXPECT_MSG_EQ (damping.RecordFlap (prefix, anchor, Seconds (0)), true, "Third flap should suppress");
+  NS_TEST_EXPECT_MSG_EQ (damping.RecordFlap (prefix, anchor, Seconds (0)), false, "Already suppressed");
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (prefix, anchor, Seconds (0)), true, "Pair should be suppressed");
+
+  // a different pair with the same names is the same key
+  Ptr<const CCNxName> prefix2 = Create<CCNxName> ("ccnx:/name=a");
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (prefix2, anchor, Seconds (0)), true, "Lookup should be by name");
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (anchor, prefix, Seconds (0)), false, "Key order matters");
+  NS_TEST_EXPECT_MSG_EQ (damping.GetSize (), 1, "Wrong size");
+}
+EndTest ()
+
+BeginTest (Decay)
+{
+  NfpFlapDamping damping (Seconds (10), 1000.0, 2000.0, 750.0, 12000.0);
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+
+  damping.RecordFlap (prefix, anchor, Seconds (0));
+  damping.RecordFlap (prefix, anchor, Seconds (0));
+  damping.RecordFlap (prefix, anchor, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ_TOL (damping.GetPenalty (prefix, anchor, Seconds (10)), 1500.0, 0.001, "Penalty should halve in one half-life");
+
+  // 1500 -> 750 in one more half-life, at 20 seconds
+  Time delay = damping.GetReuseDelay (prefix, anchor, Seconds (10));
+  NS_TEST_EXPECT_MSG_EQ_TOL (delay.GetSeconds (), 10.0, 0.001, "Wrong reuse delay");
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (prefix, anchor, Seconds (19)), true, "Should be suppressed before reuse");
+  NS_TEST_EXPECT_MSG_EQ (damping.IsSuppressed (prefix, anchor, Seconds (21)), false, "Should be reused after reuse delay");
+  NS_TEST_EXPECT_MSG_EQ (damping.GetReuseDelay (prefix, anchor, Seconds (21)), Time (0), "Reuse delay of unsuppressed pair");
+
+  // negligible entries are removed
+  NS_TEST_EXPECT_MSG_EQ (damping.GetPenalty (prefix, anchor, Seconds (200)), 0.0, "Penalty should be forgotten");
+  NS_TEST_EXPECT_MSG_EQ (damping.GetSize (), 0, "Entry should be erased");
+}
+EndTest ()
+
+BeginTest (MaxPenalty)
+{
+  NfpFlapDamping damping (Seconds (10), 1000.0, 2000.0, 750.0, 3000.0);
+  Ptr<const CCNxName> prefix = Create<CCNxName> ("ccnx:/name=a");
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+
+  for (int i = 0; i < 10; i++)
+    {
+      damping.RecordFlap (prefix, anchor, Seconds (0));
+    }
+  NS_TEST_EXPECT_MSG_EQ_TOL (damping.GetPenalty (prefix, anchor, Seconds (0)), 3000.0, 0.001, "Penalty should be capped");
+  NS_TEST_EXPECT_MSG_EQ_TOL (damping.GetReuseDelay (prefix, anchor, Seconds (0)).GetSeconds (), 20.0, 0.001, "Wrong maximum suppression");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpFlapDamping
+ */
+static class TestSuiteNfpFlapDamping : public TestSuite
+{
+public:
+  TestSuiteNfpFlapDamping () : TestSuite ("nfp-flap-damping", UNIT)
+  {
+    AddTestCase (new Suppress (), TestCase::QUICK);
+    AddTestCase (new Decay (), TestCase::QUICK);
+    AddTestCase (new MaxPenalty (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpFlapDamping;
+
+} // namespace TestSuiteNfpFlapDamping
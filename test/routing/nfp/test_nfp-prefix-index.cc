@@ -0,0 +1,142 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-prefix-index.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpPrefixIndex {
+
+BeginTest (InsertErase)
+{
+  NfpPrefixIndex index;
+  Ptr<const CCNxName> a = Create<CCNxName> ("ccnx:/name=a/name=b");
+
+  NS_TEST_EXPECT_MSG_EQ (index.Insert (a), true, "First insert should succeed");
+  NS_TEST_EXPECT_MSG_EQ (index.Insert (Create<CCNxName> ("ccnx:/name=a/name=b")), false, "Equal name should not be added twice");
+  NS_TEST_EXPECT_MSG_EQ (index.Contains (Create<CCNxName> ("ccnx:/name=a/name=b")), true, "Lookup is by name");
+  NS_TEST_EXPECT_MSG_EQ (index.GetSize (), 1, "Wrong size");
+
+  NS_TEST_EXPECT_MSG_EQ (index.Erase (a), true, "Erase should succeed");
+  NS_TEST_EXPECT_MSG_EQ (index.Erase (a), false, "Second erase should fail");
+  NS_TEST_EXPECT_MSG_EQ (index.Contains (a), false, "Should not contain a");
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=a")).size (), 0, "Descendants should be empty");
+}
+EndTest ()
+
+BeginTest (Ancestors)
+{
+  NfpPrefixIndex index;
+  index.Insert (Create<CCNxName> ("ccnx:/name=a"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=a/name=b/name=c"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=x"));
+
+  Ptr<const CCNxName> name = Create<CCNxName> ("ccnx:/name=a/name=b/name=c/name=d");
+  std::vector< Ptr<const CCNxName> > ancestors = index.GetAncestors (name);
+  NS_TEST_ASSERT_MSG_EQ (ancestors.size (), 2, "Wrong ancestor count");
+  NS_TEST_EXPECT_MSG_EQ (ancestors[0]->Equals (CCNxName ("ccnx:/name=a/name=b/name=c")), true, "Nearest ancestor should be first");
+  NS_TEST_EXPECT_MSG_EQ (ancestors[1]->Equals (CCNxName ("ccnx:/name=a")), true, "Wrong second ancestor");
+
+  Ptr<const CCNxName> nearest = index.GetNearestAncestor (Create<CCNxName> ("ccnx:/name=a/name=b"));
+  NS_TEST_ASSERT_MSG_EQ ((bool) nearest, true, "Should have an ancestor");
+  NS_TEST_EXPECT_MSG_EQ (nearest->Equals (CCNxName ("ccnx:/name=a")), true, "Wrong nearest ancestor");
+
+  // a name is not its own ancestor
+  NS_TEST_EXPECT_MSG_EQ ((bool) index.GetNearestAncestor (Create<CCNxName> ("ccnx:/name=x")), false, "x has no ancestor");
+}
+EndTest ()
+
+BeginTest (Descendants)
+{
+  NfpPrefixIndex index;
+  index.Insert (Create<CCNxName> ("ccnx:/name=a"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=a/name=b"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=a/name=b/name=c"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=a/name=d"));
+  index.Insert (Create<CCNxName> ("ccnx:/name=x/name=b"));
+
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=a")).size (), 3, "Wrong descendants of a");
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=a/name=b")).size (), 1, "Wrong descendants of a/b");
+
+  // the name does not need to be a member
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=x")).size (), 1, "Wrong descendants of x");
+
+  index.Erase (Create<CCNxName> ("ccnx:/name=a/name=b/name=c"));
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=a")).size (), 2, "Wrong descendants after erase");
+  NS_TEST_EXPECT_MSG_EQ (index.GetDescendants (Create<CCNxName> ("ccnx:/name=a/name=b")).size (), 0, "a/b should have no descendants");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpPrefixIndex
+ */
+static class TestSuiteNfpPrefixIndex : public TestSuite
+{
+public:
+  TestSuiteNfpPrefixIndex () : TestSuite ("nfp-prefix-index", UNIT)
+  {
+    AddTestCase (new InsertErase (), TestCase::QUICK);
+    AddTestCase (new Ancestors (), TestCase::QUICK);
+    AddTestCase (new Descendants (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpPrefixIndex;
+
+} // namespace TestSuiteNfpPrefixIndex
@@ -201,6 +201,51 @@ BeginTest (Duplicates)
 
 }
 EndTest ()
+
+BeginTest (RefreshInPlace)
+{
+  // Refreshing the same pair many times must not grow the heap
+  Ptr<CCNxName> prefix = Create<CCNxName> ("ccnx:/name=aaa");
+  Ptr<CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  Ptr<CCNxName> other = Create<CCNxName> ("ccnx:/name=bbb");
+
+  NfpPrefixTimerHeap heap;
+  heap.Insert (other, anchor, Seconds (50));
+  for (int i = 0; i < 100; i++)
+    {
+      // a new Ptr each time, equal by name
+      heap.Insert (Create<CCNxName> ("ccnx:/name=aaa"), anchor, Seconds (100 - i));
+    }
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 2, "Heap should have one entry per pair");
+
+  // decrease-key moved aaa (now 1s) in front of bbb
+  Ptr<const NfpPrefixTimerEntry> entry = heap.Peek ();
+  NS_TEST_EXPECT_MSG_EQ (entry->GetPrefix ()->Equals (*prefix), true, "Wrong top entry");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetTime (), Seconds (1), "Wrong top time");
+
+  // increase-key moves it behind bbb
+  heap.Insert (prefix, anchor, Seconds (60));
+  entry = heap.Peek ();
+  NS_TEST_EXPECT_MSG_EQ (entry->GetPrefix ()->Equals (*other), true, "Wrong top entry after increase");
+
+  heap.Pop ();
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 1, "Wrong size after pop");
+
+  // re-insert after pop
+  heap.Insert (other, anchor, Seconds (70));
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 2, "Wrong size after re-insert");
+
+  entry = heap.Peek ();
+  NS_TEST_EXPECT_MSG_EQ (entry->GetPrefix ()->Equals (*prefix), true, "Wrong top entry after re-insert");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetTime (), Seconds (60), "Wrong top time after re-insert");
+
+  heap.Pop ();
+  entry = heap.Peek ();
+  NS_TEST_EXPECT_MSG_EQ (entry->GetPrefix ()->Equals (*other), true, "Wrong remaining entry");
+  NS_TEST_EXPECT_MSG_EQ (entry->GetTime (), Seconds (70), "Wrong remaining time");
+}
+EndTest ()
+
 /**
  * \ingroup ccnx-test
  *
@@ -213,6 +258,7 @@ public:
   {
     AddTestCase (new NoDuplicates (), TestCase::QUICK);
     AddTestCase (new Duplicates (), TestCase::QUICK);
+    AddTestCase (new RefreshInPlace (), TestCase::QUICK);
   }
 } g_TestSuiteNfpPrefixTimerHeap;
 }
@@ -54,9 +54,11 @@
  */
 
 #include "ns3/test.h"
+#include "ns3/simulator.h"
 #include "ns3/nfp-prefix.h"
 
 #include "../../TestMacros.h"
+#include "../../mockups/mockup_ccnx-virtual-connection.h"
 
 using namespace ns3;
 using namespace ns3::ccnx;
@@ -68,6 +70,62 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+static void
+StateChanged (Ptr<const CCNxName> prefix, Ptr<const CCNxName> anchorName)
+{
+  // empty
+}
+
+BeginTest (Reachable)
+{
+  Ptr<CCNxName> anchorName = Create<CCNxName> ("ccnx:/name=anchor");
+  Ptr<CCNxName> prefixName = Create<CCNxName> ("ccnx:/name=parc.com/name=csl");
+  Ptr<NfpPrefix> prefix = Create<NfpPrefix> (prefixName, Seconds (10), MakeCallback (&StateChanged));
+  Ptr<CCNxVirtualConnection> conn = Create<CCNxVirtualConnection> (1);
+
+  NS_TEST_EXPECT_MSG_EQ (prefix->IsReachable (), false, "New prefix should not be reachable");
+
+  Ptr<NfpAdvertise> advertise = Create<NfpAdvertise> (anchorName, prefixName, 1, 3);
+  prefix->ReceiveAdvertisement (advertise, conn, Simulator::Now ());
+  NS_TEST_EXPECT_MSG_EQ (prefix->IsReachable (), true, "Prefix should be reachable after an advertisement");
+
+  Ptr<NfpWithdraw> withdraw = Create<NfpWithdraw> (anchorName, prefixName);
+  prefix->ReceiveWithdraw (withdraw, conn, Simulator::Now ());
+  NS_TEST_EXPECT_MSG_EQ (prefix->IsReachable (), false, "Prefix should not be reachable after a withdraw");
+
+  advertise = Create<NfpAdvertise> (anchorName, prefixName, 2, 3);
+  prefix->ReceiveAdvertisement (advertise, conn, Simulator::Now ());
+  NS_TEST_EXPECT_MSG_EQ (prefix->IsReachable (), true, "Prefix should be reachable after a new advertisement");
+
+  // The cached answer must not outlive the nexthop
+  Simulator::Stop (Seconds (11));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (prefix->IsReachable (), false, "Prefix should not be reachable after the nexthop expired");
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (Readvertisement)
+{
+  Ptr<CCNxName> anchorName = Create<CCNxName> ("ccnx:/name=anchor");
+  Ptr<CCNxName> prefixName = Create<CCNxName> ("ccnx:/name=parc.com/name=csl");
+  Ptr<NfpPrefix> prefix = Create<NfpPrefix> (prefixName, Seconds (10), MakeCallback (&StateChanged));
+  Ptr<CCNxVirtualConnection> conn = Create<CCNxVirtualConnection> (1);
+
+  prefix->ReceiveAdvertisement (Create<NfpAdvertise> (anchorName, prefixName, 1, 3), conn, Simulator::Now ());
+
+  Ptr<NfpAdvertise> first = prefix->GetReadvertisement (anchorName, 1);
+  NS_TEST_EXPECT_MSG_EQ (first->GetDistance (), 4, "Wrong distance");
+  Ptr<NfpAdvertise> second = prefix->GetReadvertisement (anchorName, 1);
+  NS_TEST_EXPECT_MSG_EQ (PeekPointer (first), PeekPointer (second), "Readvertisement should be cached");
+
+  // a better route replaces the cached message
+  prefix->ReceiveAdvertisement (Create<NfpAdvertise> (anchorName, prefixName, 2, 3), conn, Simulator::Now ());
+  Ptr<NfpAdvertise> third = prefix->GetReadvertisement (anchorName, 1);
+  NS_TEST_EXPECT_MSG_EQ (third->GetAnchorSeqnum (), 2, "Readvertisement should follow the best advertisement");
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +137,8 @@ public:
   TestSuiteNfpPrefix () : TestSuite ("nfp-prefix", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new Reachable (), TestCase::QUICK);
+    AddTestCase (new Readvertisement (), TestCase::QUICK);
   }
 } g_TestSuiteNfpPrefix;
 
@@ -58,12 +58,17 @@
 #include "ns3/log.h"
 #include "ns3/test.h"
 #include "ns3/type-id.h"
+#include "ns3/boolean.h"
+#include "ns3/uinteger.h"
+#include "ns3/data-rate.h"
 #include "ns3/ccnx-stack-helper.h"
 #include "ns3/ccnx-packet.h"
 
 #include "ns3/nfp-routing-protocol.h"
 #include "ns3/nfp-routing-helper.h"
 #include "ns3/nfp-payload.h"
+#include "ns3/nfp-advertise.h"
+#include "ns3/nfp-withdraw.h"
 #include "ns3/ccnx-standard-layer3.h"
 
 #include "ns3/virtual-net-device.h"
@@ -211,6 +216,90 @@ BeginTest (TestRemoveAnchor_2refcount)
 }
 EndTest ()
 
+BeginTest (TestAddAnchor_Summarized)
+{
+  Ptr<NfpRoutingProtocol> nfp = CreateProtocol (Create<Node> ());
+  nfp->SetAttribute ("Summarize", BooleanValue (true));
+  NfpRoutingProtocolFriend theFriend (nfp);
+  theFriend.DoInitialize ();
+
+  Ptr<const CCNxName> child = Create<CCNxName> ("ccnx:/name=apple/name=pie");
+  Ptr<const CCNxName> parent = Create<CCNxName> ("ccnx:/name=apple");
+
+  nfp->AddAnchorPrefix (child);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.IsAnchorSummarized (child), false, "Child should be advertised on its own");
+
+  nfp->AddAnchorPrefix (parent);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.IsAnchorSummarized (child), true, "Child should be covered by the parent");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.IsAnchorSummarized (parent), false, "Parent should be advertised");
+
+  nfp->RemoveAnchorPrefix (parent);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.IsAnchorSummarized (child), false, "Child should be advertised again");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetAnchorMapSize (), 1, "Anchor map should have 1 entry");
+}
+EndTest ()
+
+BeginTest (TestHasSameNexthops)
+{
+  Ptr<const CCNxName> child = Create<CCNxName> ("ccnx:/name=apple/name=pie");
+  Ptr<const CCNxName> parent = Create<CCNxName> ("ccnx:/name=apple");
+  Ptr<CCNxConnection> conn1 = Create<CCNxVirtualConnection> (1);
+  Ptr<CCNxConnection> conn2 = Create<CCNxVirtualConnection> (2);
+
+  Ptr<CCNxRoute> a = Create<CCNxRoute> (child);
+  a->AddNexthop (Create<CCNxRouteEntry> (child, 1, conn1));
+  a->AddNexthop (Create<CCNxRouteEntry> (child, 1, conn2));
+
+  // same connections, different prefix and cost
+  Ptr<CCNxRoute> b = Create<CCNxRoute> (parent);
+  b->AddNexthop (Create<CCNxRouteEntry> (parent, 3, conn2));
+  b->AddNexthop (Create<CCNxRouteEntry> (parent, 3, conn1));
+
+  Ptr<CCNxRoute> c = Create<CCNxRoute> (parent);
+  c->AddNexthop (Create<CCNxRouteEntry> (parent, 1, conn1));
+
+  NS_TEST_EXPECT_MSG_EQ (NfpRoutingProtocolFriend::HasSameNexthops (a, b), true, "a and b should match");
+  NS_TEST_EXPECT_MSG_EQ (NfpRoutingProtocolFriend::HasSameNexthops (a, c), false, "a and c should not match");
+}
+EndTest ()
+
+BeginTest (TestFibSummarized)
+{
+  Ptr<NfpRoutingProtocol> nfp = CreateProtocol (Create<Node> ());
+  nfp->SetAttribute ("Summarize", BooleanValue (true));
+  NfpRoutingProtocolFriend theFriend (nfp);
+  theFriend.DoInitialize ();
+
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=orchard");
+  Ptr<const CCNxName> child = Create<CCNxName> ("ccnx:/name=apple/name=pie");
+  Ptr<const CCNxName> parent = Create<CCNxName> ("ccnx:/name=apple");
+  Ptr<CCNxConnection> conn1 = Create<CCNxVirtualConnection> (1);
+  Ptr<CCNxConnection> conn2 = Create<CCNxVirtualConnection> (2);
+
+  theFriend.ReceiveAdvertise (Create<NfpAdvertise> (anchor, child, 1, 1), conn1);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (child), 1, "Child should be in the FIB on its own");
+
+  // The parent forwards the same way, so the child collapses into it
+  theFriend.ReceiveAdvertise (Create<NfpAdvertise> (anchor, parent, 1, 1), conn1);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (parent), 1, "Parent should be in the FIB");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (child), 0, "Child should be summarized by the parent");
+
+  // An equal cost path makes the child's nexthops differ from the parent's
+  theFriend.ReceiveAdvertise (Create<NfpAdvertise> (anchor, child, 1, 1), conn2);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (child), 2, "Child should be back in the FIB");
+
+  theFriend.ReceiveWithdraw (Create<NfpWithdraw> (anchor, child), conn2);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (child), 0, "Child should be summarized again");
+
+  // Losing the parent exposes the child
+  theFriend.ReceiveWithdraw (Create<NfpWithdraw> (anchor, parent), conn1);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (parent), 0, "Parent should be gone from the FIB");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetFibNexthopCount (child), 1, "Child should be in the FIB without its parent");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
 BeginTest (TestSetTimer_NoJitter)
 {
   Ptr<NfpRoutingProtocol> nfp = CreateProtocol (Create<Node> ());
@@ -365,9 +454,7 @@ BeginTest (TestBroadcast)
   Simulator::Run ();
 
   // now try to broadcast the packet
-  Ptr<CCNxPacket> packet = theFriend.CreatePacket (
-      theFriend.CreatePayload ());
-  theFriend.Broadcast (packet);
+  theFriend.Broadcast (theFriend.CreatePayload ());
 
   // Give it time to delver the packets
   // the simulator needs to be running so DoInitialize is called
@@ -396,6 +483,130 @@ SendCallback (Ptr<Packet> packet, const Address& source,
 }
 EndTest ()
 
+BeginTest (TestBroadcast_QueueLimit)
+{
+  Ptr<Node> node = Create<Node> ();
+
+  Ptr<NfpRoutingProtocol> nfp = CreateProtocol (node);
+  NfpRoutingProtocolFriend theFriend (nfp);
+  nfp->SetAttribute ("InterfaceRateLimit", DataRateValue (DataRate ("8bps")));
+  nfp->SetAttribute ("InterfaceQueueLimit", UintegerValue (2));
+
+  Ptr<VirtualNetDevice> if0 = SetupTapDevice (
+      node, 0, MakeCallback (&TestBroadcast_QueueLimit::SendCallback, this));
+  Ptr<VirtualNetDevice> if1 = SetupTapDevice (
+      node, 1, MakeCallback (&TestBroadcast_QueueLimit::SendCallback, this));
+
+  Simulator::Stop (MicroSeconds (1));
+  Simulator::Run ();
+
+  // The first payload empties the bucket, the next four wait behind it at 8 bps
+  for (int i = 0; i < 5; ++i)
+    {
+      theFriend.Broadcast (theFriend.CreatePayload ());
+    }
+
+  std::map<uint32_t, ns3::Ptr<ns3::ccnx::CCNxL3Interface> > *interfaces = theFriend.GetInterfaces ();
+  for (std::map<uint32_t, ns3::Ptr<ns3::ccnx::CCNxL3Interface> >::iterator i = interfaces->begin (); i != interfaces->end (); ++i)
+    {
+      NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueueSize (i->first), 2, "Queue should stop at InterfaceQueueLimit");
+    }
+  NS_TEST_EXPECT_MSG_EQ (nfp->GetStats ().GetPacerDropped (), 4, "Expected 2 drops per interface");
+
+  Simulator::Destroy ();
+}
+
+bool
+SendCallback (Ptr<Packet> packet, const Address& source,
+              const Address& dest, uint16_t protocolNumber)
+{
+  return true;
+}
+EndTest ()
+
+/**
+ * Create a payload with a single message
+ */
+static Ptr<NfpPayload>
+CreateMessagePayload (NfpRoutingProtocolFriend &theFriend, Ptr<NfpMessage> message)
+{
+  Ptr<NfpPayload> payload = theFriend.CreatePayload ();
+  payload->AppendMessage (message);
+  return payload;
+}
+
+BeginTest (TestBroadcast_QueueKeepsWithdraws)
+{
+  Ptr<Node> node = Create<Node> ();
+
+  Ptr<NfpRoutingProtocol> nfp = CreateProtocol (node);
+  NfpRoutingProtocolFriend theFriend (nfp);
+  nfp->SetAttribute ("InterfaceRateLimit", DataRateValue (DataRate ("8bps")));
+  nfp->SetAttribute ("InterfaceQueueLimit", UintegerValue (3));
+
+  Ptr<VirtualNetDevice> if0 = SetupTapDevice (
+      node, 0, MakeCallback (&TestBroadcast_QueueKeepsWithdraws::SendCallback, this));
+
+  Simulator::Stop (MicroSeconds (1));
+  Simulator::Run ();
+  uint32_t interface = theFriend.GetInterfaces ()->begin ()->first;
+
+  Ptr<const CCNxName> anchor = Create<CCNxName> ("ccnx:/name=anchor");
+  Ptr<const CCNxName> p = Create<CCNxName> ("ccnx:/name=p");
+  Ptr<const CCNxName> q = Create<CCNxName> ("ccnx:/name=q");
+
+  // The first payload empties the bucket, everything after it waits at 8 bps
+  theFriend.Broadcast (theFriend.CreatePayload ());
+  Ptr<NfpPayload> w1 = CreateMessagePayload (theFriend, Create<NfpWithdraw> (anchor, p));
+  Ptr<NfpPayload> bq = CreateMessagePayload (theFriend, Create<NfpAdvertise> (anchor, q, 1, 1));
+  Ptr<NfpPayload> ap = CreateMessagePayload (theFriend, Create<NfpAdvertise> (anchor, p, 2, 1));
+  theFriend.Broadcast (w1);
+  theFriend.Broadcast (bq);
+  theFriend.Broadcast (ap);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueueSize (interface), 3, "Queue should be at InterfaceQueueLimit");
+
+  // A newer advertisement of p replaces the older one for p, not the older one for q
+  Ptr<NfpPayload> ap2 = CreateMessagePayload (theFriend, Create<NfpAdvertise> (anchor, p, 3, 1));
+  theFriend.Broadcast (ap2);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueueSize (interface), 3, "Queue should stay at InterfaceQueueLimit");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueuePayload (interface, 0), w1, "Withdraw should stay queued");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueuePayload (interface, 1), bq, "Advertisement of q should stay queued");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueuePayload (interface, 2), ap2, "Newer advertisement of p should be queued");
+
+  // Withdraws push out the advertisements, then go over the limit rather than drop a withdraw
+  Ptr<NfpPayload> w2 = CreateMessagePayload (theFriend, Create<NfpWithdraw> (anchor, q));
+  Ptr<NfpPayload> w3 = CreateMessagePayload (theFriend, Create<NfpWithdraw> (anchor, p));
+  Ptr<NfpPayload> w4 = CreateMessagePayload (theFriend, Create<NfpWithdraw> (anchor, q));
+  theFriend.Broadcast (w2);
+  theFriend.Broadcast (w3);
+  theFriend.Broadcast (w4);
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueueSize (interface), 4, "Withdraws should never be dropped");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueuePayload (interface, 0), w1, "Wrong withdraw at head");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueuePayload (interface, 3), w4, "Wrong withdraw at tail");
+  NS_TEST_EXPECT_MSG_EQ (nfp->GetStats ().GetPacerDropped (), 3, "Expected only the 3 advertisements dropped");
+
+  // A hello does not wait behind the queue
+  size_t sent = m_sendQueue.size ();
+  theFriend.BroadcastHello (theFriend.CreatePayload ());
+  Simulator::Stop (MicroSeconds (10));
+  Simulator::Run ();
+  NS_TEST_EXPECT_MSG_EQ (m_sendQueue.size (), sent + 1, "Expected the hello to be sent");
+  NS_TEST_EXPECT_MSG_EQ (theFriend.GetPacerQueueSize (interface), 4, "Queue should be untouched by the hello");
+
+  Simulator::Destroy ();
+}
+
+std::deque<Ptr<Packet> > m_sendQueue;
+
+bool
+SendCallback (Ptr<Packet> packet, const Address& source,
+              const Address& dest, uint16_t protocolNumber)
+{
+  m_sendQueue.push_back (packet);
+  return true;
+}
+EndTest ()
+
 BeginTest (TestReceiveHello_FirstTime)
 {
   // receive a hello message for a neighbor for the first time
@@ -605,6 +816,9 @@ public:
     AddTestCase (new TestAddAnchor_SecondTime (), TestCase::QUICK);
     AddTestCase (new TestRemoveAnchor_1refcount (), TestCase::QUICK);
     AddTestCase (new TestRemoveAnchor_2refcount (), TestCase::QUICK);
+    AddTestCase (new TestAddAnchor_Summarized (), TestCase::QUICK);
+    AddTestCase (new TestHasSameNexthops (), TestCase::QUICK);
+    AddTestCase (new TestFibSummarized (), TestCase::QUICK);
     AddTestCase (new TestSetTimer_NoJitter (), TestCase::QUICK);
     AddTestCase (new TestSetTimer_WithJitter (), TestCase::QUICK);
     AddTestCase (new TestDoInitialize (), TestCase::QUICK);
@@ -613,6 +827,8 @@ public:
     AddTestCase (new TestCreatePacket (), TestCase::QUICK);
     AddTestCase (new TestNotifyInterfaceUp (), TestCase::QUICK);
     AddTestCase (new TestBroadcast (), TestCase::QUICK);
+    AddTestCase (new TestBroadcast_QueueLimit (), TestCase::QUICK);
+    AddTestCase (new TestBroadcast_QueueKeepsWithdraws (), TestCase::QUICK);
 
     AddTestCase (new TestReceiveHello_FirstTime (), TestCase::QUICK);
     AddTestCase (new TestReceiveHello_OldSeqnum (), TestCase::QUICK);
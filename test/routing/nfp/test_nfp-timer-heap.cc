@@ -0,0 +1,208 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <map>
+#include <vector>
+#include <algorithm>
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-timer-heap.h"
+#include "ns3/random-variable-stream.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpTimerHeap {
+
+BeginTest (Order)
+{
+  NfpTimerHeap heap;
+  int64_t times[] = { 17, 5, 9, 1, 12, 3, 20, 8, 2, 15 };
+  size_t count = sizeof(times) / sizeof(times[0]);
+  for (size_t i = 0; i < count; i++)
+    {
+      heap.Schedule (heap.Allocate (), Seconds (times[i]));
+    }
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), count, "Wrong size");
+
+  Time last = Seconds (0);
+  bool ordered = true;
+  while (!heap.IsEmpty ())
+    {
+      Time t = heap.PeekTime ();
+      ordered = ordered && last <= t;
+      last = t;
+      heap.Pop ();
+    }
+  NS_TEST_EXPECT_MSG_EQ (ordered, true, "Pop order is not by time");
+  NS_TEST_EXPECT_MSG_EQ (heap.GetAllocatedCount (), count, "Pop should not release handles");
+}
+EndTest ()
+
+BeginTest (Reschedule)
+{
+  NfpTimerHeap heap;
+  NfpTimerHeap::TimerId a = heap.Allocate ();
+  NfpTimerHeap::TimerId b = heap.Allocate ();
+  NfpTimerHeap::TimerId c = heap.Allocate ();
+  heap.Schedule (a, Seconds (1));
+  heap.Schedule (b, Seconds (2));
+  heap.Schedule (c, Seconds (3));
+
+  // increase-key
+  heap.Schedule (a, Seconds (4));
+  NS_TEST_EXPECT_MSG_EQ (heap.Peek (), b, "b should be first");
+  NS_TEST_EXPECT_MSG_EQ (heap.GetSize (), 3, "Reschedule should not add an entry");
+
+  // decrease-key
+  heap.Schedule (c, Seconds (0.5));
+  NS_TEST_EXPECT_MSG_EQ (heap.Peek (), c, "c should be first");
+  NS_TEST_EXPECT_MSG_EQ (heap.GetExpiry (a), Seconds (4), "Wrong expiry of a");
+
+  heap.Cancel (c);
+  NS_TEST_EXPECT_MSG_EQ (heap.IsScheduled (c), false, "c should not be scheduled");
+  NS_TEST_EXPECT_MSG_EQ (heap.Peek (), b, "b should be first after cancel");
+
+  heap.Release (b);
+  NS_TEST_EXPECT_MSG_EQ (heap.Peek (), a, "a should be first after release");
+  NS_TEST_EXPECT_MSG_EQ (heap.GetAllocatedCount (), 2, "Wrong allocated count");
+
+  // released handles are re-used
+  NfpTimerHeap::TimerId d = heap.Allocate ();
+  NS_TEST_EXPECT_MSG_EQ (d, b, "Released handle should be re-used");
+  NS_TEST_EXPECT_MSG_EQ (heap.IsScheduled (d), false, "New handle should not be scheduled");
+}
+EndTest ()
+
+BeginTest (CompareWithMap)
+{
+  // Random operations against a std::map of handle -> time as the reference
+  Ptr<UniformRandomVariable> random = CreateObject<UniformRandomVariable> ();
+  random->SetStream (1);
+
+  NfpTimerHeap heap;
+  std::vector<NfpTimerHeap::TimerId> ids;
+  std::map<NfpTimerHeap::TimerId, Time> reference;
+  bool correct = true;
+
+  for (uint32_t n = 0; n < 20000 && correct; n++)
+    {
+      if (ids.empty ())
+        {
+          ids.push_back (heap.Allocate ());
+        }
+
+      NfpTimerHeap::TimerId id = ids[random->GetInteger (0, ids.size () - 1)];
+      switch (random->GetInteger (0, 4))
+        {
+        case 0:
+          ids.push_back (heap.Allocate ());
+          break;
+
+        case 1:
+        case 2:
+          {
+            Time t = MilliSeconds (random->GetInteger (0, 1000));
+            heap.Schedule (id, t);
+            reference[id] = t;
+          }
+          break;
+
+        case 3:
+          heap.Cancel (id);
+          reference.erase (id);
+          break;
+
+        default:
+          if (!reference.empty ())
+            {
+              Time earliest = reference.begin ()->second;
+              for (std::map<NfpTimerHeap::TimerId, Time>::const_iterator i = reference.begin (); i != reference.end (); ++i)
+                {
+                  earliest = std::min (earliest, i->second);
+                }
+              correct = heap.PeekTime () == earliest;
+              NfpTimerHeap::TimerId top = heap.Pop ();
+              correct = correct && reference[top] == earliest;
+              reference.erase (top);
+            }
+          break;
+        }
+      correct = correct && heap.GetSize () == reference.size ();
+    }
+
+  NS_TEST_EXPECT_MSG_EQ (correct, true, "Heap differs from std::map");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpTimerHeap
+ */
+static class TestSuiteNfpTimerHeap : public TestSuite
+{
+public:
+  TestSuiteNfpTimerHeap () : TestSuite ("nfp-timer-heap", UNIT)
+  {
+    AddTestCase (new Order (), TestCase::QUICK);
+    AddTestCase (new Reschedule (), TestCase::QUICK);
+    AddTestCase (new CompareWithMap (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpTimerHeap;
+
+} // namespace TestSuiteNfpTimerHeap
@@ -0,0 +1,150 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <vector>
+
+#include "ns3/test.h"
+#include "ns3/simulator.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-timer-scheduler.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpTimerScheduler {
+
+/**
+ * Records the simulation time of each expiry
+ */
+class Recorder
+{
+public:
+  void Expired (void)
+  {
+    m_times.push_back (Simulator::Now ());
+  }
+
+  std::vector<Time> m_times;
+};
+
+BeginTest (Expire)
+{
+  Ptr<NfpTimerScheduler> scheduler = Create<NfpTimerScheduler> ();
+  Recorder a;
+  Recorder b;
+  NfpTimerScheduler::TimerId aId = scheduler->Allocate (MakeCallback (&Recorder::Expired, &a));
+  NfpTimerScheduler::TimerId bId = scheduler->Allocate (MakeCallback (&Recorder::Expired, &b));
+
+  scheduler->Schedule (aId, Seconds (3));
+  scheduler->Schedule (bId, Seconds (1));
+
+  // move b later in place, after a
+  scheduler->Schedule (bId, Seconds (5));
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (a.m_times.size (), 1, "a should expire once");
+  NS_TEST_EXPECT_MSG_EQ (b.m_times.size (), 1, "b should expire once");
+  NS_TEST_EXPECT_MSG_EQ (a.m_times[0], Seconds (3), "a expired at the wrong time");
+  NS_TEST_EXPECT_MSG_EQ (b.m_times[0], Seconds (5), "b expired at the wrong time");
+  NS_TEST_EXPECT_MSG_EQ (scheduler->GetSize (), 0, "No timers should be left");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+BeginTest (CancelAndRelease)
+{
+  Ptr<NfpTimerScheduler> scheduler = Create<NfpTimerScheduler> ();
+  Recorder a;
+  Recorder b;
+  NfpTimerScheduler::TimerId aId = scheduler->Allocate (MakeCallback (&Recorder::Expired, &a));
+  NfpTimerScheduler::TimerId bId = scheduler->Allocate (MakeCallback (&Recorder::Expired, &b));
+
+  scheduler->Schedule (aId, Seconds (1));
+  scheduler->Schedule (bId, Seconds (2));
+  scheduler->Cancel (aId);
+  scheduler->Release (bId);
+
+  NS_TEST_EXPECT_MSG_EQ (scheduler->IsScheduled (aId), false, "a should be cancelled");
+
+  Simulator::Stop (Seconds (10));
+  Simulator::Run ();
+
+  NS_TEST_EXPECT_MSG_EQ (a.m_times.size (), 0, "Cancelled timer should not expire");
+  NS_TEST_EXPECT_MSG_EQ (b.m_times.size (), 0, "Released timer should not expire");
+
+  Simulator::Destroy ();
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpTimerScheduler
+ */
+static class TestSuiteNfpTimerScheduler : public TestSuite
+{
+public:
+  TestSuiteNfpTimerScheduler () : TestSuite ("nfp-timer-scheduler", UNIT)
+  {
+    AddTestCase (new Expire (), TestCase::QUICK);
+    AddTestCase (new CancelAndRelease (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpTimerScheduler;
+
+} // namespace TestSuiteNfpTimerScheduler
@@ -0,0 +1,122 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-token-bucket.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpTokenBucket {
+
+BeginTest (Unlimited)
+{
+  NfpTokenBucket bucket;
+  NS_TEST_EXPECT_MSG_EQ (bucket.IsUnlimited (), true, "Default should be unlimited");
+  NS_TEST_EXPECT_MSG_EQ (bucket.Consume (1000000, Seconds (0)), true, "Unlimited should always consume");
+  NS_TEST_EXPECT_MSG_EQ (bucket.GetDelay (1000000, Seconds (0)), Time (0), "Unlimited should have no delay");
+
+  NfpTokenBucket zero (DataRate (0), 100);
+  NS_TEST_EXPECT_MSG_EQ (zero.IsUnlimited (), true, "Rate 0 should be unlimited");
+}
+EndTest ()
+
+BeginTest (Consume)
+{
+  // 8000 bps is 1000 bytes per second
+  NfpTokenBucket bucket (DataRate (8000), 1500);
+  NS_TEST_EXPECT_MSG_EQ (bucket.IsUnlimited (), false, "Should be limited");
+  NS_TEST_EXPECT_MSG_EQ (bucket.Consume (1000, Seconds (0)), true, "Bucket should start full");
+  NS_TEST_EXPECT_MSG_EQ (bucket.Consume (1000, Seconds (0)), false, "Only 500 tokens left");
+
+  Time delay = bucket.GetDelay (1000, Seconds (0));
+  NS_TEST_EXPECT_MSG_EQ_TOL (delay.GetSeconds (), 0.5, 0.000001, "Wrong delay");
+  NS_TEST_EXPECT_MSG_EQ (bucket.Consume (1000, delay), true, "Should consume after the delay");
+
+  // the bucket never fills above burst
+  NS_TEST_EXPECT_MSG_EQ_TOL (bucket.GetTokens (Seconds (100)), 1500.0, 0.001, "Tokens should be capped at burst");
+}
+EndTest ()
+
+BeginTest (Oversized)
+{
+  NfpTokenBucket bucket (DataRate (8000), 1000);
+  NS_TEST_EXPECT_MSG_EQ (bucket.Consume (2000, Seconds (0)), true, "Oversized payload needs a full bucket");
+  NS_TEST_EXPECT_MSG_EQ_TOL (bucket.GetTokens (Seconds (0)), -1000.0, 0.001, "Bucket should be in debt");
+
+  // needs 1000 tokens (a full bucket) from -1000
+  NS_TEST_EXPECT_MSG_EQ_TOL (bucket.GetDelay (2000, Seconds (0)).GetSeconds (), 2.0, 0.000001, "Wrong delay from debt");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpTokenBucket
+ */
+static class TestSuiteNfpTokenBucket : public TestSuite
+{
+public:
+  TestSuiteNfpTokenBucket () : TestSuite ("nfp-token-bucket", UNIT)
+  {
+    AddTestCase (new Unlimited (), TestCase::QUICK);
+    AddTestCase (new Consume (), TestCase::QUICK);
+    AddTestCase (new Oversized (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpTokenBucket;
+
+} // namespace TestSuiteNfpTokenBucket
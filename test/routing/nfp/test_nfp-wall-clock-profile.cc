@@ -0,0 +1,139 @@
+/*
+ * Copyright (c) 2016, Xerox Corporation (Xerox) and Palo Alto Research Center, Inc (PARC)
+ * All rights reserved.
+ *
+ * Redistribution and use in source and binary forms, with or without
+ * modification, are permitted provided that the following conditions are met:
+ *
+ * * Redistributions of source code must retain the above copyright
+ *   notice, this list of conditions and the following disclaimer.
+ * * Redistributions in binary form must reproduce the above copyright
+ *   notice, this list of conditions and the following disclaimer in the
+ *   documentation and/or other materials provided with the distribution.
+ *
+ * THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS "AS IS" AND
+ * ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT LIMITED TO, THE IMPLIED
+ * WARRANTIES OF MERCHANTABILITY AND FITNESS FOR A PARTICULAR PURPOSE ARE
+ * DISCLAIMED. IN NO EVENT SHALL XEROX OR PARC BE LIABLE FOR ANY
+ * DIRECT, INDIRECT, INCIDENTAL, SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES
+ * (INCLUDING, BUT NOT LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES;
+ * LOSS OF USE, DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND
+ * ON ANY THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+ * (INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE OF THIS
+ * SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+ */
+/* ################################################################################
+ * #
+ * # PATENT NOTICE
+ * #
+ * # This software is distributed under the BSD 2-clause License (see LICENSE
+ * # file).  This BSD License does not make any patent claims and as such, does
+ * # not act as a patent grant.  The purpose of this section is for each contributor
+ * # to define their intentions with respect to intellectual property.
+ * #
+ * # Each contributor to this source code is encouraged to state their patent
+ * # claims and licensing mechanisms for any contributions made. At the end of
+ * # this section contributors may each make their own statements.  Contributor's
+ * # claims and grants only apply to the pieces (source code, programs, text,
+ * # media, etc) that they have contributed directly to this software.
+ * #
+ * # There is no guarantee that this section is complete, up to date or accurate. It
+ * # is up to the contributors to maintain their portion of this section and up to
+ * # the user of the software to verify any claims herein.
+ * #
+ * # Do not remove this header notification.  The contents of this section must be
+ * # present in all distributions of the software.  You may only modify your own
+ * # intellectual property statements.  Please provide contact information.
+ *
+ * - Palo Alto Research Center, Inc
+ * This software distribution does not grant any rights to patents owned by Palo
+ * Alto Research Center, Inc (PARC). Rights to these patents are available via
+ * various mechanisms. As of January 2016 PARC has committed to FRAND licensing any
+ * intellectual property used by its contributions to this software. You may
+ * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
+ */
+
+#include <sstream>
+
+#include "ns3/test.h"
+#include "../../TestMacros.h"
+
+#include "ns3/nfp-wall-clock-profile.h"
+
+using namespace ns3;
+using namespace ns3::ccnx;
+
+namespace TestSuiteNfpWallClockProfile {
+
+BeginTest (Constructor)
+{
+  NfpWallClockProfile profile;
+  for (int i = 0; i < NfpWallClockProfile::HANDLER_COUNT; i++)
+    {
+      NfpWallClockProfile::Handler handler = (NfpWallClockProfile::Handler) i;
+      NS_TEST_EXPECT_MSG_EQ (profile.GetCalls (handler), 0, "Calls should be 0");
+      NS_TEST_EXPECT_MSG_EQ (profile.GetNanoSeconds (handler), 0, "Time should be 0");
+    }
+}
+EndTest ()
+
+BeginTest (AddAndSum)
+{
+  NfpWallClockProfile a;
+  a.Add (NfpWallClockProfile::RECEIVE_PAYLOAD, 100);
+  a.Add (NfpWallClockProfile::RECEIVE_PAYLOAD, 50);
+  a.Add (NfpWallClockProfile::NEIGHBOR, 7);
+
+  NS_TEST_EXPECT_MSG_EQ (a.GetCalls (NfpWallClockProfile::RECEIVE_PAYLOAD), 2, "Wrong calls");
+  NS_TEST_EXPECT_MSG_EQ (a.GetNanoSeconds (NfpWallClockProfile::RECEIVE_PAYLOAD), 150, "Wrong time");
+
+  NfpWallClockProfile b (a);
+  b += a;
+  NS_TEST_EXPECT_MSG_EQ (b.GetCalls (NfpWallClockProfile::NEIGHBOR), 2, "Wrong calls");
+  NS_TEST_EXPECT_MSG_EQ (b.GetNanoSeconds (NfpWallClockProfile::NEIGHBOR), 14, "Wrong time");
+  NS_TEST_EXPECT_MSG_EQ (b.GetCalls (NfpWallClockProfile::ADVERTISE_TIMER), 0, "Wrong calls");
+
+  std::ostringstream os;
+  os << b;
+  NS_TEST_EXPECT_MSG_NE (os.str ().find ("receive calls 4"), std::string::npos, "Wrong output: " << os.str ());
+}
+EndTest ()
+
+BeginTest (Scoped)
+{
+  NfpWallClockProfile profile;
+  uint64_t before = NfpWallClockProfile::Now ();
+  {
+    NfpWallClockProfile::ScopedTimer timer (&profile, NfpWallClockProfile::PROCESS_WORK_QUEUE);
+  }
+  uint64_t after = NfpWallClockProfile::Now ();
+
+  NS_TEST_EXPECT_MSG_EQ (profile.GetCalls (NfpWallClockProfile::PROCESS_WORK_QUEUE), 1, "Wrong calls");
+  NS_TEST_EXPECT_MSG_EQ ((profile.GetNanoSeconds (NfpWallClockProfile::PROCESS_WORK_QUEUE) <= after - before), true,
+                         "Timer measured more than the enclosing interval");
+
+  // A null profile does nothing
+  {
+    NfpWallClockProfile::ScopedTimer timer (0, NfpWallClockProfile::PROCESS_WORK_QUEUE);
+  }
+  NS_TEST_EXPECT_MSG_EQ (profile.GetCalls (NfpWallClockProfile::PROCESS_WORK_QUEUE), 1, "Wrong calls");
+}
+EndTest ()
+
+/**
+ * @ingroup ccnx-test
+ *
+ * Test Suite for NfpWallClockProfile
+ */
+static class TestSuiteNfpWallClockProfile : public TestSuite
+{
+public:
+  TestSuiteNfpWallClockProfile () : TestSuite ("nfp-wall-clock-profile", UNIT)
+  {
+    AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new AddAndSum (), TestCase::QUICK);
+    AddTestCase (new Scoped (), TestCase::QUICK);
+  }
+} g_TestSuiteNfpWallClockProfile;
+
+} // namespace TestSuiteNfpWallClockProfile
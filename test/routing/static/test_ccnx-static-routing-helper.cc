@@ -53,7 +53,13 @@
  * contact PARC at cipo@parc.com for more information or visit http://www.ccnx.org
  */
 
+#include <sstream>
+
 #include "ns3/test.h"
+#include "ns3/node-container.h"
+#include "ns3/point-to-point-module.h"
+#include "ns3/ccnx-stack-helper.h"
+#include "ns3/ccnx-standard-layer3.h"
 #include "ns3/ccnx-static-routing-helper.h"
 
 #include "../../TestMacros.h"
@@ -68,6 +74,52 @@ BeginTest (Constructor)
 }
 EndTest ()
 
+BeginTest (LoadRoutes)
+{
+  // 0 - 1 - 2
+  NodeContainer nodes;
+  nodes.Create (3);
+  PointToPointHelper p2p;
+  NetDeviceContainer devices;
+  devices.Add (p2p.Install (nodes.Get (0), nodes.Get (1)));
+  devices.Add (p2p.Install (nodes.Get (1), nodes.Get (2)));
+
+  CCNxStaticRoutingHelper staticRouting;
+  CCNxStackHelper stack;
+  stack.SetRoutingHelper (staticRouting);
+  stack.Install (nodes);
+  stack.AddInterfaces (devices);
+
+  std::istringstream input (
+    "# node prefix nexthop [cost]\n"
+    "\n"
+    "0 ccnx:/name=foo 1\n"
+    "1 ccnx:/name=foo 2 1\n"
+    "  1\tccnx:/name=bar   0  \n"
+    "0 ccnx:/name=foo 2\n"          // not a neighbor
+    "0 ccnx:/name=bar 2\n"          // not a neighbor again
+    "0 /name=foo 1\n"               // not a ccnx: name
+    "0 ccnx:/foo 1\n"               // segment without a label
+    "7 ccnx:/name=foo 1\n"          // no such node
+    "0 ccnx:/name=foo\n"            // missing nexthop
+    "0 ccnx:/name=foo 1 cheap\n");  // bad cost
+
+  size_t loaded = CCNxStaticRoutingHelper::LoadRoutes (input);
+  NS_TEST_EXPECT_MSG_EQ (loaded, 3, "Wrong number of routes loaded");
+
+  // A second table reuses the neighbor connections of the first
+  Ptr<CCNxStandardLayer3> layer3 = DynamicCast<CCNxStandardLayer3> (nodes.Get (1)->GetObject<CCNxL3Protocol> ());
+  size_t neighbors = layer3->GetNeighborTableStats ().neighbors;
+  std::istringstream more ("1 ccnx:/name=baz 2\n1 ccnx:/name=baz 0\n");
+  NS_TEST_EXPECT_MSG_EQ (CCNxStaticRoutingHelper::LoadRoutes (more), 2, "Wrong number of routes loaded");
+  NS_TEST_EXPECT_MSG_EQ (layer3->GetNeighborTableStats ().neighbors, neighbors, "No neighbor should be added");
+
+  NS_TEST_EXPECT_MSG_EQ (CCNxStaticRoutingHelper::LoadRouteFile ("/nonexistent/routes.txt"), 0,
+                         "A missing file should load no routes");
+  Simulator::Destroy ();
+}
+EndTest ()
+
 /**
  * @ingroup ccnx-test
  *
@@ -79,6 +131,7 @@ public:
   TestSuiteCCNxStaticRoutingHelper () : TestSuite ("ccnx-static-routing-helper", UNIT)
   {
     AddTestCase (new Constructor (), TestCase::QUICK);
+    AddTestCase (new LoadRoutes (), TestCase::QUICK);
   }
 } g_TestSuiteCCNxStaticRoutingHelper;
 